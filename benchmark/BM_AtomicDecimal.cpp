@@ -0,0 +1,72 @@
+/**
+ * @file BM_AtomicDecimal.cpp
+ * @brief Benchmark contended AtomicDecimal accumulation against a mutex-protected Decimal
+ */
+
+#include <mutex>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/AtomicDecimal.h>
+#include <nfx/datatypes/Decimal.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		/** @brief Shared accumulators, one per benchmark so runs do not interfere */
+		AtomicDecimal g_atomicNotional;
+		std::mutex g_mutex;
+		Decimal g_mutexNotional;
+
+		/** @brief Fill notional with a fixed scale */
+		const Decimal DELTA{ "1234.56" };
+	} // namespace
+
+	//=====================================================================
+	// AtomicDecimal benchmark suite
+	//=====================================================================
+
+	static void BM_AtomicDecimalFetchAdd( ::benchmark::State& state )
+	{
+		if ( state.thread_index() == 0 )
+		{
+			g_atomicNotional.store( Decimal{} );
+		}
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( g_atomicNotional.fetchAdd( DELTA ) );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) );
+	}
+
+	static void BM_MutexDecimalFetchAdd( ::benchmark::State& state )
+	{
+		if ( state.thread_index() == 0 )
+		{
+			std::lock_guard<std::mutex> lock{ g_mutex };
+			g_mutexNotional = Decimal{};
+		}
+
+		for ( auto _ : state )
+		{
+			std::lock_guard<std::mutex> lock{ g_mutex };
+			const Decimal previous{ g_mutexNotional };
+			g_mutexNotional += DELTA;
+			::benchmark::DoNotOptimize( previous );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_AtomicDecimalFetchAdd )->Threads( 1 )->Threads( 2 )->Threads( 4 );
+	BENCHMARK( BM_MutexDecimalFetchAdd )->Threads( 1 )->Threads( 2 )->Threads( 4 );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
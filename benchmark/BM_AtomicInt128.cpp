@@ -0,0 +1,72 @@
+/**
+ * @file BM_AtomicInt128.cpp
+ * @brief Benchmark contended AtomicInt128 updates against a mutex-protected Int128
+ */
+
+#include <mutex>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/AtomicInt128.h>
+#include <nfx/datatypes/Int128.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		/** @brief Shared counters, one per benchmark so runs do not interfere */
+		AtomicInt128 g_atomicCounter;
+		std::mutex g_mutex;
+		Int128 g_mutexCounter{ 0 };
+
+		/** @brief Delta touching both words */
+		const Int128 DELTA{ 0x8000000000000001ULL, 1ULL };
+	} // namespace
+
+	//=====================================================================
+	// AtomicInt128 benchmark suite
+	//=====================================================================
+
+	static void BM_AtomicInt128FetchAdd( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( g_atomicCounter.fetchAdd( DELTA ) );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) );
+	}
+
+	static void BM_AtomicInt128Load( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( g_atomicCounter.load() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) );
+	}
+
+	static void BM_MutexInt128FetchAdd( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			std::lock_guard<std::mutex> lock{ g_mutex };
+			const Int128 previous{ g_mutexCounter };
+			g_mutexCounter += DELTA;
+			::benchmark::DoNotOptimize( previous );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_AtomicInt128FetchAdd )->Threads( 1 )->Threads( 2 )->Threads( 4 );
+	BENCHMARK( BM_AtomicInt128Load )->Threads( 1 )->Threads( 2 )->Threads( 4 );
+	BENCHMARK( BM_MutexInt128FetchAdd )->Threads( 1 )->Threads( 2 )->Threads( 4 );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,160 @@
+/**
+ * @file BM_BatchFormatter.cpp
+ * @brief Benchmark batch formatting against a toString loop appending to one string
+ */
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/BatchFormatter.h>
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/Int128.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		constexpr std::size_t valueCount{ 4096 };
+
+		/** @brief Price-like decimals with 2-4 fractional digits */
+		std::vector<Decimal> makeDecimals()
+		{
+			std::vector<Decimal> values;
+			values.reserve( valueCount );
+			for ( std::size_t i{ 0 }; i < valueCount; ++i )
+			{
+				values.push_back( Decimal{ static_cast<std::int64_t>( 1000000 + i * 7919 % 90000000 ) } / Decimal{ 100 + static_cast<std::int64_t>( i % 2 ) * 9900 } );
+			}
+
+			return values;
+		}
+
+		/** @brief Integers spanning 1 to 30 digits */
+		std::vector<Int128> makeInt128s()
+		{
+			std::vector<Int128> values;
+			values.reserve( valueCount );
+			for ( std::size_t i{ 0 }; i < valueCount; ++i )
+			{
+				values.push_back( Int128{ 0x9E3779B97F4A7C15ULL * ( i + 1 ), ( i % 4 == 0 ) ? i * 1000 : 0ULL } );
+			}
+
+			return values;
+		}
+	} // namespace
+
+	//=====================================================================
+	// BatchFormatter benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Decimal
+	//----------------------------------------------
+
+	static void BM_DecimalToStringLoop( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> values{ makeDecimals() };
+		std::string text;
+
+		for ( auto _ : state )
+		{
+			text.clear();
+			for ( const Decimal& value : values )
+			{
+				text += value.toString();
+				text.push_back( '\n' );
+			}
+			::benchmark::DoNotOptimize( text.data() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_BatchFormatDecimals( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> values{ makeDecimals() };
+		BatchFormatOptions options;
+		options.delimiter = '\n';
+		options.trailingDelimiter = true;
+		std::vector<char> text( BatchFormatter::maxDecimalOutputSize( values.size(), options ) );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( BatchFormatter::formatDecimals( values, text, {}, options ) );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_BatchFormatDecimalsFixedScale( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> values{ makeDecimals() };
+		BatchFormatOptions options;
+		options.delimiter = '\n';
+		options.fixedScale = 2;
+		std::vector<char> text( BatchFormatter::maxDecimalOutputSize( values.size(), options ) );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( BatchFormatter::formatDecimals( values, text, {}, options ) );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	//----------------------------------------------
+	// Int128
+	//----------------------------------------------
+
+	static void BM_Int128ToStringLoop( ::benchmark::State& state )
+	{
+		const std::vector<Int128> values{ makeInt128s() };
+		std::string text;
+
+		for ( auto _ : state )
+		{
+			text.clear();
+			for ( const Int128& value : values )
+			{
+				text += value.toString();
+				text.push_back( '\n' );
+			}
+			::benchmark::DoNotOptimize( text.data() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_BatchFormatInt128s( ::benchmark::State& state )
+	{
+		const std::vector<Int128> values{ makeInt128s() };
+		BatchFormatOptions options;
+		options.delimiter = '\n';
+		std::vector<char> text( BatchFormatter::maxInt128OutputSize( values.size(), options ) );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( BatchFormatter::formatInt128s( values, text, {}, options ) );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_DecimalToStringLoop );
+	BENCHMARK( BM_BatchFormatDecimals );
+	BENCHMARK( BM_BatchFormatDecimalsFixedScale );
+
+	BENCHMARK( BM_Int128ToStringLoop );
+	BENCHMARK( BM_BatchFormatInt128s );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,157 @@
+/**
+ * @file BM_BatchParser.cpp
+ * @brief Benchmark batch parsing against a tryParse loop over the same fields
+ */
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/BatchParser.h>
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalColumn.h>
+#include <nfx/datatypes/Int128.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		constexpr std::size_t fieldCount{ 4096 };
+
+		/** @brief Build a newline-separated buffer of price-like decimals */
+		std::string makeDecimalText()
+		{
+			std::string text;
+			for ( std::size_t i{ 0 }; i < fieldCount; ++i )
+			{
+				text += std::to_string( 1000 + i * 7919 % 900000 ) + "." + std::to_string( 10 + i % 90 ) + "\n";
+			}
+
+			return text;
+		}
+
+		/** @brief Build a newline-separated buffer of 20-25 digit integers */
+		std::string makeInt128Text()
+		{
+			std::string text;
+			for ( std::size_t i{ 0 }; i < fieldCount; ++i )
+			{
+				text += std::to_string( 1000000000000ULL + i * 7919 ) + std::to_string( 100000000ULL + i ) + "\n";
+			}
+
+			return text;
+		}
+	} // namespace
+
+	//=====================================================================
+	// BatchParser benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Decimal
+	//----------------------------------------------
+
+	static void BM_DecimalTryParseLoop( ::benchmark::State& state )
+	{
+		const std::string text{ makeDecimalText() };
+		std::vector<Decimal> values( fieldCount );
+
+		for ( auto _ : state )
+		{
+			std::string_view rest{ text };
+			for ( std::size_t i{ 0 }; i < fieldCount; ++i )
+			{
+				const std::size_t end{ rest.find( '\n' ) };
+				(void)Decimal::tryParse( rest.substr( 0, end ), values[i] );
+				rest.remove_prefix( end + 1 );
+			}
+			::benchmark::DoNotOptimize( values.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( fieldCount ) );
+	}
+
+	static void BM_BatchParseDecimalsDelimited( ::benchmark::State& state )
+	{
+		const std::string text{ makeDecimalText() };
+		std::vector<Decimal> values( fieldCount );
+		std::vector<std::uint64_t> errors( fieldCount / 64 );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( BatchParser::parseDecimals( text, '\n', values, errors ) );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( fieldCount ) );
+	}
+
+	static void BM_BatchParseDecimalsColumn( ::benchmark::State& state )
+	{
+		const std::string text{ makeDecimalText() };
+
+		for ( auto _ : state )
+		{
+			DecimalColumn column;
+			::benchmark::DoNotOptimize( BatchParser::parseDecimals( text, '\n', column ) );
+			::benchmark::DoNotOptimize( column.lo64().data() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( fieldCount ) );
+	}
+
+	//----------------------------------------------
+	// Int128
+	//----------------------------------------------
+
+	static void BM_Int128TryParseLoop( ::benchmark::State& state )
+	{
+		const std::string text{ makeInt128Text() };
+		std::vector<Int128> values( fieldCount );
+
+		for ( auto _ : state )
+		{
+			std::string_view rest{ text };
+			for ( std::size_t i{ 0 }; i < fieldCount; ++i )
+			{
+				const std::size_t end{ rest.find( '\n' ) };
+				(void)Int128::tryParse( rest.substr( 0, end ), values[i] );
+				rest.remove_prefix( end + 1 );
+			}
+			::benchmark::DoNotOptimize( values.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( fieldCount ) );
+	}
+
+	static void BM_BatchParseInt128sDelimited( ::benchmark::State& state )
+	{
+		const std::string text{ makeInt128Text() };
+		std::vector<Int128> values( fieldCount );
+		std::vector<std::uint64_t> errors( fieldCount / 64 );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( BatchParser::parseInt128s( text, '\n', values, errors ) );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( fieldCount ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_DecimalTryParseLoop );
+	BENCHMARK( BM_BatchParseDecimalsDelimited );
+	BENCHMARK( BM_BatchParseDecimalsColumn );
+
+	BENCHMARK( BM_Int128TryParseLoop );
+	BENCHMARK( BM_BatchParseInt128sDelimited );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
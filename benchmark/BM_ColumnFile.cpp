@@ -0,0 +1,166 @@
+/**
+ * @file BM_ColumnFile.cpp
+ * @brief Benchmark loading a Decimal series from a column file against text and copy loading
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/ColumnFile.h>
+#include <nfx/datatypes/Decimal.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		/** @brief Values in the benchmark series (16 MB as Decimal) */
+		constexpr std::size_t VALUE_COUNT{ 1UL << 20 };
+
+		/** @brief Prices with four decimal places */
+		std::vector<Decimal> makePrices()
+		{
+			std::vector<Decimal> values( VALUE_COUNT );
+			for ( std::size_t i{ 0 }; i < values.size(); ++i )
+			{
+				values[i] = ( Decimal{ static_cast<std::int64_t>( 1000000 + i ) } / Decimal{ 10000 } ).rescale( 4 );
+			}
+
+			return values;
+		}
+
+		/** @brief Write the series once in the requested form */
+		std::filesystem::path makeColumnFile( ColumnType type )
+		{
+			const std::filesystem::path path{ std::filesystem::temp_directory_path() /
+											  ( type == ColumnType::Decimal ? "nfx_bm_column.col" : "nfx_bm_column64.col" ) };
+			ColumnFileWriter writer{ path, type, ColumnScalePolicy::Fixed, 4 };
+			writer.append( makePrices() );
+			writer.finish();
+
+			return path;
+		}
+	} // namespace
+
+	//=====================================================================
+	// ColumnFile benchmark suite
+	//=====================================================================
+
+	static void BM_ColumnFileOpen( ::benchmark::State& state )
+	{
+		const std::filesystem::path path{ makeColumnFile( ColumnType::Decimal ) };
+
+		for ( auto _ : state )
+		{
+			ColumnFileReader reader{ path };
+			auto values{ reader.decimals() };
+			::benchmark::DoNotOptimize( values );
+		}
+
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( VALUE_COUNT * sizeof( Decimal ) ) );
+	}
+
+	static void BM_ColumnFileOpenAndTouch( ::benchmark::State& state )
+	{
+		const std::filesystem::path path{ makeColumnFile( ColumnType::Decimal ) };
+
+		for ( auto _ : state )
+		{
+			ColumnFileReader reader{ path };
+			Decimal last{};
+			for ( const Decimal& value : reader.decimals() )
+			{
+				last = value;
+			}
+			::benchmark::DoNotOptimize( last );
+		}
+
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( VALUE_COUNT * sizeof( Decimal ) ) );
+	}
+
+	static void BM_ColumnFileExpandDecimal64( ::benchmark::State& state )
+	{
+		const std::filesystem::path path{ makeColumnFile( ColumnType::Decimal64 ) };
+		std::vector<Decimal> destination( VALUE_COUNT );
+
+		for ( auto _ : state )
+		{
+			ColumnFileReader reader{ path };
+			reader.toDecimals( destination );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( VALUE_COUNT ) );
+	}
+
+	static void BM_ColumnFileVerifyChecksum( ::benchmark::State& state )
+	{
+		const std::filesystem::path path{ makeColumnFile( ColumnType::Decimal ) };
+		const ColumnFileReader reader{ path };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( reader.verifyChecksum() );
+		}
+
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( reader.payload().size() ) );
+	}
+
+	static void BM_ColumnFileWrite( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> prices{ makePrices() };
+		const std::filesystem::path path{ std::filesystem::temp_directory_path() / "nfx_bm_column_write.col" };
+
+		for ( auto _ : state )
+		{
+			ColumnFileWriter writer{ path, ColumnType::Decimal };
+			writer.append( prices );
+			writer.finish();
+		}
+
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( VALUE_COUNT * sizeof( Decimal ) ) );
+	}
+
+	static void BM_TextFileLoad( ::benchmark::State& state )
+	{
+		const std::filesystem::path path{ std::filesystem::temp_directory_path() / "nfx_bm_column.txt" };
+		{
+			std::ofstream text{ path };
+			for ( const Decimal& price : makePrices() )
+			{
+				text << price.toString() << '\n';
+			}
+		}
+
+		for ( auto _ : state )
+		{
+			std::ifstream text{ path };
+			std::vector<Decimal> values;
+			values.reserve( VALUE_COUNT );
+			std::string line;
+			while ( std::getline( text, line ) )
+			{
+				values.push_back( Decimal::parse( line ) );
+			}
+			::benchmark::DoNotOptimize( values.data() );
+		}
+
+		state.SetBytesProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( VALUE_COUNT * sizeof( Decimal ) ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_ColumnFileOpen );
+	BENCHMARK( BM_ColumnFileOpenAndTouch );
+	BENCHMARK( BM_ColumnFileExpandDecimal64 );
+	BENCHMARK( BM_ColumnFileVerifyChecksum );
+	BENCHMARK( BM_ColumnFileWrite );
+	BENCHMARK( BM_TextFileLoad );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,95 @@
+/**
+ * @file BM_ConcurrentDecimalAdder.cpp
+ * @brief Benchmark contended Decimal counters: sharded adder against AtomicDecimal and a mutex
+ */
+
+#include <mutex>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/AtomicDecimal.h>
+#include <nfx/datatypes/ConcurrentDecimalAdder.h>
+#include <nfx/datatypes/Decimal.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		/** @brief Shared counters, one per benchmark so runs do not interfere */
+		ConcurrentDecimalAdder g_adder;
+		AtomicDecimal g_atomicTotal;
+		std::mutex g_mutex;
+		Decimal g_mutexTotal;
+
+		/** @brief Fee with a fixed scale */
+		const Decimal FEE{ "0.0125" };
+	} // namespace
+
+	//=====================================================================
+	// ConcurrentDecimalAdder benchmark suite
+	//=====================================================================
+
+	static void BM_ConcurrentDecimalAdderAdd( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			g_adder.add( FEE );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) );
+	}
+
+	static void BM_ConcurrentDecimalAdderSum( ::benchmark::State& state )
+	{
+		g_adder.add( FEE );
+
+		for ( auto _ : state )
+		{
+			Decimal result{ g_adder.sum() };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_AtomicDecimalAdd( ::benchmark::State& state )
+	{
+		if ( state.thread_index() == 0 )
+		{
+			g_atomicTotal.store( Decimal{} );
+		}
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( g_atomicTotal.fetchAdd( FEE ) );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) );
+	}
+
+	static void BM_MutexDecimalAdd( ::benchmark::State& state )
+	{
+		if ( state.thread_index() == 0 )
+		{
+			std::lock_guard<std::mutex> lock{ g_mutex };
+			g_mutexTotal = Decimal{};
+		}
+
+		for ( auto _ : state )
+		{
+			std::lock_guard<std::mutex> lock{ g_mutex };
+			g_mutexTotal += FEE;
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_ConcurrentDecimalAdderAdd )->Threads( 1 )->Threads( 4 )->Threads( 16 )->Threads( 32 );
+	BENCHMARK( BM_ConcurrentDecimalAdderSum );
+	BENCHMARK( BM_AtomicDecimalAdd )->Threads( 1 )->Threads( 4 )->Threads( 16 )->Threads( 32 );
+	BENCHMARK( BM_MutexDecimalAdd )->Threads( 1 )->Threads( 4 )->Threads( 16 )->Threads( 32 );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,136 @@
+/**
+ * @file BM_CpuDispatch.cpp
+ * @brief Benchmark the dispatched span kernels under each instruction set
+ */
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/ArithmeticStatus.h>
+#include <nfx/datatypes/CpuDispatch.h>
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalColumn.h>
+#include <nfx/datatypes/DecimalFilter.h>
+#include <nfx/datatypes/Int128.h>
+#include <nfx/datatypes/Int128Kernels.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		/** @brief Number of values per iteration */
+		constexpr std::size_t VALUE_COUNT{ 1UL << 16 };
+
+		std::vector<Int128> balances( std::uint64_t seed )
+		{
+			std::mt19937_64 engine{ seed };
+			std::vector<Int128> values;
+			values.reserve( VALUE_COUNT );
+			for ( std::size_t i{ 0 }; i < VALUE_COUNT; ++i )
+			{
+				values.emplace_back( engine(), engine() % 1024 );
+			}
+
+			return values;
+		}
+
+		/**
+		 * @brief Activate the instruction set of the benchmark argument
+		 * @return false (and the benchmark is skipped) if the CPU does not support it
+		 */
+		bool activate( ::benchmark::State& state )
+		{
+			const auto instructionSet{ static_cast<CpuDispatch::InstructionSet>( state.range( 0 ) ) };
+			if ( !CpuDispatch::isSupported( instructionSet ) )
+			{
+				state.SkipWithError( "Instruction set not supported by this CPU" );
+				return false;
+			}
+
+			CpuDispatch::setActive( instructionSet );
+			return true;
+		}
+	} // namespace
+
+	//=====================================================================
+	// CpuDispatch benchmark suite
+	//=====================================================================
+
+	static void BM_DispatchInt128Sum( ::benchmark::State& state )
+	{
+		const std::vector<Int128> values{ balances( 41 ) };
+		if ( !activate( state ) )
+		{
+			return;
+		}
+
+		for ( auto _ : state )
+		{
+			ArithmeticStatus status{ ArithmeticStatus::None };
+			Int128 total{ Int128Kernels::sum( values, status ) };
+			::benchmark::DoNotOptimize( total );
+		}
+
+		CpuDispatch::reset();
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_DispatchInt128LessThan( ::benchmark::State& state )
+	{
+		const std::vector<Int128> left{ balances( 41 ) };
+		const std::vector<Int128> right{ balances( 42 ) };
+		std::vector<std::uint64_t> mask( ( VALUE_COUNT + 63 ) / 64 );
+		if ( !activate( state ) )
+		{
+			return;
+		}
+
+		for ( auto _ : state )
+		{
+			Int128Kernels::lessThan( left, right, mask );
+			::benchmark::DoNotOptimize( mask.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		CpuDispatch::reset();
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( left.size() ) );
+	}
+
+	static void BM_DispatchDecimalFilterColumn( ::benchmark::State& state )
+	{
+		std::mt19937_64 engine{ 43 };
+		DecimalColumn column;
+		for ( std::size_t i{ 0 }; i < VALUE_COUNT; ++i )
+		{
+			column.append( ( Decimal{ static_cast<std::int64_t>( engine() % 2000000 ) - 1000000 } / Decimal{ 100 } ).rescale( 2 ) );
+		}
+		std::vector<std::uint64_t> selection( ( VALUE_COUNT + 63 ) / 64 );
+		if ( !activate( state ) )
+		{
+			return;
+		}
+
+		for ( auto _ : state )
+		{
+			DecimalFilter::between( column, Decimal{ "-2500.5" }, Decimal{ "4000" }, selection );
+			::benchmark::DoNotOptimize( selection.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		CpuDispatch::reset();
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( column.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	// Argument: 0 = Baseline, 1 = Avx2, 2 = Avx512
+	BENCHMARK( BM_DispatchInt128Sum )->Arg( 0 )->Arg( 1 )->Arg( 2 );
+	BENCHMARK( BM_DispatchInt128LessThan )->Arg( 0 )->Arg( 1 )->Arg( 2 );
+	BENCHMARK( BM_DispatchDecimalFilterColumn )->Arg( 0 )->Arg( 1 )->Arg( 2 );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
@@ -3,6 +3,9 @@
  * @brief Benchmark Decimal construction, arithmetic, parsing, formatting, and comparison operations
  */
 
+#include <unordered_map>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include <nfx/datatypes/Decimal.h>
@@ -229,6 +232,36 @@ namespace nfx::datatypes::benchmark
 		}
 	}
 
+	//----------------------------------------------
+	// Non-throwing arithmetic
+	//----------------------------------------------
+
+	static void BM_DecimalStatusMultiply( ::benchmark::State& state )
+	{
+		Decimal a{ 123.456 };
+		Decimal b{ 789.012 };
+		ArithmeticStatus status{ ArithmeticStatus::None };
+		for ( auto _ : state )
+		{
+			Decimal result{ Decimal::multiply( a, b, status ) };
+			::benchmark::DoNotOptimize( result );
+		}
+		::benchmark::DoNotOptimize( status );
+	}
+
+	static void BM_DecimalStatusDivide( ::benchmark::State& state )
+	{
+		Decimal a{ 987654.321 };
+		Decimal b{ 123.456 };
+		ArithmeticStatus status{ ArithmeticStatus::None };
+		for ( auto _ : state )
+		{
+			Decimal result{ Decimal::divide( a, b, status ) };
+			::benchmark::DoNotOptimize( result );
+		}
+		::benchmark::DoNotOptimize( status );
+	}
+
 	//----------------------------------------------
 	// Parsing
 	//----------------------------------------------
@@ -537,6 +570,56 @@ namespace nfx::datatypes::benchmark
 		}
 	}
 
+	//----------------------------------------------
+	// Hashing
+	//----------------------------------------------
+
+	static void BM_DecimalHash( ::benchmark::State& state )
+	{
+		Decimal value{ "-12345678901234567890.123456789" };
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			std::uint64_t result{ value.hash() };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_DecimalHashNormalized( ::benchmark::State& state )
+	{
+		// Baseline: normalize trailing zeros away, then hash the bits
+		Decimal value{ "-12345678901234567890.123456789" };
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			const Decimal normalized{ value.rescale( value.decimalPlacesCount() ) };
+			const auto bits{ normalized.toBits() };
+			std::uint64_t result{ Int128{ static_cast<std::uint64_t>( static_cast<std::uint32_t>( bits[1] ) ) << 32 | static_cast<std::uint32_t>( bits[0] ),
+				static_cast<std::uint64_t>( static_cast<std::uint32_t>( bits[3] ) ) << 32 | static_cast<std::uint32_t>( bits[2] ) }
+					.hash() };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_DecimalUnorderedMapFind( ::benchmark::State& state )
+	{
+		std::unordered_map<Decimal, std::size_t> levels;
+		std::vector<Decimal> prices;
+		for ( std::size_t i{ 0 }; i < 4096; ++i )
+		{
+			prices.push_back( Decimal{ "100" } + Decimal{ static_cast<std::int64_t>( i ) } * Decimal{ "0.01" } );
+			levels.emplace( prices.back(), i );
+		}
+
+		std::size_t index{ 0 };
+		for ( auto _ : state )
+		{
+			auto it{ levels.find( prices[index] ) };
+			::benchmark::DoNotOptimize( it );
+			index = ( index + 1 ) & ( prices.size() - 1 );
+		}
+	}
+
 	//----------------------------------------------
 	// Mathematical operations
 	//----------------------------------------------
@@ -601,6 +684,36 @@ namespace nfx::datatypes::benchmark
 		}
 	}
 
+	static void BM_DecimalRescaleUp( ::benchmark::State& state )
+	{
+		Decimal value{ "123456.789" };
+		for ( auto _ : state )
+		{
+			Decimal result{ value.rescale( 8 ) };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_DecimalRescaleDown( ::benchmark::State& state )
+	{
+		Decimal value{ "123456.789" };
+		for ( auto _ : state )
+		{
+			Decimal result{ value.rescale( 2 ) };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_DecimalMovePointLeft( ::benchmark::State& state )
+	{
+		Decimal value{ "123456789" };
+		for ( auto _ : state )
+		{
+			Decimal result{ value.movePointLeft( 4 ) };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
 	//----------------------------------------------
 	// Property accessors
 	//----------------------------------------------
@@ -699,6 +812,9 @@ namespace nfx::datatypes::benchmark
 	BENCHMARK( BM_DecimalMultiplicationAssignment );
 	BENCHMARK( BM_DecimalDivisionAssignment );
 
+	BENCHMARK( BM_DecimalStatusMultiply );
+	BENCHMARK( BM_DecimalStatusDivide );
+
 	//----------------------------------------------
 	// Parsing
 	//----------------------------------------------
@@ -752,6 +868,14 @@ namespace nfx::datatypes::benchmark
 	BENCHMARK( BM_DecimalIsNegative );
 	BENCHMARK( BM_DecimalIsNegativePositive );
 
+	//----------------------------------------------
+	// Hashing
+	//----------------------------------------------
+
+	BENCHMARK( BM_DecimalHash );
+	BENCHMARK( BM_DecimalHashNormalized );
+	BENCHMARK( BM_DecimalUnorderedMapFind );
+
 	//----------------------------------------------
 	// Mathematical operations
 	//----------------------------------------------
@@ -762,6 +886,9 @@ namespace nfx::datatypes::benchmark
 	BENCHMARK( BM_DecimalFloor );
 	BENCHMARK( BM_DecimalCeiling );
 	BENCHMARK( BM_DecimalRound );
+	BENCHMARK( BM_DecimalRescaleUp );
+	BENCHMARK( BM_DecimalRescaleDown );
+	BENCHMARK( BM_DecimalMovePointLeft );
 
 	//----------------------------------------------
 	// Property accessors
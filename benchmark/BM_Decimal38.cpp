@@ -0,0 +1,132 @@
+/**
+ * @file BM_Decimal38.cpp
+ * @brief Benchmark Decimal38 arithmetic, parsing and formatting against Decimal
+ */
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/Decimal38.h>
+
+namespace nfx::datatypes::benchmark
+{
+	//=====================================================================
+	// Decimal38 benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Arithmetic
+	//----------------------------------------------
+
+	static void BM_Decimal38Addition( ::benchmark::State& state )
+	{
+		Decimal38 a{ "123456789012345678901234.56789012345" };
+		Decimal38 b{ "987.654321" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result{ a + b };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_Decimal38Multiplication( ::benchmark::State& state )
+	{
+		Decimal38 a{ "12345678901234567890.12345678901234567" };
+		Decimal38 b{ "98765.4321" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result{ a * b };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_Decimal38Division( ::benchmark::State& state )
+	{
+		Decimal38 a{ "123456789.123456789" };
+		Decimal38 b{ "3.7" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result{ a / b };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_DecimalMultiplicationReference( ::benchmark::State& state )
+	{
+		Decimal a{ "12345678901234.12345678901234" };
+		Decimal b{ "98765.4321" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result{ a * b };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	//----------------------------------------------
+	// Conversion
+	//----------------------------------------------
+
+	static void BM_Decimal38Parse( ::benchmark::State& state )
+	{
+		const std::string text{ "-123456789012345678901234.56789012345" };
+
+		for ( auto _ : state )
+		{
+			auto result{ Decimal38::parse( text ) };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_Decimal38ToString( ::benchmark::State& state )
+	{
+		Decimal38 value{ "-123456789012345678901234.56789012345" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			auto result{ value.toString() };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_Decimal38ToDecimal( ::benchmark::State& state )
+	{
+		Decimal38 value{ "1.23456789012345678901234567890123456789" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			auto result{ value.toDecimal() };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_Decimal38Addition );
+	BENCHMARK( BM_Decimal38Multiplication );
+	BENCHMARK( BM_Decimal38Division );
+	BENCHMARK( BM_DecimalMultiplicationReference );
+
+	BENCHMARK( BM_Decimal38Parse );
+	BENCHMARK( BM_Decimal38ToString );
+	BENCHMARK( BM_Decimal38ToDecimal );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
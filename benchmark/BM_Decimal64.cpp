@@ -0,0 +1,139 @@
+/**
+ * @file BM_Decimal64.cpp
+ * @brief Benchmark Decimal64 packing, promotion, bulk conversion and arithmetic against Decimal
+ */
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/Decimal64.h>
+
+namespace nfx::datatypes::benchmark
+{
+	//=====================================================================
+	// Decimal64 benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Conversion
+	//----------------------------------------------
+
+	static void BM_Decimal64FromDecimal( ::benchmark::State& state )
+	{
+		Decimal value{ "123.4567" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			Decimal64 result{ value };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_Decimal64ToDecimal( ::benchmark::State& state )
+	{
+		Decimal64 value{ "123.4567" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			Decimal result{ value.toDecimal() };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_Decimal64FromDecimalsSpan( ::benchmark::State& state )
+	{
+		const auto count{ static_cast<std::size_t>( state.range( 0 ) ) };
+		std::vector<Decimal> source( count, Decimal{ "101.25" } );
+		std::vector<Decimal64> destination( count );
+
+		for ( auto _ : state )
+		{
+			Decimal64::fromDecimals( source, destination );
+			::benchmark::DoNotOptimize( destination.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Decimal64ToDecimalsSpan( ::benchmark::State& state )
+	{
+		const auto count{ static_cast<std::size_t>( state.range( 0 ) ) };
+		std::vector<Decimal64> source( count, Decimal64{ "101.25" } );
+		std::vector<Decimal> destination( count );
+
+		for ( auto _ : state )
+		{
+			Decimal64::toDecimals( source, destination );
+			::benchmark::DoNotOptimize( destination.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	//----------------------------------------------
+	// Arithmetic
+	//----------------------------------------------
+
+	static void BM_Decimal64AdditionSameScale( ::benchmark::State& state )
+	{
+		Decimal64 a{ "123.45" };
+		Decimal64 b{ "987.65" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result = a + b;
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_Decimal64Multiplication( ::benchmark::State& state )
+	{
+		Decimal64 a{ "123.45" };
+		Decimal64 b{ "9.87" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result = a * b;
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_Decimal64LessThan( ::benchmark::State& state )
+	{
+		Decimal64 a{ "123.45" };
+		Decimal64 b{ "123.46" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			bool result = a < b;
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_Decimal64FromDecimal );
+	BENCHMARK( BM_Decimal64ToDecimal );
+	BENCHMARK( BM_Decimal64FromDecimalsSpan )->Arg( 1024 );
+	BENCHMARK( BM_Decimal64ToDecimalsSpan )->Arg( 1024 );
+
+	BENCHMARK( BM_Decimal64AdditionSameScale );
+	BENCHMARK( BM_Decimal64Multiplication );
+	BENCHMARK( BM_Decimal64LessThan );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,129 @@
+/**
+ * @file BM_DecimalAccumulator.cpp
+ * @brief Benchmark exact accumulation and dot products against chained operator loops
+ */
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalAccumulator.h>
+#include <nfx/datatypes/DecimalColumn.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		/** @brief Prices with 2 to 6 fractional digits, as a mixed feed holds them */
+		std::vector<Decimal> mixedPrices( std::size_t count, bool sameScale )
+		{
+			std::vector<Decimal> values;
+			values.reserve( count );
+			for ( std::size_t i{ 0 }; i < count; ++i )
+			{
+				const std::int32_t scale{ sameScale ? 4 : static_cast<std::int32_t>( 2 + i % 5 ) };
+				values.push_back( ( Decimal{ static_cast<std::int64_t>( i * 7919 % 200000 ) - 100000 } / Decimal{ 1000 } ).rescale( scale ) );
+			}
+
+			return values;
+		}
+	} // namespace
+
+	//=====================================================================
+	// DecimalAccumulator benchmark suite
+	//=====================================================================
+
+	static void BM_DecimalOperatorPlusSum( ::benchmark::State& state )
+	{
+		const auto values{ mixedPrices( 4096, state.range( 0 ) != 0 ) };
+
+		for ( auto _ : state )
+		{
+			Decimal sum{};
+			for ( const Decimal& value : values )
+			{
+				sum += value;
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_DecimalAccumulatorSpan( ::benchmark::State& state )
+	{
+		const auto values{ mixedPrices( 4096, state.range( 0 ) != 0 ) };
+
+		for ( auto _ : state )
+		{
+			DecimalAccumulator accumulator;
+			accumulator.add( values );
+			Decimal sum{ accumulator.result() };
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_DecimalAccumulatorColumn( ::benchmark::State& state )
+	{
+		const DecimalColumn column{ mixedPrices( 4096, state.range( 0 ) != 0 ) };
+
+		for ( auto _ : state )
+		{
+			DecimalAccumulator accumulator;
+			accumulator.add( column );
+			Decimal sum{ accumulator.result() };
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( column.size() ) );
+	}
+
+	static void BM_DecimalOperatorMultiplyAddDot( ::benchmark::State& state )
+	{
+		const auto prices{ mixedPrices( 4096, state.range( 0 ) != 0 ) };
+		const std::vector<Decimal> quantities( prices.size(), Decimal{ 250 } );
+
+		for ( auto _ : state )
+		{
+			Decimal notional{};
+			for ( std::size_t i{ 0 }; i < prices.size(); ++i )
+			{
+				notional += prices[i] * quantities[i];
+			}
+			::benchmark::DoNotOptimize( notional );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( prices.size() ) );
+	}
+
+	static void BM_DecimalAccumulatorDot( ::benchmark::State& state )
+	{
+		const auto prices{ mixedPrices( 4096, state.range( 0 ) != 0 ) };
+		const std::vector<Decimal> quantities( prices.size(), Decimal{ 250 } );
+
+		for ( auto _ : state )
+		{
+			Decimal notional{ DecimalAccumulator::dot( prices, quantities ) };
+			::benchmark::DoNotOptimize( notional );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( prices.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	// Argument: 0 = mixed scales, 1 = same scale
+	BENCHMARK( BM_DecimalOperatorPlusSum )->Arg( 0 )->Arg( 1 );
+	BENCHMARK( BM_DecimalAccumulatorSpan )->Arg( 0 )->Arg( 1 );
+	BENCHMARK( BM_DecimalAccumulatorColumn )->Arg( 0 )->Arg( 1 );
+	BENCHMARK( BM_DecimalOperatorMultiplyAddDot )->Arg( 0 )->Arg( 1 );
+	BENCHMARK( BM_DecimalAccumulatorDot )->Arg( 0 )->Arg( 1 );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
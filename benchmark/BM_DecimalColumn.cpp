@@ -0,0 +1,140 @@
+/**
+ * @file BM_DecimalColumn.cpp
+ * @brief Benchmark DecimalColumn conversion and selection against an array of Decimal
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalColumn.h>
+
+namespace nfx::datatypes::benchmark
+{
+	//=====================================================================
+	// DecimalColumn benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Bulk conversion
+	//----------------------------------------------
+
+	static void BM_DecimalColumnFromDecimals( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> source( 1024, Decimal{ "101.25" } );
+
+		for ( auto _ : state )
+		{
+			DecimalColumn column{ source };
+			::benchmark::DoNotOptimize( column.lo64().data() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( source.size() ) );
+	}
+
+	static void BM_DecimalColumnToDecimals( ::benchmark::State& state )
+	{
+		const DecimalColumn column{ std::vector<Decimal>( 1024, Decimal{ "101.25" } ) };
+		std::vector<Decimal> destination( column.size() );
+
+		for ( auto _ : state )
+		{
+			column.toDecimals( destination );
+			::benchmark::DoNotOptimize( destination.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( column.size() ) );
+	}
+
+	//----------------------------------------------
+	// Field scan
+	//----------------------------------------------
+
+	static void BM_DecimalArrayScaleScan( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> values( 4096, Decimal{ "101.25" } );
+
+		for ( auto _ : state )
+		{
+			std::uint32_t maxScale{ 0 };
+			for ( const Decimal& value : values )
+			{
+				maxScale = std::max( maxScale, static_cast<std::uint32_t>( value.scale() ) );
+			}
+			::benchmark::DoNotOptimize( maxScale );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_DecimalColumnScaleScan( ::benchmark::State& state )
+	{
+		const DecimalColumn column{ std::vector<Decimal>( 4096, Decimal{ "101.25" } ) };
+
+		for ( auto _ : state )
+		{
+			std::uint32_t maxFlags{ 0 };
+			for ( const std::uint32_t flags : column.scaleSign() )
+			{
+				maxFlags = std::max( maxFlags, flags & 0x00FF0000U );
+			}
+			::benchmark::DoNotOptimize( maxFlags );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( column.size() ) );
+	}
+
+	//----------------------------------------------
+	// Selection
+	//----------------------------------------------
+
+	static void BM_DecimalColumnGather( ::benchmark::State& state )
+	{
+		const DecimalColumn column{ std::vector<Decimal>( 4096, Decimal{ "101.25" } ) };
+		std::vector<std::size_t> indices( 1024 );
+		for ( std::size_t i{ 0 }; i < indices.size(); ++i )
+		{
+			indices[i] = ( i * 2654435761U ) % column.size();
+		}
+
+		for ( auto _ : state )
+		{
+			DecimalColumn picked{ column.gather( indices ) };
+			::benchmark::DoNotOptimize( picked.lo64().data() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( indices.size() ) );
+	}
+
+	static void BM_DecimalColumnSlice( ::benchmark::State& state )
+	{
+		DecimalColumn column{ std::vector<Decimal>( 4096, Decimal{ "101.25" } ) };
+		column.appendNull();
+
+		for ( auto _ : state )
+		{
+			DecimalColumn part{ column.slice( 13, 1024 ) };
+			::benchmark::DoNotOptimize( part.validity().data() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * 1024 );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_DecimalColumnFromDecimals );
+	BENCHMARK( BM_DecimalColumnToDecimals );
+
+	BENCHMARK( BM_DecimalArrayScaleScan );
+	BENCHMARK( BM_DecimalColumnScaleScan );
+
+	BENCHMARK( BM_DecimalColumnGather );
+	BENCHMARK( BM_DecimalColumnSlice );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
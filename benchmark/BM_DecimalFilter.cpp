@@ -0,0 +1,114 @@
+/**
+ * @file BM_DecimalFilter.cpp
+ * @brief Benchmark the Decimal predicate kernels against a loop over Decimal::operator>=
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalColumn.h>
+#include <nfx/datatypes/DecimalFilter.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		std::vector<Decimal> prices( std::size_t count )
+		{
+			std::mt19937_64 engine{ 37 };
+			std::vector<Decimal> values;
+			values.reserve( count );
+			for ( std::size_t i{ 0 }; i < count; ++i )
+			{
+				values.push_back( ( Decimal{ static_cast<std::int64_t>( engine() % 100000 ) } / Decimal{ 100 } ).rescale( 2 ) );
+			}
+
+			return values;
+		}
+
+		const Decimal threshold{ "450.5" };
+	} // namespace
+
+	//=====================================================================
+	// DecimalFilter benchmark suite
+	//=====================================================================
+
+	static void BM_DecimalOperatorLoop( ::benchmark::State& state )
+	{
+		const auto values{ prices( 4096 ) };
+		std::vector<std::uint64_t> selection( values.size() / 64 );
+
+		for ( auto _ : state )
+		{
+			std::fill( selection.begin(), selection.end(), 0ULL );
+			for ( std::size_t i{ 0 }; i < values.size(); ++i )
+			{
+				selection[i / 64] |= static_cast<std::uint64_t>( values[i] >= threshold ) << ( i % 64 );
+			}
+			::benchmark::DoNotOptimize( selection.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_DecimalFilterSpan( ::benchmark::State& state )
+	{
+		const auto values{ prices( 4096 ) };
+		std::vector<std::uint64_t> selection( values.size() / 64 );
+
+		for ( auto _ : state )
+		{
+			DecimalFilter::compare( values, DecimalFilter::Comparison::GreaterOrEqual, threshold, selection );
+			::benchmark::DoNotOptimize( selection.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_DecimalFilterColumn( ::benchmark::State& state )
+	{
+		const DecimalColumn column{ prices( 4096 ) };
+		std::vector<std::uint64_t> selection( column.size() / 64 );
+
+		for ( auto _ : state )
+		{
+			DecimalFilter::compare( column, DecimalFilter::Comparison::GreaterOrEqual, threshold, selection );
+			::benchmark::DoNotOptimize( selection.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( column.size() ) );
+	}
+
+	static void BM_DecimalFilterColumnBetween( ::benchmark::State& state )
+	{
+		const DecimalColumn column{ prices( 4096 ) };
+		std::vector<std::uint64_t> selection( column.size() / 64 );
+
+		for ( auto _ : state )
+		{
+			DecimalFilter::between( column, Decimal{ 100 }, threshold, selection );
+			::benchmark::DoNotOptimize( selection.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( column.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_DecimalOperatorLoop );
+	BENCHMARK( BM_DecimalFilterSpan );
+	BENCHMARK( BM_DecimalFilterColumn );
+	BENCHMARK( BM_DecimalFilterColumnBetween );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
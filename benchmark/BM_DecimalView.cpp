@@ -0,0 +1,111 @@
+/**
+ * @file BM_DecimalView.cpp
+ * @brief Benchmark reading wire decimal records through DecimalView against text parsing
+ */
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalView.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		/** @brief Number of records per iteration */
+		constexpr std::size_t RECORD_COUNT{ 1024 };
+
+		/** @brief Little-endian records in a .NET layout */
+		std::vector<std::byte> makeWire( DecimalView::Layout layout )
+		{
+			std::vector<std::byte> bytes;
+			for ( std::size_t i{ 0 }; i < RECORD_COUNT; ++i )
+			{
+				const Decimal price{ Decimal{ static_cast<std::int64_t>( 10000 + i ) } / Decimal{ 100 } };
+				const auto bits{ price.toBits() };
+				const std::array<std::int32_t, 4> words{ layout == DecimalView::Layout::DotNetBits
+															 ? bits
+															 : std::array<std::int32_t, 4>{ bits[3], bits[2], bits[0], bits[1] } };
+				for ( const std::int32_t word : words )
+				{
+					for ( int shift{ 0 }; shift < 32; shift += 8 )
+					{
+						bytes.push_back( static_cast<std::byte>( static_cast<std::uint32_t>( word ) >> shift ) );
+					}
+				}
+			}
+
+			return bytes;
+		}
+	} // namespace
+
+	//=====================================================================
+	// DecimalView benchmark suite
+	//=====================================================================
+
+	static void BM_DecimalViewToDecimals( ::benchmark::State& state )
+	{
+		const auto layout{ static_cast<DecimalView::Layout>( state.range( 0 ) ) };
+		const std::vector<std::byte> wire{ makeWire( layout ) };
+		const DecimalView view{ wire, layout };
+		std::vector<Decimal> destination( view.size() );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( view.tryToDecimals( destination ) );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( RECORD_COUNT ) );
+	}
+
+	static void BM_DecimalViewAsDecimals( ::benchmark::State& state )
+	{
+		std::vector<Decimal> stored( RECORD_COUNT, Decimal{ "101.25" } );
+		const std::span<const std::byte> bytes{ std::as_bytes( std::span{ stored } ) };
+
+		for ( auto _ : state )
+		{
+			auto values{ DecimalView::asDecimals( bytes ) };
+			::benchmark::DoNotOptimize( values );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( RECORD_COUNT ) );
+	}
+
+	static void BM_DecimalViewStringParse( ::benchmark::State& state )
+	{
+		std::vector<std::string> texts;
+		for ( std::size_t i{ 0 }; i < RECORD_COUNT; ++i )
+		{
+			texts.push_back( ( Decimal{ static_cast<std::int64_t>( 10000 + i ) } / Decimal{ 100 } ).toString() );
+		}
+		std::vector<Decimal> destination( RECORD_COUNT );
+
+		for ( auto _ : state )
+		{
+			for ( std::size_t i{ 0 }; i < RECORD_COUNT; ++i )
+			{
+				destination[i] = Decimal::parse( texts[i] );
+			}
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( RECORD_COUNT ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	// Argument: 0 = Native, 1 = DotNetBits, 2 = DotNetMemory
+	BENCHMARK( BM_DecimalViewToDecimals )->Arg( 1 )->Arg( 2 );
+	BENCHMARK( BM_DecimalViewAsDecimals );
+	BENCHMARK( BM_DecimalViewStringParse );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
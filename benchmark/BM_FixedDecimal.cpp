@@ -0,0 +1,194 @@
+/**
+ * @file BM_FixedDecimal.cpp
+ * @brief Benchmark FixedDecimal arithmetic, comparison and conversion against Decimal
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/FixedDecimal.h>
+#include <nfx/datatypes/Int128.h>
+
+namespace nfx::datatypes::benchmark
+{
+	using Price = FixedDecimal<4>;
+	using WidePrice = FixedDecimal<20, Int128>;
+
+	//=====================================================================
+	// FixedDecimal benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Arithmetic
+	//----------------------------------------------
+
+	static void BM_FixedDecimalAddition( ::benchmark::State& state )
+	{
+		Price a{ "123.4567" };
+		Price b{ "987.6543" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result = a + b;
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_FixedDecimalMultiplication( ::benchmark::State& state )
+	{
+		Price a{ "123.4567" };
+		Price b{ "9.8765" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result = a * b;
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_FixedDecimalDivision( ::benchmark::State& state )
+	{
+		Price a{ "123.4567" };
+		Price b{ "9.8765" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result = a / b;
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_FixedDecimalWideMultiplication( ::benchmark::State& state )
+	{
+		WidePrice a{ "123.45678901234567890123" };
+		WidePrice b{ "9.87654321098765432109" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result = a * b;
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_DecimalReferenceAddition( ::benchmark::State& state )
+	{
+		Decimal a{ "123.4567" };
+		Decimal b{ "987.6543" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result = a + b;
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_DecimalReferenceMultiplication( ::benchmark::State& state )
+	{
+		Decimal a{ "123.4567" };
+		Decimal b{ "9.8765" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			auto result = a * b;
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	static void BM_FixedDecimalLessThan( ::benchmark::State& state )
+	{
+		Price a{ "123.4567" };
+		Price b{ "123.4568" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			bool result = a < b;
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	//----------------------------------------------
+	// Conversion
+	//----------------------------------------------
+
+	static void BM_FixedDecimalFromDecimal( ::benchmark::State& state )
+	{
+		Decimal value{ "123.456789" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			Price result{ value };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_FixedDecimalToDecimal( ::benchmark::State& state )
+	{
+		Price value{ "123.4567" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			auto result = value.toDecimal();
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_FixedDecimalParse( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			auto result = Price::parse( "123.4567" );
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_FixedDecimalToString( ::benchmark::State& state )
+	{
+		Price value{ "123.4567" };
+
+		for ( auto _ : state )
+		{
+			auto result = value.toString();
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_FixedDecimalAddition );
+	BENCHMARK( BM_FixedDecimalMultiplication );
+	BENCHMARK( BM_FixedDecimalDivision );
+	BENCHMARK( BM_FixedDecimalWideMultiplication );
+	BENCHMARK( BM_DecimalReferenceAddition );
+	BENCHMARK( BM_DecimalReferenceMultiplication );
+
+	BENCHMARK( BM_FixedDecimalLessThan );
+
+	BENCHMARK( BM_FixedDecimalFromDecimal );
+	BENCHMARK( BM_FixedDecimalToDecimal );
+	BENCHMARK( BM_FixedDecimalParse );
+	BENCHMARK( BM_FixedDecimalToString );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
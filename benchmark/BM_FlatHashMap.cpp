@@ -0,0 +1,190 @@
+/**
+ * @file BM_FlatHashMap.cpp
+ * @brief Benchmark flat hash map aggregation and lookup against std::unordered_map
+ */
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/FlatHashMap.h>
+#include <nfx/datatypes/Int128.h>
+
+namespace nfx::datatypes::benchmark
+{
+	//=====================================================================
+	// FlatHashMap benchmark suite
+	//=====================================================================
+
+	/**
+	 * @brief Prices on a 0.01 tick grid, a quarter of them quoted at scale 4
+	 */
+	static std::vector<Decimal> makePrices( std::size_t count, std::size_t levels )
+	{
+		std::mt19937_64 random{ 47 };
+		std::vector<Decimal> prices;
+		prices.reserve( count );
+		for ( std::size_t i{ 0 }; i < count; ++i )
+		{
+			Decimal price{ Decimal{ "100" } + Decimal{ static_cast<std::int64_t>( random() % levels ) } * Decimal{ "0.01" } };
+			prices.push_back( random() % 4U == 0 ? price.rescale( 4 ) : price );
+		}
+
+		return prices;
+	}
+
+	static std::vector<Int128> makeAccounts( std::size_t count, std::size_t accounts )
+	{
+		std::mt19937_64 random{ 48 };
+		std::vector<Int128> ids;
+		ids.reserve( count );
+		for ( std::size_t i{ 0 }; i < count; ++i )
+		{
+			ids.emplace_back( random() % accounts * 0x9E3779B97F4A7C15ULL, 0x42ULL );
+		}
+
+		return ids;
+	}
+
+	//----------------------------------------------
+	// Aggregation by price level
+	//----------------------------------------------
+
+	static void BM_FlatHashMapAggregatePrices( ::benchmark::State& state )
+	{
+		const auto prices{ makePrices( 1UL << 16, static_cast<std::size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			DecimalFlatMap<std::int64_t> volumes;
+			for ( const auto& price : prices )
+			{
+				++volumes[price];
+			}
+			::benchmark::DoNotOptimize( volumes.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( prices.size() ) );
+	}
+
+	static void BM_UnorderedMapAggregatePrices( ::benchmark::State& state )
+	{
+		const auto prices{ makePrices( 1UL << 16, static_cast<std::size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			std::unordered_map<Decimal, std::int64_t> volumes;
+			for ( const auto& price : prices )
+			{
+				++volumes[price];
+			}
+			::benchmark::DoNotOptimize( volumes.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( prices.size() ) );
+	}
+
+	//----------------------------------------------
+	// Aggregation by account ID
+	//----------------------------------------------
+
+	static void BM_FlatHashMapAggregateAccounts( ::benchmark::State& state )
+	{
+		const auto accounts{ makeAccounts( 1UL << 16, static_cast<std::size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			Int128FlatMap<std::int64_t> counts;
+			for ( const auto& account : accounts )
+			{
+				++counts[account];
+			}
+			::benchmark::DoNotOptimize( counts.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( accounts.size() ) );
+	}
+
+	static void BM_UnorderedMapAggregateAccounts( ::benchmark::State& state )
+	{
+		const auto accounts{ makeAccounts( 1UL << 16, static_cast<std::size_t>( state.range( 0 ) ) ) };
+
+		for ( auto _ : state )
+		{
+			std::unordered_map<Int128, std::int64_t> counts;
+			for ( const auto& account : accounts )
+			{
+				++counts[account];
+			}
+			::benchmark::DoNotOptimize( counts.size() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( accounts.size() ) );
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	static void BM_FlatHashMapFindPrices( ::benchmark::State& state )
+	{
+		const auto prices{ makePrices( 1UL << 16, 4096 ) };
+		DecimalFlatMap<std::int64_t> volumes;
+		for ( const auto& price : prices )
+		{
+			++volumes[price];
+		}
+
+		for ( auto _ : state )
+		{
+			std::int64_t total{ 0 };
+			for ( const auto& price : prices )
+			{
+				total += *volumes.find( price );
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( prices.size() ) );
+	}
+
+	static void BM_UnorderedMapFindPrices( ::benchmark::State& state )
+	{
+		const auto prices{ makePrices( 1UL << 16, 4096 ) };
+		std::unordered_map<Decimal, std::int64_t> volumes;
+		for ( const auto& price : prices )
+		{
+			++volumes[price];
+		}
+
+		for ( auto _ : state )
+		{
+			std::int64_t total{ 0 };
+			for ( const auto& price : prices )
+			{
+				total += volumes.find( price )->second;
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( prices.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	// Argument: number of distinct keys
+	BENCHMARK( BM_FlatHashMapAggregatePrices )->Arg( 256 )->Arg( 16384 );
+	BENCHMARK( BM_UnorderedMapAggregatePrices )->Arg( 256 )->Arg( 16384 );
+	BENCHMARK( BM_FlatHashMapAggregateAccounts )->Arg( 256 )->Arg( 16384 );
+	BENCHMARK( BM_UnorderedMapAggregateAccounts )->Arg( 256 )->Arg( 16384 );
+
+	BENCHMARK( BM_FlatHashMapFindPrices );
+	BENCHMARK( BM_UnorderedMapFindPrices );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+/**
+ * @file BM_IeeeDecimal128.cpp
+ * @brief Benchmark decimal128 BID/DPD transcoding against a string round trip
+ */
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/IeeeDecimal128.h>
+
+namespace nfx::datatypes::benchmark
+{
+	//=====================================================================
+	// IeeeDecimal128 benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Single value
+	//----------------------------------------------
+
+	static void BM_IeeeDecimal128Encode( ::benchmark::State& state )
+	{
+		const auto encoding{ static_cast<IeeeDecimal128::Encoding>( state.range( 0 ) ) };
+		Decimal value{ "-12345678901234567890.123456789" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			auto result{ IeeeDecimal128::fromDecimal( value, encoding ) };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_IeeeDecimal128Decode( ::benchmark::State& state )
+	{
+		const auto encoding{ static_cast<IeeeDecimal128::Encoding>( state.range( 0 ) ) };
+		auto value{ IeeeDecimal128::fromDecimal( Decimal{ "-12345678901234567890.123456789" }, encoding ) };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			Decimal result{ value.toDecimal( encoding ) };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_IeeeDecimal128StringRoundTrip( ::benchmark::State& state )
+	{
+		Decimal value{ "-12345678901234567890.123456789" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			Decimal result{ Decimal::parse( value.toString() ) };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	//----------------------------------------------
+	// Bulk conversion
+	//----------------------------------------------
+
+	static void BM_IeeeDecimal128FromDecimalsSpan( ::benchmark::State& state )
+	{
+		const auto encoding{ static_cast<IeeeDecimal128::Encoding>( state.range( 0 ) ) };
+		std::vector<Decimal> source( 1024, Decimal{ "101.25" } );
+		std::vector<IeeeDecimal128> destination( source.size() );
+
+		for ( auto _ : state )
+		{
+			IeeeDecimal128::fromDecimals( source, destination, encoding );
+			::benchmark::DoNotOptimize( destination.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( source.size() ) );
+	}
+
+	static void BM_IeeeDecimal128ToDecimalsSpan( ::benchmark::State& state )
+	{
+		const auto encoding{ static_cast<IeeeDecimal128::Encoding>( state.range( 0 ) ) };
+		std::vector<IeeeDecimal128> source( 1024, IeeeDecimal128::fromDecimal( Decimal{ "101.25" }, encoding ) );
+		std::vector<Decimal> destination( source.size() );
+
+		for ( auto _ : state )
+		{
+			IeeeDecimal128::toDecimals( source, destination, encoding );
+			::benchmark::DoNotOptimize( destination.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( source.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	// Argument: 0 = BID, 1 = DPD
+	BENCHMARK( BM_IeeeDecimal128Encode )->Arg( 0 )->Arg( 1 );
+	BENCHMARK( BM_IeeeDecimal128Decode )->Arg( 0 )->Arg( 1 );
+	BENCHMARK( BM_IeeeDecimal128StringRoundTrip );
+
+	BENCHMARK( BM_IeeeDecimal128FromDecimalsSpan )->Arg( 0 )->Arg( 1 );
+	BENCHMARK( BM_IeeeDecimal128ToDecimalsSpan )->Arg( 0 )->Arg( 1 );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
@@ -515,6 +515,21 @@ namespace nfx::datatypes::benchmark
 		}
 	}
 
+	//----------------------------------------------
+	// Hashing
+	//----------------------------------------------
+
+	static void BM_Int128Hash( ::benchmark::State& state )
+	{
+		Int128 value{ 0x0AB54A98CEB1F0D2ULL, 0x0173DC35270122E8ULL };
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			std::uint64_t result{ value.hash() };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
 	//----------------------------------------------
 	// Mathematical operations
 	//----------------------------------------------
@@ -627,6 +642,12 @@ namespace nfx::datatypes::benchmark
 	BENCHMARK( BM_Int128IsNegative );
 	BENCHMARK( BM_Int128IsNegativePositive );
 
+	//----------------------------------------------
+	// Hashing
+	//----------------------------------------------
+
+	BENCHMARK( BM_Int128Hash );
+
 	//----------------------------------------------
 	// Mathematical operations
 	//----------------------------------------------
@@ -0,0 +1,165 @@
+/**
+ * @file BM_Int128Kernels.cpp
+ * @brief Benchmark the Int128 span kernels against loops over the scalar operators
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Int128.h>
+#include <nfx/datatypes/Int128Kernels.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		std::vector<Int128> balances( std::size_t count, std::uint64_t seed )
+		{
+			std::mt19937_64 engine{ seed };
+			std::vector<Int128> values;
+			values.reserve( count );
+			for ( std::size_t i{ 0 }; i < count; ++i )
+			{
+				values.emplace_back( engine(), engine() % 1024 );
+			}
+
+			return values;
+		}
+	} // namespace
+
+	//=====================================================================
+	// Int128Kernels benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Element-wise arithmetic
+	//----------------------------------------------
+
+	static void BM_Int128AddLoop( ::benchmark::State& state )
+	{
+		const auto left{ balances( static_cast<std::size_t>( state.range( 0 ) ), 1 ) };
+		const auto right{ balances( left.size(), 2 ) };
+		std::vector<Int128> result( left.size() );
+
+		for ( auto _ : state )
+		{
+			for ( std::size_t i{ 0 }; i < left.size(); ++i )
+			{
+				result[i] = left[i] + right[i];
+			}
+			::benchmark::DoNotOptimize( result.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Int128KernelsAdd( ::benchmark::State& state )
+	{
+		const auto left{ balances( static_cast<std::size_t>( state.range( 0 ) ), 1 ) };
+		const auto right{ balances( left.size(), 2 ) };
+		std::vector<Int128> result( left.size() );
+
+		for ( auto _ : state )
+		{
+			Int128Kernels::add( left, right, result );
+			::benchmark::DoNotOptimize( result.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	static void BM_Int128LessThanLoop( ::benchmark::State& state )
+	{
+		const auto left{ balances( static_cast<std::size_t>( state.range( 0 ) ), 1 ) };
+		const auto right{ balances( left.size(), 2 ) };
+		std::vector<std::uint64_t> mask( ( left.size() + 63 ) / 64 );
+
+		for ( auto _ : state )
+		{
+			std::fill( mask.begin(), mask.end(), 0ULL );
+			for ( std::size_t i{ 0 }; i < left.size(); ++i )
+			{
+				mask[i / 64] |= static_cast<std::uint64_t>( left[i] < right[i] ) << ( i % 64 );
+			}
+			::benchmark::DoNotOptimize( mask.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Int128KernelsLessThan( ::benchmark::State& state )
+	{
+		const auto left{ balances( static_cast<std::size_t>( state.range( 0 ) ), 1 ) };
+		const auto right{ balances( left.size(), 2 ) };
+		std::vector<std::uint64_t> mask( ( left.size() + 63 ) / 64 );
+
+		for ( auto _ : state )
+		{
+			Int128Kernels::lessThan( left, right, mask );
+			::benchmark::DoNotOptimize( mask.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	//----------------------------------------------
+	// Reduction
+	//----------------------------------------------
+
+	static void BM_Int128SumLoop( ::benchmark::State& state )
+	{
+		const auto values{ balances( static_cast<std::size_t>( state.range( 0 ) ), 1 ) };
+
+		for ( auto _ : state )
+		{
+			ArithmeticStatus status{ ArithmeticStatus::None };
+			Int128 total{ 0 };
+			for ( const Int128& value : values )
+			{
+				total = Int128::add( total, value, status );
+			}
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Int128KernelsSum( ::benchmark::State& state )
+	{
+		const auto values{ balances( static_cast<std::size_t>( state.range( 0 ) ), 1 ) };
+
+		for ( auto _ : state )
+		{
+			ArithmeticStatus status{ ArithmeticStatus::None };
+			Int128 total{ Int128Kernels::sum( values, status ) };
+			::benchmark::DoNotOptimize( total );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	// Argument: span length (cache resident, then memory bound)
+	BENCHMARK( BM_Int128AddLoop )->Arg( 4096 )->Arg( 1 << 20 );
+	BENCHMARK( BM_Int128KernelsAdd )->Arg( 4096 )->Arg( 1 << 20 );
+	BENCHMARK( BM_Int128LessThanLoop )->Arg( 4096 )->Arg( 1 << 20 );
+	BENCHMARK( BM_Int128KernelsLessThan )->Arg( 4096 )->Arg( 1 << 20 );
+	BENCHMARK( BM_Int128SumLoop )->Arg( 4096 )->Arg( 1 << 20 );
+	BENCHMARK( BM_Int128KernelsSum )->Arg( 4096 )->Arg( 1 << 20 );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
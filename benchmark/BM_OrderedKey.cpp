@@ -0,0 +1,167 @@
+/**
+ * @file BM_OrderedKey.cpp
+ * @brief Benchmark memcmp-comparable key encoding against a string round trip
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/Int128.h>
+#include <nfx/datatypes/OrderedKey.h>
+
+namespace nfx::datatypes::benchmark
+{
+	//=====================================================================
+	// OrderedKey benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Single value
+	//----------------------------------------------
+
+	static void BM_OrderedKeyEncodeDecimal( ::benchmark::State& state )
+	{
+		Decimal value{ "-12345678901234567890.123456789" };
+		std::array<std::uint8_t, 16> key{};
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			auto size{ OrderedKey::encode( value, key ) };
+			::benchmark::DoNotOptimize( size );
+			::benchmark::DoNotOptimize( key.data() );
+		}
+	}
+
+	static void BM_OrderedKeyDecodeDecimal( ::benchmark::State& state )
+	{
+		std::array<std::uint8_t, 16> key{};
+		(void)OrderedKey::encode( Decimal{ "-12345678901234567890.123456789" }, key );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( key.data() );
+			Decimal result{ OrderedKey::decodeDecimal( key ) };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_OrderedKeyEncodeInt128( ::benchmark::State& state )
+	{
+		Int128 value{ 0x0AB54A98CEB1F0D2ULL, 0x0173DC35270122E8ULL };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			auto key{ OrderedKey::encode( value ) };
+			::benchmark::DoNotOptimize( key );
+		}
+	}
+
+	static void BM_OrderedKeyStringRoundTrip( ::benchmark::State& state )
+	{
+		Decimal value{ "-12345678901234567890.123456789" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( value );
+			Decimal result{ Decimal::parse( value.toString() ) };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	//----------------------------------------------
+	// Key comparison
+	//----------------------------------------------
+
+	static void BM_OrderedKeyCompareKeys( ::benchmark::State& state )
+	{
+		std::array<std::uint8_t, 16> a{};
+		std::array<std::uint8_t, 16> b{};
+		const std::size_t sizeA{ OrderedKey::encode( Decimal{ "101.25" }, a ) };
+		const std::size_t sizeB{ OrderedKey::encode( Decimal{ "101.2501" }, b ) };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a.data() );
+			::benchmark::DoNotOptimize( b.data() );
+			int result{ std::memcmp( a.data(), b.data(), std::min( sizeA, sizeB ) ) };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_OrderedKeyCompareDecimals( ::benchmark::State& state )
+	{
+		Decimal a{ "101.25" };
+		Decimal b{ "101.2501" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( a );
+			::benchmark::DoNotOptimize( b );
+			bool result{ a < b };
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	//----------------------------------------------
+	// Bulk conversion
+	//----------------------------------------------
+
+	static void BM_OrderedKeyEncodeDecimalsSpan( ::benchmark::State& state )
+	{
+		std::vector<Decimal> source( 1024, Decimal{ "101.25" } );
+		std::vector<std::uint8_t> destination( source.size() * constants::ORDERED_KEY_DECIMAL_MAX_SIZE );
+
+		for ( auto _ : state )
+		{
+			auto written{ OrderedKey::encode( source, destination ) };
+			::benchmark::DoNotOptimize( written );
+			::benchmark::DoNotOptimize( destination.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( source.size() ) );
+	}
+
+	static void BM_OrderedKeyDecodeDecimalsSpan( ::benchmark::State& state )
+	{
+		std::vector<Decimal> source( 1024, Decimal{ "101.25" } );
+		std::vector<std::uint8_t> keys( source.size() * constants::ORDERED_KEY_DECIMAL_MAX_SIZE );
+		const std::size_t written{ OrderedKey::encode( source, keys ) };
+		std::vector<Decimal> destination( source.size() );
+
+		for ( auto _ : state )
+		{
+			auto consumed{ OrderedKey::decode( std::span{ keys }.first( written ), destination ) };
+			::benchmark::DoNotOptimize( consumed );
+			::benchmark::DoNotOptimize( destination.data() );
+			::benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( source.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_OrderedKeyEncodeDecimal );
+	BENCHMARK( BM_OrderedKeyDecodeDecimal );
+	BENCHMARK( BM_OrderedKeyEncodeInt128 );
+	BENCHMARK( BM_OrderedKeyStringRoundTrip );
+
+	BENCHMARK( BM_OrderedKeyCompareKeys );
+	BENCHMARK( BM_OrderedKeyCompareDecimals );
+
+	BENCHMARK( BM_OrderedKeyEncodeDecimalsSpan );
+	BENCHMARK( BM_OrderedKeyDecodeDecimalsSpan );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,116 @@
+/**
+ * @file BM_ParallelReduce.cpp
+ * @brief Benchmark multi-threaded Decimal and Int128 reductions by thread count
+ */
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/ArithmeticStatus.h>
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/Int128.h>
+#include <nfx/datatypes/ParallelReduce.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		/** @brief Number of values reduced per iteration */
+		constexpr std::size_t VALUE_COUNT{ 1UL << 22 };
+
+		/** @brief Prices with 2-4 fractional digits and random signs */
+		std::vector<Decimal> makePrices()
+		{
+			std::mt19937_64 engine{ 40 };
+			std::vector<Decimal> values( VALUE_COUNT );
+			for ( auto& value : values )
+			{
+				const Decimal cents{ static_cast<std::int64_t>( engine() % 100000000 ) - 50000000 };
+				value = ( cents / Decimal{ 100 } ).rescale( static_cast<std::int32_t>( 2 + engine() % 3 ) );
+			}
+
+			return values;
+		}
+	} // namespace
+
+	//=====================================================================
+	// ParallelReduce benchmark suite
+	//=====================================================================
+
+	static void BM_ParallelSumDecimal( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> values{ makePrices() };
+		const auto threads{ static_cast<std::size_t>( state.range( 0 ) ) };
+
+		for ( auto _ : state )
+		{
+			Decimal result{ ParallelReduce::parallelSum( values, threads ) };
+			::benchmark::DoNotOptimize( result );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_ParallelDotDecimal( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> values{ makePrices() };
+		const std::vector<Decimal> weights( values.rbegin(), values.rend() );
+		const auto threads{ static_cast<std::size_t>( state.range( 0 ) ) };
+
+		for ( auto _ : state )
+		{
+			Decimal result{ ParallelReduce::parallelDot( values, weights, threads ) };
+			::benchmark::DoNotOptimize( result );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_ParallelMinMaxDecimal( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> values{ makePrices() };
+		const auto threads{ static_cast<std::size_t>( state.range( 0 ) ) };
+
+		for ( auto _ : state )
+		{
+			auto result{ ParallelReduce::parallelMinMax( values, threads ) };
+			::benchmark::DoNotOptimize( result );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	static void BM_ParallelSumInt128( ::benchmark::State& state )
+	{
+		std::mt19937_64 engine{ 41 };
+		std::vector<Int128> values( VALUE_COUNT );
+		for ( auto& value : values )
+		{
+			value = Int128{ static_cast<std::int64_t>( engine() ) };
+		}
+		const auto threads{ static_cast<std::size_t>( state.range( 0 ) ) };
+
+		for ( auto _ : state )
+		{
+			ArithmeticStatus status{ ArithmeticStatus::None };
+			Int128 result{ ParallelReduce::parallelSum( values, status, threads ) };
+			::benchmark::DoNotOptimize( result );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( values.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	// Argument: thread count
+	BENCHMARK( BM_ParallelSumDecimal )->Arg( 1 )->Arg( 2 )->Arg( 4 )->Arg( 8 )->UseRealTime();
+	BENCHMARK( BM_ParallelDotDecimal )->Arg( 1 )->Arg( 2 )->Arg( 4 )->Arg( 8 )->UseRealTime();
+	BENCHMARK( BM_ParallelMinMaxDecimal )->Arg( 1 )->Arg( 2 )->Arg( 4 )->Arg( 8 )->UseRealTime();
+	BENCHMARK( BM_ParallelSumInt128 )->Arg( 1 )->Arg( 2 )->Arg( 4 )->Arg( 8 )->UseRealTime();
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
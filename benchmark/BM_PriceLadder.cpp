@@ -0,0 +1,157 @@
+/**
+ * @file BM_PriceLadder.cpp
+ * @brief Benchmark tick-indexed price levels against std::map keyed by Decimal
+ */
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/PriceLadder.h>
+
+namespace nfx::datatypes::benchmark
+{
+	//=====================================================================
+	// PriceLadder benchmark suite
+	//=====================================================================
+
+	struct Level
+	{
+		std::int64_t quantity{ 0 };
+	};
+
+	/**
+	 * @brief Order prices within 500 ticks of 100.00
+	 */
+	static std::vector<Decimal> makeOrderPrices()
+	{
+		std::mt19937_64 random{ 50 };
+		std::vector<Decimal> prices;
+		for ( std::size_t i{ 0 }; i < 4096; ++i )
+		{
+			prices.push_back( Decimal{ "100" } + Decimal{ static_cast<std::int64_t>( random() % 1000U ) - 500 } * Decimal{ "0.01" } );
+		}
+
+		return prices;
+	}
+
+	//----------------------------------------------
+	// Price mapping
+	//----------------------------------------------
+
+	static void BM_PriceGridTickOf( ::benchmark::State& state )
+	{
+		const PriceGrid grid{ Decimal{ "0.01" }, Decimal{ "100" } };
+		Decimal price{ "101.25" };
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( price );
+			std::int64_t tick{ grid.tickOf( price ) };
+			::benchmark::DoNotOptimize( tick );
+		}
+	}
+
+	//----------------------------------------------
+	// Level updates
+	//----------------------------------------------
+
+	static void BM_PriceLadderUpdate( ::benchmark::State& state )
+	{
+		const auto prices{ makeOrderPrices() };
+		PriceLadder<Level> book{ PriceLadder<Level>::Side::Bid, Decimal{ "0.01" }, Decimal{ "100" }, 2048 };
+
+		for ( auto _ : state )
+		{
+			for ( const auto& price : prices )
+			{
+				book[price].quantity += 100;
+			}
+			::benchmark::DoNotOptimize( book.best().quantity );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( prices.size() ) );
+	}
+
+	static void BM_OrderedMapUpdate( ::benchmark::State& state )
+	{
+		const auto prices{ makeOrderPrices() };
+		std::map<Decimal, Level> book;
+
+		for ( auto _ : state )
+		{
+			for ( const auto& price : prices )
+			{
+				book[price].quantity += 100;
+			}
+			::benchmark::DoNotOptimize( book.rbegin()->second.quantity );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( prices.size() ) );
+	}
+
+	//----------------------------------------------
+	// Level churn at the top of book
+	//----------------------------------------------
+
+	static void BM_PriceLadderInsertErase( ::benchmark::State& state )
+	{
+		const auto prices{ makeOrderPrices() };
+		PriceLadder<Level> book{ PriceLadder<Level>::Side::Bid, Decimal{ "0.01" }, Decimal{ "100" }, 2048 };
+		for ( const auto& price : prices )
+		{
+			book[price].quantity = 1;
+		}
+
+		for ( auto _ : state )
+		{
+			for ( const auto& price : prices )
+			{
+				(void)book.erase( price );
+				book[price].quantity = 1;
+			}
+			::benchmark::DoNotOptimize( book.bestTick() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( prices.size() ) );
+	}
+
+	static void BM_OrderedMapInsertErase( ::benchmark::State& state )
+	{
+		const auto prices{ makeOrderPrices() };
+		std::map<Decimal, Level> book;
+		for ( const auto& price : prices )
+		{
+			book[price].quantity = 1;
+		}
+
+		for ( auto _ : state )
+		{
+			for ( const auto& price : prices )
+			{
+				book.erase( price );
+				book[price].quantity = 1;
+			}
+			::benchmark::DoNotOptimize( book.rbegin()->first );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * static_cast<std::int64_t>( prices.size() ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	BENCHMARK( BM_PriceGridTickOf );
+
+	BENCHMARK( BM_PriceLadderUpdate );
+	BENCHMARK( BM_OrderedMapUpdate );
+
+	BENCHMARK( BM_PriceLadderInsertErase );
+	BENCHMARK( BM_OrderedMapInsertErase );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
@@ -0,0 +1,158 @@
+/**
+ * @file BM_RadixSort.cpp
+ * @brief Benchmark the radix sorts against std::sort with the comparison operators
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/Int128.h>
+#include <nfx/datatypes/RadixSort.h>
+
+namespace nfx::datatypes::benchmark
+{
+	namespace
+	{
+		/** @brief Prices with 2-4 fractional digits */
+		std::vector<Decimal> prices( std::size_t count )
+		{
+			std::mt19937_64 engine{ 42 };
+			std::vector<Decimal> values( count );
+			for ( auto& value : values )
+			{
+				const Decimal cents{ static_cast<std::int64_t>( engine() % 100000000 ) };
+				value = ( cents / Decimal{ 100 } ).rescale( static_cast<std::int32_t>( 2 + engine() % 3 ) );
+			}
+
+			return values;
+		}
+
+		std::vector<Int128> balances( std::size_t count )
+		{
+			std::mt19937_64 engine{ 43 };
+			std::vector<Int128> values( count );
+			for ( auto& value : values )
+			{
+				value = Int128{ static_cast<std::int64_t>( engine() ) };
+			}
+
+			return values;
+		}
+	} // namespace
+
+	//=====================================================================
+	// RadixSort benchmark suite
+	//=====================================================================
+
+	//----------------------------------------------
+	// Decimal
+	//----------------------------------------------
+
+	static void BM_DecimalStdSort( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> source{ prices( static_cast<std::size_t>( state.range( 0 ) ) ) };
+		std::vector<Decimal> values;
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			values = source;
+			state.ResumeTiming();
+
+			std::sort( values.begin(), values.end() );
+			::benchmark::DoNotOptimize( values.data() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_DecimalRadixSort( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> source{ prices( static_cast<std::size_t>( state.range( 0 ) ) ) };
+		const auto threads{ static_cast<std::size_t>( state.range( 1 ) ) };
+		std::vector<Decimal> values;
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			values = source;
+			state.ResumeTiming();
+
+			RadixSort::radixSort( std::span{ values }, threads );
+			::benchmark::DoNotOptimize( values.data() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_DecimalArgsort( ::benchmark::State& state )
+	{
+		const std::vector<Decimal> values{ prices( static_cast<std::size_t>( state.range( 0 ) ) ) };
+		std::vector<std::size_t> indices( values.size() );
+
+		for ( auto _ : state )
+		{
+			RadixSort::argsort( std::span<const Decimal>{ values }, indices );
+			::benchmark::DoNotOptimize( indices.data() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	//----------------------------------------------
+	// Int128
+	//----------------------------------------------
+
+	static void BM_Int128StdSort( ::benchmark::State& state )
+	{
+		const std::vector<Int128> source{ balances( static_cast<std::size_t>( state.range( 0 ) ) ) };
+		std::vector<Int128> values;
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			values = source;
+			state.ResumeTiming();
+
+			std::sort( values.begin(), values.end() );
+			::benchmark::DoNotOptimize( values.data() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	static void BM_Int128RadixSort( ::benchmark::State& state )
+	{
+		const std::vector<Int128> source{ balances( static_cast<std::size_t>( state.range( 0 ) ) ) };
+		std::vector<Int128> values;
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			values = source;
+			state.ResumeTiming();
+
+			RadixSort::radixSort( std::span{ values } );
+			::benchmark::DoNotOptimize( values.data() );
+		}
+
+		state.SetItemsProcessed( static_cast<std::int64_t>( state.iterations() ) * state.range( 0 ) );
+	}
+
+	//=====================================================================
+	// Benchmarks registration
+	//=====================================================================
+
+	// Arguments: value count[, thread count]
+	BENCHMARK( BM_DecimalStdSort )->Arg( 1 << 16 )->Arg( 1 << 22 )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_DecimalRadixSort )->Args( { 1 << 16, 1 } )->Args( { 1 << 22, 1 } )->Args( { 1 << 22, 4 } )->Unit( ::benchmark::kMillisecond )->UseRealTime();
+	BENCHMARK( BM_DecimalArgsort )->Arg( 1 << 16 )->Arg( 1 << 22 )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_Int128StdSort )->Arg( 1 << 16 )->Arg( 1 << 22 )->Unit( ::benchmark::kMillisecond );
+	BENCHMARK( BM_Int128RadixSort )->Arg( 1 << 16 )->Arg( 1 << 22 )->Unit( ::benchmark::kMillisecond );
+} // namespace nfx::datatypes::benchmark
+
+BENCHMARK_MAIN();
@@ -14,6 +14,13 @@ set(CMAKE_REQUIRED_QUIET    ON         )
 set(CMAKE_MESSAGE_LOG_LEVEL VERBOSE    ) # [ERROR, WARNING, NOTICE, STATUS, VERBOSE, DEBUG]
 set(CMAKE_FIND_QUIETLY      ON         )
 
+#----------------------------------------------
+# System dependencies
+#----------------------------------------------
+
+# --- Threads (ParallelReduce) ---
+find_package(Threads REQUIRED)
+
 #----------------------------------------------
 # FetchContent dependencies
 #----------------------------------------------
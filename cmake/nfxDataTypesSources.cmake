@@ -11,18 +11,63 @@ set(PRIVATE_HEADERS)
 set(PRIVATE_SOURCES)
 
 list(APPEND PUBLIC_HEADERS
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/ArithmeticStatus.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/AtomicDecimal.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/AtomicInt128.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/BatchFormatter.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/BatchParser.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/ColumnFile.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/ConcurrentDecimalAdder.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/CpuDispatch.h
 	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/Decimal.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/Decimal38.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/Decimal64.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/DecimalAccumulator.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/DecimalColumn.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/DecimalFilter.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/DecimalView.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/FixedDecimal.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/FlatHashMap.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/IeeeDecimal128.h
 	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/Int128.h
-
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/Int128Kernels.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/OrderedKey.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/ParallelReduce.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/PriceLadder.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/datatypes/RadixSort.h
+
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/AtomicDecimal.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/AtomicInt128.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/ConcurrentDecimalAdder.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/Constants.h
 	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/Decimal.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/Decimal38.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/Decimal64.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/DecimalAccumulator.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/DecimalColumn.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/DecimalView.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/FixedDecimal.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/FlatHashMap.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/IeeeDecimal128.inl
 	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/Int128.inl
-)
-list(APPEND PRIVATE_HEADERS
-	${NFX_DATATYPES_SOURCE_DIR}/Constants.h
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/OrderedKey.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/PriceLadder.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/RadixSort.inl
+	${NFX_DATATYPES_INCLUDE_DIR}/nfx/detail/datatypes/UInt256.h
 )
 list(APPEND PRIVATE_SOURCES
+	${NFX_DATATYPES_SOURCE_DIR}/BatchFormatter.cpp
+	${NFX_DATATYPES_SOURCE_DIR}/BatchParser.cpp
+	${NFX_DATATYPES_SOURCE_DIR}/ColumnFile.cpp
+	${NFX_DATATYPES_SOURCE_DIR}/ConcurrentDecimalAdder.cpp
+	${NFX_DATATYPES_SOURCE_DIR}/CpuDispatch.cpp
 	${NFX_DATATYPES_SOURCE_DIR}/Decimal.cpp
+	${NFX_DATATYPES_SOURCE_DIR}/Decimal38.cpp
+	${NFX_DATATYPES_SOURCE_DIR}/DecimalFilter.cpp
 	${NFX_DATATYPES_SOURCE_DIR}/Int128.cpp
+	${NFX_DATATYPES_SOURCE_DIR}/Int128Kernels.cpp
+	${NFX_DATATYPES_SOURCE_DIR}/ParallelReduce.cpp
+	${NFX_DATATYPES_SOURCE_DIR}/RadixSort.cpp
 )
 
 #----------------------------------------------
@@ -79,6 +124,12 @@ function(configure_target target_name)
 			${NFX_DATATYPES_SOURCE_DIR}
 	)
 
+	# --- Link libraries ---
+	target_link_libraries(${target_name}
+		PRIVATE
+			Threads::Threads
+	)
+
 	# --- Properties ---
 	set_target_properties(${target_name} PROPERTIES
 		CXX_STANDARD 20
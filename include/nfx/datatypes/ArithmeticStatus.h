@@ -0,0 +1,114 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ArithmeticStatus.h
+ * @brief Sticky status flags for the non-throwing arithmetic API
+ * @details The status overloads of Int128 and Decimal arithmetic (add, subtract, multiply,
+ *          divide, remainder) never throw. Instead each call ORs the conditions it met into
+ *          a caller-owned ArithmeticStatus, in the manner of IEEE 754 exception flags: flags
+ *          are only ever set, never cleared, so a batch kernel can run a whole block with one
+ *          status variable and check it once afterwards.
+ *
+ *          Usage:
+ *          @code
+ *          ArithmeticStatus status{ ArithmeticStatus::None };
+ *          for ( std::size_t i{ 0 }; i < prices.size(); ++i )
+ *          {
+ *              notionals[i] = Decimal::multiply( prices[i], quantities[i], status );
+ *          }
+ *
+ *          if ( hasStatus( status, ArithmeticStatus::Overflow ) )
+ *          {
+ *              // at least one element was clamped
+ *          }
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// ArithmeticStatus flags
+	//=====================================================================
+
+	/**
+	 * @brief Conditions raised by the non-throwing arithmetic API (bit flags)
+	 */
+	enum class ArithmeticStatus : std::uint8_t
+	{
+		None = 0,				 ///< No condition raised
+		Overflow = 1U << 0,		 ///< Result out of range, clamped to the nearest representable limit
+		DivisionByZero = 1U << 1, ///< Divisor was zero, result is zero
+		Inexact = 1U << 2		 ///< Result was rounded (digits or a remainder were discarded)
+	};
+
+	/**
+	 * @brief Combine status flags
+	 * @param left First set of flags
+	 * @param right Second set of flags
+	 * @return Union of both sets
+	 */
+	inline constexpr ArithmeticStatus operator|( ArithmeticStatus left, ArithmeticStatus right ) noexcept
+	{
+		return static_cast<ArithmeticStatus>( static_cast<std::uint8_t>( left ) | static_cast<std::uint8_t>( right ) );
+	}
+
+	/**
+	 * @brief Intersect status flags
+	 * @param left First set of flags
+	 * @param right Second set of flags
+	 * @return Flags present in both sets
+	 */
+	inline constexpr ArithmeticStatus operator&( ArithmeticStatus left, ArithmeticStatus right ) noexcept
+	{
+		return static_cast<ArithmeticStatus>( static_cast<std::uint8_t>( left ) & static_cast<std::uint8_t>( right ) );
+	}
+
+	/**
+	 * @brief Raise status flags (sticky)
+	 * @param status Flags to update
+	 * @param raised Flags to add
+	 * @return Reference to status
+	 */
+	inline constexpr ArithmeticStatus& operator|=( ArithmeticStatus& status, ArithmeticStatus raised ) noexcept
+	{
+		status = status | raised;
+		return status;
+	}
+
+	/**
+	 * @brief Check whether any of the given flags is raised
+	 * @param status Accumulated flags
+	 * @param flags Flags to test
+	 * @return true if status and flags have a flag in common
+	 */
+	[[nodiscard]] inline constexpr bool hasStatus( ArithmeticStatus status, ArithmeticStatus flags ) noexcept
+	{
+		return ( status & flags ) != ArithmeticStatus::None;
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file AtomicDecimal.h
+ * @brief Lock-free atomic Decimal built on a 16-byte compare-and-swap
+ * @details AtomicDecimal stores the 16 bytes of a Decimal in the same aligned storage as
+ *          AtomicInt128 and shares its compare-and-swap primitive. fetchAdd() is a
+ *          compare-and-swap loop around Decimal addition: operands whose scales differ by
+ *          at most nine digits (the common case of accumulating prices and quantities) are
+ *          added in signed 128-bit arithmetic, everything else goes through Decimal::add.
+ *
+ *          Semantics:
+ *          - compareExchange() compares bit patterns, not numeric values: 1.5 and 1.50
+ *            have different scales and do not match
+ *          - fetchAdd() stores exactly the bits Decimal::add returns (normalized, so 1.5 + 0.5
+ *            stores 2, not 2.0), whichever path ran and however threads interleave
+ *          - fetchAdd() either throws (std::overflow_error) or reports through an
+ *            ArithmeticStatus; in both cases the stored value is left unchanged on overflow
+ *          - Every operation is sequentially consistent
+ *
+ *          Usage:
+ *          @code
+ *          AtomicDecimal notional;
+ *
+ *          // Any thread
+ *          notional.fetchAdd( fill.price * fill.quantity );
+ *
+ *          Decimal total{ notional.load() };
+ *          @endcode
+ */
+
+#pragma once
+
+#include "AtomicInt128.h"
+#include "Decimal.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// AtomicDecimal class
+	//=====================================================================
+
+	/**
+	 * @brief Decimal with lock-free atomic load, store, exchange, compare-exchange and add
+	 */
+	class AtomicDecimal final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor (zero)
+		 */
+		inline AtomicDecimal() noexcept;
+
+		/**
+		 * @brief Construct with an initial value (not an atomic operation)
+		 * @param value Initial value
+		 */
+		inline explicit AtomicDecimal( const Decimal& value ) noexcept;
+
+		AtomicDecimal( const AtomicDecimal& ) = delete;
+		AtomicDecimal& operator=( const AtomicDecimal& ) = delete;
+
+		//----------------------------------------------
+		// Atomic operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Read the value
+		 * @return Current value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Decimal load() const noexcept;
+
+		/**
+		 * @brief Replace the value
+		 * @param value New value
+		 */
+		inline void store( const Decimal& value ) noexcept;
+
+		/**
+		 * @brief Replace the value, returning the previous one
+		 * @param value New value
+		 * @return Previous value
+		 */
+		inline Decimal exchange( const Decimal& value ) noexcept;
+
+		/**
+		 * @brief Replace the value if its bits equal an expected value
+		 * @param expected Expected value; receives the current value on failure
+		 * @param desired New value
+		 * @return true if the value was replaced
+		 * @note Values with equal magnitude but different scale (1.5 and 1.50) do not match
+		 */
+		inline bool compareExchange( Decimal& expected, const Decimal& desired ) noexcept;
+
+		/**
+		 * @brief Add to the value
+		 * @param delta Value to add
+		 * @return Previous value
+		 * @throws std::overflow_error if the sum is out of range (the value is left unchanged)
+		 */
+		inline Decimal fetchAdd( const Decimal& delta );
+
+		/**
+		 * @brief Add to the value without throwing
+		 * @param delta Value to add
+		 * @param status Receives the flags raised by Decimal::add; on ArithmeticStatus::Overflow
+		 *               the value is left unchanged rather than clamped
+		 * @return Previous value
+		 */
+		inline Decimal fetchAdd( const Decimal& delta, ArithmeticStatus& status ) noexcept;
+
+		//----------------------------------------------
+		// Lock-freedom
+		//----------------------------------------------
+
+		/** @brief true when every AtomicDecimal is lock-free on this target */
+		static constexpr bool isAlwaysLockFree{ AtomicInt128::isAlwaysLockFree };
+
+		/**
+		 * @brief Check if operations on this object are lock-free
+		 * @return true if the 16-byte compare-and-swap is a single instruction
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isLockFree() const noexcept;
+
+	private:
+		/** @brief Decimal bytes */
+		mutable internal::AtomicWords m_words;
+	};
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/AtomicDecimal.inl"
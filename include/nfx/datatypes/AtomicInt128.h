@@ -0,0 +1,169 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file AtomicInt128.h
+ * @brief Lock-free atomic Int128 built on a 16-byte compare-and-swap
+ * @details std::atomic<Int128> falls back to a lock on most toolchains: GCC routes 16-byte
+ *          atomics through libatomic, and the storage is not guaranteed 16-byte alignment.
+ *          AtomicInt128 keeps its value in alignas(16) storage and issues the 16-byte
+ *          compare-and-swap directly:
+ *
+ *          - x86-64 (GCC, Clang): inline lock cmpxchg16b; lock-free
+ *          - Other targets: std::atomic_ref on the aligned storage, lock-free only where the
+ *            platform provides 16-byte atomics (see isLockFree())
+ *
+ *          Every operation is sequentially consistent. load() is itself a compare-and-swap
+ *          (cmpxchg16b is the only 16-byte atomic read x86-64 guarantees), so the object must
+ *          live in writable memory. fetchAdd() is one compare-and-swap loop and wraps like
+ *          Int128::operator+.
+ *
+ *          Usage:
+ *          @code
+ *          AtomicInt128 filledQuantity;
+ *
+ *          // Any thread
+ *          filledQuantity.fetchAdd( fill.quantity );
+ *
+ *          Int128 total{ filledQuantity.load() };
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		/**
+		 * @brief Two 64-bit words aligned for a 16-byte compare-and-swap
+		 */
+		struct alignas( 16 ) AtomicWords
+		{
+			/** @brief Bytes 0-7 */
+			std::uint64_t low;
+
+			/** @brief Bytes 8-15 */
+			std::uint64_t high;
+		};
+	} // namespace internal
+
+	//=====================================================================
+	// AtomicInt128 class
+	//=====================================================================
+
+	/**
+	 * @brief Int128 with lock-free atomic load, store, exchange, compare-exchange and add
+	 */
+	class AtomicInt128 final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor (zero)
+		 */
+		inline AtomicInt128() noexcept;
+
+		/**
+		 * @brief Construct with an initial value (not an atomic operation)
+		 * @param value Initial value
+		 */
+		inline explicit AtomicInt128( const Int128& value ) noexcept;
+
+		AtomicInt128( const AtomicInt128& ) = delete;
+		AtomicInt128& operator=( const AtomicInt128& ) = delete;
+
+		//----------------------------------------------
+		// Atomic operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Read the value
+		 * @return Current value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Int128 load() const noexcept;
+
+		/**
+		 * @brief Replace the value
+		 * @param value New value
+		 */
+		inline void store( const Int128& value ) noexcept;
+
+		/**
+		 * @brief Replace the value, returning the previous one
+		 * @param value New value
+		 * @return Previous value
+		 */
+		inline Int128 exchange( const Int128& value ) noexcept;
+
+		/**
+		 * @brief Replace the value if it equals an expected value
+		 * @param expected Expected value; receives the current value on failure
+		 * @param desired New value
+		 * @return true if the value was replaced
+		 */
+		inline bool compareExchange( Int128& expected, const Int128& desired ) noexcept;
+
+		/**
+		 * @brief Add to the value, wrapping modulo 2^128
+		 * @param delta Value to add
+		 * @return Previous value
+		 */
+		inline Int128 fetchAdd( const Int128& delta ) noexcept;
+
+		//----------------------------------------------
+		// Lock-freedom
+		//----------------------------------------------
+
+		/** @brief true when every AtomicInt128 is lock-free on this target */
+		static constexpr bool isAlwaysLockFree{
+#if ( defined( __x86_64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) ) )
+			true
+#else
+			false
+#endif
+		};
+
+		/**
+		 * @brief Check if operations on this object are lock-free
+		 * @return true if the 16-byte compare-and-swap is a single instruction
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isLockFree() const noexcept;
+
+	private:
+		/** @brief Value as two's complement words */
+		mutable internal::AtomicWords m_words;
+	};
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/AtomicInt128.inl"
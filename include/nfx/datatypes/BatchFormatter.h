@@ -0,0 +1,153 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BatchFormatter.h
+ * @brief Batch formatting of Decimal and Int128 values into one caller-supplied buffer
+ * @details BatchFormatter writes many values back to back into a single character buffer,
+ *          without allocating per value. Options select an optional delimiter (between values,
+ *          or after every value), and for Decimal a fixed number of fractional digits.
+ *
+ *          Output semantics:
+ *          - Without a fixed scale every value is written exactly as toString() would
+ *          - With a fixed scale, values with more fractional digits are rounded with the
+ *            configured rounding mode and values with fewer are padded with zeros
+ *          - Digits are produced two at a time from a 100-entry digit-pair table; magnitudes
+ *            wider than 64 bits are first split into 19-digit chunks
+ *          - The optional offsets output receives the start of every value plus the total
+ *            length; without a delimiter that is the layout BatchParser reads back
+ *
+ *          Usage:
+ *          @code
+ *          BatchFormatOptions options;
+ *          options.delimiter = '\n';
+ *          options.trailingDelimiter = true;
+ *          options.fixedScale = 2;
+ *
+ *          std::vector<char> text( BatchFormatter::maxDecimalOutputSize( prices.size(), options ) );
+ *          text.resize( BatchFormatter::formatDecimals( prices, text, {}, options ) );
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "Decimal.h"
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// BatchFormatOptions struct
+	//=====================================================================
+
+	/**
+	 * @brief Output options for BatchFormatter
+	 */
+	struct BatchFormatOptions
+	{
+		/** @brief Character written between values (none when empty) */
+		std::optional<char> delimiter{};
+
+		/** @brief Also write the delimiter after the last value (e.g. newline-terminated lines) */
+		bool trailingDelimiter{ false };
+
+		/** @brief Fractional digits written for every Decimal (0-28), or each value's own scale when empty; ignored for Int128 */
+		std::optional<std::uint8_t> fixedScale{};
+
+		/** @brief Rounding applied when fixedScale is below a value's scale */
+		Decimal::RoundingMode rounding{ Decimal::RoundingMode::ToNearest };
+	};
+
+	//=====================================================================
+	// BatchFormatter class
+	//=====================================================================
+
+	/**
+	 * @brief Formats many Decimal or Int128 values into one contiguous buffer in a single call
+	 */
+	class BatchFormatter final
+	{
+	public:
+		BatchFormatter() = delete;
+
+		//----------------------------------------------
+		// Output sizing
+		//----------------------------------------------
+
+		/**
+		 * @brief Get an output size large enough for any count Decimal values
+		 * @param count Number of values
+		 * @param options Output options
+		 * @return Upper bound of the bytes formatDecimals() writes
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static std::size_t maxDecimalOutputSize( std::size_t count, const BatchFormatOptions& options = {} ) noexcept;
+
+		/**
+		 * @brief Get an output size large enough for any count Int128 values
+		 * @param count Number of values
+		 * @param options Output options
+		 * @return Upper bound of the bytes formatInt128s() writes
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static std::size_t maxInt128OutputSize( std::size_t count, const BatchFormatOptions& options = {} ) noexcept;
+
+		//----------------------------------------------
+		// Formatting
+		//----------------------------------------------
+
+		/**
+		 * @brief Format Decimal values into a buffer
+		 * @param values Values to format
+		 * @param output Destination buffer (not null-terminated)
+		 * @param offsets Optional output of values.size() + 1 entries: the start of every value,
+		 *        then the total length; pass an empty span to skip
+		 * @param options Output options
+		 * @return Number of bytes written
+		 * @throws std::invalid_argument if output or offsets is too small, or fixedScale exceeds 28
+		 *         (values before the one that did not fit have been written)
+		 */
+		static std::size_t formatDecimals( std::span<const Decimal> values, std::span<char> output,
+			std::span<std::size_t> offsets = {}, const BatchFormatOptions& options = {} );
+
+		/**
+		 * @brief Format Int128 values into a buffer
+		 * @param values Values to format
+		 * @param output Destination buffer (not null-terminated)
+		 * @param offsets Optional output of values.size() + 1 entries: the start of every value,
+		 *        then the total length; pass an empty span to skip
+		 * @param options Output options (fixedScale and rounding are ignored)
+		 * @return Number of bytes written
+		 * @throws std::invalid_argument if output or offsets is too small
+		 *         (values before the one that did not fit have been written)
+		 */
+		static std::size_t formatInt128s( std::span<const Int128> values, std::span<char> output,
+			std::span<std::size_t> offsets = {}, const BatchFormatOptions& options = {} );
+	};
+} // namespace nfx::datatypes
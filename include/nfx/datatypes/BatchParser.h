@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BatchParser.h
+ * @brief Batch parsing of Decimal and Int128 fields from one contiguous text buffer
+ * @details BatchParser converts many numeric text fields in a single call, as produced by a
+ *          CSV or fixed-layout reader. Fields are located either by an offsets array or by a
+ *          single-character delimiter:
+ *
+ *          - Offsets: field i spans buffer[offsets[i], offsets[i + 1]), so n fields need n + 1
+ *            offsets (the same layout as an Arrow string column)
+ *          - Delimiter: fields are separated by the delimiter; a trailing delimiter ends the
+ *            last field instead of opening an empty one, and an empty buffer holds no fields
+ *
+ *          Every field is accepted or rejected exactly as Decimal::tryParse / Int128::tryParse
+ *          would, and accepted values are bit-identical. Rejected fields are written as zero
+ *          (or appended as null to a DecimalColumn) and flagged in an error bitmap that uses
+ *          the DecimalColumn validity layout: bit i % 64 of word i / 64, set when field i failed.
+ *
+ *          Fields of up to 28 digits (32 for Int128) take a fast path that classifies and
+ *          converts eight characters at a time inside a 64-bit register (SWAR) and strips
+ *          trailing fractional zeros from the text instead of dividing the mantissa. Longer
+ *          or malformed fields fall back to the scalar tryParse.
+ *
+ *          Usage:
+ *          @code
+ *          std::vector<Decimal> prices( rowCount );
+ *          std::vector<std::uint64_t> errors( ( rowCount + 63 ) / 64 );
+ *          BatchParser::parseDecimals( text, '\n', prices, errors );
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "Decimal.h"
+#include "DecimalColumn.h"
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// BatchParser class
+	//=====================================================================
+
+	/**
+	 * @brief Parses many Decimal or Int128 text fields from one buffer in a single call
+	 */
+	class BatchParser final
+	{
+	public:
+		BatchParser() = delete;
+
+		//----------------------------------------------
+		// Decimal parsing
+		//----------------------------------------------
+
+		/**
+		 * @brief Parse fields located by offsets into a span
+		 * @param buffer Text holding every field
+		 * @param offsets Field boundaries (offsets.size() - 1 fields; empty means no fields)
+		 * @param destination Output values (at least one per field); failed fields are set to zero
+		 * @param errors Error bitmap (at least (fields + 63) / 64 words), overwritten for every field
+		 * @return Number of fields parsed
+		 * @throws std::invalid_argument if destination or errors is too small, or if the offsets
+		 *         decrease or exceed the buffer (fields before the bad offset have been written)
+		 */
+		static std::size_t parseDecimals( std::string_view buffer, std::span<const std::size_t> offsets,
+			std::span<Decimal> destination, std::span<std::uint64_t> errors );
+
+		/**
+		 * @brief Parse delimiter-separated fields into a span
+		 * @param buffer Text holding every field
+		 * @param delimiter Field separator
+		 * @param destination Output values (at least one per field); failed fields are set to zero
+		 * @param errors Error bitmap (at least (fields + 63) / 64 words), overwritten for every field
+		 * @return Number of fields parsed
+		 * @throws std::invalid_argument if the buffer holds more fields than destination or errors
+		 *         can take (fields that fit have been written)
+		 */
+		static std::size_t parseDecimals( std::string_view buffer, char delimiter,
+			std::span<Decimal> destination, std::span<std::uint64_t> errors );
+
+		/**
+		 * @brief Parse fields located by offsets and append them to a column
+		 * @param buffer Text holding every field
+		 * @param offsets Field boundaries (offsets.size() - 1 fields; empty means no fields)
+		 * @param column Column to append to; failed fields are appended as null
+		 * @return Number of fields appended
+		 * @throws std::invalid_argument if the offsets decrease or exceed the buffer
+		 */
+		static std::size_t parseDecimals( std::string_view buffer, std::span<const std::size_t> offsets, DecimalColumn& column );
+
+		/**
+		 * @brief Parse delimiter-separated fields and append them to a column
+		 * @param buffer Text holding every field
+		 * @param delimiter Field separator
+		 * @param column Column to append to; failed fields are appended as null
+		 * @return Number of fields appended
+		 */
+		static std::size_t parseDecimals( std::string_view buffer, char delimiter, DecimalColumn& column );
+
+		//----------------------------------------------
+		// Int128 parsing
+		//----------------------------------------------
+
+		/**
+		 * @brief Parse fields located by offsets into a span
+		 * @param buffer Text holding every field
+		 * @param offsets Field boundaries (offsets.size() - 1 fields; empty means no fields)
+		 * @param destination Output values (at least one per field); failed fields are set to zero
+		 * @param errors Error bitmap (at least (fields + 63) / 64 words), overwritten for every field
+		 * @return Number of fields parsed
+		 * @throws std::invalid_argument if destination or errors is too small, or if the offsets
+		 *         decrease or exceed the buffer (fields before the bad offset have been written)
+		 */
+		static std::size_t parseInt128s( std::string_view buffer, std::span<const std::size_t> offsets,
+			std::span<Int128> destination, std::span<std::uint64_t> errors );
+
+		/**
+		 * @brief Parse delimiter-separated fields into a span
+		 * @param buffer Text holding every field
+		 * @param delimiter Field separator
+		 * @param destination Output values (at least one per field); failed fields are set to zero
+		 * @param errors Error bitmap (at least (fields + 63) / 64 words), overwritten for every field
+		 * @return Number of fields parsed
+		 * @throws std::invalid_argument if the buffer holds more fields than destination or errors
+		 *         can take (fields that fit have been written)
+		 */
+		static std::size_t parseInt128s( std::string_view buffer, char delimiter,
+			std::span<Int128> destination, std::span<std::uint64_t> errors );
+	};
+} // namespace nfx::datatypes
@@ -0,0 +1,429 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ColumnFile.h
+ * @brief Self-describing binary column files with a memory-mapped zero-copy reader
+ * @details A column file stores one series of Decimal, Int128 or Decimal64 values behind a
+ *          fixed 64-byte header. ColumnFileWriter streams values to disk; ColumnFileReader
+ *          maps the file and exposes the values as a span over the mapping, so opening a
+ *          file costs the same whatever its size and pages are loaded on first access.
+ *
+ *          File layout:
+ *          ┌──────────┬───────────────────────────────────────┬──────────────────────────────────────┐
+ *          │  Offset  │              Description              │                Notes                 │
+ *          ├──────────┼───────────────────────────────────────┼──────────────────────────────────────┤
+ *          │   0      │  Magic "NFXCOLMN"                     │  8 bytes                             │
+ *          │   8      │  Format version (uint16)              │  constants::COLUMN_FILE_VERSION      │
+ *          │  10      │  Column type (uint8)                  │  ColumnType                          │
+ *          │  11      │  Scale policy (uint8)                 │  ColumnScalePolicy                   │
+ *          │  12      │  Scale (uint8)                        │  Fixed policy only, else 0           │
+ *          │  13      │  Value size in bytes (uint8)          │  16, or 8 for Decimal64              │
+ *          │  16      │  Byte order marker (uint32)           │  0x01020304 as written by the host   │
+ *          │  24      │  Value count (uint64)                 │                                      │
+ *          │  32      │  Payload offset (uint64)              │  64: values start 64-byte aligned    │
+ *          │  40      │  Payload checksum (uint64)            │  XXH64 of the payload, seed 0        │
+ *          │  56      │  Header checksum (uint64)             │  XXH64 of bytes 0-55, seed 0         │
+ *          │  64      │  Values                               │  In-memory layout of the value type  │
+ *          └──────────┴───────────────────────────────────────┴──────────────────────────────────────┘
+ *
+ *          Unlisted header bytes are zero. Values are stored exactly as they are laid out in
+ *          memory (see the layout guarantees in Decimal.h and Int128.h), so a file is only
+ *          readable on a host with the same byte order; the reader checks the marker.
+ *
+ *          Semantics:
+ *          - The reader validates the header (magic, version, marker, header checksum, type
+ *            and file size) on open; the payload is not read until it is accessed
+ *          - verifyChecksum() and findInvalid() scan the whole payload and are left to the
+ *            caller, for files that may have been damaged after they were written; the value
+ *            spans are not validated, so run findInvalid() before using values from a file
+ *            that may not have come from ColumnFileWriter
+ *          - finish() must be called to complete a file; a writer destroyed without it
+ *            removes the partial file
+ *          - ColumnScalePolicy::Fixed makes the writer reject values of any other scale, so
+ *            readers can rely on scale() for every value
+ *          - Decimal64 columns accept Decimal values and throw std::overflow_error when a
+ *            mantissa needs more than 56 bits
+ *
+ *          Usage:
+ *          @code
+ *          {
+ *              ColumnFileWriter writer{ "closes.col", ColumnType::Decimal64, ColumnScalePolicy::Fixed, 4 };
+ *              writer.append( closes );
+ *              writer.finish();
+ *          }
+ *
+ *          ColumnFileReader reader{ "history.col" };
+ *          std::span<const Decimal> history{ reader.decimals() };   // no copy, no parsing
+ *          @endcode
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+
+#include "Decimal.h"
+#include "Decimal64.h"
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// Column description
+	//=====================================================================
+
+	/**
+	 * @brief Value type stored in a column file
+	 */
+	enum class ColumnType : std::uint8_t
+	{
+		Decimal = 1, ///< 16-byte Decimal values
+		Int128,		 ///< 16-byte Int128 values
+		Decimal64	 ///< 8-byte Decimal64 values (compact Decimal)
+	};
+
+	/**
+	 * @brief Scale guarantee recorded in a column file
+	 */
+	enum class ColumnScalePolicy : std::uint8_t
+	{
+		Preserve = 0, ///< Every value keeps its own scale
+		Fixed		  ///< Every value has the scale recorded in the header
+	};
+
+	//=====================================================================
+	// ColumnFileWriter class
+	//=====================================================================
+
+	/**
+	 * @brief Streams values into a new column file
+	 */
+	class ColumnFileWriter final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Create (or truncate) a column file
+		 * @param path File to write
+		 * @param type Value type of the column
+		 * @param policy Scale guarantee of the column (Preserve for Int128)
+		 * @param scale Scale of every value under ColumnScalePolicy::Fixed (0-28)
+		 * @throws std::invalid_argument if the type or scale policy is not valid
+		 * @throws std::system_error if the file cannot be created
+		 */
+		ColumnFileWriter( const std::filesystem::path& path, ColumnType type, ColumnScalePolicy policy = ColumnScalePolicy::Preserve,
+			std::uint8_t scale = 0 );
+
+		/**
+		 * @brief Destructor; removes the file if finish() was not called
+		 * @details An unfinished file is never left looking complete: its header is only
+		 *          written by finish(), so a writer abandoned after an error or exception
+		 *          deletes what it had written.
+		 */
+		~ColumnFileWriter();
+
+		ColumnFileWriter( const ColumnFileWriter& ) = delete;
+		ColumnFileWriter& operator=( const ColumnFileWriter& ) = delete;
+
+		//----------------------------------------------
+		// Writing
+		//----------------------------------------------
+
+		/**
+		 * @brief Append Decimal values to a Decimal or Decimal64 column
+		 * @param values Values to append; nothing is written if any of them is rejected
+		 * @throws std::invalid_argument if the column holds Int128, or a value breaks the scale policy
+		 * @throws std::overflow_error if a value does not fit in a Decimal64 column
+		 * @throws std::system_error if the file cannot be written
+		 */
+		void append( std::span<const Decimal> values );
+
+		/**
+		 * @brief Append Decimal64 values to a Decimal64 column
+		 * @param values Values to append; nothing is written if any of them is rejected
+		 * @throws std::invalid_argument if the column does not hold Decimal64, or a value breaks the scale policy
+		 * @throws std::system_error if the file cannot be written
+		 */
+		void append( std::span<const Decimal64> values );
+
+		/**
+		 * @brief Append Int128 values to an Int128 column
+		 * @param values Values to append
+		 * @throws std::invalid_argument if the column does not hold Int128
+		 * @throws std::system_error if the file cannot be written
+		 */
+		void append( std::span<const Int128> values );
+
+		/**
+		 * @brief Write the header and close the file
+		 * @throws std::system_error if the file cannot be written
+		 * @note Required to complete the file; see ~ColumnFileWriter()
+		 * @note Further calls do nothing; append() after finish() throws std::logic_error
+		 */
+		void finish();
+
+		//----------------------------------------------
+		// Property accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of values appended
+		 * @return Value count
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::uint64_t size() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief Write payload bytes and fold them into the checksum
+		 * @param bytes Encoded values
+		 * @param count Number of values in bytes
+		 */
+		void writeValues( std::span<const std::byte> bytes, std::size_t count );
+
+		/** @brief Path of the output file, removed if the writer is never finished */
+		std::filesystem::path m_path;
+
+		/** @brief Output file */
+		std::ofstream m_file;
+
+		/** @brief Streaming XXH64 state: four lanes, pending bytes and total length */
+		struct ChecksumState
+		{
+			/** @brief Accumulators of the four 8-byte lanes */
+			std::array<std::uint64_t, 4> lanes;
+
+			/** @brief Bytes not yet forming a whole 32-byte stripe */
+			std::array<std::byte, 32> pending;
+
+			/** @brief Number of pending bytes */
+			std::size_t pendingSize;
+
+			/** @brief Total payload bytes */
+			std::uint64_t length;
+		} m_checksum;
+
+		/** @brief Values appended */
+		std::uint64_t m_count;
+
+		/** @brief Value type */
+		ColumnType m_type;
+
+		/** @brief Scale guarantee */
+		ColumnScalePolicy m_policy;
+
+		/** @brief Scale under ColumnScalePolicy::Fixed */
+		std::uint8_t m_scale;
+
+		/** @brief Set once the header has been written */
+		bool m_finished;
+	};
+
+	//=====================================================================
+	// ColumnFileReader class
+	//=====================================================================
+
+	/**
+	 * @brief Read-only memory mapping of a column file
+	 */
+	class ColumnFileReader final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Map a column file and validate its header
+		 * @param path File to read
+		 * @throws std::system_error if the file cannot be opened or mapped
+		 * @throws std::invalid_argument if the file is not a valid column file for this host
+		 */
+		explicit ColumnFileReader( const std::filesystem::path& path );
+
+		/**
+		 * @brief Move constructor
+		 * @param other Reader to take the mapping from (left empty)
+		 */
+		ColumnFileReader( ColumnFileReader&& other ) noexcept;
+
+		/**
+		 * @brief Move assignment operator
+		 * @param other Reader to take the mapping from (left empty)
+		 * @return Reference to this reader
+		 */
+		ColumnFileReader& operator=( ColumnFileReader&& other ) noexcept;
+
+		/**
+		 * @brief Destructor; unmaps the file, invalidating every span obtained from it
+		 */
+		~ColumnFileReader();
+
+		ColumnFileReader( const ColumnFileReader& ) = delete;
+		ColumnFileReader& operator=( const ColumnFileReader& ) = delete;
+
+		//----------------------------------------------
+		// Values
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the values of a Decimal column
+		 * @return Span over the mapping
+		 * @throws std::invalid_argument if the column does not hold Decimal
+		 * @warning The values are not validated on open. Call findInvalid() first unless the
+		 *          file is known to come from ColumnFileWriter; an invalid Decimal breaks the
+		 *          invariants every Decimal operation relies on.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::span<const Decimal> decimals() const;
+
+		/**
+		 * @brief Get the values of an Int128 column
+		 * @return Span over the mapping
+		 * @throws std::invalid_argument if the column does not hold Int128
+		 * @details Every bit pattern is a valid Int128, so the values need no validation.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::span<const Int128> int128s() const;
+
+		/**
+		 * @brief Get the values of a Decimal64 column
+		 * @return Span over the mapping
+		 * @throws std::invalid_argument if the column does not hold Decimal64
+		 * @warning The values are not validated on open. Call findInvalid() first unless the
+		 *          file is known to come from ColumnFileWriter; an invalid Decimal64 breaks the
+		 *          invariants every Decimal64 operation relies on.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::span<const Decimal64> decimal64s() const;
+
+		/**
+		 * @brief Copy the values of a Decimal or Decimal64 column as Decimal
+		 * @param destination Output span (at least size() elements)
+		 * @throws std::invalid_argument if the column holds Int128 or destination is too small
+		 */
+		void toDecimals( std::span<Decimal> destination ) const;
+
+		/**
+		 * @brief Get the raw payload
+		 * @return Bytes of every value, in file order
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::span<const std::byte> payload() const noexcept;
+
+		//----------------------------------------------
+		// Integrity
+		//----------------------------------------------
+
+		/**
+		 * @brief Recompute the payload checksum
+		 * @return true if it matches the header (reads the whole payload)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] bool verifyChecksum() const noexcept;
+
+		/**
+		 * @brief Find the first value that is not valid for the column type
+		 * @return Index of that value, or size() if every value is valid (reads the whole payload)
+		 * @details Decimal values must pass Decimal::tryFromBits(), Decimal64 values need a
+		 *          scale of at most 28, and under ColumnScalePolicy::Fixed every value must have
+		 *          the column scale. Every Int128 bit pattern is valid.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::size_t findInvalid() const noexcept;
+
+		//----------------------------------------------
+		// Property accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the value type
+		 * @return Column type from the header
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] ColumnType type() const noexcept;
+
+		/**
+		 * @brief Get the scale guarantee
+		 * @return Scale policy from the header
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] ColumnScalePolicy scalePolicy() const noexcept;
+
+		/**
+		 * @brief Get the scale of every value under ColumnScalePolicy::Fixed
+		 * @return Scale from the header (0 under ColumnScalePolicy::Preserve)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::uint8_t scale() const noexcept;
+
+		/**
+		 * @brief Get the number of values
+		 * @return Value count from the header
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::size_t size() const noexcept;
+
+		/**
+		 * @brief Get the payload checksum recorded by the writer
+		 * @return XXH64 of the payload
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::uint64_t checksum() const noexcept;
+
+	private:
+		/** @brief Start of the mapping (the header) */
+		const std::byte* m_mapping;
+
+		/** @brief Mapped length in bytes */
+		std::size_t m_mappingSize;
+
+		/** @brief Value count */
+		std::size_t m_count;
+
+		/** @brief Payload checksum from the header */
+		std::uint64_t m_checksum;
+
+		/** @brief Value type */
+		ColumnType m_type;
+
+		/** @brief Scale guarantee */
+		ColumnScalePolicy m_policy;
+
+		/** @brief Scale under ColumnScalePolicy::Fixed */
+		std::uint8_t m_scale;
+	};
+} // namespace nfx::datatypes
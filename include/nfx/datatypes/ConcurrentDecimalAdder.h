@@ -0,0 +1,239 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ConcurrentDecimalAdder.h
+ * @brief Sharded exact Decimal sum for counters updated by many threads
+ * @details A single total updated by many threads serializes on one cache line, even when
+ *          the update is a lock-free compare-and-swap. ConcurrentDecimalAdder spreads the
+ *          updates over shards, in the manner of java.util.concurrent.atomic.LongAdder:
+ *
+ *          - Each shard is an exact DecimalAccumulator guarded by its own spin flag, padded
+ *            to constants::CONCURRENT_ADDER_SHARD_ALIGNMENT bytes so shards never share a line
+ *          - Each thread starts on its own shard (assigned round-robin on first use) and
+ *            moves to the next one only when it finds its shard busy, so threads settle on
+ *            distinct shards and an add is an uncontended flag exchange plus a local add
+ *          - sum() folds the shards lazily, one shard at a time
+ *
+ *          Semantics:
+ *          - Every value is added exactly, so the sum does not depend on which shard a value
+ *            landed in, nor on the order of the adds
+ *          - sum() and snapshot() are not atomic across shards: an add that runs concurrently
+ *            may or may not be included, but every add that completed before the call is
+ *          - snapshotThenReset() and sumThenReset() take and clear each shard under its flag,
+ *            so with concurrent adds every value is reported by exactly one call
+ *          - reset() is only exact when no add runs concurrently
+ *
+ *          Usage:
+ *          @code
+ *          ConcurrentDecimalAdder fees;
+ *          ConcurrentDecimalAdder volume;
+ *
+ *          // Any gateway thread
+ *          fees.add( fill.fee );
+ *          volume.addWeighted( fill.price, fill.quantity );
+ *
+ *          // Reporting thread
+ *          Decimal intervalFees{ fees.sumThenReset() };
+ *          @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "ArithmeticStatus.h"
+#include "Decimal.h"
+#include "DecimalAccumulator.h"
+#include "nfx/detail/datatypes/Constants.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		/**
+		 * @brief One adder shard on its own cache lines
+		 */
+		struct alignas( constants::CONCURRENT_ADDER_SHARD_ALIGNMENT ) AdderShard
+		{
+			/** @brief Set while a thread owns the shard */
+			std::atomic<bool> busy{ false };
+
+			/** @brief Exact sum of the values added to this shard */
+			DecimalAccumulator accumulator;
+		};
+	} // namespace internal
+
+	//=====================================================================
+	// ConcurrentDecimalAdder class
+	//=====================================================================
+
+	/**
+	 * @brief Exact Decimal sum spread over cache-line-padded shards
+	 */
+	class ConcurrentDecimalAdder final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Construct with one shard per hardware thread
+		 * @details The shard count is std::thread::hardware_concurrency() rounded up to a power of
+		 *          two, at most constants::CONCURRENT_ADDER_MAX_DEFAULT_SHARDS
+		 */
+		ConcurrentDecimalAdder();
+
+		/**
+		 * @brief Construct with an explicit shard count
+		 * @param shardCount Number of shards, rounded up to a power of two (0 behaves as 1)
+		 */
+		explicit ConcurrentDecimalAdder( std::size_t shardCount );
+
+		ConcurrentDecimalAdder( const ConcurrentDecimalAdder& ) = delete;
+		ConcurrentDecimalAdder& operator=( const ConcurrentDecimalAdder& ) = delete;
+
+		//----------------------------------------------
+		// Accumulation
+		//----------------------------------------------
+
+		/**
+		 * @brief Add one value
+		 * @param value Value to add
+		 */
+		inline void add( const Decimal& value ) noexcept;
+
+		/**
+		 * @brief Add the exact product of two values
+		 * @param value Value to weight (e.g. price)
+		 * @param weight Weight (e.g. quantity)
+		 */
+		inline void addWeighted( const Decimal& value, const Decimal& weight ) noexcept;
+
+		/**
+		 * @brief Discard every value added so far
+		 * @note Adds running concurrently may survive or be discarded; use sumThenReset() to
+		 *       account for every value
+		 */
+		void reset() noexcept;
+
+		//----------------------------------------------
+		// Result
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the sum
+		 * @return Normalized sum of every value added (zero if none)
+		 * @throws std::overflow_error if the sum is outside the Decimal range
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] Decimal sum() const;
+
+		/**
+		 * @brief Get the sum without throwing
+		 * @param status Raises Overflow (result clamped) or Inexact (fractional digits truncated)
+		 * @return Normalized sum of every value added (zero if none)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] Decimal sum( ArithmeticStatus& status ) const noexcept;
+
+		/**
+		 * @brief Get the sum and reset to zero, shard by shard
+		 * @return Normalized sum of every value taken
+		 * @throws std::overflow_error if the sum is outside the Decimal range (the shards are
+		 *         reset regardless)
+		 */
+		Decimal sumThenReset();
+
+		/**
+		 * @brief Get the exact unnormalized sum
+		 * @return Accumulator holding every value added, for merging with other totals
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] DecimalAccumulator snapshot() const noexcept;
+
+		/**
+		 * @brief Get the exact unnormalized sum and reset to zero, shard by shard
+		 * @return Accumulator holding every value taken
+		 */
+		DecimalAccumulator snapshotThenReset() noexcept;
+
+		/**
+		 * @brief Get the number of values added
+		 * @return Count of add() and addWeighted() calls since construction or the last reset
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::uint64_t count() const noexcept;
+
+		//----------------------------------------------
+		// Configuration
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of shards
+		 * @return Shard count (a power of two)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t shardCount() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief Run an update on a shard owned by the calling thread
+		 * @tparam Update Callable (DecimalAccumulator&)
+		 * @param apply Update to apply
+		 */
+		template <typename Update>
+		inline void update( Update apply ) noexcept;
+
+		/**
+		 * @brief Visit every shard while owning it
+		 * @tparam Visit Callable (DecimalAccumulator&)
+		 * @param visit Visitor
+		 */
+		template <typename Visit>
+		inline void visitShards( Visit visit ) const noexcept;
+
+		/**
+		 * @brief Get the starting shard of a thread that has not used an adder yet
+		 * @return Round-robin probe value
+		 */
+		static std::size_t nextThreadProbe() noexcept;
+
+		/** @brief Shards, constants::CONCURRENT_ADDER_SHARD_ALIGNMENT bytes each */
+		std::unique_ptr<internal::AdderShard[]> m_shards;
+
+		/** @brief Shard count minus one */
+		std::size_t m_mask;
+	};
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/ConcurrentDecimalAdder.inl"
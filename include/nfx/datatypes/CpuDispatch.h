@@ -0,0 +1,124 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CpuDispatch.h
+ * @brief Runtime instruction set selection for the vectorized span kernels
+ * @details The library is built for the baseline instruction set of its target, and
+ *          compiles its wider kernels with per-function target attributes. CpuDispatch
+ *          detects once which of them the running CPU supports, and tells every kernel
+ *          family which variant to run:
+ *
+ *          - Int128Kernels: add, subtract, negate, lessThan and sum
+ *          - DecimalFilter: compare and between over DecimalColumn
+ *
+ *          Detection uses cpuid (through the GCC/Clang CPU builtins, which also check
+ *          that the OS saves the wide registers) and only applies on x86-64; other targets
+ *          and compilers always run the Baseline variants. Every variant produces identical
+ *          results, so setActive() only changes speed. It is meant for benchmarks and tests
+ *          comparing variants on one machine, and affects every thread.
+ *
+ *          Usage:
+ *          @code
+ *          CpuDispatch::setActive( CpuDispatch::InstructionSet::Avx2 );
+ *          Int128 total{ Int128Kernels::sum( balances, status ) };
+ *          CpuDispatch::reset();
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// CpuDispatch class
+	//=====================================================================
+
+	/**
+	 * @brief Detection and override of the instruction set used by the span kernels
+	 */
+	class CpuDispatch final
+	{
+	public:
+		CpuDispatch() = delete;
+
+		//----------------------------------------------
+		// Instruction sets
+		//----------------------------------------------
+
+		/**
+		 * @brief Kernel variants, from narrowest to widest
+		 */
+		enum class InstructionSet : std::uint8_t
+		{
+			Baseline = 0, ///< Portable scalar code
+			Avx2,		  ///< 256-bit AVX2 vectors (Haswell, Zen and later)
+			Avx512		  ///< 512-bit AVX-512F vectors (Skylake-SP, Zen 4 and later)
+		};
+
+		//----------------------------------------------
+		// Detection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the widest instruction set the running CPU supports
+		 * @return Detected instruction set (Baseline on non-x86 targets)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static InstructionSet detected() noexcept;
+
+		/**
+		 * @brief Check whether the running CPU supports an instruction set
+		 * @param instructionSet Instruction set to check
+		 * @return true if instructionSet is not wider than detected()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static bool isSupported( InstructionSet instructionSet ) noexcept;
+
+		//----------------------------------------------
+		// Selection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the instruction set the kernels currently run
+		 * @return detected(), unless overridden with setActive()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static InstructionSet active() noexcept;
+
+		/**
+		 * @brief Force the kernels to run a given instruction set
+		 * @param instructionSet Instruction set to use from now on, in every thread
+		 * @throws std::invalid_argument if the running CPU does not support instructionSet
+		 */
+		static void setActive( InstructionSet instructionSet );
+
+		/**
+		 * @brief Return to the detected instruction set
+		 */
+		static void reset() noexcept;
+	};
+} // namespace nfx::datatypes
@@ -121,8 +121,11 @@
 
 #include <array>
 #include <cstdint>
+#include <functional>
 #include <string_view>
+#include <type_traits>
 
+#include "ArithmeticStatus.h"
 #include "Int128.h"
 
 namespace nfx::datatypes
@@ -230,25 +233,25 @@ namespace nfx::datatypes
 		 * @brief Construct from 32-bit integer
 		 * @param value Integer value to convert
 		 */
-		explicit Decimal( std::int32_t value ) noexcept;
+		inline explicit constexpr Decimal( std::int32_t value ) noexcept;
 
 		/**
 		 * @brief Construct from 64-bit integer
 		 * @param value Integer value to convert
 		 */
-		explicit Decimal( std::int64_t value ) noexcept;
+		inline explicit constexpr Decimal( std::int64_t value ) noexcept;
 
 		/**
 		 * @brief Construct from 32-bit unsigned integer
 		 * @param value Unsigned integer value to convert
 		 */
-		explicit Decimal( std::uint32_t value ) noexcept;
+		inline explicit constexpr Decimal( std::uint32_t value ) noexcept;
 
 		/**
 		 * @brief Construct from 64-bit unsigned integer
 		 * @param value Unsigned integer value to convert
 		 */
-		explicit Decimal( std::uint64_t value ) noexcept;
+		inline explicit constexpr Decimal( std::uint64_t value ) noexcept;
 
 		/**
 		 * @brief Construct from string (exact parsing)
@@ -257,7 +260,7 @@ namespace nfx::datatypes
 		 * @see parse() for static parsing with error handling
 		 * @see tryParse() for non-throwing parsing
 		 */
-		explicit Decimal( std::string_view str );
+		inline explicit constexpr Decimal( std::string_view str );
 
 		/**
 		 * @brief Construct from 128-bit integer with overflow handling
@@ -279,19 +282,19 @@ namespace nfx::datatypes
 		 *          - Int128("170141183460469231731687303715884105727")  → Decimal("79228162514264337593543950335") (clamped)
 		 *          - Int128("-170141183460469231731687303715884105728") → Decimal("-79228162514264337593543950335") (clamped)
 		 */
-		explicit Decimal( const Int128& val );
+		inline explicit constexpr Decimal( const Int128& val );
 
 		/**
 		 * @brief Copy constructor
 		 * @param other The Decimal object to copy from
 		 */
-		Decimal( const Decimal& other ) noexcept = default;
+		constexpr Decimal( const Decimal& other ) noexcept = default;
 
 		/**
 		 * @brief Move constructor
 		 * @param other The Decimal object to move from
 		 */
-		Decimal( Decimal&& other ) noexcept = default;
+		constexpr Decimal( Decimal&& other ) noexcept = default;
 
 		//----------------------------------------------
 		// Destruction
@@ -309,14 +312,14 @@ namespace nfx::datatypes
 		 * @param other The Decimal object to copy from
 		 * @return Reference to this Decimal object after assignment
 		 */
-		Decimal& operator=( const Decimal& other ) noexcept = default;
+		constexpr Decimal& operator=( const Decimal& other ) noexcept = default;
 
 		/**
 		 * @brief Move assignment operator
 		 * @param other The Decimal object to move from
 		 * @return Reference to this Decimal object after assignment
 		 */
-		Decimal& operator=( Decimal&& other ) noexcept = default;
+		constexpr Decimal& operator=( Decimal&& other ) noexcept = default;
 
 		//----------------------------------------------
 		// Decimal constants
@@ -341,14 +344,14 @@ namespace nfx::datatypes
 		 * @return Smallest representable positive decimal
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] static Decimal minValue() noexcept;
+		[[nodiscard]] inline static constexpr Decimal minValue() noexcept;
 
 		/**
 		 * @brief Maximum finite value constant
 		 * @return Largest representable decimal
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] static Decimal maxValue() noexcept;
+		[[nodiscard]] inline static constexpr Decimal maxValue() noexcept;
 
 		//----------------------------------------------
 		// Static mathematical operations
@@ -360,7 +363,7 @@ namespace nfx::datatypes
 		 * @return Decimal with fractional part removed
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline static Decimal truncate( const Decimal& value ) noexcept;
+		[[nodiscard]] inline static constexpr Decimal truncate( const Decimal& value ) noexcept;
 
 		/**
 		 * @brief Round down to nearest integer
@@ -368,7 +371,7 @@ namespace nfx::datatypes
 		 * @return Largest integer less than or equal to value
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline static Decimal floor( Decimal& value ) noexcept;
+		[[nodiscard]] inline static constexpr Decimal floor( Decimal& value ) noexcept;
 
 		/**
 		 * @brief Round up to nearest integer
@@ -376,7 +379,7 @@ namespace nfx::datatypes
 		 * @return Smallest integer greater than or equal to value
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline static Decimal ceiling( Decimal& value ) noexcept;
+		[[nodiscard]] inline static constexpr Decimal ceiling( Decimal& value ) noexcept;
 
 		/**
 		 * @brief Round decimal value to specified precision using configurable rounding mode (static helper)
@@ -388,7 +391,7 @@ namespace nfx::datatypes
 		 *          See the instance method documentation for detailed rounding mode behavior and examples.
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline static Decimal round( Decimal& value, std::int32_t decimalsPlacesCount = 0, RoundingMode mode = RoundingMode::ToNearest ) noexcept;
+		[[nodiscard]] inline static constexpr Decimal round( Decimal& value, std::int32_t decimalsPlacesCount = 0, RoundingMode mode = RoundingMode::ToNearest ) noexcept;
 
 		/**
 		 * @brief Get absolute value
@@ -396,7 +399,7 @@ namespace nfx::datatypes
 		 * @return Absolute value of the decimal
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline static Decimal abs( const Decimal& value ) noexcept;
+		[[nodiscard]] inline static constexpr Decimal abs( const Decimal& value ) noexcept;
 
 		//----------------------------------------------
 		// Arithmetic operators
@@ -407,21 +410,21 @@ namespace nfx::datatypes
 		 * @param other The Decimal value to add
 		 * @return Result of addition
 		 */
-		Decimal operator+( const Decimal& other );
+		inline constexpr Decimal operator+( const Decimal& other ) const;
 
 		/**
 		 * @brief Subtraction operator
 		 * @param other The Decimal value to subtract
 		 * @return Result of subtraction
 		 */
-		Decimal operator-( const Decimal& other );
+		inline constexpr Decimal operator-( const Decimal& other ) const;
 
 		/**
 		 * @brief Multiplication operator
 		 * @param other The Decimal value to multiply by
 		 * @return Result of multiplication
 		 */
-		Decimal operator*( const Decimal& other ) const;
+		inline constexpr Decimal operator*( const Decimal& other ) const;
 
 		/**
 		 * @brief Division operator
@@ -429,28 +432,28 @@ namespace nfx::datatypes
 		 * @return Result of division
 		 * @throws std::overflow_error if divisor is zero (no NaN/Infinity representation)
 		 */
-		Decimal operator/( const Decimal& other ) const;
+		inline constexpr Decimal operator/( const Decimal& other ) const;
 
 		/**
 		 * @brief Addition assignment operator
 		 * @param other The Decimal value to add
 		 * @return Reference to this Decimal after addition
 		 */
-		inline Decimal& operator+=( const Decimal& other );
+		inline constexpr Decimal& operator+=( const Decimal& other );
 
 		/**
 		 * @brief Subtraction assignment operator
 		 * @param other The Decimal value to subtract
 		 * @return Reference to this Decimal after subtraction
 		 */
-		inline Decimal& operator-=( const Decimal& other );
+		inline constexpr Decimal& operator-=( const Decimal& other );
 
 		/**
 		 * @brief Multiplication assignment operator
 		 * @param other The Decimal value to multiply by
 		 * @return Reference to this Decimal after multiplication
 		 */
-		inline Decimal& operator*=( const Decimal& other );
+		inline constexpr Decimal& operator*=( const Decimal& other );
 
 		/**
 		 * @brief Division assignment operator
@@ -458,13 +461,63 @@ namespace nfx::datatypes
 		 * @return Reference to this after division
 		 * @throws std::overflow_error if divisor is zero (no NaN/Infinity representation)
 		 */
-		inline Decimal& operator/=( const Decimal& other );
+		inline constexpr Decimal& operator/=( const Decimal& other );
 
 		/**
 		 * @brief Unary minus operator (negation)
 		 * @return Negated decimal value
 		 */
-		Decimal operator-() const noexcept;
+		inline constexpr Decimal operator-() const noexcept;
+
+		//----------------------------------------------
+		// Non-throwing arithmetic
+		//----------------------------------------------
+
+		/**
+		 * @brief Add without throwing
+		 * @param left Left operand
+		 * @param right Right operand
+		 * @param status Sticky flags; Inexact when digits beyond 96 bits are truncated,
+		 *        Overflow when the integer part is out of range
+		 * @return Same result as left + right whenever that fits; clamped to ±maxValue() on overflow
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal add( const Decimal& left, const Decimal& right, ArithmeticStatus& status ) noexcept;
+
+		/**
+		 * @brief Subtract without throwing
+		 * @param left Left operand
+		 * @param right Right operand
+		 * @param status Sticky flags; Inexact when digits beyond 96 bits are truncated,
+		 *        Overflow when the integer part is out of range
+		 * @return Same result as left - right whenever that fits; clamped to ±maxValue() on overflow
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal subtract( const Decimal& left, const Decimal& right, ArithmeticStatus& status ) noexcept;
+
+		/**
+		 * @brief Multiply without throwing
+		 * @param left Left operand
+		 * @param right Right operand
+		 * @param status Sticky flags; Inexact when digits beyond 28 places or 96 bits are truncated,
+		 *        Overflow when the integer part is out of range
+		 * @return Same result as left * right whenever that fits; clamped to ±maxValue() on overflow
+		 * @details The product is formed exactly in 256 bits, so unlike operator* it never wraps.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal multiply( const Decimal& left, const Decimal& right, ArithmeticStatus& status ) noexcept;
+
+		/**
+		 * @brief Divide without throwing
+		 * @param left Dividend
+		 * @param right Divisor
+		 * @param status Sticky flags; DivisionByZero for a zero divisor, Inexact when the quotient
+		 *        is truncated, Overflow when the integer part is out of range
+		 * @return Same result as left / right whenever that fits; zero on division by zero,
+		 *         clamped to ±maxValue() on overflow
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal divide( const Decimal& left, const Decimal& right, ArithmeticStatus& status ) noexcept;
 
 		//----------------------------------------------
 		// Comparison operators
@@ -475,42 +528,42 @@ namespace nfx::datatypes
 		 * @param other The Decimal value to compare with
 		 * @return true if values are equal, false otherwise
 		 */
-		bool operator==( const Decimal& other ) const noexcept;
+		inline constexpr bool operator==( const Decimal& other ) const noexcept;
 
 		/**
 		 * @brief Inequality comparison operator
 		 * @param other The Decimal value to compare with
 		 * @return true if values are not equal, false otherwise
 		 */
-		inline bool operator!=( const Decimal& other ) const noexcept;
+		inline constexpr bool operator!=( const Decimal& other ) const noexcept;
 
 		/**
 		 * @brief Less than comparison operator
 		 * @param other The Decimal value to compare with
 		 * @return true if this value is less than other, false otherwise
 		 */
-		bool operator<( const Decimal& other ) const noexcept;
+		inline constexpr bool operator<( const Decimal& other ) const noexcept;
 
 		/**
 		 * @brief Less than or equal comparison operator
 		 * @param other The Decimal value to compare with
 		 * @return true if this value is less than or equal to other, false otherwise
 		 */
-		inline bool operator<=( const Decimal& other ) const noexcept;
+		inline constexpr bool operator<=( const Decimal& other ) const noexcept;
 
 		/**
 		 * @brief Greater than comparison operator
 		 * @param other The Decimal value to compare with
 		 * @return true if this value is greater than other, false otherwise
 		 */
-		inline bool operator>( const Decimal& other ) const noexcept;
+		inline constexpr bool operator>( const Decimal& other ) const noexcept;
 
 		/**
 		 * @brief Greater than or equal comparison operator
 		 * @param other The Decimal value to compare with
 		 * @return true if this value is greater than or equal to other, false otherwise
 		 */
-		inline bool operator>=( const Decimal& other ) const noexcept;
+		inline constexpr bool operator>=( const Decimal& other ) const noexcept;
 
 		//----------------------------------------------
 		// Comparison with built-in floating point types
@@ -621,126 +674,126 @@ namespace nfx::datatypes
 		 * @param val Right operand
 		 * @return true if values are equal
 		 */
-		inline bool operator==( std::int64_t val ) const noexcept;
+		inline constexpr bool operator==( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Inequality comparison with signed 64-bit integer
 		 * @param val Right operand
 		 * @return true if values are not equal
 		 */
-		inline bool operator!=( std::int64_t val ) const noexcept;
+		inline constexpr bool operator!=( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Less than comparison with signed 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than val
 		 */
-		inline bool operator<( std::int64_t val ) const noexcept;
+		inline constexpr bool operator<( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Less than or equal comparison with signed 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than or equal to val
 		 */
-		inline bool operator<=( std::int64_t val ) const noexcept;
+		inline constexpr bool operator<=( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Greater than comparison with signed 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than val
 		 */
-		inline bool operator>( std::int64_t val ) const noexcept;
+		inline constexpr bool operator>( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Greater than or equal comparison with signed 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than or equal to val
 		 */
-		inline bool operator>=( std::int64_t val ) const noexcept;
+		inline constexpr bool operator>=( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Equality comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if values are equal
 		 */
-		inline bool operator==( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator==( std::uint64_t val ) const noexcept;
 
 		/**
 		 * @brief Inequality comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if values are not equal
 		 */
-		inline bool operator!=( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator!=( std::uint64_t val ) const noexcept;
 
 		/**
 		 * @brief Less than comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than val
 		 */
-		inline bool operator<( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator<( std::uint64_t val ) const noexcept;
 
 		/**
 		 * @brief Less than or equal comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than or equal to val
 		 */
-		inline bool operator<=( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator<=( std::uint64_t val ) const noexcept;
 
 		/**
 		 * @brief Greater than comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than val
 		 */
-		inline bool operator>( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator>( std::uint64_t val ) const noexcept;
 
 		/**
 		 * @brief Greater than or equal comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than or equal to val
 		 */
-		inline bool operator>=( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator>=( std::uint64_t val ) const noexcept;
 
 		/**
 		 * @brief Equality comparison with signed 32-bit integer
 		 * @param val Right operand
 		 * @return true if values are equal
 		 */
-		inline bool operator==( std::int32_t val ) const noexcept;
+		inline constexpr bool operator==( std::int32_t val ) const noexcept;
 
 		/**
 		 * @brief Inequality comparison with signed 32-bit integer
 		 * @param val Right operand
 		 * @return true if values are not equal
 		 */
-		inline bool operator!=( std::int32_t val ) const noexcept;
+		inline constexpr bool operator!=( std::int32_t val ) const noexcept;
 
 		/**
 		 * @brief Less than comparison with signed 32-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than val
 		 */
-		inline bool operator<( std::int32_t val ) const noexcept;
+		inline constexpr bool operator<( std::int32_t val ) const noexcept;
 
 		/**
 		 * @brief Less than or equal comparison with signed 32-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than or equal to val
 		 */
-		inline bool operator<=( std::int32_t val ) const noexcept;
+		inline constexpr bool operator<=( std::int32_t val ) const noexcept;
 
 		/**
 		 * @brief Greater than comparison with signed 32-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than val
 		 */
-		inline bool operator>( std::int32_t val ) const noexcept;
+		inline constexpr bool operator>( std::int32_t val ) const noexcept;
 
 		/**
 		 * @brief Greater than or equal comparison with signed 32-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than or equal to val
 		 */
-		inline bool operator>=( std::int32_t val ) const noexcept;
+		inline constexpr bool operator>=( std::int32_t val ) const noexcept;
 
 		//----------------------------------------------
 		// Comparison with nfx Int128
@@ -752,42 +805,42 @@ namespace nfx::datatypes
 		 * @return true if values are equal
 		 * @note For equality, the Decimal must have no fractional part and represent the same integer value
 		 */
-		bool operator==( const Int128& val ) const noexcept;
+		inline constexpr bool operator==( const Int128& val ) const noexcept;
 
 		/**
 		 * @brief Inequality comparison with Int128
 		 * @param val Right operand
 		 * @return true if values are not equal
 		 */
-		inline bool operator!=( const Int128& val ) const noexcept;
+		inline constexpr bool operator!=( const Int128& val ) const noexcept;
 
 		/**
 		 * @brief Less than comparison with Int128
 		 * @param val Right operand
 		 * @return true if this is less than val
 		 */
-		bool operator<( const Int128& val ) const noexcept;
+		inline constexpr bool operator<( const Int128& val ) const noexcept;
 
 		/**
 		 * @brief Less than or equal comparison with Int128
 		 * @param val Right operand
 		 * @return true if this is less than or equal to val
 		 */
-		inline bool operator<=( const Int128& val ) const noexcept;
+		inline constexpr bool operator<=( const Int128& val ) const noexcept;
 
 		/**
 		 * @brief Greater than comparison with Int128
 		 * @param val Right operand
 		 * @return true if this is greater than val
 		 */
-		inline bool operator>( const Int128& val ) const noexcept;
+		inline constexpr bool operator>( const Int128& val ) const noexcept;
 
 		/**
 		 * @brief Greater than or equal comparison with Int128
 		 * @param val Right operand
 		 * @return true if this is greater than or equal to val
 		 */
-		inline bool operator>=( const Int128& val ) const noexcept;
+		inline constexpr bool operator>=( const Int128& val ) const noexcept;
 
 		//----------------------------------------------
 		// String parsing and conversion
@@ -801,7 +854,7 @@ namespace nfx::datatypes
 		 * @note Provides exact decimal parsing up to 28-29 significant digits without floating-point rounding errors
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] static Decimal parse( std::string_view str );
+		[[nodiscard]] inline static constexpr Decimal parse( std::string_view str );
 
 		/**
 		 * @brief Parse string to decimal with error handling
@@ -810,7 +863,7 @@ namespace nfx::datatypes
 		 * @return true if parsing succeeded, false otherwise
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] static bool tryParse( std::string_view str, Decimal& result ) noexcept;
+		[[nodiscard]] inline static constexpr bool tryParse( std::string_view str, Decimal& result ) noexcept;
 
 		//----------------------------------------------
 		// Type conversion
@@ -837,7 +890,38 @@ namespace nfx::datatypes
 		 * @return Array of 4 32-bit integers representing the decimal
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] std::array<std::int32_t, 4> toBits() const noexcept;
+		[[nodiscard]] inline constexpr std::array<std::int32_t, 4> toBits() const noexcept;
+
+		/**
+		 * @brief Construct from the 32-bit representation returned by toBits()
+		 * @param bits Mantissa bits 0-31, 32-63, 64-95, then the flags word (same order as .NET Decimal.GetBits)
+		 * @return Decimal with exactly these bits
+		 * @throws std::invalid_argument if the flags word has reserved bits set or a scale above 28
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal fromBits( const std::array<std::int32_t, 4>& bits );
+
+		/**
+		 * @brief Try to construct from the 32-bit representation returned by toBits()
+		 * @param bits Mantissa bits 0-31, 32-63, 64-95, then the flags word
+		 * @param result Output Decimal (unchanged on failure)
+		 * @return true if the flags word is valid
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr bool tryFromBits( const std::array<std::int32_t, 4>& bits, Decimal& result ) noexcept;
+
+		/**
+		 * @brief Construct from a 96-bit mantissa, a scale and a sign
+		 * @param lo Mantissa bits 0-31
+		 * @param mid Mantissa bits 32-63
+		 * @param hi Mantissa bits 64-95
+		 * @param scale Number of decimal places (0-28)
+		 * @param negative Sign; ignored for a zero mantissa
+		 * @return Decimal equal to (-1)^negative * mantissa / 10^scale, scale kept as given
+		 * @throws std::invalid_argument if scale is above 28
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal fromParts( std::uint32_t lo, std::uint32_t mid, std::uint32_t hi, std::uint8_t scale, bool negative );
 
 		//----------------------------------------------
 		// Property accessors
@@ -848,35 +932,35 @@ namespace nfx::datatypes
 		 * @return Scale value (0-28)
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] std::uint8_t scale() const noexcept;
+		[[nodiscard]] inline constexpr std::uint8_t scale() const noexcept;
 
 		/**
 		 * @brief Get flags value
 		 * @return Reference to flags
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline const std::uint32_t& flags() const noexcept;
+		[[nodiscard]] inline constexpr const std::uint32_t& flags() const noexcept;
 
 		/**
 		 * @brief Get mutable flags value
 		 * @return Mutable reference to flags
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline std::uint32_t& flags() noexcept;
+		[[nodiscard]] inline constexpr std::uint32_t& flags() noexcept;
 
 		/**
 		 * @brief Get mantissa array
 		 * @return Reference to mantissa array
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline const std::array<std::uint32_t, 3>& mantissa() const noexcept;
+		[[nodiscard]] inline constexpr const std::array<std::uint32_t, 3>& mantissa() const noexcept;
 
 		/**
 		 * @brief Get mutable mantissa array
 		 * @return Mutable reference to mantissa array
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline std::array<std::uint32_t, 3>& mantissa() noexcept;
+		[[nodiscard]] inline constexpr std::array<std::uint32_t, 3>& mantissa() noexcept;
 
 		//----------------------------------------------
 		// State checking
@@ -887,14 +971,28 @@ namespace nfx::datatypes
 		 * @return true if zero
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline bool isZero() const noexcept;
+		[[nodiscard]] inline constexpr bool isZero() const noexcept;
 
 		/**
 		 * @brief Check if value is negative
 		 * @return true if negative
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] bool isNegative() const noexcept;
+		[[nodiscard]] inline constexpr bool isNegative() const noexcept;
+
+		//----------------------------------------------
+		// Hashing
+		//----------------------------------------------
+
+		/**
+		 * @brief Compute a 64-bit hash consistent with operator==
+		 * @return Hash of the numeric value: equal values hash equally whatever their scale
+		 *         (1.5 and 1.50, -0 and 0)
+		 * @details Reduces mantissa / 10^scale modulo the prime 2^61 - 1, using a table of
+		 *          inverse powers of ten, so no normalization or division is needed.
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::uint64_t hash() const noexcept;
 
 		//----------------------------------------------
 		// Utilities
@@ -909,7 +1007,7 @@ namespace nfx::datatypes
 		 *          - Decimal("0.001") returns 3
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] std::uint8_t decimalPlacesCount() const noexcept;
+		[[nodiscard]] inline constexpr std::uint8_t decimalPlacesCount() const noexcept;
 
 		//----------------------------------------------
 		// Mathematical operations
@@ -920,21 +1018,21 @@ namespace nfx::datatypes
 		 * @return Decimal with fractional part removed
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] Decimal truncate() const noexcept;
+		[[nodiscard]] inline constexpr Decimal truncate() const noexcept;
 
 		/**
 		 * @brief Round down to nearest integer
 		 * @return Largest integer less than or equal to value
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] Decimal floor() const noexcept;
+		[[nodiscard]] inline constexpr Decimal floor() const noexcept;
 
 		/**
 		 * @brief Round up to nearest integer
 		 * @return Smallest integer greater than or equal to value
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] Decimal ceiling() const noexcept;
+		[[nodiscard]] inline constexpr Decimal ceiling() const noexcept;
 
 		/**
 		 * @brief Round decimal to specified precision using configurable rounding mode
@@ -943,14 +1041,66 @@ namespace nfx::datatypes
 		 * @return Decimal value rounded to the specified precision
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] Decimal round( std::int32_t decimalsPlacesCount = 0, RoundingMode mode = RoundingMode::ToNearest ) const noexcept;
+		[[nodiscard]] inline constexpr Decimal round( std::int32_t decimalsPlacesCount = 0, RoundingMode mode = RoundingMode::ToNearest ) const noexcept;
+
+		/**
+		 * @brief Rescale decimal to an exact number of decimal places
+		 * @param targetScale Number of decimal places of the result (clamped to 0-28)
+		 * @param mode Rounding mode applied when the scale is lowered (default: RoundingMode::ToNearest)
+		 * @return Decimal with the requested scale, trailing zeros preserved
+		 * @details Unlike round(), which can only lower the scale, rescale() also raises it by
+		 *          appending trailing zeros to the mantissa. This keeps values of a column at a
+		 *          uniform scale, so comparisons and sums between them need no scale alignment.
+		 *          Examples:
+		 *          - Decimal("1.5").rescale(2)   → "1.50"
+		 *          - Decimal("1.005").rescale(2) → "1.00" (banker's rounding)
+		 *          - Decimal("-2.5").rescale(0, RoundingMode::ToNearestTiesAway) → "-3"
+		 * @throws std::overflow_error if raising the scale would overflow the 96-bit mantissa
+		 * @see tryRescale() for non-throwing rescaling
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal rescale( std::int32_t targetScale, RoundingMode mode = RoundingMode::ToNearest ) const;
+
+		/**
+		 * @brief Try to rescale decimal to an exact number of decimal places without throwing
+		 * @param targetScale Number of decimal places of the result (clamped to 0-28)
+		 * @param result Output Decimal with the requested scale (unchanged on failure)
+		 * @param mode Rounding mode applied when the scale is lowered (default: RoundingMode::ToNearest)
+		 * @return true if the requested scale was reached, false if raising the scale would
+		 *         overflow the 96-bit mantissa
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool tryRescale( std::int32_t targetScale, Decimal& result, RoundingMode mode = RoundingMode::ToNearest ) const noexcept;
+
+		/**
+		 * @brief Move the decimal point to the left (divide by 10^places)
+		 * @param places Number of places to move (negative values move to the right)
+		 * @return Decimal equal to this value divided by 10^places
+		 * @details Only adjusts the scale bits when the resulting scale is representable (0-28).
+		 *          Otherwise excess digits are rounded away using banker's rounding.
+		 *          Any places beyond ±58 give the same result as ±58 (zero, or ±maxValue() to the right).
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal movePointLeft( std::int32_t places ) const noexcept;
+
+		/**
+		 * @brief Move the decimal point to the right (multiply by 10^places)
+		 * @param places Number of places to move (negative values move to the left)
+		 * @return Decimal equal to this value multiplied by 10^places
+		 * @details Only adjusts the scale bits when the current scale is at least places.
+		 *          Otherwise the mantissa is multiplied by the remaining power of 10.
+		 *          Any places beyond ±58 give the same result as ±58 (±maxValue(), or zero to the left).
+		 * @note Results exceeding the Decimal range are clamped to ±maxValue()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal movePointRight( std::int32_t places ) const noexcept;
 
 		/**
 		 * @brief Get absolute value
 		 * @return Absolute value of the decimal
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline Decimal abs() const noexcept;
+		[[nodiscard]] inline constexpr Decimal abs() const noexcept;
 
 	private:
 		//----------------------------------------------
@@ -968,6 +1118,16 @@ namespace nfx::datatypes
 		} m_layout;
 	};
 
+	//=====================================================================
+	// Layout guarantees
+	//=====================================================================
+
+	// Buffers of Decimal values are copied and reinterpreted as raw 16-byte records
+	static_assert( sizeof( Decimal ) == 16, "Decimal must be exactly 16 bytes" );
+	static_assert( std::is_trivially_copyable_v<Decimal>, "Decimal must be trivially copyable" );
+	static_assert( std::is_standard_layout_v<Decimal>, "Decimal must have standard layout" );
+	static_assert( alignof( Decimal ) == alignof( std::uint32_t ), "Decimal must keep 4-byte alignment" );
+
 	//=====================================================================
 	// Stream operators
 	//=====================================================================
@@ -987,6 +1147,45 @@ namespace nfx::datatypes
 	 * @return Reference to input stream
 	 */
 	std::istream& operator>>( std::istream& is, Decimal& decimal );
+
+	//=====================================================================
+	// User-defined literals
+	//=====================================================================
+
+	namespace literals
+	{
+		/**
+		 * @brief Decimal literal parsed at compile time
+		 * @param str Literal characters as written (digits, optional decimal point and exponent)
+		 * @return Normalized Decimal equal to the literal
+		 * @details Accepts the same digits as tryParse plus an optional exponent part,
+		 *          so both fixed and scientific notation fold to constants:
+		 *          @code
+		 *          using namespace nfx::datatypes::literals;
+		 *          constexpr Decimal tickSize{ 0.0001_dec };
+		 *          constexpr Decimal feeRate{ 2.5e-4_dec };
+		 *          @endcode
+		 *          Malformed literals and exponents that overflow the 96-bit mantissa
+		 *          are rejected at compile time. Use unary minus for negative values.
+		 */
+		consteval Decimal operator""_dec( const char* str );
+	} // namespace literals
 } // namespace nfx::datatypes
 
+//=====================================================================
+// Standard library specializations
+//=====================================================================
+
+/**
+ * @brief std::hash specialization consistent with operator==, for use as a key of unordered containers
+ */
+template <>
+struct std::hash<nfx::datatypes::Decimal>
+{
+	[[nodiscard]] std::size_t operator()( const nfx::datatypes::Decimal& value ) const noexcept
+	{
+		return static_cast<std::size_t>( value.hash() );
+	}
+};
+
 #include "nfx/detail/datatypes/Decimal.inl"
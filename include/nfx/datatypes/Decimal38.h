@@ -0,0 +1,510 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Decimal38.h
+ * @brief Wide decimal type with a 127-bit mantissa and up to 38 decimal places
+ * @details Decimal38 follows the same model as Decimal - an unsigned mantissa, a scale and a
+ *          sign bit, value = mantissa / 10^scale - but widens the mantissa to the magnitude
+ *          range of Int128, so 38 significant digits fit.
+ *
+ *          Range and Precision:
+ *          - Values from -170,141,183,460,469,231,731,687,303,715,884,105,727 to
+ *            +170,141,183,460,469,231,731,687,303,715,884,105,727
+ *          - 38 significant decimal digits (39 when the leading digit is 1)
+ *          - Finite set of values of the form m / 10^e where:
+ *            * m is an integer such that -2^127 < m < 2^127
+ *            * e is an integer between 0 and 38 inclusive
+ *
+ *          Memory Layout of Decimal38 (192 bits / 24 bytes):
+ *          ┌───────────────┬─────────────────────────────────────┬───────────────────────────────────────┐
+ *          │     Field     │             Description             │                 Notes                 │
+ *          ├───────────────┼─────────────────────────────────────┼───────────────────────────────────────┤
+ *          │  flags        │  Scale (bits 16-23), sign (bit 31)  │  Same encoding as Decimal flags       │
+ *          │  mantissa[0]  │  Lower 64 bits of the mantissa      │                                       │
+ *          │  mantissa[1]  │  Upper 63 bits of the mantissa      │  Bit 63 is always zero                │
+ *          └───────────────┴─────────────────────────────────────┴───────────────────────────────────────┘
+ *
+ *          Semantics:
+ *          - Every Decimal is exactly representable; conversion from Decimal is implicit and lossless
+ *          - Conversion to Decimal rounds beyond 28 decimal places (or 96 mantissa bits) with a
+ *            configurable rounding mode and throws std::overflow_error when the integer part does not fit
+ *          - Arithmetic is exact while the result fits; otherwise fractional digits are rounded
+ *            to nearest, ties to even. Results are normalized (trailing zeros removed), as with Decimal
+ *          - std::overflow_error is thrown when the integer part of a result exceeds the range,
+ *            and on division by zero
+ *
+ *          Usage:
+ *          @code
+ *          Decimal38 notional{ "123456789012345678901234.56789012345" };
+ *          Decimal38 rate{ Decimal{ "0.0425" } };
+ *          Decimal38 interest{ ( notional * rate ).round( 12 ) };
+ *          Decimal reported{ interest.toDecimal() };
+ *          @endcode
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+#include "Decimal.h"
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// Decimal38 class
+	//=====================================================================
+
+	/**
+	 * @brief Decimal with a 127-bit mantissa and a scale of 0-38
+	 */
+	class Decimal38 final
+	{
+	public:
+		//----------------------------------------------
+		// Rounding modes
+		//----------------------------------------------
+
+		/** @brief Rounding modes, shared with Decimal */
+		using RoundingMode = Decimal::RoundingMode;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor (zero value)
+		 */
+		inline constexpr Decimal38() noexcept;
+
+		/**
+		 * @brief Construct from 32-bit integer
+		 * @param value Integer value to convert
+		 */
+		inline explicit constexpr Decimal38( std::int32_t value ) noexcept;
+
+		/**
+		 * @brief Construct from 64-bit integer
+		 * @param value Integer value to convert
+		 */
+		inline explicit constexpr Decimal38( std::int64_t value ) noexcept;
+
+		/**
+		 * @brief Construct from 32-bit unsigned integer
+		 * @param value Unsigned integer value to convert
+		 */
+		inline explicit constexpr Decimal38( std::uint32_t value ) noexcept;
+
+		/**
+		 * @brief Construct from 64-bit unsigned integer
+		 * @param value Unsigned integer value to convert
+		 */
+		inline explicit constexpr Decimal38( std::uint64_t value ) noexcept;
+
+		/**
+		 * @brief Construct from 128-bit integer
+		 * @param value Integer value to convert
+		 * @throws std::overflow_error for the minimum Int128 value (-2^127), whose magnitude needs 128 bits
+		 */
+		inline explicit constexpr Decimal38( const Int128& value );
+
+		/**
+		 * @brief Construct from Decimal (lossless)
+		 * @param value Decimal value to widen
+		 */
+		inline constexpr Decimal38( const Decimal& value ) noexcept;
+
+		/**
+		 * @brief Construct from string
+		 * @param str String representation of decimal value
+		 * @throws std::invalid_argument if string is not a valid decimal or its integer part does not fit in 127 bits
+		 */
+		inline explicit constexpr Decimal38( std::string_view str );
+
+		//----------------------------------------------
+		// Decimal38 constants
+		//----------------------------------------------
+
+		/**
+		 * @brief Zero value
+		 * @return Decimal38 equal to 0
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal38 zero() noexcept;
+
+		/**
+		 * @brief One value
+		 * @return Decimal38 equal to 1
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal38 one() noexcept;
+
+		/**
+		 * @brief Minimum value (-(2^127 - 1))
+		 * @return Smallest representable Decimal38
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal38 minValue() noexcept;
+
+		/**
+		 * @brief Maximum value (2^127 - 1)
+		 * @return Largest representable Decimal38
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal38 maxValue() noexcept;
+
+		//----------------------------------------------
+		// Arithmetic operators
+		//----------------------------------------------
+
+		/**
+		 * @brief Addition operator
+		 * @param other Right operand
+		 * @return Sum, rounded to nearest (ties to even) if it needs more than 127 bits
+		 * @throws std::overflow_error if the integer part of the result is out of range
+		 */
+		inline constexpr Decimal38 operator+( const Decimal38& other ) const;
+
+		/**
+		 * @brief Subtraction operator
+		 * @param other Right operand
+		 * @return Difference, rounded to nearest (ties to even) if it needs more than 127 bits
+		 * @throws std::overflow_error if the integer part of the result is out of range
+		 */
+		inline constexpr Decimal38 operator-( const Decimal38& other ) const;
+
+		/**
+		 * @brief Multiplication operator
+		 * @param other Right operand
+		 * @return Product, rounded to nearest (ties to even) beyond 38 places or 127 bits
+		 * @throws std::overflow_error if the integer part of the result is out of range
+		 */
+		inline constexpr Decimal38 operator*( const Decimal38& other ) const;
+
+		/**
+		 * @brief Division operator
+		 * @param other Divisor
+		 * @return Quotient, rounded to nearest (ties to even) beyond 38 places or 127 bits
+		 * @throws std::overflow_error on division by zero or if the integer part of the result is out of range
+		 */
+		inline constexpr Decimal38 operator/( const Decimal38& other ) const;
+
+		/**
+		 * @brief Addition assignment operator
+		 * @param other Right operand
+		 * @return Reference to this after addition
+		 * @throws std::overflow_error if the integer part of the result is out of range
+		 */
+		inline constexpr Decimal38& operator+=( const Decimal38& other );
+
+		/**
+		 * @brief Subtraction assignment operator
+		 * @param other Right operand
+		 * @return Reference to this after subtraction
+		 * @throws std::overflow_error if the integer part of the result is out of range
+		 */
+		inline constexpr Decimal38& operator-=( const Decimal38& other );
+
+		/**
+		 * @brief Multiplication assignment operator
+		 * @param other Right operand
+		 * @return Reference to this after multiplication
+		 * @throws std::overflow_error if the integer part of the result is out of range
+		 */
+		inline constexpr Decimal38& operator*=( const Decimal38& other );
+
+		/**
+		 * @brief Division assignment operator
+		 * @param other Divisor
+		 * @return Reference to this after division
+		 * @throws std::overflow_error on division by zero or if the integer part of the result is out of range
+		 */
+		inline constexpr Decimal38& operator/=( const Decimal38& other );
+
+		/**
+		 * @brief Unary minus operator
+		 * @return Negated value
+		 */
+		inline constexpr Decimal38 operator-() const noexcept;
+
+		//----------------------------------------------
+		// Comparison operators
+		//----------------------------------------------
+
+		/**
+		 * @brief Equality operator (numeric, independent of scale)
+		 * @param other Value to compare with
+		 * @return true if values are numerically equal
+		 */
+		inline constexpr bool operator==( const Decimal38& other ) const noexcept;
+
+		/**
+		 * @brief Inequality operator
+		 * @param other Value to compare with
+		 * @return true if values are not equal
+		 */
+		inline constexpr bool operator!=( const Decimal38& other ) const noexcept;
+
+		/**
+		 * @brief Less than operator
+		 * @param other Value to compare with
+		 * @return true if this is less than other
+		 */
+		inline constexpr bool operator<( const Decimal38& other ) const noexcept;
+
+		/**
+		 * @brief Less than or equal operator
+		 * @param other Value to compare with
+		 * @return true if this is less than or equal to other
+		 */
+		inline constexpr bool operator<=( const Decimal38& other ) const noexcept;
+
+		/**
+		 * @brief Greater than operator
+		 * @param other Value to compare with
+		 * @return true if this is greater than other
+		 */
+		inline constexpr bool operator>( const Decimal38& other ) const noexcept;
+
+		/**
+		 * @brief Greater than or equal operator
+		 * @param other Value to compare with
+		 * @return true if this is greater than or equal to other
+		 */
+		inline constexpr bool operator>=( const Decimal38& other ) const noexcept;
+
+		//----------------------------------------------
+		// String parsing and conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Parse string to Decimal38
+		 * @param str String to parse (optional sign, digits, optional decimal point)
+		 * @return Parsed value, fractional digits beyond 38 places or 127 bits rounded to nearest (ties to even)
+		 * @throws std::invalid_argument if string is not a valid decimal or its integer part does not fit in 127 bits
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal38 parse( std::string_view str );
+
+		/**
+		 * @brief Try to parse string to Decimal38 without throwing
+		 * @param str String to parse
+		 * @param result Output value (zero on failure)
+		 * @return true if parsing succeeded and the value is in range
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr bool tryParse( std::string_view str, Decimal38& result ) noexcept;
+
+		//----------------------------------------------
+		// Type conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Convert to Decimal
+		 * @param mode Rounding mode applied beyond 28 decimal places or 96 mantissa bits (default: ToNearest)
+		 * @return Decimal closest to this value under the given rounding mode
+		 * @throws std::overflow_error if the integer part does not fit in 96 bits
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal toDecimal( RoundingMode mode = RoundingMode::ToNearest ) const;
+
+		/**
+		 * @brief Try to convert to Decimal without throwing
+		 * @param result Output Decimal (unchanged on failure)
+		 * @param mode Rounding mode applied beyond 28 decimal places or 96 mantissa bits (default: ToNearest)
+		 * @return true if the integer part fits in 96 bits
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool tryToDecimal( Decimal& result, RoundingMode mode = RoundingMode::ToNearest ) const noexcept;
+
+		/**
+		 * @brief Convert to string with exact precision
+		 * @return String representation, same format as Decimal::toString()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] std::string toString() const;
+
+		//----------------------------------------------
+		// Property accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get decimal scale (number of decimal places)
+		 * @return Scale value (0-38)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::uint8_t scale() const noexcept;
+
+		/**
+		 * @brief Get read-only access to internal flags
+		 * @return Const reference to flags field containing scale and sign
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr const std::uint32_t& flags() const noexcept;
+
+		/**
+		 * @brief Get mutable access to internal flags
+		 * @return Mutable reference to flags field containing scale and sign
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::uint32_t& flags() noexcept;
+
+		/**
+		 * @brief Get read-only access to internal mantissa
+		 * @return Const reference to the 127-bit mantissa as two 64-bit words (low word first)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr const std::array<std::uint64_t, 2>& mantissa() const noexcept;
+
+		/**
+		 * @brief Get mutable access to internal mantissa
+		 * @return Mutable reference to the 127-bit mantissa as two 64-bit words (low word first)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::array<std::uint64_t, 2>& mantissa() noexcept;
+
+		//----------------------------------------------
+		// State checking
+		//----------------------------------------------
+
+		/**
+		 * @brief Check if value is zero
+		 * @return true if value is zero
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool isZero() const noexcept;
+
+		/**
+		 * @brief Check if value is negative
+		 * @return true if value is negative
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool isNegative() const noexcept;
+
+		//----------------------------------------------
+		// Mathematical operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Remove fractional part
+		 * @return Integer part of the value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal38 truncate() const noexcept;
+
+		/**
+		 * @brief Round down to nearest integer
+		 * @return Largest integer less than or equal to value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal38 floor() const noexcept;
+
+		/**
+		 * @brief Round up to nearest integer
+		 * @return Smallest integer greater than or equal to value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal38 ceiling() const noexcept;
+
+		/**
+		 * @brief Round to specified precision using configurable rounding mode
+		 * @param decimalsPlacesCount Number of decimal places to round to (default: 0 for integer rounding)
+		 * @param mode Rounding mode to apply (default: RoundingMode::ToNearest for banker's rounding)
+		 * @return Value rounded to the specified precision
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal38 round( std::int32_t decimalsPlacesCount = 0, RoundingMode mode = RoundingMode::ToNearest ) const noexcept;
+
+		/**
+		 * @brief Rescale to an exact number of decimal places
+		 * @param targetScale Number of decimal places of the result (clamped to 0-38)
+		 * @param mode Rounding mode applied when the scale is lowered (default: RoundingMode::ToNearest)
+		 * @return Value with the requested scale, trailing zeros preserved
+		 * @throws std::overflow_error if raising the scale would overflow the 127-bit mantissa
+		 * @see tryRescale() for non-throwing rescaling
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal38 rescale( std::int32_t targetScale, RoundingMode mode = RoundingMode::ToNearest ) const;
+
+		/**
+		 * @brief Try to rescale to an exact number of decimal places without throwing
+		 * @param targetScale Number of decimal places of the result (clamped to 0-38)
+		 * @param result Output value with the requested scale (unchanged on failure)
+		 * @param mode Rounding mode applied when the scale is lowered (default: RoundingMode::ToNearest)
+		 * @return true if the requested scale was reached, false if raising the scale would
+		 *         overflow the 127-bit mantissa
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool tryRescale( std::int32_t targetScale, Decimal38& result, RoundingMode mode = RoundingMode::ToNearest ) const noexcept;
+
+		/**
+		 * @brief Get absolute value
+		 * @return Absolute value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal38 abs() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal representation
+		//----------------------------------------------
+
+		/** @brief Internal storage layout for the wide decimal representation */
+		struct Layout
+		{
+			/** @brief Scale (bits 16-23) + Sign (bit 31) */
+			std::uint32_t flags;
+
+			/** @brief 127-bit mantissa (2 x 64-bit, low word first) */
+			std::array<std::uint64_t, 2> mantissa;
+		} m_layout;
+	};
+
+	//=====================================================================
+	// Stream operators
+	//=====================================================================
+
+	/**
+	 * @brief Output stream operator
+	 * @param os Output stream
+	 * @param value Decimal38 value to output
+	 * @return Reference to output stream
+	 */
+	std::ostream& operator<<( std::ostream& os, const Decimal38& value );
+
+	/**
+	 * @brief Input stream operator
+	 * @param is Input stream
+	 * @param value Decimal38 value to input
+	 * @return Reference to input stream
+	 */
+	std::istream& operator>>( std::istream& is, Decimal38& value );
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/Decimal38.inl"
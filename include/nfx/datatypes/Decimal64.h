@@ -0,0 +1,390 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Decimal64.h
+ * @brief Compact 8-byte storage form of Decimal
+ * @details Decimal64 packs the sign, scale and a 56-bit mantissa of a Decimal into a single
+ *          64-bit word. It is intended for storing large amounts of values whose mantissa is
+ *          small (prices, quantities) at half the footprint of Decimal.
+ *
+ *          Memory Layout of Decimal64 (64 bits / 8 bytes):
+ *          ┌───────────┬─────────────────────────────────────┬───────────────────────────────────────┐
+ *          │    Bits   │             Description             │                 Notes                 │
+ *          ├───────────┼─────────────────────────────────────┼───────────────────────────────────────┤
+ *          │   0 - 55  │  Mantissa (0 to 2^56 - 1)           │  Unsigned magnitude                   │
+ *          │  56 - 62  │  Scale (0-28)                       │  Same meaning as in Decimal           │
+ *          │  63       │  Sign (0 = positive, 1 = negative)  │  Sign bit                             │
+ *          └───────────┴─────────────────────────────────────┴───────────────────────────────────────┘
+ *
+ *          Semantics:
+ *          - Every Decimal64 value is exactly representable as a Decimal; conversion to Decimal
+ *            is implicit and lossless (mantissa, scale and sign are preserved bit for bit)
+ *          - Conversion from Decimal is explicit and throws std::overflow_error when the mantissa
+ *            needs more than 56 bits; tryFromDecimal() reports the same condition without throwing
+ *          - Arithmetic returns Decimal, so results never overflow the compact form. Same-scale
+ *            addition/subtraction and small products are computed directly in 64-bit integers
+ *          - Results are bit-identical to performing the same operation on the Decimal values
+ *
+ *          Usage:
+ *          @code
+ *          std::vector<Decimal64> history( prices.size() );
+ *          Decimal64::fromDecimals( prices, history );  // 8 bytes per stored price
+ *
+ *          Decimal total{ history[0] + history[1] };    // promotes to Decimal
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "Decimal.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// Decimal64 class
+	//=====================================================================
+
+	/**
+	 * @brief 8-byte decimal storage type with a 56-bit mantissa that promotes to Decimal
+	 */
+	class Decimal64 final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor (zero value)
+		 */
+		inline constexpr Decimal64() noexcept;
+
+		/**
+		 * @brief Construct from an integer value
+		 * @param value Integer value
+		 * @throws std::overflow_error if |value| needs more than 56 bits
+		 */
+		inline explicit constexpr Decimal64( std::int64_t value );
+
+		/**
+		 * @brief Construct from a Decimal, preserving mantissa, scale and sign exactly
+		 * @param value Decimal value to pack
+		 * @throws std::overflow_error if the mantissa needs more than 56 bits
+		 */
+		inline explicit constexpr Decimal64( const Decimal& value );
+
+		/**
+		 * @brief Construct from a string
+		 * @param str String representation accepted by Decimal::parse
+		 * @throws std::invalid_argument if the string is not a valid decimal
+		 * @throws std::overflow_error if the mantissa needs more than 56 bits
+		 */
+		inline explicit constexpr Decimal64( std::string_view str );
+
+		/**
+		 * @brief Try to pack a Decimal without throwing
+		 * @param value Decimal value to pack
+		 * @param result Output Decimal64 (unchanged on failure)
+		 * @return true if the mantissa fits in 56 bits
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr bool tryFromDecimal( const Decimal& value, Decimal64& result ) noexcept;
+
+		/**
+		 * @brief Check whether a Decimal can be stored as Decimal64
+		 * @param value Decimal value to check
+		 * @return true if the mantissa fits in 56 bits
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr bool fits( const Decimal& value ) noexcept;
+
+		//----------------------------------------------
+		// Bulk conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Promote a span of Decimal64 values to Decimal
+		 * @param source Values to promote
+		 * @param destination Output span (at least source.size() elements)
+		 * @throws std::invalid_argument if destination is smaller than source
+		 */
+		inline static constexpr void toDecimals( std::span<const Decimal64> source, std::span<Decimal> destination );
+
+		/**
+		 * @brief Pack a span of Decimal values into Decimal64
+		 * @param source Values to pack
+		 * @param destination Output span (at least source.size() elements)
+		 * @throws std::invalid_argument if destination is smaller than source
+		 * @throws std::overflow_error if any mantissa needs more than 56 bits
+		 *         (elements before the failing one have been written)
+		 */
+		inline static constexpr void fromDecimals( std::span<const Decimal> source, std::span<Decimal64> destination );
+
+		/**
+		 * @brief Pack a span of Decimal values into Decimal64 without throwing
+		 * @param source Values to pack
+		 * @param destination Output span
+		 * @return Number of leading elements converted; stops at the first value that does not
+		 *         fit or when destination is full
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr std::size_t tryFromDecimals( std::span<const Decimal> source, std::span<Decimal64> destination ) noexcept;
+
+		//----------------------------------------------
+		// Static factory methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Get minimum representable value (-(2^56 - 1))
+		 * @return Minimum Decimal64 value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal64 minValue() noexcept;
+
+		/**
+		 * @brief Get maximum representable value (2^56 - 1)
+		 * @return Maximum Decimal64 value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal64 maxValue() noexcept;
+
+		//----------------------------------------------
+		// Type conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Lossless conversion to Decimal
+		 * @return Decimal with identical mantissa, scale and sign
+		 */
+		inline constexpr operator Decimal() const noexcept;
+
+		/**
+		 * @brief Lossless conversion to Decimal
+		 * @return Decimal with identical mantissa, scale and sign
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal toDecimal() const noexcept;
+
+		/**
+		 * @brief Convert to string
+		 * @return Same representation as Decimal::toString()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::string toString() const;
+
+		//----------------------------------------------
+		// Arithmetic operators
+		//----------------------------------------------
+
+		/**
+		 * @brief Addition operator, promoting to Decimal
+		 * @param other Value to add
+		 * @return Sum as Decimal
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal operator+( const Decimal64& other ) const;
+
+		/**
+		 * @brief Subtraction operator, promoting to Decimal
+		 * @param other Value to subtract
+		 * @return Difference as Decimal
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal operator-( const Decimal64& other ) const;
+
+		/**
+		 * @brief Multiplication operator, promoting to Decimal
+		 * @param other Value to multiply by
+		 * @return Product as Decimal
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal operator*( const Decimal64& other ) const;
+
+		/**
+		 * @brief Division operator, promoting to Decimal
+		 * @param other Divisor
+		 * @return Quotient as Decimal
+		 * @throws std::overflow_error if divisor is zero
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal operator/( const Decimal64& other ) const;
+
+		[[nodiscard]] inline constexpr Decimal operator+( const Decimal& other ) const;
+		[[nodiscard]] inline constexpr Decimal operator-( const Decimal& other ) const;
+		[[nodiscard]] inline constexpr Decimal operator*( const Decimal& other ) const;
+		[[nodiscard]] inline constexpr Decimal operator/( const Decimal& other ) const;
+
+		/**
+		 * @brief Unary minus operator
+		 * @return Negated value (always representable)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal64 operator-() const noexcept;
+
+		//----------------------------------------------
+		// Comparison operators
+		//----------------------------------------------
+
+		/**
+		 * @brief Equality operator
+		 * @param other Value to compare with
+		 * @return true if values are numerically equal
+		 * @details Values sharing a scale are compared as plain integers.
+		 */
+		inline constexpr bool operator==( const Decimal64& other ) const noexcept;
+		inline constexpr bool operator!=( const Decimal64& other ) const noexcept;
+		inline constexpr bool operator<( const Decimal64& other ) const noexcept;
+		inline constexpr bool operator<=( const Decimal64& other ) const noexcept;
+		inline constexpr bool operator>( const Decimal64& other ) const noexcept;
+		inline constexpr bool operator>=( const Decimal64& other ) const noexcept;
+
+		inline constexpr bool operator==( const Decimal& other ) const noexcept;
+		inline constexpr bool operator!=( const Decimal& other ) const noexcept;
+		inline constexpr bool operator<( const Decimal& other ) const noexcept;
+		inline constexpr bool operator<=( const Decimal& other ) const noexcept;
+		inline constexpr bool operator>( const Decimal& other ) const noexcept;
+		inline constexpr bool operator>=( const Decimal& other ) const noexcept;
+
+		//----------------------------------------------
+		// String parsing
+		//----------------------------------------------
+
+		/**
+		 * @brief Parse string to Decimal64
+		 * @param str String representation accepted by Decimal::parse
+		 * @return Parsed value
+		 * @throws std::invalid_argument if the string is not a valid decimal
+		 * @throws std::overflow_error if the mantissa needs more than 56 bits
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal64 parse( std::string_view str );
+
+		/**
+		 * @brief Try to parse string to Decimal64 without throwing
+		 * @param str String to parse
+		 * @param result Output Decimal64 (unchanged on failure)
+		 * @return true if parsing succeeded and the value fits
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr bool tryParse( std::string_view str, Decimal64& result ) noexcept;
+
+		//----------------------------------------------
+		// Property accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the decimal scale (number of digits after decimal point)
+		 * @return Scale value (0-28)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::uint8_t scale() const noexcept;
+
+		/**
+		 * @brief Get the unsigned 56-bit mantissa
+		 * @return Mantissa magnitude
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::uint64_t mantissa() const noexcept;
+
+		/**
+		 * @brief Get the packed representation
+		 * @return Raw 64-bit word (sign, scale, mantissa)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::uint64_t toBits() const noexcept;
+
+		//----------------------------------------------
+		// State checking
+		//----------------------------------------------
+
+		/**
+		 * @brief Check if value is zero
+		 * @return true if zero
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool isZero() const noexcept;
+
+		/**
+		 * @brief Check if value is negative
+		 * @return true if negative
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool isNegative() const noexcept;
+
+		//----------------------------------------------
+		// Mathematical operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Absolute value
+		 * @return Non-negative value
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal64 abs() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Private helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief Signed mantissa (sign applied, scale ignored)
+		 * @return Mantissa as signed 64-bit integer
+		 */
+		[[nodiscard]] inline constexpr std::int64_t signedMantissa() const noexcept;
+
+		/** @brief Sign (bit 63), scale (bits 56-62) and mantissa (bits 0-55) */
+		std::uint64_t m_bits;
+	};
+
+	//=====================================================================
+	// Stream operators
+	//=====================================================================
+
+	/**
+	 * @brief Output stream operator
+	 * @param os Output stream
+	 * @param value Decimal64 value to output
+	 * @return Reference to output stream
+	 */
+	inline std::ostream& operator<<( std::ostream& os, const Decimal64& value );
+
+	/**
+	 * @brief Input stream operator
+	 * @param is Input stream
+	 * @param value Decimal64 value to input
+	 * @return Reference to input stream
+	 */
+	inline std::istream& operator>>( std::istream& is, Decimal64& value );
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/Decimal64.inl"
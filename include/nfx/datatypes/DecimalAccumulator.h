@@ -0,0 +1,312 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DecimalAccumulator.h
+ * @brief Exact Decimal sums and dot products with a single normalization at the end
+ * @details DecimalAccumulator sums any number of Decimal values and products without rounding
+ *          or overflowing mid-stream. Repeated operator* and operator+ normalize and range check
+ *          once per operation; the accumulator defers all of that to result().
+ *
+ *          Internal representation:
+ *          - A signed 256-bit total at the largest scale absorbed so far
+ *          - Values at that scale are added to a 128-bit partial sum with no multiply at all
+ *            (folded into the total every 2^31 values, before it could overflow)
+ *          - Products keep their full 192-bit mantissa and the sum of both scales (up to 56);
+ *            products at the internal scale are added with no multiply at all
+ *          - Values and products at a smaller scale are lifted with one multiply by a power of 10
+ *          - A value at a larger scale lifts the total once, and becomes the new scale
+ *
+ *          The total is exact while it stays below 2^254 at the internal scale. Sums of plain
+ *          values never come close; with products, only integer parts above 10^20 mixed with
+ *          products of more than 36 fractional digits can exceed it, and result() then reports
+ *          an overflow. result() converts the total with the rules of the non-throwing Decimal
+ *          arithmetic: the sum is normalized, and fractional digits are truncated only if the
+ *          integer part needs most of the 96 bits.
+ *
+ *          Accumulators are independent values: fill one per thread, partition or group and
+ *          combine them with merge(). The result does not depend on the order of add() and
+ *          merge() calls.
+ *
+ *          Usage:
+ *          @code
+ *          DecimalAccumulator total;
+ *          total.add( cash );
+ *          total.addWeighted( prices, quantities );
+ *          total.merge( otherPartition );
+ *
+ *          Decimal valuation{ total.result() };
+ *          Decimal notional{ DecimalAccumulator::dot( prices, quantities ) };
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "ArithmeticStatus.h"
+#include "Decimal.h"
+#include "DecimalColumn.h"
+#include "Int128.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// DecimalAccumulator class
+	//=====================================================================
+
+	/**
+	 * @brief Exact running sum of Decimal values, normalized once on result()
+	 */
+	class DecimalAccumulator final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor (empty sum)
+		 */
+		inline constexpr DecimalAccumulator() noexcept;
+
+		//----------------------------------------------
+		// Accumulation
+		//----------------------------------------------
+
+		/**
+		 * @brief Add one value
+		 * @param value Value to add
+		 */
+		inline constexpr void add( const Decimal& value ) noexcept;
+
+		/**
+		 * @brief Add every value of a span
+		 * @param values Values to add
+		 */
+		inline constexpr void add( std::span<const Decimal> values ) noexcept;
+
+		/**
+		 * @brief Add every valid row of a column
+		 * @param column Rows to add; null rows are skipped and not counted
+		 */
+		inline void add( const DecimalColumn& column ) noexcept;
+
+		/**
+		 * @brief Add the exact product of two values
+		 * @param value Value to weight
+		 * @param weight Weight (quantity, factor)
+		 */
+		inline constexpr void addWeighted( const Decimal& value, const Decimal& weight ) noexcept;
+
+		/**
+		 * @brief Add the exact products of two spans, element by element
+		 * @param values Values to weight
+		 * @param weights Weights, one per value
+		 * @throws std::invalid_argument if the spans differ in size
+		 */
+		inline constexpr void addWeighted( std::span<const Decimal> values, std::span<const Decimal> weights );
+
+		/**
+		 * @brief Add the values absorbed by another accumulator
+		 * @param other Accumulator to combine with this one (unchanged)
+		 */
+		inline constexpr void merge( const DecimalAccumulator& other ) noexcept;
+
+		/**
+		 * @brief Discard every value absorbed so far
+		 */
+		inline constexpr void reset() noexcept;
+
+		//----------------------------------------------
+		// Result
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the sum
+		 * @return Normalized sum of every value absorbed (zero if none)
+		 * @throws std::overflow_error if the sum is outside the Decimal range
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal result() const;
+
+		/**
+		 * @brief Get the sum without throwing
+		 * @param status Raises Overflow (result clamped) or Inexact (fractional digits truncated)
+		 * @return Normalized sum of every value absorbed (zero if none)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal result( ArithmeticStatus& status ) const noexcept;
+
+		/**
+		 * @brief Compute a dot product rounded once
+		 * @param values First operand (e.g. prices)
+		 * @param weights Second operand (e.g. quantities), one per value
+		 * @return Normalized sum of values[i] * weights[i] (zero for empty spans)
+		 * @throws std::invalid_argument if the spans differ in size
+		 * @throws std::overflow_error if the sum is outside the Decimal range
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal dot( std::span<const Decimal> values, std::span<const Decimal> weights );
+
+		/**
+		 * @brief Compute a dot product rounded once, without throwing on overflow
+		 * @param values First operand (e.g. prices)
+		 * @param weights Second operand (e.g. quantities), one per value
+		 * @param status Raises Overflow (result clamped) or Inexact (fractional digits truncated)
+		 * @return Normalized sum of values[i] * weights[i] (zero for empty spans)
+		 * @throws std::invalid_argument if the spans differ in size
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal dot( std::span<const Decimal> values, std::span<const Decimal> weights, ArithmeticStatus& status );
+
+		/**
+		 * @brief Get the number of values absorbed
+		 * @return Count of values and products added, including those of merged accumulators
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::uint64_t count() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief Add a run of values, keeping the same-scale partial sum out of memory
+		 * @tparam Rows Callable (index, lo64&, hi32&, flags&) -> bool, false for rows to skip
+		 * @param rows Number of rows
+		 * @param read Reads the mantissa words and flags of a row
+		 */
+		template <typename Rows>
+		inline constexpr void addRows( std::size_t rows, Rows read ) noexcept;
+
+		/**
+		 * @brief Add a value given as mantissa words, scale and sign
+		 * @param lo64 Mantissa bits 0-63
+		 * @param hi32 Mantissa bits 64-95
+		 * @param flags Scale and sign in the Decimal flags layout
+		 */
+		inline constexpr void addWords( std::uint64_t lo64, std::uint32_t hi32, std::uint32_t flags ) noexcept;
+
+		/**
+		 * @brief Add a value at the internal scale to the partial sum
+		 * @param lo64 Mantissa bits 0-63
+		 * @param hi32 Mantissa bits 64-95
+		 * @param negative Sign of the value
+		 */
+		inline constexpr void addPending( std::uint64_t lo64, std::uint32_t hi32, bool negative ) noexcept;
+
+		/**
+		 * @brief Add a value whose scale differs from the internal scale
+		 * @param lo64 Mantissa bits 0-63
+		 * @param hi32 Mantissa bits 64-95
+		 * @param scale Scale of the value
+		 * @param negative Sign of the value
+		 */
+		inline constexpr void addRescaled( std::uint64_t lo64, std::uint32_t hi32, std::uint8_t scale, bool negative ) noexcept;
+
+		/**
+		 * @brief Add a product whose scale differs from the internal scale
+		 * @param magnitude Product mantissa (below 2^192)
+		 * @param scale Scale of the product (0-56)
+		 * @param negative Sign of the product
+		 */
+		inline constexpr void addProductRescaled( const internal::UInt256& magnitude, std::uint8_t scale, bool negative ) noexcept;
+
+		/**
+		 * @brief Add a magnitude at the internal scale to the total, tracking overflow
+		 * @param magnitude Magnitude to add (below 2^254)
+		 * @param negative true to subtract
+		 */
+		inline constexpr void addToTotal( const internal::UInt256& magnitude, bool negative ) noexcept;
+
+		/**
+		 * @brief Record an overflow, and clear the total, if it reached 2^254 in magnitude
+		 */
+		inline constexpr void checkTotalRange() noexcept;
+
+		/**
+		 * @brief Multiply a magnitude by a power of 10, tracking overflow
+		 * @param magnitude Magnitude to lift
+		 * @param power Power of 10 (0-56)
+		 * @param negative Sign recorded if the product does not fit
+		 * @return magnitude * 10^power if below 2^254; zero, with the overflow flag set, otherwise
+		 */
+		[[nodiscard]] inline constexpr internal::UInt256 lift( const internal::UInt256& magnitude, std::uint8_t power, bool negative ) noexcept;
+
+		/**
+		 * @brief Record that the total left the exact range (the first sign is kept)
+		 * @param negative Sign of the value that did not fit
+		 */
+		inline constexpr void markOverflow( bool negative ) noexcept;
+
+		/**
+		 * @brief Raise the internal scale, folding the partial sum and multiplying the total
+		 * @param scale New scale (greater than the current one)
+		 */
+		inline constexpr void raiseScale( std::uint8_t scale ) noexcept;
+
+		/**
+		 * @brief Fold the partial sum into the total
+		 */
+		inline constexpr void flushPending() noexcept;
+
+		/**
+		 * @brief Get the total including the partial sum
+		 * @return Signed 256-bit total at the internal scale (two's complement)
+		 */
+		[[nodiscard]] inline constexpr internal::UInt256 combinedTotal() const noexcept;
+
+		//----------------------------------------------
+		// Member variables
+		//----------------------------------------------
+
+		/** @brief Total at m_scale, excluding m_pending (two's complement modulo 2^256) */
+		internal::UInt256 m_total;
+
+		/** @brief Partial sum of the latest values at m_scale */
+		Int128 m_pending;
+
+		/** @brief Number of values in m_pending */
+		std::uint32_t m_pendingCount;
+
+		/** @brief Scale of m_total and m_pending (largest scale absorbed, up to 56 with products) */
+		std::uint8_t m_scale;
+
+		/** @brief Number of values absorbed */
+		std::uint64_t m_count;
+
+		/** @brief Set once the total left the exact range */
+		bool m_overflow;
+
+		/** @brief Sign of the total when it left the exact range */
+		bool m_overflowNegative;
+	};
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/DecimalAccumulator.inl"
@@ -0,0 +1,282 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DecimalColumn.h
+ * @brief Structure-of-arrays column of Decimal values with an optional validity bitmap
+ * @details DecimalColumn stores each field of a Decimal in its own contiguous array so that
+ *          batch kernels can stream over one field at a time with unit-stride loads:
+ *
+ *          ┌─────────────┬──────────────────────┬────────────────────────────────────────────┐
+ *          │   Array     │   Element type       │   Contents                                 │
+ *          ├─────────────┼──────────────────────┼────────────────────────────────────────────┤
+ *          │  lo64       │  std::uint64_t       │  Mantissa bits 0-63                        │
+ *          │  hi32       │  std::uint32_t       │  Mantissa bits 64-95                       │
+ *          │  scaleSign  │  std::uint32_t       │  Decimal flags word (scale bits 16-23,     │
+ *          │             │                      │  sign bit 31)                              │
+ *          │  validity   │  std::uint64_t       │  Optional bitmap, bit i of word i / 64     │
+ *          │             │                      │  set when row i is valid (not null)        │
+ *          └─────────────┴──────────────────────┴────────────────────────────────────────────┘
+ *
+ *          Semantics:
+ *          - Values are stored bit for bit; an unnormalized scale survives the round trip
+ *          - The validity bitmap is only allocated once the first null is appended; until then
+ *            validity() is empty and every row is valid
+ *          - Null rows hold zero in every value array, so kernels may process them unmasked
+ *          - Unused high bits of the last validity word are always zero
+ *          - gather() and slice() return new columns that own their storage
+ *
+ *          Usage:
+ *          @code
+ *          DecimalColumn column{ prices };    // std::span<const Decimal>
+ *          column.appendNull();
+ *
+ *          DecimalColumn recent{ column.slice( column.size() - 100, 100 ) };
+ *          std::vector<Decimal> restored( recent.size() );
+ *          recent.toDecimals( restored );     // nulls are written as zero
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Decimal.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// DecimalColumn class
+	//=====================================================================
+
+	/**
+	 * @brief Columnar (structure-of-arrays) storage for Decimal values with optional nulls
+	 */
+	class DecimalColumn final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor (empty column without validity bitmap)
+		 */
+		DecimalColumn() = default;
+
+		/**
+		 * @brief Construct from a span of Decimal values
+		 * @param values Values to store (all valid)
+		 */
+		inline explicit DecimalColumn( std::span<const Decimal> values );
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of rows, including nulls
+		 * @return Row count
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check whether the column has no rows
+		 * @return true if empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool empty() const noexcept;
+
+		/**
+		 * @brief Reserve storage for a number of rows in every array
+		 * @param capacity Row count to reserve
+		 */
+		inline void reserve( std::size_t capacity );
+
+		/**
+		 * @brief Remove all rows and release the validity bitmap
+		 */
+		inline void clear() noexcept;
+
+		//----------------------------------------------
+		// Appending
+		//----------------------------------------------
+
+		/**
+		 * @brief Append a valid value
+		 * @param value Value to append
+		 */
+		inline void append( const Decimal& value );
+
+		/**
+		 * @brief Append a span of valid values
+		 * @param values Values to append
+		 */
+		inline void append( std::span<const Decimal> values );
+
+		/**
+		 * @brief Append a null row
+		 * @note Allocates the validity bitmap on first use
+		 */
+		inline void appendNull();
+
+		//----------------------------------------------
+		// Element access
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the value of a row
+		 * @param index Row index (must be less than size())
+		 * @return Stored value, or zero for a null row
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Decimal operator[]( std::size_t index ) const noexcept;
+
+		/**
+		 * @brief Check whether a row holds a value
+		 * @param index Row index (must be less than size())
+		 * @return true if the row is not null
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isValid( std::size_t index ) const noexcept;
+
+		/**
+		 * @brief Check whether the column contains any null rows
+		 * @return true if the validity bitmap is allocated and has a cleared bit
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool hasNulls() const noexcept;
+
+		/**
+		 * @brief Count null rows
+		 * @return Number of rows whose validity bit is cleared
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t nullCount() const noexcept;
+
+		//----------------------------------------------
+		// Column arrays
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the low 64 mantissa bits of every row
+		 * @return Read-only view of size() elements
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::span<const std::uint64_t> lo64() const noexcept;
+
+		/**
+		 * @brief Get the high 32 mantissa bits of every row
+		 * @return Read-only view of size() elements
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::span<const std::uint32_t> hi32() const noexcept;
+
+		/**
+		 * @brief Get the Decimal flags word (scale and sign) of every row
+		 * @return Read-only view of size() elements
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::span<const std::uint32_t> scaleSign() const noexcept;
+
+		/**
+		 * @brief Get the validity bitmap
+		 * @return Read-only view of (size() + 63) / 64 words, or an empty view if no null was ever appended
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::span<const std::uint64_t> validity() const noexcept;
+
+		//----------------------------------------------
+		// Selection
+		//----------------------------------------------
+
+		/**
+		 * @brief Copy the rows at the given indices into a new column
+		 * @param indices Row indices to copy, in output order (repeats allowed)
+		 * @return Column with indices.size() rows; has a validity bitmap only if this column has one
+		 * @throws std::out_of_range if an index is not less than size()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline DecimalColumn gather( std::span<const std::size_t> indices ) const;
+
+		/**
+		 * @brief Copy a contiguous range of rows into a new column
+		 * @param offset First row to copy
+		 * @param count Number of rows to copy
+		 * @return Column with count rows; has a validity bitmap only if this column has one
+		 * @throws std::out_of_range if offset + count exceeds size()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline DecimalColumn slice( std::size_t offset, std::size_t count ) const;
+
+		//----------------------------------------------
+		// Bulk conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Write every row as a Decimal
+		 * @param destination Output span (at least size() elements); null rows are written as zero
+		 * @throws std::invalid_argument if destination is smaller than the column
+		 */
+		inline void toDecimals( std::span<Decimal> destination ) const;
+
+	private:
+		//----------------------------------------------
+		// Internal helpers
+		//----------------------------------------------
+
+		/**
+		 * @brief Allocate the validity bitmap with every existing row marked valid
+		 */
+		inline void materializeValidity();
+
+		/**
+		 * @brief Record the validity bit of the row that was just appended
+		 * @param valid Validity of the new row
+		 */
+		inline void pushValidity( bool valid );
+
+		//----------------------------------------------
+		// Column storage
+		//----------------------------------------------
+
+		/** @brief Mantissa bits 0-63 */
+		std::vector<std::uint64_t> m_lo64;
+
+		/** @brief Mantissa bits 64-95 */
+		std::vector<std::uint32_t> m_hi32;
+
+		/** @brief Decimal flags word (scale bits 16-23, sign bit 31) */
+		std::vector<std::uint32_t> m_scaleSign;
+
+		/** @brief Validity bitmap (empty until the first null) */
+		std::vector<std::uint64_t> m_validity;
+	};
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/DecimalColumn.inl"
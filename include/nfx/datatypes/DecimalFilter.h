@@ -0,0 +1,165 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DecimalFilter.h
+ * @brief Predicate kernels comparing many Decimal values against constant bounds
+ * @details DecimalFilter evaluates a comparison (value < bound, lower <= value <= upper, ...)
+ *          for every value of a span or DecimalColumn and writes the outcome as a selection
+ *          bitmask, which toIndices turns into row indices for DecimalColumn::gather.
+ *
+ *          Instead of aligning scales per row as Decimal::operator< does, each bound is
+ *          aligned once for every scale present in the input: at scale s, value < B holds
+ *          exactly when the signed mantissa is below ceil(B * 10^s), value <= B when it is
+ *          below floor(B * 10^s) + 1, and so on. Every predicate therefore reduces to a range
+ *          test low <= mantissa < high on 128-bit integers, whose thresholds are cached per
+ *          scale (clamped to +/-2^97, beyond any 96-bit mantissa).
+ *
+ *          For a DecimalColumn the mantissa words are already stored in separate arrays, so
+ *          runs of eight (AVX-512) or four (AVX2) values sharing a scale are compared in
+ *          vector registers, as chosen by CpuDispatch; groups mixing scales and Decimal spans
+ *          use the scalar kernel.
+ *
+ *          Semantics:
+ *          - Comparisons are exact: results agree with the Decimal operators, and stay exact
+ *            where aligning both scales would need more than 128 bits; zero and negative
+ *            zero compare equal
+ *          - Bitmasks use the DecimalColumn validity layout: bit i % 64 of word i / 64, set
+ *            when row i is selected; unused bits of the last word are cleared
+ *          - Null rows of a column are never selected, whatever the predicate
+ *
+ *          Usage:
+ *          @code
+ *          std::vector<std::uint64_t> selection( ( prices.size() + 63 ) / 64 );
+ *          DecimalFilter::compare( prices, DecimalFilter::Comparison::GreaterOrEqual, Decimal{ "100.5" }, selection );
+ *
+ *          std::vector<std::size_t> rows( prices.size() );
+ *          rows.resize( DecimalFilter::toIndices( selection, prices.size(), rows ) );
+ *          DecimalColumn matches{ prices.gather( rows ) };
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Decimal.h"
+#include "DecimalColumn.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// DecimalFilter class
+	//=====================================================================
+
+	/**
+	 * @brief Evaluates comparisons against constant bounds over many Decimal values
+	 */
+	class DecimalFilter final
+	{
+	public:
+		DecimalFilter() = delete;
+
+		//----------------------------------------------
+		// Comparison operators
+		//----------------------------------------------
+
+		/**
+		 * @brief Relation between each value and the bound
+		 */
+		enum class Comparison : std::uint8_t
+		{
+			Less = 0,		///< value < bound
+			LessOrEqual,	///< value <= bound
+			Greater,		///< value > bound
+			GreaterOrEqual, ///< value >= bound
+			Equal,			///< value == bound (numerically, whatever the scales)
+			NotEqual		///< value != bound
+		};
+
+		//----------------------------------------------
+		// Span predicates
+		//----------------------------------------------
+
+		/**
+		 * @brief Compare every value against a bound
+		 * @param values Values to test
+		 * @param comparison Relation to test
+		 * @param bound Constant right-hand side
+		 * @param selection Output bitmask (at least (values.size() + 63) / 64 words)
+		 * @throws std::invalid_argument if selection is too small
+		 */
+		static void compare( std::span<const Decimal> values, Comparison comparison, const Decimal& bound, std::span<std::uint64_t> selection );
+
+		/**
+		 * @brief Select values inside an inclusive range
+		 * @param values Values to test
+		 * @param lower Smallest value selected
+		 * @param upper Largest value selected (nothing is selected if upper < lower)
+		 * @param selection Output bitmask (at least (values.size() + 63) / 64 words)
+		 * @throws std::invalid_argument if selection is too small
+		 */
+		static void between( std::span<const Decimal> values, const Decimal& lower, const Decimal& upper, std::span<std::uint64_t> selection );
+
+		//----------------------------------------------
+		// Column predicates
+		//----------------------------------------------
+
+		/**
+		 * @brief Compare every row of a column against a bound
+		 * @param column Rows to test; null rows are never selected
+		 * @param comparison Relation to test
+		 * @param bound Constant right-hand side
+		 * @param selection Output bitmask (at least (column.size() + 63) / 64 words)
+		 * @throws std::invalid_argument if selection is too small
+		 */
+		static void compare( const DecimalColumn& column, Comparison comparison, const Decimal& bound, std::span<std::uint64_t> selection );
+
+		/**
+		 * @brief Select rows of a column inside an inclusive range
+		 * @param column Rows to test; null rows are never selected
+		 * @param lower Smallest value selected
+		 * @param upper Largest value selected (nothing is selected if upper < lower)
+		 * @param selection Output bitmask (at least (column.size() + 63) / 64 words)
+		 * @throws std::invalid_argument if selection is too small
+		 */
+		static void between( const DecimalColumn& column, const Decimal& lower, const Decimal& upper, std::span<std::uint64_t> selection );
+
+		//----------------------------------------------
+		// Selection conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Convert a selection bitmask to ascending row indices
+		 * @param selection Bitmask in the DecimalColumn validity layout
+		 * @param count Number of rows covered by the bitmask
+		 * @param indices Output indices (at least one per selected row)
+		 * @return Number of indices written
+		 * @throws std::invalid_argument if selection covers fewer than count rows or indices is too small
+		 */
+		static std::size_t toIndices( std::span<const std::uint64_t> selection, std::size_t count, std::span<std::size_t> indices );
+	};
+} // namespace nfx::datatypes
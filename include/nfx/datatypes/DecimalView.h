@@ -0,0 +1,211 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DecimalView.h
+ * @brief Read-only view of 16-byte decimal records in a raw byte buffer
+ * @details DecimalView reads Decimal values straight out of a received or mapped buffer,
+ *          without a copy or a text round trip. Each record is 16 bytes in one of three
+ *          layouts:
+ *
+ *          ┌──────────────┬─────────────────────────────┬──────────────────────────────────────────┐
+ *          │    Layout    │    32-bit words, in order   │                  Source                  │
+ *          ├──────────────┼─────────────────────────────┼──────────────────────────────────────────┤
+ *          │ Native       │  flags, lo, mid, hi         │  Decimal objects copied byte for byte    │
+ *          │ DotNetBits   │  lo, mid, hi, flags         │  .NET BinaryWriter / Decimal.GetBits     │
+ *          │ DotNetMemory │  flags, hi, lo, mid         │  .NET System.Decimal copied from memory  │
+ *          └──────────────┴─────────────────────────────┴──────────────────────────────────────────┘
+ *
+ *          Native words are in host byte order; the .NET layouts are little-endian. Every
+ *          record is validated like Decimal::fromBits(): reserved flag bits must be clear and
+ *          the scale at most 28.
+ *
+ *          Native buffers aligned to 4 bytes can also be used in place as
+ *          std::span<const Decimal> through asDecimals(), which validates every record once.
+ *
+ *          Usage:
+ *          @code
+ *          DecimalView prices{ std::as_bytes( std::span{ payload } ), DecimalView::Layout::DotNetBits };
+ *          for ( std::size_t i{ 0 }; i < prices.size(); ++i )
+ *          {
+ *              book.update( prices[i] );
+ *          }
+ *
+ *          std::span<const Decimal> stored{ DecimalView::asDecimals( mappedBytes ) };
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Decimal.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// DecimalView class
+	//=====================================================================
+
+	/**
+	 * @brief Non-owning, validated view of 16-byte decimal records
+	 */
+	class DecimalView final
+	{
+	public:
+		//----------------------------------------------
+		// Record layouts
+		//----------------------------------------------
+
+		/**
+		 * @brief Word order of a 16-byte record
+		 */
+		enum class Layout : std::uint8_t
+		{
+			Native = 0,	 ///< Decimal in-memory layout (flags, lo, mid, hi), host byte order
+			DotNetBits,	 ///< .NET GetBits / BinaryWriter order (lo, mid, hi, flags), little-endian
+			DotNetMemory ///< .NET System.Decimal fields (flags, hi, lo, mid), little-endian
+		};
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor (empty view)
+		 */
+		inline constexpr DecimalView() noexcept;
+
+		/**
+		 * @brief Construct over a byte buffer
+		 * @param bytes Records, 16 bytes each; must outlive the view
+		 * @param layout Word order of every record
+		 * @throws std::invalid_argument if the buffer size is not a multiple of 16
+		 */
+		inline DecimalView( std::span<const std::byte> bytes, Layout layout );
+
+		//----------------------------------------------
+		// Element access
+		//----------------------------------------------
+
+		/**
+		 * @brief Read a record
+		 * @param index Record index (must be less than size())
+		 * @return Decimal with the bits of the record
+		 * @throws std::invalid_argument if the record is not a valid decimal
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Decimal operator[]( std::size_t index ) const;
+
+		/**
+		 * @brief Read a record without throwing
+		 * @param index Record index (must be less than size())
+		 * @param result Output Decimal (unchanged on failure)
+		 * @return true if the record is a valid decimal
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool tryGet( std::size_t index, Decimal& result ) const noexcept;
+
+		/**
+		 * @brief Find the first record that is not a valid decimal
+		 * @return Index of that record, or size() if every record is valid
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t findInvalid() const noexcept;
+
+		//----------------------------------------------
+		// Bulk conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Copy every record into Decimal values
+		 * @param destination Output span (at least size() elements)
+		 * @throws std::invalid_argument if destination is too small or a record is not valid
+		 *         (records before the failing one have been written)
+		 */
+		inline void toDecimals( std::span<Decimal> destination ) const;
+
+		/**
+		 * @brief Copy records into Decimal values without throwing
+		 * @param destination Output span
+		 * @return Number of leading records converted; stops at the first invalid record or
+		 *         when destination is full
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t tryToDecimals( std::span<Decimal> destination ) const noexcept;
+
+		/**
+		 * @brief Use a Native buffer in place as Decimal values
+		 * @param bytes Native records, 16 bytes each, aligned to alignof( Decimal )
+		 * @return Span over the same memory
+		 * @throws std::invalid_argument if the size is not a multiple of 16, the buffer is
+		 *         misaligned, or a record is not a valid decimal
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static std::span<const Decimal> asDecimals( std::span<const std::byte> bytes );
+
+		//----------------------------------------------
+		// Property accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of records
+		 * @return Buffer size divided by 16
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check if the view has no records
+		 * @return true if size() is 0
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Get the record layout
+		 * @return Layout given at construction
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Layout layout() const noexcept;
+
+		/**
+		 * @brief Get the underlying buffer
+		 * @return Bytes given at construction
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::span<const std::byte> bytes() const noexcept;
+
+	private:
+		/** @brief Records */
+		std::span<const std::byte> m_bytes;
+
+		/** @brief Word order of every record */
+		Layout m_layout;
+	};
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/DecimalView.inl"
@@ -0,0 +1,357 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FixedDecimal.h
+ * @brief Fixed-point decimal type with a compile-time scale
+ * @details FixedDecimal<Scale, Storage> stores value * 10^Scale as a plain signed integer.
+ *          Because every value of a given type shares the same scale, addition, subtraction
+ *          and comparison are single integer instructions: there is no scale extraction,
+ *          alignment or normalization as in Decimal.
+ *
+ *          Storage options:
+ *          ┌──────────────┬─────────────┬──────────────────────────────────────────────┐
+ *          │   Storage    │  Max Scale  │                    Range                     │
+ *          ├──────────────┼─────────────┼──────────────────────────────────────────────┤
+ *          │ std::int64_t │     18      │  ±9,223,372,036,854,775,807 / 10^Scale       │
+ *          │ Int128       │     28      │  ±2^127 / 10^Scale                           │
+ *          └──────────────┴─────────────┴──────────────────────────────────────────────┘
+ *
+ *          Arithmetic semantics:
+ *          - Addition, subtraction and comparison operate directly on the raw integers
+ *          - Multiplication and division compute the exact wide intermediate and round
+ *            back to Scale digits with banker's rounding (Decimal::RoundingMode::ToNearest)
+ *          - All arithmetic (including negation) and conversions throw std::overflow_error
+ *            when the result does not fit the storage type
+ *
+ *          Conversions with Decimal are explicit and exactly rounded in both directions.
+ *
+ *          Usage:
+ *          @code
+ *          using Price = nfx::datatypes::FixedDecimal<4>;
+ *          using Quantity = nfx::datatypes::FixedDecimal<8>;
+ *
+ *          Price bid{ "101.2500" };
+ *          Price ask{ bid + Price::fromRaw( 25 ) }; // one tick = 0.0025
+ *          Decimal mid{ ( ( bid + ask ) / Price{ 2 } ).toDecimal() };
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "Decimal.h"
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		/**
+		 * @brief Maximum scale supported by a FixedDecimal storage type
+		 * @tparam Storage std::int64_t or Int128
+		 * @return 18 for std::int64_t, 28 for Int128, 0 for unsupported types
+		 */
+		template <typename Storage>
+		inline constexpr std::uint8_t fixedDecimalMaxScale() noexcept
+		{
+			if constexpr ( std::is_same_v<Storage, std::int64_t> )
+			{
+				return 18U;
+			}
+			else if constexpr ( std::is_same_v<Storage, Int128> )
+			{
+				return 28U;
+			}
+			else
+			{
+				return 0U;
+			}
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// FixedDecimal class
+	//=====================================================================
+
+	/**
+	 * @brief Signed fixed-point decimal with a compile-time number of decimal places
+	 * @tparam Scale Number of digits after the decimal point
+	 * @tparam Storage Underlying integer type (std::int64_t or Int128)
+	 */
+	template <std::uint8_t Scale, typename Storage = std::int64_t>
+	class FixedDecimal final
+	{
+		static_assert( std::is_same_v<Storage, std::int64_t> || std::is_same_v<Storage, Int128>,
+			"FixedDecimal storage must be std::int64_t or Int128" );
+		static_assert( Scale <= internal::fixedDecimalMaxScale<Storage>(),
+			"FixedDecimal scale exceeds the precision of the storage type" );
+
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor (zero value)
+		 */
+		inline constexpr FixedDecimal() noexcept;
+
+		/**
+		 * @brief Construct from an integer value
+		 * @param value Integer value (scaled by 10^Scale internally)
+		 * @throws std::overflow_error if value * 10^Scale does not fit the storage type
+		 */
+		inline explicit constexpr FixedDecimal( std::int64_t value );
+
+		/**
+		 * @brief Construct from a Decimal, rounding to Scale digits
+		 * @param value Decimal value to convert
+		 * @param mode Rounding mode applied to digits beyond Scale
+		 * @throws std::overflow_error if the rounded value does not fit the storage type
+		 */
+		inline explicit constexpr FixedDecimal( const Decimal& value, Decimal::RoundingMode mode = Decimal::RoundingMode::ToNearest );
+
+		/**
+		 * @brief Construct from a string
+		 * @param str String in the Decimal::parse format, rounded half-even to Scale digits
+		 * @throws std::invalid_argument if the string is not a valid decimal
+		 * @throws std::overflow_error if the value does not fit the storage type
+		 */
+		inline explicit constexpr FixedDecimal( std::string_view str );
+
+		/**
+		 * @brief Construct from the raw scaled integer
+		 * @param raw Value multiplied by 10^Scale
+		 * @return FixedDecimal holding raw / 10^Scale
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr FixedDecimal fromRaw( Storage raw ) noexcept;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/**
+		 * @brief Number of decimal places of this type
+		 * @return Scale
+		 */
+		[[nodiscard]] inline static constexpr std::uint8_t scale() noexcept;
+
+		/**
+		 * @brief Smallest representable value
+		 * @return Storage minimum / 10^Scale
+		 */
+		[[nodiscard]] inline static constexpr FixedDecimal minValue() noexcept;
+
+		/**
+		 * @brief Largest representable value
+		 * @return Storage maximum / 10^Scale
+		 */
+		[[nodiscard]] inline static constexpr FixedDecimal maxValue() noexcept;
+
+		//----------------------------------------------
+		// Arithmetic operators
+		//----------------------------------------------
+
+		/**
+		 * @brief Addition operator (raw integer addition)
+		 * @param other Value to add
+		 * @return Sum
+		 * @throws std::overflow_error if the sum does not fit the storage type
+		 */
+		inline constexpr FixedDecimal operator+( const FixedDecimal& other ) const;
+
+		/**
+		 * @brief Subtraction operator (raw integer subtraction)
+		 * @param other Value to subtract
+		 * @return Difference
+		 * @throws std::overflow_error if the difference does not fit the storage type
+		 */
+		inline constexpr FixedDecimal operator-( const FixedDecimal& other ) const;
+
+		/**
+		 * @brief Multiplication operator
+		 * @param other Value to multiply by
+		 * @return Product rounded to Scale digits (ties to even)
+		 * @throws std::overflow_error if the product does not fit the storage type
+		 */
+		inline constexpr FixedDecimal operator*( const FixedDecimal& other ) const;
+
+		/**
+		 * @brief Division operator
+		 * @param other Divisor
+		 * @return Quotient rounded to Scale digits (ties to even)
+		 * @throws std::overflow_error if divisor is zero or the quotient does not fit the storage type
+		 */
+		inline constexpr FixedDecimal operator/( const FixedDecimal& other ) const;
+
+		/**
+		 * @brief Unary minus operator
+		 * @return Negated value
+		 * @throws std::overflow_error if the value is minValue()
+		 */
+		inline constexpr FixedDecimal operator-() const;
+
+		/** @brief Addition assignment operator (throws std::overflow_error like operator+) */
+		inline constexpr FixedDecimal& operator+=( const FixedDecimal& other );
+
+		/** @brief Subtraction assignment operator (throws std::overflow_error like operator-) */
+		inline constexpr FixedDecimal& operator-=( const FixedDecimal& other );
+
+		/** @brief Multiplication assignment operator */
+		inline constexpr FixedDecimal& operator*=( const FixedDecimal& other );
+
+		/** @brief Division assignment operator */
+		inline constexpr FixedDecimal& operator/=( const FixedDecimal& other );
+
+		//----------------------------------------------
+		// Comparison operators
+		//----------------------------------------------
+
+		inline constexpr bool operator==( const FixedDecimal& other ) const noexcept;
+		inline constexpr bool operator!=( const FixedDecimal& other ) const noexcept;
+		inline constexpr bool operator<( const FixedDecimal& other ) const noexcept;
+		inline constexpr bool operator<=( const FixedDecimal& other ) const noexcept;
+		inline constexpr bool operator>( const FixedDecimal& other ) const noexcept;
+		inline constexpr bool operator>=( const FixedDecimal& other ) const noexcept;
+
+		//----------------------------------------------
+		// String parsing
+		//----------------------------------------------
+
+		/**
+		 * @brief Parse string to FixedDecimal
+		 * @param str String in the Decimal::parse format, rounded half-even to Scale digits
+		 * @return Parsed value rounded to Scale digits
+		 * @throws std::invalid_argument if the string is not a valid decimal
+		 * @throws std::overflow_error if the value does not fit the storage type
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr FixedDecimal parse( std::string_view str );
+
+		/**
+		 * @brief Try to parse string to FixedDecimal without throwing
+		 * @param str String to parse
+		 * @param result Output value (unspecified on failure)
+		 * @return true if parsing succeeded and the value fits, false otherwise
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr bool tryParse( std::string_view str, FixedDecimal& result ) noexcept;
+
+		//----------------------------------------------
+		// Type conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Convert to Decimal
+		 * @return Normalized Decimal equal to this value, rounded to nearest (ties to even)
+		 *         only when the magnitude exceeds the 96-bit Decimal mantissa
+		 * @throws std::overflow_error if the integer part alone exceeds the Decimal range
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal toDecimal() const;
+
+		/**
+		 * @brief Convert to string with exactly Scale decimal places
+		 * @return String such as "-12.3400" for FixedDecimal<4>
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::string toString() const;
+
+		//----------------------------------------------
+		// Property accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Raw scaled integer
+		 * @return Value multiplied by 10^Scale
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Storage raw() const noexcept;
+
+		//----------------------------------------------
+		// State checking
+		//----------------------------------------------
+
+		/**
+		 * @brief Check if value is zero
+		 * @return true if zero
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool isZero() const noexcept;
+
+		/**
+		 * @brief Check if value is negative
+		 * @return true if negative
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool isNegative() const noexcept;
+
+		//----------------------------------------------
+		// Mathematical operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Absolute value
+		 * @return Non-negative value
+		 * @throws std::overflow_error if the value is minValue()
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr FixedDecimal abs() const;
+
+	private:
+		/** @brief Value multiplied by 10^Scale */
+		Storage m_value;
+	};
+
+	//=====================================================================
+	// Stream operators
+	//=====================================================================
+
+	/**
+	 * @brief Output stream operator
+	 * @param os Output stream
+	 * @param value FixedDecimal value to output
+	 * @return Reference to output stream
+	 */
+	template <std::uint8_t Scale, typename Storage>
+	std::ostream& operator<<( std::ostream& os, const FixedDecimal<Scale, Storage>& value );
+
+	/**
+	 * @brief Input stream operator
+	 * @param is Input stream
+	 * @param value FixedDecimal value to input
+	 * @return Reference to input stream
+	 */
+	template <std::uint8_t Scale, typename Storage>
+	std::istream& operator>>( std::istream& is, FixedDecimal<Scale, Storage>& value );
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/FixedDecimal.inl"
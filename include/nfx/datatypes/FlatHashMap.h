@@ -0,0 +1,309 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FlatHashMap.h
+ * @brief Open-addressing hash maps keyed by Decimal or Int128
+ * @details FlatHashMap stores every key as two canonical 64-bit words next to its value, in
+ *          one flat array, and compares keys as raw words. std::unordered_map keeps one
+ *          heap node per entry and compares Decimal keys with operator==, which aligns scales
+ *          on every probe.
+ *
+ *          Canonical keys:
+ *          - Int128: the two's complement low and high words
+ *          - Decimal: trailing zeros are removed first, so 1.5 and 1.50 are the same key, and
+ *            -0 is stored as 0; the words are the 96-bit mantissa and the flags word
+ *
+ *          Table layout (Swiss table):
+ *          - One control byte per slot: empty, deleted, or 7 bits of the key hash
+ *          - Slots are probed 16 at a time: the control bytes of a group are compared with
+ *            SSE2 where available (a portable scalar loop otherwise), and only slots whose
+ *            7-bit tag matches have their key words compared
+ *          - Groups are visited in triangular order; a group with an empty slot ends a lookup
+ *          - The table doubles beyond 7/8 occupancy and is rebuilt in place when erased slots
+ *            fill it
+ *
+ *          Values must be default constructible and move assignable. Inserting can move
+ *          every entry: references and pointers returned by find() or operator[] are
+ *          invalidated by any later insertion.
+ *
+ *          Usage:
+ *          @code
+ *          DecimalFlatMap<Decimal> volumeByPrice;
+ *          for ( const auto& trade : trades )
+ *          {
+ *              volumeByPrice[trade.price] += trade.quantity;
+ *          }
+ *
+ *          volumeByPrice.forEach( []( const Decimal& price, const Decimal& volume ) { ... } );
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "Decimal.h"
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		/**
+		 * @brief Canonical key of a flat hash map slot
+		 */
+		struct FlatMapKey
+		{
+			/** @brief Low word (Int128 low bits, or Decimal mantissa bits 0-63) */
+			std::uint64_t low;
+
+			/** @brief High word (Int128 high bits, or Decimal flags and mantissa bits 64-95) */
+			std::uint64_t high;
+		};
+
+		/**
+		 * @brief Conversion between keys and canonical words
+		 * @tparam Key Decimal or Int128
+		 */
+		template <typename Key>
+		struct FlatMapKeyTraits;
+	} // namespace internal
+
+	//=====================================================================
+	// FlatHashMap class
+	//=====================================================================
+
+	/**
+	 * @brief Open-addressing hash map with inline canonical Decimal or Int128 keys
+	 * @tparam Key Decimal or Int128
+	 * @tparam Value Mapped type (default constructible, move assignable)
+	 */
+	template <typename Key, typename Value>
+	class FlatHashMap final
+	{
+		static_assert( std::is_same_v<Key, Decimal> || std::is_same_v<Key, Int128>, "FlatHashMap keys must be Decimal or Int128" );
+		static_assert( std::is_default_constructible_v<Value> && std::is_move_assignable_v<Value>,
+			"FlatHashMap values must be default constructible and move assignable" );
+
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor (empty map, no allocation)
+		 */
+		FlatHashMap() = default;
+
+		/**
+		 * @brief Construct an empty map sized for a number of entries
+		 * @param count Entries to hold without rehashing
+		 */
+		inline explicit FlatHashMap( std::size_t count );
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Find the value of a key
+		 * @param key Key to look up
+		 * @return Pointer to the value, or nullptr if the key is absent
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Value* find( const Key& key ) noexcept;
+
+		/**
+		 * @brief Find the value of a key
+		 * @param key Key to look up
+		 * @return Pointer to the value, or nullptr if the key is absent
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const Value* find( const Key& key ) const noexcept;
+
+		/**
+		 * @brief Check if a key is present
+		 * @param key Key to look up
+		 * @return true if the map holds a value for key
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool contains( const Key& key ) const noexcept;
+
+		//----------------------------------------------
+		// Modification
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the value of a key, inserting a default value if absent
+		 * @param key Key to look up
+		 * @return Reference to the value
+		 */
+		inline Value& operator[]( const Key& key );
+
+		/**
+		 * @brief Insert a value if the key is absent
+		 * @param key Key to insert
+		 * @param value Value to store
+		 * @return true if inserted, false if the key was present (its value is unchanged)
+		 */
+		inline bool insert( const Key& key, Value value );
+
+		/**
+		 * @brief Insert a value, or replace the value of a present key
+		 * @param key Key to insert
+		 * @param value Value to store
+		 * @return true if inserted, false if an existing value was replaced
+		 */
+		inline bool insertOrAssign( const Key& key, Value value );
+
+		/**
+		 * @brief Remove a key
+		 * @param key Key to remove
+		 * @return true if the key was present
+		 */
+		inline bool erase( const Key& key );
+
+		/**
+		 * @brief Remove every entry, keeping the allocated capacity
+		 */
+		inline void clear();
+
+		/**
+		 * @brief Allocate room for a number of entries
+		 * @param count Entries to hold without rehashing
+		 */
+		inline void reserve( std::size_t count );
+
+		//----------------------------------------------
+		// Iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Visit every entry, in table order
+		 * @param function Callable as function( const Key&, Value& ); Decimal keys are passed
+		 *        in canonical form (smallest scale)
+		 */
+		template <typename Function>
+		inline void forEach( Function&& function );
+
+		/**
+		 * @brief Visit every entry, in table order
+		 * @param function Callable as function( const Key&, const Value& )
+		 */
+		template <typename Function>
+		inline void forEach( Function&& function ) const;
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of entries
+		 * @return Entry count
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check if the map has no entries
+		 * @return true if empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Get the number of slots
+		 * @return Slot count (0 or a power of two, at least 16)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t capacity() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal representation
+		//----------------------------------------------
+
+		/** @brief Entry storage */
+		struct Slot
+		{
+			/** @brief Canonical key words */
+			internal::FlatMapKey key;
+
+			/** @brief Mapped value */
+			Value value;
+		};
+
+		/**
+		 * @brief Find the slot of canonical key words
+		 * @param key Canonical key
+		 * @param hash Hash of key
+		 * @return Slot index, or capacity() if absent
+		 */
+		[[nodiscard]] inline std::size_t findIndex( const internal::FlatMapKey& key, std::uint64_t hash ) const noexcept;
+
+		/**
+		 * @brief Find or claim the slot of canonical key words
+		 * @param key Canonical key
+		 * @param inserted Set to true if a new slot was claimed
+		 * @return Slot index
+		 */
+		inline std::size_t findOrInsertIndex( const internal::FlatMapKey& key, bool& inserted );
+
+		/**
+		 * @brief Rebuild the table with a new slot count
+		 * @param slotCount New slot count (a power of two, at least 16)
+		 */
+		inline void rehash( std::size_t slotCount );
+
+		/** @brief One control byte per slot */
+		std::vector<std::uint8_t> m_control;
+
+		/** @brief Keys and values, parallel to m_control */
+		std::vector<Slot> m_slots;
+
+		/** @brief Number of entries */
+		std::size_t m_size{ 0 };
+
+		/** @brief Number of deleted control bytes */
+		std::size_t m_deleted{ 0 };
+	};
+
+	//=====================================================================
+	// Type aliases
+	//=====================================================================
+
+	/** @brief Flat hash map keyed by Decimal value (1.5 and 1.50 are the same key) */
+	template <typename Value>
+	using DecimalFlatMap = FlatHashMap<Decimal, Value>;
+
+	/** @brief Flat hash map keyed by Int128 */
+	template <typename Value>
+	using Int128FlatMap = FlatHashMap<Int128, Value>;
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/FlatHashMap.inl"
@@ -0,0 +1,247 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file IeeeDecimal128.h
+ * @brief IEEE 754-2008 decimal128 interchange container with direct Decimal transcoding
+ * @details IeeeDecimal128 holds the 16 raw bytes of a decimal128 value as exchanged with
+ *          external systems, and converts to and from Decimal at the bit level in either
+ *          of the two standard coefficient encodings:
+ *
+ *          - Bid: binary integer decimal, the coefficient is a 113-bit binary integer
+ *          - Dpd: densely packed decimal, the coefficient is a leading digit plus eleven
+ *            10-bit declets of three digits each, converted through lookup tables
+ *
+ *          Memory Layout of IeeeDecimal128 (128 bits / 16 bytes):
+ *          ┌───────────┬───────────────────────────────────────┬──────────────────────────────────────┐
+ *          │    Bits   │              Description              │                Notes                 │
+ *          ├───────────┼───────────────────────────────────────┼──────────────────────────────────────┤
+ *          │   0 - 63  │  Low word                             │  Stored first                        │
+ *          │  64 - 126 │  Combination, exponent, coefficient   │  Layout depends on the encoding      │
+ *          │  127      │  Sign (0 = positive, 1 = negative)    │  Same position in both encodings     │
+ *          └───────────┴───────────────────────────────────────┴──────────────────────────────────────┘
+ *
+ *          The low word is stored first, which matches the in-memory layout of a 16-byte
+ *          decimal128 on little-endian hosts.
+ *
+ *          Semantics:
+ *          - Decimal to decimal128 is always exact: the 96-bit mantissa becomes the coefficient
+ *            and the scale becomes the negated exponent, so unnormalized scales round-trip
+ *          - decimal128 to Decimal is exact whenever the value fits a 96-bit mantissa with a
+ *            scale of 0-28; extra fractional digits are rounded to nearest, ties to even
+ *          - Values whose integer part needs more than 96 bits, infinities and NaNs are
+ *            rejected (exceptions for the throwing API, false for the try* API)
+ *          - Non-canonical BID coefficients (above 10^34 - 1) decode as zero, as the standard requires
+ *
+ *          Usage:
+ *          @code
+ *          std::vector<IeeeDecimal128> wire( prices.size() );
+ *          IeeeDecimal128::fromDecimals( prices, wire, IeeeDecimal128::Encoding::Bid );
+ *
+ *          Decimal price{ wire[0].toDecimal( IeeeDecimal128::Encoding::Bid ) };
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Decimal.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// IeeeDecimal128 class
+	//=====================================================================
+
+	/**
+	 * @brief Raw IEEE 754-2008 decimal128 value with bit-level conversion to and from Decimal
+	 */
+	class IeeeDecimal128 final
+	{
+	public:
+		//----------------------------------------------
+		// Coefficient encodings
+		//----------------------------------------------
+
+		/**
+		 * @brief Coefficient encoding of the decimal128 interchange format
+		 */
+		enum class Encoding : std::uint8_t
+		{
+			Bid = 0, ///< Binary integer decimal (coefficient stored as a binary integer)
+			Dpd		 ///< Densely packed decimal (coefficient stored as 10-bit declets)
+		};
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor (all bits zero, a positive zero in both encodings)
+		 */
+		inline constexpr IeeeDecimal128() noexcept;
+
+		/**
+		 * @brief Construct from raw bits
+		 * @param high Bits 64-127 (sign, combination field and upper coefficient bits)
+		 * @param low Bits 0-63
+		 */
+		inline constexpr IeeeDecimal128( std::uint64_t high, std::uint64_t low ) noexcept;
+
+		/**
+		 * @brief Encode a Decimal exactly
+		 * @param value Decimal to encode
+		 * @param encoding Coefficient encoding to produce
+		 * @return decimal128 with the same coefficient, exponent (-scale) and sign
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr IeeeDecimal128 fromDecimal( const Decimal& value, Encoding encoding ) noexcept;
+
+		//----------------------------------------------
+		// Bulk conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Encode a span of Decimal values
+		 * @param source Values to encode
+		 * @param destination Output span (at least source.size() elements)
+		 * @param encoding Coefficient encoding to produce
+		 * @throws std::invalid_argument if destination is smaller than source
+		 */
+		inline static constexpr void fromDecimals( std::span<const Decimal> source, std::span<IeeeDecimal128> destination, Encoding encoding );
+
+		/**
+		 * @brief Decode a span of decimal128 values
+		 * @param source Values to decode
+		 * @param destination Output span (at least source.size() elements)
+		 * @param encoding Coefficient encoding of the source
+		 * @throws std::invalid_argument if destination is smaller than source, or a value is NaN or infinite
+		 * @throws std::overflow_error if a value does not fit in Decimal
+		 *         (elements before the failing one have been written)
+		 */
+		inline static constexpr void toDecimals( std::span<const IeeeDecimal128> source, std::span<Decimal> destination, Encoding encoding );
+
+		/**
+		 * @brief Decode a span of decimal128 values without throwing
+		 * @param source Values to decode
+		 * @param destination Output span
+		 * @param encoding Coefficient encoding of the source
+		 * @return Number of leading elements converted; stops at the first value that is not
+		 *         representable or when destination is full
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr std::size_t tryToDecimals( std::span<const IeeeDecimal128> source, std::span<Decimal> destination, Encoding encoding ) noexcept;
+
+		//----------------------------------------------
+		// Type conversion
+		//----------------------------------------------
+
+		/**
+		 * @brief Decode to Decimal
+		 * @param encoding Coefficient encoding of this value
+		 * @return Decimal equal to this value, rounded half-even beyond 28 fractional digits
+		 * @throws std::invalid_argument if the value is NaN or infinite
+		 * @throws std::overflow_error if the value does not fit in Decimal
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr Decimal toDecimal( Encoding encoding ) const;
+
+		/**
+		 * @brief Try to decode to Decimal without throwing
+		 * @param encoding Coefficient encoding of this value
+		 * @param result Output Decimal (unchanged on failure)
+		 * @return true if the value is finite and fits in Decimal
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool tryToDecimal( Encoding encoding, Decimal& result ) const noexcept;
+
+		//----------------------------------------------
+		// Property accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get bits 64-127
+		 * @return High 64-bit word
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::uint64_t highBits() const noexcept;
+
+		/**
+		 * @brief Get bits 0-63
+		 * @return Low 64-bit word
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::uint64_t lowBits() const noexcept;
+
+		//----------------------------------------------
+		// State checking
+		//----------------------------------------------
+
+		/**
+		 * @brief Check if value is a quiet or signaling NaN
+		 * @return true if NaN
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool isNaN() const noexcept;
+
+		/**
+		 * @brief Check if value is positive or negative infinity
+		 * @return true if infinite
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool isInfinite() const noexcept;
+
+		/**
+		 * @brief Check if the sign bit is set
+		 * @return true if negative (including negative zero)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr bool isNegative() const noexcept;
+
+		//----------------------------------------------
+		// Comparison operators
+		//----------------------------------------------
+
+		/**
+		 * @brief Bitwise equality operator
+		 * @param other Value to compare with
+		 * @return true if both values have identical bits
+		 * @note Cohort members (e.g. 1.0 and 1.00) compare unequal; decode to compare numerically
+		 */
+		inline constexpr bool operator==( const IeeeDecimal128& other ) const noexcept;
+		inline constexpr bool operator!=( const IeeeDecimal128& other ) const noexcept;
+
+	private:
+		/** @brief Bits 0-63 */
+		std::uint64_t m_low;
+
+		/** @brief Bits 64-127 */
+		std::uint64_t m_high;
+	};
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/IeeeDecimal128.inl"
@@ -146,8 +146,12 @@
 
 #include <array>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <string_view>
+#include <type_traits>
+
+#include "ArithmeticStatus.h"
 
 //----------------------------------------------
 // Cross-platform 128-bit integer support
@@ -240,14 +244,14 @@ namespace nfx::datatypes
 		 * @param low Lower 64 bits
 		 * @param high Upper 64 bits
 		 */
-		Int128( std::uint64_t low, std::uint64_t high ) noexcept;
+		inline constexpr Int128( std::uint64_t low, std::uint64_t high ) noexcept;
 
 #if NFX_DATATYPES_HAS_NATIVE_INT128
 		/**
 		 * @brief Construct from native __int128 (GCC/Clang only)
 		 * @param val Native 128-bit value
 		 */
-		explicit constexpr Int128( NFX_DATATYPES_NATIVE_INT128 val ) noexcept;
+		inline explicit constexpr Int128( NFX_DATATYPES_NATIVE_INT128 val ) noexcept;
 #endif
 
 		/**
@@ -255,7 +259,7 @@ namespace nfx::datatypes
 		 * @param str String representation (e.g., "123", "-456789")
 		 * @throws std::invalid_argument if string is not a valid integer
 		 */
-		inline explicit Int128( std::string_view str );
+		inline explicit constexpr Int128( std::string_view str );
 
 		/**
 		 * @brief Construct from single-precision floating-point value
@@ -339,21 +343,21 @@ namespace nfx::datatypes
 		 * @param other Right operand
 		 * @return Sum of this and other
 		 */
-		Int128 operator+( const Int128& other ) const noexcept;
+		inline constexpr Int128 operator+( const Int128& other ) const noexcept;
 
 		/**
 		 * @brief Subtraction operator
 		 * @param other Right operand
 		 * @return Difference of this and other
 		 */
-		Int128 operator-( const Int128& other ) const noexcept;
+		inline constexpr Int128 operator-( const Int128& other ) const noexcept;
 
 		/**
 		 * @brief Multiplication operator
 		 * @param other Right operand
 		 * @return Product of this and other
 		 */
-		Int128 operator*( const Int128& other ) const noexcept;
+		inline constexpr Int128 operator*( const Int128& other ) const noexcept;
 
 		/**
 		 * @brief Division operator
@@ -361,28 +365,28 @@ namespace nfx::datatypes
 		 * @return Result of division
 		 * @throws std::overflow_error if divisor is zero
 		 */
-		Int128 operator/( const Int128& other ) const;
+		inline constexpr Int128 operator/( const Int128& other ) const;
 
 		/**
 		 * @brief Addition assignment operator
 		 * @param other Right operand to add
 		 * @return Reference to this after addition
 		 */
-		inline Int128& operator+=( const Int128& other ) noexcept;
+		inline constexpr Int128& operator+=( const Int128& other ) noexcept;
 
 		/**
 		 * @brief Subtraction assignment operator
 		 * @param other Right operand to subtract
 		 * @return Reference to this after subtraction
 		 */
-		inline Int128& operator-=( const Int128& other ) noexcept;
+		inline constexpr Int128& operator-=( const Int128& other ) noexcept;
 
 		/**
 		 * @brief Multiplication assignment operator
 		 * @param other Right operand to multiply by
 		 * @return Reference to this after multiplication
 		 */
-		inline Int128& operator*=( const Int128& other ) noexcept;
+		inline constexpr Int128& operator*=( const Int128& other ) noexcept;
 
 		/**
 		 * @brief Division assignment operator
@@ -390,7 +394,7 @@ namespace nfx::datatypes
 		 * @return Reference to this after division
 		 * @throws std::overflow_error if divisor is zero
 		 */
-		inline Int128& operator/=( const Int128& other );
+		inline constexpr Int128& operator/=( const Int128& other );
 
 		/**
 		 * @brief Modulo assignment operator
@@ -398,7 +402,7 @@ namespace nfx::datatypes
 		 * @return Reference to this after modulo operation
 		 * @throws std::overflow_error if divisor is zero
 		 */
-		inline Int128& operator%=( const Int128& other );
+		inline constexpr Int128& operator%=( const Int128& other );
 
 		/**
 		 * @brief Modulo operator
@@ -406,13 +410,68 @@ namespace nfx::datatypes
 		 * @return Remainder of division
 		 * @throws std::overflow_error if divisor is zero
 		 */
-		inline Int128 operator%( const Int128& other ) const;
+		inline constexpr Int128 operator%( const Int128& other ) const;
 
 		/**
 		 * @brief Unary minus operator
 		 * @return Negated value
 		 */
-		inline Int128 operator-() const noexcept;
+		inline constexpr Int128 operator-() const noexcept;
+
+		//----------------------------------------------
+		// Non-throwing arithmetic
+		//----------------------------------------------
+
+		/**
+		 * @brief Add without undefined overflow
+		 * @param left Left operand
+		 * @param right Right operand
+		 * @param status Sticky flags; Overflow is raised when the sum is out of range
+		 * @return Sum, saturated to the 128-bit range on overflow
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Int128 add( const Int128& left, const Int128& right, ArithmeticStatus& status ) noexcept;
+
+		/**
+		 * @brief Subtract without undefined overflow
+		 * @param left Left operand
+		 * @param right Right operand
+		 * @param status Sticky flags; Overflow is raised when the difference is out of range
+		 * @return Difference, saturated to the 128-bit range on overflow
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Int128 subtract( const Int128& left, const Int128& right, ArithmeticStatus& status ) noexcept;
+
+		/**
+		 * @brief Multiply without undefined overflow
+		 * @param left Left operand
+		 * @param right Right operand
+		 * @param status Sticky flags; Overflow is raised when the product is out of range
+		 * @return Product, saturated to the 128-bit range on overflow
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Int128 multiply( const Int128& left, const Int128& right, ArithmeticStatus& status ) noexcept;
+
+		/**
+		 * @brief Divide without throwing
+		 * @param left Dividend
+		 * @param right Divisor
+		 * @param status Sticky flags; DivisionByZero for a zero divisor, Overflow for minimum / -1,
+		 *        Inexact when the division leaves a remainder
+		 * @return Quotient truncated toward zero; zero on division by zero, maximum value on overflow
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Int128 divide( const Int128& left, const Int128& right, ArithmeticStatus& status ) noexcept;
+
+		/**
+		 * @brief Remainder without throwing
+		 * @param left Dividend
+		 * @param right Divisor
+		 * @param status Sticky flags; DivisionByZero for a zero divisor
+		 * @return Remainder with the sign of the dividend; zero on division by zero
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Int128 remainder( const Int128& left, const Int128& right, ArithmeticStatus& status ) noexcept;
 
 		//----------------------------------------------
 		// Comparison operators
@@ -423,42 +482,42 @@ namespace nfx::datatypes
 		 * @param other Right operand
 		 * @return true if values are equal
 		 */
-		inline bool operator==( const Int128& other ) const noexcept;
+		inline constexpr bool operator==( const Int128& other ) const noexcept;
 
 		/**
 		 * @brief Inequality operator
 		 * @param other Right operand
 		 * @return true if values are not equal
 		 */
-		inline bool operator!=( const Int128& other ) const noexcept;
+		inline constexpr bool operator!=( const Int128& other ) const noexcept;
 
 		/**
 		 * @brief Less than operator
 		 * @param other Right operand
 		 * @return true if this is less than other
 		 */
-		inline bool operator<( const Int128& other ) const noexcept;
+		inline constexpr bool operator<( const Int128& other ) const noexcept;
 
 		/**
 		 * @brief Less than or equal operator
 		 * @param other Right operand
 		 * @return true if this is less than or equal to other
 		 */
-		inline bool operator<=( const Int128& other ) const noexcept;
+		inline constexpr bool operator<=( const Int128& other ) const noexcept;
 
 		/**
 		 * @brief Greater than operator
 		 * @param other Right operand
 		 * @return true if this is greater than other
 		 */
-		inline bool operator>( const Int128& other ) const noexcept;
+		inline constexpr bool operator>( const Int128& other ) const noexcept;
 
 		/**
 		 * @brief Greater than or equal operator
 		 * @param other Right operand
 		 * @return true if this is greater than or equal to other
 		 */
-		inline bool operator>=( const Int128& other ) const noexcept;
+		inline constexpr bool operator>=( const Int128& other ) const noexcept;
 
 		//----------------------------------------------
 		// Comparison with built-in integer types
@@ -469,126 +528,126 @@ namespace nfx::datatypes
 		 * @param val Right operand
 		 * @return true if values are equal
 		 */
-		inline bool operator==( int val ) const noexcept;
+		inline constexpr bool operator==( int val ) const noexcept;
 
 		/**
 		 * @brief Inequality comparison with signed 32-bit integer
 		 * @param val Right operand
 		 * @return true if values are not equal
 		 */
-		inline bool operator!=( int val ) const noexcept;
+		inline constexpr bool operator!=( int val ) const noexcept;
 
 		/**
 		 * @brief Less than comparison with signed 32-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than val
 		 */
-		inline bool operator<( int val ) const noexcept;
+		inline constexpr bool operator<( int val ) const noexcept;
 
 		/**
 		 * @brief Less than or equal comparison with signed 32-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than or equal to val
 		 */
-		inline bool operator<=( int val ) const noexcept;
+		inline constexpr bool operator<=( int val ) const noexcept;
 
 		/**
 		 * @brief Greater than comparison with signed 32-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than val
 		 */
-		inline bool operator>( int val ) const noexcept;
+		inline constexpr bool operator>( int val ) const noexcept;
 
 		/**
 		 * @brief Greater than or equal comparison with signed 32-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than or equal to val
 		 */
-		inline bool operator>=( int val ) const noexcept;
+		inline constexpr bool operator>=( int val ) const noexcept;
 
 		/**
 		 * @brief Equality comparison with signed 64-bit integer
 		 * @param val Right operand
 		 * @return true if values are equal
 		 */
-		inline bool operator==( std::int64_t val ) const noexcept;
+		inline constexpr bool operator==( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Inequality comparison with signed 64-bit integer
 		 * @param val Right operand
 		 * @return true if values are not equal
 		 */
-		bool operator!=( std::int64_t val ) const noexcept;
+		inline constexpr bool operator!=( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Less than comparison with signed 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than val
 		 */
-		inline bool operator<( std::int64_t val ) const noexcept;
+		inline constexpr bool operator<( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Less than or equal comparison with signed 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than or equal to val
 		 */
-		inline bool operator<=( std::int64_t val ) const noexcept;
+		inline constexpr bool operator<=( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Greater than comparison with signed 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than val
 		 */
-		inline bool operator>( std::int64_t val ) const noexcept;
+		inline constexpr bool operator>( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Greater than or equal comparison with signed 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than or equal to val
 		 */
-		inline bool operator>=( std::int64_t val ) const noexcept;
+		inline constexpr bool operator>=( std::int64_t val ) const noexcept;
 
 		/**
 		 * @brief Equality comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if values are equal
 		 */
-		inline bool operator==( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator==( std::uint64_t val ) const noexcept;
 
 		/**
 		 * @brief Inequality comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if values are not equal
 		 */
-		inline bool operator!=( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator!=( std::uint64_t val ) const noexcept;
 
 		/**
 		 * @brief Less than comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than val
 		 */
-		inline bool operator<( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator<( std::uint64_t val ) const noexcept;
 
 		/**
 		 * @brief Less than or equal comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is less than or equal to val
 		 */
-		inline bool operator<=( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator<=( std::uint64_t val ) const noexcept;
 
 		/**
 		 * @brief Greater than comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than val
 		 */
-		inline bool operator>( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator>( std::uint64_t val ) const noexcept;
 
 		/**
 		 * @brief Greater than or equal comparison with unsigned 64-bit integer
 		 * @param val Right operand
 		 * @return true if this is greater than or equal to val
 		 */
-		inline bool operator>=( std::uint64_t val ) const noexcept;
+		inline constexpr bool operator>=( std::uint64_t val ) const noexcept;
 
 		//----------------------------------------------
 		// Comparison with built-in floating point types
@@ -736,7 +795,7 @@ namespace nfx::datatypes
 		 * @throws std::invalid_argument if string format is invalid or represents value outside Int128 range
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] static Int128 parse( std::string_view str );
+		[[nodiscard]] inline static constexpr Int128 parse( std::string_view str );
 
 		/**
 		 * @brief Try to parse 128-bit integer from string without throwing
@@ -745,7 +804,7 @@ namespace nfx::datatypes
 		 * @return true if parsing succeeded, false if string format is invalid or value is outside Int128 range
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] static bool tryParse( std::string_view str, Int128& result ) noexcept;
+		[[nodiscard]] inline static constexpr bool tryParse( std::string_view str, Int128& result ) noexcept;
 
 		//----------------------------------------------
 		// Type conversion
@@ -763,7 +822,7 @@ namespace nfx::datatypes
 		 * @return Array of 4 32-bit integers representing the 128-bit integer
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] std::array<std::int32_t, 4> toBits() const noexcept;
+		[[nodiscard]] inline constexpr std::array<std::int32_t, 4> toBits() const noexcept;
 
 		//----------------------------------------------
 		// State checking
@@ -774,14 +833,25 @@ namespace nfx::datatypes
 		 * @return true if zero
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline bool isZero() const noexcept;
+		[[nodiscard]] inline constexpr bool isZero() const noexcept;
 
 		/**
 		 * @brief Check if value is negative
 		 * @return true if negative
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline bool isNegative() const noexcept;
+		[[nodiscard]] inline constexpr bool isNegative() const noexcept;
+
+		//----------------------------------------------
+		// Hashing
+		//----------------------------------------------
+
+		/**
+		 * @brief Compute a 64-bit hash of the value
+		 * @return Hash mixing both 64-bit words, stable across platforms and builds
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline constexpr std::uint64_t hash() const noexcept;
 
 		//----------------------------------------------
 		// Mathematical operations
@@ -792,7 +862,7 @@ namespace nfx::datatypes
 		 * @return Absolute value of the integer
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] inline Int128 abs() const noexcept;
+		[[nodiscard]] inline constexpr Int128 abs() const noexcept;
 
 		//----------------------------------------------
 		// Access operations
@@ -803,14 +873,14 @@ namespace nfx::datatypes
 		 * @return Lower 64 bits as unsigned integer
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] std::uint64_t toLow() const noexcept;
+		[[nodiscard]] inline constexpr std::uint64_t toLow() const noexcept;
 
 		/**
 		 * @brief Get upper 64 bits
 		 * @return Upper 64 bits as unsigned integer
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		[[nodiscard]] std::uint64_t toHigh() const noexcept;
+		[[nodiscard]] inline constexpr std::uint64_t toHigh() const noexcept;
 
 #if NFX_DATATYPES_HAS_NATIVE_INT128
 		/**
@@ -827,7 +897,7 @@ namespace nfx::datatypes
 		 *          - Optimal performance for bulk arithmetic operations
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
-		NFX_DATATYPES_NATIVE_INT128 toNative() const noexcept;
+		[[nodiscard]] inline constexpr NFX_DATATYPES_NATIVE_INT128 toNative() const noexcept;
 #endif
 
 	private:
@@ -848,6 +918,15 @@ namespace nfx::datatypes
 #endif
 	};
 
+	//=====================================================================
+	// Layout guarantees
+	//=====================================================================
+
+	// Buffers of Int128 values are copied and reinterpreted as raw 16-byte records
+	static_assert( sizeof( Int128 ) == 16, "Int128 must be exactly 16 bytes" );
+	static_assert( std::is_trivially_copyable_v<Int128>, "Int128 must be trivially copyable" );
+	static_assert( std::is_standard_layout_v<Int128>, "Int128 must have standard layout" );
+
 	//=====================================================================
 	// Stream operators
 	//=====================================================================
@@ -867,6 +946,42 @@ namespace nfx::datatypes
 	 * @return Reference to input stream
 	 */
 	std::istream& operator>>( std::istream& is, Int128& value );
+
+	//=====================================================================
+	// User-defined literals
+	//=====================================================================
+
+	namespace literals
+	{
+		/**
+		 * @brief Int128 literal parsed at compile time
+		 * @param str Literal digits as written
+		 * @return Int128 equal to the literal
+		 * @details Covers the full positive range, which built-in integer literals cannot express:
+		 *          @code
+		 *          using namespace nfx::datatypes::literals;
+		 *          constexpr Int128 max{ 170141183460469231731687303715884105727_i128 };
+		 *          @endcode
+		 *          Out-of-range or non-decimal literals are rejected at compile time.
+		 */
+		consteval Int128 operator""_i128( const char* str );
+	} // namespace literals
 } // namespace nfx::datatypes
 
+//=====================================================================
+// Standard library specializations
+//=====================================================================
+
+/**
+ * @brief std::hash specialization, for use as a key of unordered containers
+ */
+template <>
+struct std::hash<nfx::datatypes::Int128>
+{
+	[[nodiscard]] std::size_t operator()( const nfx::datatypes::Int128& value ) const noexcept
+	{
+		return static_cast<std::size_t>( value.hash() );
+	}
+};
+
 #include "nfx/detail/datatypes/Int128.inl"
@@ -0,0 +1,141 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Int128Kernels.h
+ * @brief Element-wise arithmetic, comparison and summation kernels over Int128 spans
+ * @details Int128Kernels applies one operation to whole arrays of Int128 values, for
+ *          workloads such as ledger reconciliation that add or compare balance vectors of
+ *          many millions of entries. Each value is treated as a pair of 64-bit lanes (low
+ *          word first), so a 256-bit register holds two values and a 512-bit register four:
+ *
+ *          - add / subtract: lane-wise 64-bit add, with the carry (borrow) out of each low
+ *            lane detected by an unsigned compare and propagated into the adjacent high lane
+ *          - lessThan: signed compare of the high lanes, refined by an unsigned compare of
+ *            the low lanes where the high lanes are equal
+ *          - sum: the low and high words are summed as 32-bit halves in 64-bit lanes, so no
+ *            carries are lost, and folded into an exact 192-bit total
+ *
+ *          The AVX-512, AVX2 or portable scalar variant is chosen by CpuDispatch from the
+ *          features of the running CPU (GCC/Clang on x86-64; other targets always use the
+ *          scalar variant). Every variant produces identical results.
+ *
+ *          Semantics:
+ *          - add, subtract and negate wrap modulo 2^128, exactly like the Int128 operators
+ *          - Results may alias an input span (in-place update)
+ *          - lessThan writes a bitmask in the DecimalColumn validity layout: bit i % 64 of
+ *            word i / 64, set when left[i] < right[i]; unused bits of the last word are cleared
+ *          - sum is exact: it only reports overflow when the final total does not fit in Int128,
+ *            however large the intermediate partial sums become
+ *
+ *          Usage:
+ *          @code
+ *          Int128Kernels::add( openingBalances, movements, closingBalances );
+ *
+ *          ArithmeticStatus status{ ArithmeticStatus::None };
+ *          Int128 total{ Int128Kernels::sum( closingBalances, status ) };
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "ArithmeticStatus.h"
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// Int128Kernels class
+	//=====================================================================
+
+	/**
+	 * @brief Vectorized element-wise operations over spans of Int128
+	 */
+	class Int128Kernels final
+	{
+	public:
+		Int128Kernels() = delete;
+
+		//----------------------------------------------
+		// Element-wise arithmetic
+		//----------------------------------------------
+
+		/**
+		 * @brief Add two spans element by element (result[i] = left[i] + right[i])
+		 * @param left First operands
+		 * @param right Second operands (same size as left)
+		 * @param result Output values (at least left.size() elements, may alias an input)
+		 * @throws std::invalid_argument if the input sizes differ or result is too small
+		 */
+		static void add( std::span<const Int128> left, std::span<const Int128> right, std::span<Int128> result );
+
+		/**
+		 * @brief Subtract two spans element by element (result[i] = left[i] - right[i])
+		 * @param left Minuends
+		 * @param right Subtrahends (same size as left)
+		 * @param result Output values (at least left.size() elements, may alias an input)
+		 * @throws std::invalid_argument if the input sizes differ or result is too small
+		 */
+		static void subtract( std::span<const Int128> left, std::span<const Int128> right, std::span<Int128> result );
+
+		/**
+		 * @brief Negate a span element by element (result[i] = -values[i])
+		 * @param values Operands
+		 * @param result Output values (at least values.size() elements, may alias values)
+		 * @throws std::invalid_argument if result is too small
+		 */
+		static void negate( std::span<const Int128> values, std::span<Int128> result );
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/**
+		 * @brief Compare two spans element by element into a bitmask
+		 * @param left First operands
+		 * @param right Second operands (same size as left)
+		 * @param mask Output bitmask (at least (left.size() + 63) / 64 words); bit i is set
+		 *        when left[i] < right[i]
+		 * @throws std::invalid_argument if the input sizes differ or mask is too small
+		 */
+		static void lessThan( std::span<const Int128> left, std::span<const Int128> right, std::span<std::uint64_t> mask );
+
+		//----------------------------------------------
+		// Reduction
+		//----------------------------------------------
+
+		/**
+		 * @brief Sum a span exactly
+		 * @param values Values to sum
+		 * @param status Raises Overflow if the total does not fit in Int128
+		 * @return Total, or the nearest Int128 limit on overflow (zero for an empty span)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static Int128 sum( std::span<const Int128> values, ArithmeticStatus& status ) noexcept;
+	};
+} // namespace nfx::datatypes
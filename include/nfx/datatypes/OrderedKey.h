@@ -0,0 +1,186 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file OrderedKey.h
+ * @brief Order-preserving binary keys for Decimal and Int128, comparable with memcmp
+ * @details OrderedKey encodes values as byte strings whose lexicographic (memcmp) order is
+ *          the numeric order of the values, for use as keys of B-trees, LSM trees and other
+ *          stores that compare raw bytes:
+ *
+ *          - Int128: 16 bytes, big-endian two's complement with the sign bit flipped
+ *          - Decimal: 1 to 16 bytes. A header byte holds the sign and the exponent E of the
+ *            value written as 0.d1d2...dn x 10^E (d1 and dn non-zero); it is 0x80 for zero,
+ *            0x81 + (E + 27) for positive and 0x7F - (E + 27) for negative values. The digits
+ *            follow in pairs, one byte per pair p: 2p, plus 1 when another pair follows.
+ *            Negative values store every pair byte complemented (255 - b).
+ *
+ *          Decimal keys are canonical: trailing zeros are removed before encoding, so equal
+ *          values at different scales (1.5, 1.50, 1.500) have identical keys, and decoding
+ *          returns the value at its smallest scale. Both encodings are self-delimiting, so keys
+ *          can be concatenated into composite keys and still compare field by field.
+ *
+ *          Usage:
+ *          @code
+ *          std::array<std::uint8_t, 16> key{};
+ *          const std::size_t size{ OrderedKey::encode( price, key ) };
+ *          store.put( std::span{ key }.first( size ), order );
+ *
+ *          Decimal price{ OrderedKey::decodeDecimal( key ) };
+ *          @endcode
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Decimal.h"
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// OrderedKey class
+	//=====================================================================
+
+	/**
+	 * @brief Encoding and decoding of memcmp-comparable Decimal and Int128 keys
+	 */
+	class OrderedKey final
+	{
+	public:
+		OrderedKey() = delete;
+
+		/** @brief Encoded Int128 key (constants::ORDERED_KEY_INT128_SIZE bytes) */
+		using Int128Key = std::array<std::uint8_t, 16>;
+
+		//----------------------------------------------
+		// Int128 keys
+		//----------------------------------------------
+
+		/**
+		 * @brief Encode an Int128
+		 * @param value Value to encode
+		 * @return 16-byte key
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Int128Key encode( const Int128& value ) noexcept;
+
+		/**
+		 * @brief Decode an Int128 key
+		 * @param key Bytes starting with a 16-byte key (further bytes are ignored)
+		 * @return Decoded value
+		 * @throws std::invalid_argument if key is shorter than 16 bytes
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Int128 decodeInt128( std::span<const std::uint8_t> key );
+
+		//----------------------------------------------
+		// Decimal keys
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the size of the key of a Decimal
+		 * @param value Value to measure
+		 * @return Key size in bytes (1-16)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr std::size_t encodedSize( const Decimal& value ) noexcept;
+
+		/**
+		 * @brief Encode a Decimal
+		 * @param value Value to encode
+		 * @param destination Output buffer (16 bytes always suffice)
+		 * @return Number of bytes written
+		 * @throws std::invalid_argument if destination is smaller than encodedSize( value )
+		 */
+		inline static constexpr std::size_t encode( const Decimal& value, std::span<std::uint8_t> destination );
+
+		/**
+		 * @brief Decode a Decimal key
+		 * @param key Bytes starting with a Decimal key (further bytes are ignored)
+		 * @param consumed Receives the size of the key
+		 * @return Decoded value, at its smallest scale
+		 * @throws std::invalid_argument if key does not start with a valid, complete Decimal key
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal decodeDecimal( std::span<const std::uint8_t> key, std::size_t& consumed );
+
+		/**
+		 * @brief Decode a Decimal key
+		 * @param key Bytes starting with a Decimal key (further bytes are ignored)
+		 * @return Decoded value, at its smallest scale
+		 * @throws std::invalid_argument if key does not start with a valid, complete Decimal key
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline static constexpr Decimal decodeDecimal( std::span<const std::uint8_t> key );
+
+		//----------------------------------------------
+		// Batch encoding
+		//----------------------------------------------
+
+		/**
+		 * @brief Encode Int128 values back to back
+		 * @param values Values to encode
+		 * @param destination Output buffer (at least 16 * values.size() bytes)
+		 * @throws std::invalid_argument if destination is too small
+		 */
+		inline static constexpr void encode( std::span<const Int128> values, std::span<std::uint8_t> destination );
+
+		/**
+		 * @brief Decode back-to-back Int128 keys
+		 * @param keys Concatenated keys (at least 16 * destination.size() bytes)
+		 * @param destination Receives one value per key
+		 * @throws std::invalid_argument if keys is too small
+		 */
+		inline static constexpr void decode( std::span<const std::uint8_t> keys, std::span<Int128> destination );
+
+		/**
+		 * @brief Encode Decimal values back to back
+		 * @param values Values to encode
+		 * @param destination Output buffer (16 * values.size() bytes always suffice)
+		 * @param offsets Optional output of values.size() + 1 entries: the start of every key,
+		 *        then the total length; pass an empty span to skip
+		 * @return Number of bytes written
+		 * @throws std::invalid_argument if destination or offsets is too small
+		 *         (keys before the one that did not fit have been written)
+		 */
+		inline static constexpr std::size_t encode( std::span<const Decimal> values, std::span<std::uint8_t> destination,
+			std::span<std::size_t> offsets = {} );
+
+		/**
+		 * @brief Decode back-to-back Decimal keys
+		 * @param keys Concatenated keys
+		 * @param destination Receives one value per key
+		 * @return Number of bytes consumed
+		 * @throws std::invalid_argument if keys does not hold destination.size() valid keys
+		 */
+		inline static constexpr std::size_t decode( std::span<const std::uint8_t> keys, std::span<Decimal> destination );
+	};
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/OrderedKey.inl"
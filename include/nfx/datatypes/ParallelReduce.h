@@ -0,0 +1,178 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ParallelReduce.h
+ * @brief Multi-threaded sum, minimum / maximum and dot product over Decimal and Int128 spans
+ * @details ParallelReduce splits a span into contiguous chunks, reduces each chunk on its own
+ *          thread and merges the partial results in chunk order on the calling thread:
+ *
+ *          - parallelSum / parallelDot: each chunk fills an exact DecimalAccumulator (Decimal)
+ *            or an exact 256-bit total (Int128); totals are normalized once, after the merge
+ *          - parallelMinMax: each chunk keeps its first minimum and first maximum; the merge
+ *            keeps the earliest of equal values, exactly like a sequential scan
+ *
+ *          Because every partial result is exact, the result is bit for bit the same for
+ *          every thread count, including 1. Chunks hold at least
+ *          constants::PARALLEL_MIN_CHUNK_VALUES values, so small spans run on the calling
+ *          thread only; a thread count of 0 uses std::thread::hardware_concurrency().
+ *
+ *          Usage:
+ *          @code
+ *          Decimal notional{ ParallelReduce::parallelDot( prices, quantities ) };
+ *          Decimal total{ ParallelReduce::parallelSum( amounts, 16 ) };
+ *          auto [low, high]{ ParallelReduce::parallelMinMax( prices ) };
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <utility>
+
+#include "ArithmeticStatus.h"
+#include "Decimal.h"
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// ParallelReduce class
+	//=====================================================================
+
+	/**
+	 * @brief Deterministic multi-threaded reductions over spans of Decimal and Int128
+	 */
+	class ParallelReduce final
+	{
+	public:
+		ParallelReduce() = delete;
+
+		//----------------------------------------------
+		// Sum
+		//----------------------------------------------
+
+		/**
+		 * @brief Sum a span of Decimal values
+		 * @param values Values to sum
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @return Normalized exact sum, truncated once like DecimalAccumulator::result() (zero for an empty span)
+		 * @throws std::overflow_error if the sum is outside the Decimal range
+		 * @throws std::system_error if a thread cannot be started
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static Decimal parallelSum( std::span<const Decimal> values, std::size_t threadCount = 0 );
+
+		/**
+		 * @brief Sum a span of Decimal values without throwing on overflow
+		 * @param values Values to sum
+		 * @param status Raises Overflow (result clamped) or Inexact (fractional digits truncated)
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @return Normalized exact sum, truncated once like DecimalAccumulator::result() (zero for an empty span)
+		 * @throws std::system_error if a thread cannot be started
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static Decimal parallelSum( std::span<const Decimal> values, ArithmeticStatus& status, std::size_t threadCount = 0 );
+
+		/**
+		 * @brief Sum a span of Int128 values
+		 * @param values Values to sum
+		 * @param status Raises Overflow if the total does not fit in Int128
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @return Exact total, or the saturated value of its sign on overflow
+		 * @throws std::system_error if a thread cannot be started
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static Int128 parallelSum( std::span<const Int128> values, ArithmeticStatus& status, std::size_t threadCount = 0 );
+
+		//----------------------------------------------
+		// Minimum and maximum
+		//----------------------------------------------
+
+		/**
+		 * @brief Find the smallest and largest Decimal values
+		 * @param values Values to scan (not empty)
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @return Pair of {minimum, maximum}; of equal values (e.g. 1.5 and 1.50) the first one is returned
+		 * @throws std::invalid_argument if values is empty
+		 * @throws std::system_error if a thread cannot be started
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static std::pair<Decimal, Decimal> parallelMinMax( std::span<const Decimal> values, std::size_t threadCount = 0 );
+
+		/**
+		 * @brief Find the smallest and largest Int128 values
+		 * @param values Values to scan (not empty)
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @return Pair of {minimum, maximum}
+		 * @throws std::invalid_argument if values is empty
+		 * @throws std::system_error if a thread cannot be started
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static std::pair<Int128, Int128> parallelMinMax( std::span<const Int128> values, std::size_t threadCount = 0 );
+
+		//----------------------------------------------
+		// Dot product
+		//----------------------------------------------
+
+		/**
+		 * @brief Compute a dot product rounded once
+		 * @param values First operand (e.g. prices)
+		 * @param weights Second operand (e.g. quantities), one per value
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @return Normalized sum of values[i] * weights[i], like DecimalAccumulator::dot()
+		 * @throws std::invalid_argument if the spans differ in size
+		 * @throws std::overflow_error if the sum is outside the Decimal range
+		 * @throws std::system_error if a thread cannot be started
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static Decimal parallelDot( std::span<const Decimal> values, std::span<const Decimal> weights, std::size_t threadCount = 0 );
+
+		/**
+		 * @brief Compute a dot product rounded once, without throwing on overflow
+		 * @param values First operand (e.g. prices)
+		 * @param weights Second operand (e.g. quantities), one per value
+		 * @param status Raises Overflow (result clamped) or Inexact (fractional digits truncated)
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @return Normalized sum of values[i] * weights[i], like DecimalAccumulator::dot()
+		 * @throws std::invalid_argument if the spans differ in size
+		 * @throws std::system_error if a thread cannot be started
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static Decimal parallelDot( std::span<const Decimal> values, std::span<const Decimal> weights, ArithmeticStatus& status,
+			std::size_t threadCount = 0 );
+
+		//----------------------------------------------
+		// Configuration
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the thread count used when 0 is requested
+		 * @return std::thread::hardware_concurrency(), or 1 if it is unknown
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] static std::size_t defaultThreadCount() noexcept;
+	};
+} // namespace nfx::datatypes
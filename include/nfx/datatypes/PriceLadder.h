@@ -0,0 +1,444 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file PriceLadder.h
+ * @brief Dense tick-indexed price levels for order books
+ * @details PriceGrid maps Decimal prices on a tick grid (basePrice + k * tickSize) to integer
+ *          ticks k. Tick size and base price are aligned once to a common scale, so mapping a
+ *          price costs one integer subtraction and one 64-bit division, with no Decimal
+ *          comparison or normalization.
+ *
+ *          PriceLadder stores one level per tick in a contiguous ring covering a window of
+ *          capacity() consecutive ticks, initially centered on the base price:
+ *          - Level lookup, insertion and erasure are O(1); std::map<Decimal, Level> pays a
+ *            scale-aligning comparison at every tree hop
+ *          - The best level (highest bid or lowest ask) is tracked on every change; when it is
+ *            erased, the next one is found by scanning a 64-bit occupancy bitmap
+ *          - recenter() slides the window without moving the levels that stay inside it;
+ *            levels that fall outside are dropped
+ *
+ *          Prices off the grid are rejected with std::invalid_argument, prices on the grid but
+ *          outside the window with std::out_of_range.
+ *
+ *          Usage:
+ *          @code
+ *          PriceLadder<Level> bids{ PriceLadder<Level>::Side::Bid, Decimal{ "0.01" }, Decimal{ "100" }, 4096 };
+ *          bids[Decimal{ "101.25" }].quantity += 500;
+ *
+ *          if ( !bids.isEmpty() )
+ *          {
+ *              publish( bids.bestPrice(), bids.best().quantity );
+ *          }
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "Decimal.h"
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// PriceGrid class
+	//=====================================================================
+
+	/**
+	 * @brief Mapping between Decimal prices and integer ticks of a price grid
+	 */
+	class PriceGrid final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Construct a grid
+		 * @param tickSize Distance between adjacent prices
+		 * @param basePrice Price of tick 0
+		 * @throws std::invalid_argument if tickSize is not positive, or tickSize or basePrice
+		 *         does not fit at the common scale (tick units must fit in 63 bits)
+		 */
+		inline PriceGrid( const Decimal& tickSize, const Decimal& basePrice );
+
+		//----------------------------------------------
+		// Price mapping
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the tick of a price
+		 * @param price Price to map
+		 * @param tick Receives the tick (unchanged on failure)
+		 * @return true if price lies on the grid, within 2^63 ticks of the base price
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool tryTickOf( const Decimal& price, std::int64_t& tick ) const noexcept;
+
+		/**
+		 * @brief Get the tick of a price
+		 * @param price Price to map
+		 * @return Tick of price
+		 * @throws std::invalid_argument if price does not lie on the grid
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::int64_t tickOf( const Decimal& price ) const;
+
+		/**
+		 * @brief Get the price of a tick
+		 * @param tick Tick to map
+		 * @return basePrice + tick * tickSize, at the grid scale
+		 * @throws std::overflow_error if the price does not fit in Decimal
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Decimal priceOf( std::int64_t tick ) const;
+
+		/**
+		 * @brief Check if a price lies on the grid
+		 * @param price Price to check
+		 * @return true if tryTickOf( price ) succeeds
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isOnGrid( const Decimal& price ) const noexcept;
+
+		//----------------------------------------------
+		// Property accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the tick size
+		 * @return Distance between adjacent prices
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const Decimal& tickSize() const noexcept;
+
+		/**
+		 * @brief Get the base price
+		 * @return Price of tick 0
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const Decimal& basePrice() const noexcept;
+
+		/**
+		 * @brief Get the grid scale
+		 * @return Larger of the tick size and base price scales; priceOf() returns this scale
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::uint8_t scale() const noexcept;
+
+	private:
+		/** @brief Tick size as given */
+		Decimal m_tickSize;
+
+		/** @brief Base price as given */
+		Decimal m_basePrice;
+
+		/** @brief Base price in units of 10^-scale */
+		Int128 m_baseUnits;
+
+		/** @brief Tick size in units of 10^-scale */
+		std::int64_t m_tickUnits;
+
+		/** @brief Common scale of the grid */
+		std::uint8_t m_scale;
+	};
+
+	//=====================================================================
+	// PriceLadder class
+	//=====================================================================
+
+	/**
+	 * @brief Order book side with one level per tick in a re-centerable ring
+	 * @tparam Level Per-price state (default constructible and move assignable; a
+	 *         default-constructed level is what an untouched price holds)
+	 */
+	template <typename Level>
+	class PriceLadder final
+	{
+		static_assert( std::is_default_constructible_v<Level> && std::is_move_assignable_v<Level>,
+			"PriceLadder levels must be default constructible and move assignable" );
+
+	public:
+		//----------------------------------------------
+		// Book side
+		//----------------------------------------------
+
+		/**
+		 * @brief Side of the book, which decides the best level
+		 */
+		enum class Side : std::uint8_t
+		{
+			Bid = 0, ///< Best level is the highest price
+			Ask		 ///< Best level is the lowest price
+		};
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Construct an empty ladder centered on the base price
+		 * @param side Book side
+		 * @param tickSize Distance between adjacent prices
+		 * @param basePrice Price of tick 0
+		 * @param capacity Number of ticks in the window (rounded up to a power of two, at least 64)
+		 * @throws std::invalid_argument if the grid is invalid (see PriceGrid)
+		 */
+		inline PriceLadder( Side side, const Decimal& tickSize, const Decimal& basePrice, std::size_t capacity );
+
+		//----------------------------------------------
+		// Level access
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the level of a price, creating it if absent
+		 * @param price Price of the level
+		 * @return Reference to the level
+		 * @throws std::invalid_argument if price does not lie on the grid
+		 * @throws std::out_of_range if price lies outside the window
+		 */
+		inline Level& operator[]( const Decimal& price );
+
+		/**
+		 * @brief Find the level of a price
+		 * @param price Price of the level
+		 * @return Pointer to the level, or nullptr if absent, off the grid or outside the window
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Level* find( const Decimal& price ) noexcept;
+
+		/**
+		 * @brief Find the level of a price
+		 * @param price Price of the level
+		 * @return Pointer to the level, or nullptr if absent, off the grid or outside the window
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const Level* find( const Decimal& price ) const noexcept;
+
+		/**
+		 * @brief Remove the level of a price, resetting it to a default-constructed level
+		 * @param price Price of the level
+		 * @return true if the level was present
+		 */
+		inline bool erase( const Decimal& price );
+
+		/**
+		 * @brief Remove every level, keeping the window
+		 */
+		inline void clear();
+
+		//----------------------------------------------
+		// Best level
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the best level
+		 * @return Highest bid or lowest ask level
+		 * @throws std::out_of_range if the ladder is empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Level& best();
+
+		/**
+		 * @brief Get the best level
+		 * @return Highest bid or lowest ask level
+		 * @throws std::out_of_range if the ladder is empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const Level& best() const;
+
+		/**
+		 * @brief Get the tick of the best level
+		 * @return Tick of the highest bid or lowest ask
+		 * @throws std::out_of_range if the ladder is empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::int64_t bestTick() const;
+
+		/**
+		 * @brief Get the price of the best level
+		 * @return Highest bid or lowest ask price, at the grid scale
+		 * @throws std::out_of_range if the ladder is empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Decimal bestPrice() const;
+
+		//----------------------------------------------
+		// Iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Visit every level from the best outward
+		 * @param function Callable as function( const Decimal& price, Level& level )
+		 */
+		template <typename Function>
+		inline void forEach( Function&& function );
+
+		//----------------------------------------------
+		// Window
+		//----------------------------------------------
+
+		/**
+		 * @brief Slide the window so that it is centered on a price
+		 * @param price New center price
+		 * @return Number of levels dropped because they fell outside the window
+		 * @throws std::invalid_argument if price does not lie on the grid
+		 */
+		inline std::size_t recenter( const Decimal& price );
+
+		/**
+		 * @brief Check if a price lies on the grid and inside the window
+		 * @param price Price to check
+		 * @return true if operator[] accepts price
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isInWindow( const Decimal& price ) const noexcept;
+
+		/**
+		 * @brief Get the lowest tick of the window
+		 * @return First tick of the window (the window holds capacity() ticks)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::int64_t windowLowTick() const noexcept;
+
+		//----------------------------------------------
+		// Property accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the price grid
+		 * @return Grid mapping prices to ticks
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline const PriceGrid& grid() const noexcept;
+
+		/**
+		 * @brief Get the book side
+		 * @return Side given at construction
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline Side side() const noexcept;
+
+		/**
+		 * @brief Get the number of levels
+		 * @return Level count
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t size() const noexcept;
+
+		/**
+		 * @brief Check if the ladder has no levels
+		 * @return true if empty
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Get the number of ticks in the window
+		 * @return Ring size (a power of two, at least 64)
+		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
+		 */
+		[[nodiscard]] inline std::size_t capacity() const noexcept;
+
+	private:
+		/**
+		 * @brief Get the ring slot of a tick
+		 * @param tick Tick inside the window
+		 * @return Slot index
+		 */
+		[[nodiscard]] inline std::size_t slotOf( std::int64_t tick ) const noexcept;
+
+		/**
+		 * @brief Check if a tick is inside the window
+		 * @param tick Tick to check
+		 * @return true if windowLowTick() <= tick < windowLowTick() + capacity()
+		 */
+		[[nodiscard]] inline bool isInWindow( std::int64_t tick ) const noexcept;
+
+		/**
+		 * @brief Check if the level of a tick is present
+		 * @param tick Tick inside the window
+		 * @return true if occupied
+		 */
+		[[nodiscard]] inline bool isOccupied( std::int64_t tick ) const noexcept;
+
+		/**
+		 * @brief Find the highest occupied tick in a range
+		 * @param from Highest tick to consider
+		 * @param to Lowest tick to consider (all ticks in the window)
+		 * @param tick Receives the occupied tick
+		 * @return true if one was found
+		 */
+		[[nodiscard]] inline bool findOccupiedDown( std::int64_t from, std::int64_t to, std::int64_t& tick ) const noexcept;
+
+		/**
+		 * @brief Find the lowest occupied tick in a range
+		 * @param from Lowest tick to consider
+		 * @param to Highest tick to consider (all ticks in the window)
+		 * @param tick Receives the occupied tick
+		 * @return true if one was found
+		 */
+		[[nodiscard]] inline bool findOccupiedUp( std::int64_t from, std::int64_t to, std::int64_t& tick ) const noexcept;
+
+		/**
+		 * @brief Find the best occupied tick after the best level was removed
+		 */
+		inline void updateBest() noexcept;
+
+		/**
+		 * @brief Remove the level of an occupied tick
+		 * @param tick Occupied tick inside the window
+		 */
+		inline void release( std::int64_t tick );
+
+		/** @brief Price to tick mapping */
+		PriceGrid m_grid;
+
+		/** @brief Levels, indexed by slotOf( tick ) */
+		std::vector<Level> m_levels;
+
+		/** @brief One bit per slot, set for present levels */
+		std::vector<std::uint64_t> m_occupied;
+
+		/** @brief First tick of the window */
+		std::int64_t m_windowLow;
+
+		/** @brief Tick of the best level (meaningful when m_size > 0) */
+		std::int64_t m_bestTick{ 0 };
+
+		/** @brief Number of present levels */
+		std::size_t m_size{ 0 };
+
+		/** @brief Book side */
+		Side m_side;
+	};
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/PriceLadder.inl"
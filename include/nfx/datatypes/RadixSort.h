@@ -0,0 +1,164 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file RadixSort.h
+ * @brief Stable LSD radix sort, argsort and key-value sort for Decimal and Int128 arrays
+ * @details RadixSort orders values without comparing them. Each value is mapped to an
+ *          unsigned key whose byte order is its numeric order:
+ *
+ *          - Int128: the two's complement value with the sign bit flipped
+ *          - Decimal: the signed mantissa aligned to the largest scale of the input, then
+ *            sign-flipped like Int128. The key is 128 bits wide when every aligned mantissa
+ *            fits in 127 bits (the usual case for prices and quantities), otherwise 256 bits,
+ *            so ordering stays exact where Decimal::operator< would need more than 128 bits
+ *
+ *          Keys are rebased on the smallest key and sorted eleven bits per pass, least
+ *          significant first, over the bits spanned by the key range only. A single counting
+ *          pass builds every histogram, and digits shared by all keys are skipped, so narrow
+ *          data takes few passes (e.g. four for prices with 12 significant digits). Inputs
+ *          shorter than constants::RADIX_SORT_MIN_VALUES compare keys instead.
+ *
+ *          With a thread count other than 1, inputs of at least twice
+ *          constants::PARALLEL_MIN_CHUNK_VALUES are split into chunks: every pass counts and
+ *          scatters the chunks concurrently, into offsets assigned in chunk order. The result is
+ *          the same for every thread count.
+ *
+ *          Semantics:
+ *          - Sorts are stable: equal values (e.g. 1.5 and 1.50) keep their input order
+ *          - Zero and negative zero sort as equal
+ *          - Sorting needs a scratch copy of the input with its keys (32 bytes per value for
+ *            128-bit keys)
+ *
+ *          Usage:
+ *          @code
+ *          RadixSort::radixSort( prices );
+ *          Decimal median{ prices[prices.size() / 2] };
+ *
+ *          std::vector<std::size_t> order( prices.size() );
+ *          RadixSort::argsort( prices, order, 0 );
+ *
+ *          RadixSort::radixSortByKey( prices, std::span{ orderIds } );
+ *          @endcode
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "Decimal.h"
+#include "Int128.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// RadixSort class
+	//=====================================================================
+
+	/**
+	 * @brief Stable radix sorting of Decimal and Int128 spans
+	 */
+	class RadixSort final
+	{
+	public:
+		RadixSort() = delete;
+
+		//----------------------------------------------
+		// In-place sort
+		//----------------------------------------------
+
+		/**
+		 * @brief Sort Decimal values in ascending numeric order
+		 * @param values Values to sort in place
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @throws std::system_error if a thread cannot be started
+		 */
+		static void radixSort( std::span<Decimal> values, std::size_t threadCount = 1 );
+
+		/**
+		 * @brief Sort Int128 values in ascending order
+		 * @param values Values to sort in place
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @throws std::system_error if a thread cannot be started
+		 */
+		static void radixSort( std::span<Int128> values, std::size_t threadCount = 1 );
+
+		//----------------------------------------------
+		// Argsort
+		//----------------------------------------------
+
+		/**
+		 * @brief Compute the permutation that sorts Decimal values
+		 * @param values Values to rank (unchanged)
+		 * @param indices Output: indices[i] is the position in values of the i-th smallest value
+		 *        (the first values.size() elements are written)
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @throws std::invalid_argument if indices is smaller than values
+		 * @throws std::system_error if a thread cannot be started
+		 */
+		static void argsort( std::span<const Decimal> values, std::span<std::size_t> indices, std::size_t threadCount = 1 );
+
+		/**
+		 * @brief Compute the permutation that sorts Int128 values
+		 * @param values Values to rank (unchanged)
+		 * @param indices Output: indices[i] is the position in values of the i-th smallest value
+		 *        (the first values.size() elements are written)
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @throws std::invalid_argument if indices is smaller than values
+		 * @throws std::system_error if a thread cannot be started
+		 */
+		static void argsort( std::span<const Int128> values, std::span<std::size_t> indices, std::size_t threadCount = 1 );
+
+		//----------------------------------------------
+		// Key-value sort
+		//----------------------------------------------
+
+		/**
+		 * @brief Sort Decimal keys and reorder associated values alongside
+		 * @tparam T Value type (move constructible and move assignable)
+		 * @param keys Keys to sort in place
+		 * @param values Values to permute like keys (values[i] belongs to keys[i])
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @throws std::invalid_argument if the spans differ in size
+		 * @throws std::system_error if a thread cannot be started
+		 */
+		template <typename T>
+		inline static void radixSortByKey( std::span<Decimal> keys, std::span<T> values, std::size_t threadCount = 1 );
+
+		/**
+		 * @brief Sort Int128 keys and reorder associated values alongside
+		 * @tparam T Value type (move constructible and move assignable)
+		 * @param keys Keys to sort in place
+		 * @param values Values to permute like keys (values[i] belongs to keys[i])
+		 * @param threadCount Maximum number of threads, including the calling one (0 = hardware concurrency)
+		 * @throws std::invalid_argument if the spans differ in size
+		 * @throws std::system_error if a thread cannot be started
+		 */
+		template <typename T>
+		inline static void radixSortByKey( std::span<Int128> keys, std::span<T> values, std::size_t threadCount = 1 );
+	};
+} // namespace nfx::datatypes
+
+#include "nfx/detail/datatypes/RadixSort.inl"
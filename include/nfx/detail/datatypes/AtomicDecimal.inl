@@ -0,0 +1,223 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file AtomicDecimal.inl
+ * @brief Inline implementations for the AtomicDecimal class
+ */
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <type_traits>
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		static_assert( sizeof( Decimal ) == sizeof( AtomicWords ) && std::is_trivially_copyable_v<Decimal>,
+			"AtomicDecimal requires Decimal to be 16 trivially copyable bytes" );
+
+		/**
+		 * @brief Reinterpret a Decimal as compare-and-swap words
+		 * @param value Decimal to convert
+		 * @return Words with the same bytes
+		 */
+		inline AtomicWords toAtomicWords( const Decimal& value ) noexcept
+		{
+			return std::bit_cast<AtomicWords>( value );
+		}
+
+		/**
+		 * @brief Reinterpret compare-and-swap words as a Decimal
+		 * @param words Words to convert
+		 * @return Decimal with the same bytes
+		 */
+		inline Decimal fromAtomicWords( const AtomicWords& words ) noexcept
+		{
+			return std::bit_cast<Decimal>( words );
+		}
+
+		/**
+		 * @brief Add two decimals of nearby scales in signed 128-bit arithmetic
+		 * @param left First operand
+		 * @param right Second operand
+		 * @param result Receives left + right, normalized like Decimal::add
+		 * @return true if both operands are non-zero, their scales differ by at most
+		 *         ATOMIC_DECIMAL_MAX_ALIGN_DIGITS and the sum fits in 96 bits;
+		 *         false sends the caller to Decimal::add
+		 */
+		inline bool tryAddAligned( const Decimal& left, const Decimal& right, Decimal& result ) noexcept
+		{
+			// Decimal::add returns the other operand unchanged when one is zero
+			if ( left.isZero() || right.isZero() )
+			{
+				return false;
+			}
+
+			const std::uint8_t commonScale{ std::max( left.scale(), right.scale() ) };
+			const std::uint8_t leftGap{ static_cast<std::uint8_t>( commonScale - left.scale() ) };
+			const std::uint8_t rightGap{ static_cast<std::uint8_t>( commonScale - right.scale() ) };
+			if ( std::max( leftGap, rightGap ) > constants::ATOMIC_DECIMAL_MAX_ALIGN_DIGITS )
+			{
+				return false;
+			}
+
+			const Int128 leftMantissa{ mantissaAsInt128( left ) * getPowerOf10( leftGap ) };
+			const Int128 rightMantissa{ mantissaAsInt128( right ) * getPowerOf10( rightGap ) };
+			const Int128 sum{ ( left.isNegative() ? -leftMantissa : leftMantissa ) + ( right.isNegative() ? -rightMantissa : rightMantissa ) };
+			const Int128 magnitude{ sum.abs() };
+			if ( ( magnitude.toHigh() >> constants::BITS_PER_UINT32 ) != 0 )
+			{
+				return false;
+			}
+
+			// Strip trailing zeros like normalize(), in 64-bit words: 2^64 = 6 (mod 10) gives the last
+			// digit, and with the high word below 2^32 the division by 10 runs in 32-bit steps
+			std::uint64_t high{ magnitude.toHigh() };
+			std::uint64_t low{ magnitude.toLow() };
+			std::uint8_t scale{ commonScale };
+			while ( scale > 0 && ( low & 1U ) == 0 &&
+					( low % constants::DECIMAL_BASE + 6U * ( high % constants::DECIMAL_BASE ) ) % constants::DECIMAL_BASE == 0 )
+			{
+				const std::uint64_t upper{ ( high % constants::DECIMAL_BASE ) << constants::BITS_PER_UINT32 | low >> constants::BITS_PER_UINT32 };
+				const std::uint64_t lower{ ( upper % constants::DECIMAL_BASE ) << constants::BITS_PER_UINT32 | ( low & constants::UINT32_MAX_VALUE ) };
+
+				high /= constants::DECIMAL_BASE;
+				low = ( upper / constants::DECIMAL_BASE ) << constants::BITS_PER_UINT32 | lower / constants::DECIMAL_BASE;
+				--scale;
+			}
+
+			setMantissa( result, Int128{ low, high } );
+			result.flags() = static_cast<std::uint32_t>( scale ) << constants::DECIMAL_SCALE_SHIFT;
+			if ( sum.isNegative() )
+			{
+				result.flags() |= constants::DECIMAL_SIGN_MASK;
+			}
+
+			return true;
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// AtomicDecimal class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline AtomicDecimal::AtomicDecimal() noexcept
+		: m_words{ internal::toAtomicWords( Decimal{} ) }
+	{
+	}
+
+	inline AtomicDecimal::AtomicDecimal( const Decimal& value ) noexcept
+		: m_words{ internal::toAtomicWords( value ) }
+	{
+	}
+
+	//----------------------------------------------
+	// Atomic operations
+	//----------------------------------------------
+
+	inline Decimal AtomicDecimal::load() const noexcept
+	{
+		return internal::fromAtomicWords( internal::loadWords( m_words ) );
+	}
+
+	inline void AtomicDecimal::store( const Decimal& value ) noexcept
+	{
+		(void)internal::exchangeWords( m_words, internal::toAtomicWords( value ) );
+	}
+
+	inline Decimal AtomicDecimal::exchange( const Decimal& value ) noexcept
+	{
+		return internal::fromAtomicWords( internal::exchangeWords( m_words, internal::toAtomicWords( value ) ) );
+	}
+
+	inline bool AtomicDecimal::compareExchange( Decimal& expected, const Decimal& desired ) noexcept
+	{
+		internal::AtomicWords current{ internal::toAtomicWords( expected ) };
+		if ( internal::compareExchangeWords( m_words, current, internal::toAtomicWords( desired ) ) )
+		{
+			return true;
+		}
+
+		expected = internal::fromAtomicWords( current );
+
+		return false;
+	}
+
+	inline Decimal AtomicDecimal::fetchAdd( const Decimal& delta )
+	{
+		ArithmeticStatus status{ ArithmeticStatus::None };
+		const Decimal previous{ fetchAdd( delta, status ) };
+		if ( hasStatus( status, ArithmeticStatus::Overflow ) )
+		{
+			throw std::overflow_error{ "Decimal addition overflow" };
+		}
+
+		return previous;
+	}
+
+	inline Decimal AtomicDecimal::fetchAdd( const Decimal& delta, ArithmeticStatus& status ) noexcept
+	{
+		internal::AtomicWords current{ internal::peekWords( m_words ) };
+		while ( true )
+		{
+			const Decimal previous{ internal::fromAtomicWords( current ) };
+
+			// Both paths store the bits Decimal::add would return
+			ArithmeticStatus addStatus{ ArithmeticStatus::None };
+			Decimal next;
+			if ( !internal::tryAddAligned( previous, delta, next ) )
+			{
+				next = Decimal::add( previous, delta, addStatus );
+				if ( hasStatus( addStatus, ArithmeticStatus::Overflow ) )
+				{
+					status |= addStatus;
+
+					return previous;
+				}
+			}
+
+			if ( internal::compareExchangeWords( m_words, current, internal::toAtomicWords( next ) ) )
+			{
+				status |= addStatus;
+
+				return previous;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Lock-freedom
+	//----------------------------------------------
+
+	inline bool AtomicDecimal::isLockFree() const noexcept
+	{
+		return internal::isLockFreeWords( m_words );
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,200 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file AtomicInt128.inl
+ * @brief Inline implementations for the AtomicInt128 class
+ */
+
+#include <atomic>
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// 16-byte compare-and-swap
+		//=====================================================================
+
+		/**
+		 * @brief Atomically replace 16 bytes if they hold an expected value
+		 * @param target Aligned storage
+		 * @param expected Expected words; receives the current words on failure
+		 * @param desired New words
+		 * @return true if target was replaced
+		 */
+		inline bool compareExchangeWords( AtomicWords& target, AtomicWords& expected, const AtomicWords& desired ) noexcept
+		{
+#if ( defined( __x86_64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) ) )
+			bool exchanged;
+			__asm__ __volatile__( "lock cmpxchg16b %1"
+				: "=@ccz"( exchanged ), "+m"( target ), "+a"( expected.low ), "+d"( expected.high )
+				: "b"( desired.low ), "c"( desired.high )
+				: "memory" );
+
+			return exchanged;
+#else
+			return std::atomic_ref<AtomicWords>{ target }.compare_exchange_strong( expected, desired );
+#endif
+		}
+
+		/**
+		 * @brief Atomically read 16 bytes
+		 * @param target Aligned storage
+		 * @return Current words
+		 */
+		inline AtomicWords loadWords( AtomicWords& target ) noexcept
+		{
+			// A failed (or same-value) exchange returns the current words
+			AtomicWords current{ 0, 0 };
+			(void)compareExchangeWords( target, current, current );
+
+			return current;
+		}
+
+		/**
+		 * @brief Read 16 bytes without a 16-byte atomic, as a first guess for a compare-and-swap loop
+		 * @param target Aligned storage
+		 * @return Words that may be torn between concurrent writes; the exchange validates them
+		 */
+		inline AtomicWords peekWords( AtomicWords& target ) noexcept
+		{
+#if ( defined( __x86_64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) ) )
+			return AtomicWords{ std::atomic_ref<std::uint64_t>{ target.low }.load( std::memory_order_relaxed ),
+				std::atomic_ref<std::uint64_t>{ target.high }.load( std::memory_order_relaxed ) };
+#else
+			return std::atomic_ref<AtomicWords>{ target }.load( std::memory_order_relaxed );
+#endif
+		}
+
+		/**
+		 * @brief Atomically replace 16 bytes
+		 * @param target Aligned storage
+		 * @param desired New words
+		 * @return Previous words
+		 */
+		inline AtomicWords exchangeWords( AtomicWords& target, const AtomicWords& desired ) noexcept
+		{
+			AtomicWords current{ peekWords( target ) };
+			while ( !compareExchangeWords( target, current, desired ) )
+			{
+			}
+
+			return current;
+		}
+
+		/**
+		 * @brief Check if the 16-byte compare-and-swap is lock-free
+		 * @param target Aligned storage
+		 * @return true if lock-free
+		 */
+		inline bool isLockFreeWords( AtomicWords& target ) noexcept
+		{
+#if ( defined( __x86_64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) ) )
+			(void)target;
+
+			return true;
+#else
+			return std::atomic_ref<AtomicWords>{ target }.is_lock_free();
+#endif
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// AtomicInt128 class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline AtomicInt128::AtomicInt128() noexcept
+		: m_words{ 0, 0 }
+	{
+	}
+
+	inline AtomicInt128::AtomicInt128( const Int128& value ) noexcept
+		: m_words{ value.toLow(), value.toHigh() }
+	{
+	}
+
+	//----------------------------------------------
+	// Atomic operations
+	//----------------------------------------------
+
+	inline Int128 AtomicInt128::load() const noexcept
+	{
+		const internal::AtomicWords words{ internal::loadWords( m_words ) };
+
+		return Int128{ words.low, words.high };
+	}
+
+	inline void AtomicInt128::store( const Int128& value ) noexcept
+	{
+		(void)internal::exchangeWords( m_words, internal::AtomicWords{ value.toLow(), value.toHigh() } );
+	}
+
+	inline Int128 AtomicInt128::exchange( const Int128& value ) noexcept
+	{
+		const internal::AtomicWords previous{ internal::exchangeWords( m_words, internal::AtomicWords{ value.toLow(), value.toHigh() } ) };
+
+		return Int128{ previous.low, previous.high };
+	}
+
+	inline bool AtomicInt128::compareExchange( Int128& expected, const Int128& desired ) noexcept
+	{
+		internal::AtomicWords current{ expected.toLow(), expected.toHigh() };
+		if ( internal::compareExchangeWords( m_words, current, internal::AtomicWords{ desired.toLow(), desired.toHigh() } ) )
+		{
+			return true;
+		}
+
+		expected = Int128{ current.low, current.high };
+
+		return false;
+	}
+
+	inline Int128 AtomicInt128::fetchAdd( const Int128& delta ) noexcept
+	{
+		internal::AtomicWords current{ internal::peekWords( m_words ) };
+		while ( true )
+		{
+			const Int128 previous{ current.low, current.high };
+			const Int128 next{ previous + delta };
+			if ( internal::compareExchangeWords( m_words, current, internal::AtomicWords{ next.toLow(), next.toHigh() } ) )
+			{
+				return previous;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Lock-freedom
+	//----------------------------------------------
+
+	inline bool AtomicInt128::isLockFree() const noexcept
+	{
+		return internal::isLockFreeWords( m_words );
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,112 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ConcurrentDecimalAdder.inl
+ * @brief Inline implementations for the ConcurrentDecimalAdder class
+ */
+
+#include <thread>
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// ConcurrentDecimalAdder class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Accumulation
+	//----------------------------------------------
+
+	inline void ConcurrentDecimalAdder::add( const Decimal& value ) noexcept
+	{
+		update( [&value]( DecimalAccumulator& accumulator ) { accumulator.add( value ); } );
+	}
+
+	inline void ConcurrentDecimalAdder::addWeighted( const Decimal& value, const Decimal& weight ) noexcept
+	{
+		update( [&value, &weight]( DecimalAccumulator& accumulator ) { accumulator.addWeighted( value, weight ); } );
+	}
+
+	//----------------------------------------------
+	// Configuration
+	//----------------------------------------------
+
+	inline std::size_t ConcurrentDecimalAdder::shardCount() const noexcept
+	{
+		return m_mask + 1;
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename Update>
+	inline void ConcurrentDecimalAdder::update( Update apply ) noexcept
+	{
+		// Shared by every adder: a thread keeps the shard index where it last succeeded
+		thread_local std::size_t probe{ nextThreadProbe() };
+
+		std::size_t attempts{ 0 };
+		while ( true )
+		{
+			internal::AdderShard& shard{ m_shards[probe & m_mask] };
+			if ( !shard.busy.load( std::memory_order_relaxed ) && !shard.busy.exchange( true, std::memory_order_acquire ) )
+			{
+				apply( shard.accumulator );
+				shard.busy.store( false, std::memory_order_release );
+
+				return;
+			}
+
+			// Busy: move on, so colliding threads settle on different shards
+			++probe;
+			if ( ++attempts > m_mask )
+			{
+				// Every shard was busy; let the owners run
+				attempts = 0;
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	template <typename Visit>
+	inline void ConcurrentDecimalAdder::visitShards( Visit visit ) const noexcept
+	{
+		for ( std::size_t i{ 0 }; i <= m_mask; ++i )
+		{
+			internal::AdderShard& shard{ m_shards[i] };
+			while ( shard.busy.exchange( true, std::memory_order_acquire ) )
+			{
+				while ( shard.busy.load( std::memory_order_relaxed ) )
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			visit( shard.accumulator );
+			shard.busy.store( false, std::memory_order_release );
+		}
+	}
+} // namespace nfx::datatypes
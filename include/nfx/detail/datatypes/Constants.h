@@ -0,0 +1,631 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Constants.h
+ * @brief Internal constants for Decimal and Int128 implementations
+ * @details Defines precision limits, scale constraints, and internal masks
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace nfx::datatypes::constants
+{
+	//=====================================================================
+	// Common constants
+	//=====================================================================
+
+	//----------------------------------------------
+	// Bit manipulation
+	//----------------------------------------------
+
+	/** @brief Bit shift amount for 32-bit operations (used for extracting/combining uint32_t from uint64_t) */
+	inline constexpr int BITS_PER_UINT32{ 32 };
+
+	/** @brief Bit shift amount for 64-bit operations (used for extracting/combining uint64_t from uint128_t) */
+	inline constexpr int BITS_PER_UINT64{ 64 };
+
+	/** @brief Maximum value for 32-bit unsigned integer (2^32 - 1). */
+	inline constexpr std::uint64_t UINT32_MAX_VALUE{ 0xFFFFFFFFULL };
+
+	/** @brief Bit mask value 1 as unsigned 64-bit (used for bit operations). */
+	inline constexpr std::uint64_t BIT_MASK_ONE{ 1ULL };
+
+	/** @brief Bit mask value 0 as unsigned 64-bit (used for bit operations). */
+	inline constexpr std::uint64_t BIT_MASK_ZERO{ 0ULL };
+
+	//----------------------------------------------
+	// Maximum values
+	//----------------------------------------------
+
+	/** @brief Maximum 96-bit mantissa value (2^96 - 1) as low 64 bits. */
+	inline constexpr std::uint64_t DECIMAL_96BIT_MAX_LOW{ 0xFFFFFFFFFFFFFFFFULL };
+
+	/** @brief Maximum 96-bit mantissa value (2^96 - 1) as high 32 bits. */
+	inline constexpr std::uint64_t DECIMAL_96BIT_MAX_HIGH{ 0x00000000FFFFFFFFULL };
+
+	//----------------------------------------------
+	// Precision limits
+	//----------------------------------------------
+
+	/** @brief Maximum decimal precision that IEEE 754 double can accurately represent. */
+	inline constexpr std::uint8_t DOUBLE_DECIMAL_PRECISION{ 15U };
+
+	//=====================================================================
+	// Int128 data type constants
+	//=====================================================================
+
+	//----------------------------------------------
+	// Numeric base
+	//----------------------------------------------
+
+	/** @brief Base for decimal digit conversion. */
+	inline constexpr int INT_128_BASE{ 10 };
+
+	//----------------------------------------------
+	// Bit indexing
+	//----------------------------------------------
+
+	/** @brief Maximum bit index for 128-bit integers (0-127). */
+	inline constexpr int INT_128_MAX_BIT_INDEX{ 127 };
+
+	//----------------------------------------------
+	// Overflow detection
+	//----------------------------------------------
+
+	/** @brief Maximum high 64-bit value before multiplying by 10 causes overflow (0xFFFFFFFFFFFFFFFF / 10). */
+	inline constexpr std::uint64_t INT128_MUL10_OVERFLOW_THRESHOLD{ 0x1999999999999999ULL };
+
+	/** @brief Double approximation of maximum positive Int128 value (2^127 - 1) for overflow checks. */
+	inline constexpr double INT_128_MAX_AS_DOUBLE{ 1.7014118346046923e38 };
+
+	/** @brief Double approximation of minimum negative Int128 value (-2^127) for overflow checks. */
+	inline constexpr double INT_128_MIN_AS_DOUBLE{ -1.7014118346046924e38 };
+
+	//----------------------------------------------
+	// Arithmetic
+	//----------------------------------------------
+
+	/** @brief High 64 bits of maximum positive 128-bit signed integer (2^127 - 1) */
+	inline constexpr std::uint64_t INT_128_MAX_POSITIVE_HIGH{ 0x7FFFFFFFFFFFFFFFULL };
+
+	/** @brief Low 64 bits of maximum positive 128-bit signed integer (2^127 - 1) */
+	inline constexpr std::uint64_t INT_128_MAX_POSITIVE_LOW{ 0xFFFFFFFFFFFFFFFFULL };
+
+	/** @brief High 64 bits of minimum negative 128-bit signed integer (-2^127) */
+	inline constexpr std::uint64_t INT_128_MIN_NEGATIVE_HIGH{ 0x8000000000000000ULL };
+
+	/** @brief Low 64 bits of minimum negative 128-bit signed integer (-2^127) */
+	inline constexpr std::uint64_t INT_128_MIN_NEGATIVE_LOW{ 0x0000000000000000ULL };
+
+	//----------------------------------------------
+	// String conversion
+	//----------------------------------------------
+
+	/** @brief Maximum number of decimal digits in a 128-bit signed integer (2^127 - 1 has 39 digits). */
+	inline constexpr size_t INT_128_MAX_DIGIT_COUNT{ 39UL };
+
+	/** @brief Maximum expected length for Int128 string representation. */
+	inline constexpr size_t INT_128_MAX_STRING_LENGTH{ 64UL };
+
+	/** @brief Maximum positive value as decimal string (2^127 - 1). */
+	inline constexpr std::string_view INT_128_MAX_POSITIVE_STRING{ "170141183460469231731687303715884105727" };
+
+	/** @brief Maximum negative value as decimal string (absolute value of -2^127). */
+	inline constexpr std::string_view INT_128_MAX_NEGATIVE_STRING{ "170141183460469231731687303715884105728" };
+
+	//=====================================================================
+	// Decimal data type constants
+	//=====================================================================
+
+	//----------------------------------------------
+	// Numeric base
+	//----------------------------------------------
+
+	/** @brief Base for decimal digit conversion. */
+	inline constexpr std::uint64_t DECIMAL_BASE{ 10ULL };
+
+	//----------------------------------------------
+	// Arithmetic
+	//----------------------------------------------
+
+	/** @brief Lower 32 bits of maximum Decimal mantissa (2^96 - 1) */
+	inline constexpr std::uint32_t DECIMAL_MAX_MANTISSA_0{ 0xFFFFFFFFU };
+
+	/** @brief Middle 32 bits of maximum Decimal mantissa (2^96 - 1) */
+	inline constexpr std::uint32_t DECIMAL_MAX_MANTISSA_1{ 0xFFFFFFFFU };
+
+	/** @brief Upper 32 bits of maximum Decimal mantissa (2^96 - 1) */
+	inline constexpr std::uint32_t DECIMAL_MAX_MANTISSA_2{ 0xFFFFFFFFU };
+
+	/** @brief Lower 32 bits of minimum positive Decimal mantissa (1 × 10^-28) */
+	inline constexpr std::uint32_t DECIMAL_MIN_MANTISSA_0{ 1U };
+
+	/** @brief Middle 32 bits of minimum positive Decimal mantissa (1 × 10^-28) */
+	inline constexpr std::uint32_t DECIMAL_MIN_MANTISSA_1{ 0U };
+
+	/** @brief Upper 32 bits of minimum positive Decimal mantissa (1 × 10^-28) */
+	inline constexpr std::uint32_t DECIMAL_MIN_MANTISSA_2{ 0U };
+
+	/** @brief Maximum number of decimal places supported. */
+	inline constexpr std::uint8_t DECIMAL_MAXIMUM_PLACES{ 28U };
+
+	/** @brief Largest decimal point shift that can change a result (28 places of scale plus 29 mantissa digits, plus one rounding digit). */
+	inline constexpr std::int32_t DECIMAL_MAXIMUM_POINT_SHIFT{ 58 };
+
+	/** @brief Extra precision digits added during division to maintain accuracy. */
+	inline constexpr std::uint8_t DECIMAL_DIVISION_EXTRA_PRECISION{ 18U };
+
+	/** @brief Rounding threshold value (round up if digit >= this value). */
+	inline constexpr std::uint8_t DECIMAL_ROUNDING_THRESHOLD{ 5U };
+
+	/** @brief Bit mask for extracting scale from flags field (bits 16-23). */
+	inline constexpr std::uint32_t DECIMAL_SCALE_MASK{ 0x00FF0000U };
+
+	/** @brief Bit mask for sign detection (bit 31). */
+	inline constexpr std::uint32_t DECIMAL_SIGN_MASK{ 0x80000000U };
+
+	/** @brief Bit position for scale field in flags. */
+	inline constexpr std::uint8_t DECIMAL_SCALE_SHIFT{ 16U };
+
+	/** @brief Flags bits that must be zero in a valid decimal (bits 0-15 and 24-30). */
+	inline constexpr std::uint32_t DECIMAL_RESERVED_FLAGS_MASK{ 0x7F00FFFFU };
+
+	//----------------------------------------------
+	// String conversion
+	//----------------------------------------------
+
+	/** @brief Maximum expected length for decimal string representation. */
+	inline constexpr size_t DECIMAL_MAX_STRING_LENGTH{ 64UL };
+
+	/** @brief Reserved buffer size for string conversion to avoid reallocation. */
+	inline constexpr size_t DECIMAL_STRING_BUFFER_SIZE{ 64UL };
+
+	//----------------------------------------------
+	// Performance optimization
+	//----------------------------------------------
+
+	/** @brief Power of 10 lookup table size for fast scaling operations (64-bit range). */
+	inline constexpr std::uint8_t DECIMAL_POWER_TABLE_SIZE{ 20U };
+
+	/** @brief Minimum power for extended 128-bit power-of-10 table (10^20 and above). */
+	inline constexpr std::uint8_t DECIMAL_EXTENDED_POWER_MIN{ 20U };
+
+	/** @brief Maximum power for extended 128-bit power-of-10 table (10^28). */
+	inline constexpr std::uint8_t DECIMAL_EXTENDED_POWER_MAX{ 28U };
+
+	/** @brief Powers of 10 lookup table for efficient scaling operations (64-bit range: 10^0 to 10^19). */
+	inline constexpr std::array<std::uint64_t, DECIMAL_POWER_TABLE_SIZE> DECIMAL_POWERS_OF_10{ {
+		1ULL,					 // 10^0
+		10ULL,					 // 10^1
+		100ULL,					 // 10^2
+		1000ULL,				 // 10^3
+		10000ULL,				 // 10^4
+		100000ULL,				 // 10^5
+		1000000ULL,				 // 10^6
+		10000000ULL,			 // 10^7
+		100000000ULL,			 // 10^8
+		1000000000ULL,			 // 10^9
+		10000000000ULL,			 // 10^10
+		100000000000ULL,		 // 10^11
+		1000000000000ULL,		 // 10^12
+		10000000000000ULL,		 // 10^13
+		100000000000000ULL,		 // 10^14
+		1000000000000000ULL,	 // 10^15
+		10000000000000000ULL,	 // 10^16
+		100000000000000000ULL,	 // 10^17
+		1000000000000000000ULL,	 // 10^18
+		10000000000000000000ULL, // 10^19 (max uint64_t support)
+	} };
+
+	/**
+	 * @brief Power-of-10 calculation constants for 128-bit arithmetic
+	 * @details Pre-computed constants for powers that exceed 64-bit range.
+	 *          These are the low and high 64-bit components of 10^n where n > 19.
+	 */
+	inline constexpr std::array<std::pair<std::uint64_t, std::uint64_t>, 9> DECIMAL_EXTENDED_POWERS_OF_10{ {
+		{ 0x6BC75E2D63100000ULL, 0x0000000000000005ULL }, // 10^20
+		{ 0x35C9ADC5DEA00000ULL, 0x0000000000000036ULL }, // 10^21
+		{ 0x19E0C9BAB2400000ULL, 0x000000000000021EULL }, // 10^22
+		{ 0x02C7E14AF6800000ULL, 0x000000000000152DULL }, // 10^23
+		{ 0x1BCECCEDA1000000ULL, 0x000000000000D3C2ULL }, // 10^24
+		{ 0x161401484A000000ULL, 0x0000000000084595ULL }, // 10^25
+		{ 0xDCC80CD2E4000000ULL, 0x000000000052B7D2ULL }, // 10^26
+		{ 0x9FD0803CE8000000ULL, 0x00000000033B2E3CULL }, // 10^27
+		{ 0x3E25026110000000ULL, 0x00000000204FCE5EULL }  // 10^28
+	} };
+
+	//=====================================================================
+	// Decimal64 data type constants
+	//=====================================================================
+
+	//----------------------------------------------
+	// Bit layout
+	//----------------------------------------------
+
+	/** @brief Number of bits in the Decimal64 mantissa field (bits 0-55). */
+	inline constexpr std::uint8_t DECIMAL64_MANTISSA_BITS{ 56U };
+
+	/** @brief Bit mask for extracting the mantissa from Decimal64 bits (2^56 - 1). */
+	inline constexpr std::uint64_t DECIMAL64_MANTISSA_MASK{ 0x00FFFFFFFFFFFFFFULL };
+
+	/** @brief Bit mask for extracting scale from Decimal64 bits (bits 56-62). */
+	inline constexpr std::uint64_t DECIMAL64_SCALE_MASK{ 0x7F00000000000000ULL };
+
+	/** @brief Bit mask for sign detection in Decimal64 bits (bit 63). */
+	inline constexpr std::uint64_t DECIMAL64_SIGN_MASK{ 0x8000000000000000ULL };
+
+	/** @brief Bit position for the scale field in Decimal64 bits. */
+	inline constexpr std::uint8_t DECIMAL64_SCALE_SHIFT{ 56U };
+
+	//=====================================================================
+	// Decimal38 data type constants
+	//=====================================================================
+
+	//----------------------------------------------
+	// Arithmetic
+	//----------------------------------------------
+
+	/** @brief Maximum number of decimal places supported by Decimal38. */
+	inline constexpr std::uint8_t DECIMAL38_MAXIMUM_PLACES{ 38U };
+
+	/** @brief Number of bits in the Decimal38 mantissa (magnitude below 2^127). */
+	inline constexpr std::uint8_t DECIMAL38_MANTISSA_BITS{ 127U };
+
+	/** @brief Number of bits in the Decimal mantissa. */
+	inline constexpr std::uint8_t DECIMAL_MANTISSA_BITS{ 96U };
+
+	/** @brief High 64 bits of maximum Decimal38 mantissa (2^127 - 1). */
+	inline constexpr std::uint64_t DECIMAL38_MAX_MANTISSA_HIGH{ 0x7FFFFFFFFFFFFFFFULL };
+
+	/** @brief Low 64 bits of maximum Decimal38 mantissa (2^127 - 1). */
+	inline constexpr std::uint64_t DECIMAL38_MAX_MANTISSA_LOW{ 0xFFFFFFFFFFFFFFFFULL };
+
+	/** @brief Largest power of 10 a wide (256-bit) rounding division needs to evaluate. */
+	inline constexpr std::uint8_t DECIMAL38_MAX_WIDE_POWER{ 76U };
+
+	//=====================================================================
+	// IeeeDecimal128 data type constants
+	//=====================================================================
+
+	//----------------------------------------------
+	// Common layout (high 64-bit word)
+	//----------------------------------------------
+
+	/** @brief Exponent bias of the IEEE 754-2008 decimal128 interchange format. */
+	inline constexpr std::int32_t DECIMAL128_EXPONENT_BIAS{ 6176 };
+
+	/** @brief Bit mask for sign detection in the high word (bit 127). */
+	inline constexpr std::uint64_t DECIMAL128_SIGN_MASK{ 0x8000000000000000ULL };
+
+	/** @brief Bit mask for the special-value marker in the high word (bits 123-126 all set). */
+	inline constexpr std::uint64_t DECIMAL128_SPECIAL_MASK{ 0x7800000000000000ULL };
+
+	/** @brief Bit mask distinguishing NaN from infinity in the high word (bits 122-126). */
+	inline constexpr std::uint64_t DECIMAL128_NAN_MASK{ 0x7C00000000000000ULL };
+
+	/** @brief Number of decimal digits in a decimal128 coefficient. */
+	inline constexpr std::uint8_t DECIMAL128_COEFFICIENT_DIGITS{ 34U };
+
+	/** @brief High word of the largest canonical coefficient (10^34 - 1). */
+	inline constexpr std::uint64_t DECIMAL128_MAX_COEFFICIENT_HIGH{ 0x0001ED09BEAD87C0ULL };
+
+	/** @brief Low word of the largest canonical coefficient (10^34 - 1). */
+	inline constexpr std::uint64_t DECIMAL128_MAX_COEFFICIENT_LOW{ 0x378D8E63FFFFFFFFULL };
+
+	//----------------------------------------------
+	// Binary integer decimal (BID) encoding
+	//----------------------------------------------
+
+	/** @brief Bit mask selecting the large-coefficient form in the high word (bits 125-126). */
+	inline constexpr std::uint64_t DECIMAL128_BID_LARGE_FORM_MASK{ 0x6000000000000000ULL };
+
+	/** @brief Bit position of the 14-bit exponent in the high word (bits 113-126). */
+	inline constexpr std::uint8_t DECIMAL128_BID_EXPONENT_SHIFT{ 49U };
+
+	/** @brief Bit position of the 14-bit exponent in the large-coefficient form (bits 111-124). */
+	inline constexpr std::uint8_t DECIMAL128_BID_LARGE_EXPONENT_SHIFT{ 47U };
+
+	/** @brief Bit mask for the 14-bit biased exponent after shifting. */
+	inline constexpr std::uint64_t DECIMAL128_BID_EXPONENT_MASK{ 0x3FFFULL };
+
+	/** @brief Bit mask for the coefficient bits held in the high word (bits 64-112). */
+	inline constexpr std::uint64_t DECIMAL128_BID_COEFFICIENT_HIGH_MASK{ 0x0001FFFFFFFFFFFFULL };
+
+	//----------------------------------------------
+	// Densely packed decimal (DPD) encoding
+	//----------------------------------------------
+
+	/** @brief Bit position of the 5-bit combination field in the high word (bits 122-126). */
+	inline constexpr std::uint8_t DECIMAL128_DPD_COMBINATION_SHIFT{ 58U };
+
+	/** @brief Bit position of the 12-bit exponent continuation in the high word (bits 110-121). */
+	inline constexpr std::uint8_t DECIMAL128_DPD_EXPONENT_SHIFT{ 46U };
+
+	/** @brief Number of exponent continuation bits. */
+	inline constexpr std::uint8_t DECIMAL128_DPD_EXPONENT_BITS{ 12U };
+
+	/** @brief Bit mask for the exponent continuation after shifting. */
+	inline constexpr std::uint64_t DECIMAL128_DPD_EXPONENT_MASK{ 0xFFFULL };
+
+	/** @brief Bit mask for the coefficient continuation held in the high word (bits 64-109). */
+	inline constexpr std::uint64_t DECIMAL128_DPD_COEFFICIENT_HIGH_MASK{ 0x00003FFFFFFFFFFFULL };
+
+	/** @brief Number of 10-bit declets in the coefficient continuation. */
+	inline constexpr std::size_t DECIMAL128_DECLET_COUNT{ 11UL };
+
+	/** @brief Number of bits in a declet. */
+	inline constexpr std::uint8_t DECIMAL128_DECLET_BITS{ 10U };
+
+	/** @brief Bit mask for a single declet. */
+	inline constexpr std::uint64_t DECIMAL128_DECLET_MASK{ 0x3FFULL };
+
+	//=====================================================================
+	// Batch text processing constants
+	//=====================================================================
+
+	//----------------------------------------------
+	// SWAR digit parsing (8 ASCII characters per 64-bit word)
+	//----------------------------------------------
+
+	/** @brief Number of ASCII digits held in one 64-bit word. */
+	inline constexpr std::size_t SWAR_DIGITS_PER_WORD{ 8UL };
+
+	/** @brief Trailing digits accumulated separately once a field exceeds 19 digits. */
+	inline constexpr std::size_t SWAR_SPLIT_DIGITS{ 16UL };
+
+	/** @brief '0' replicated in every byte. */
+	inline constexpr std::uint64_t SWAR_ASCII_ZEROS{ 0x3030303030303030ULL };
+
+	/** @brief High nibble of every byte. */
+	inline constexpr std::uint64_t SWAR_HIGH_NIBBLES{ 0xF0F0F0F0F0F0F0F0ULL };
+
+	/** @brief Value added to every byte so that characters above '9' carry into the high nibble. */
+	inline constexpr std::uint64_t SWAR_DIGIT_LIMIT_BIAS{ 0x0606060606060606ULL };
+
+	/** @brief Expected classification result when all eight bytes are ASCII digits. */
+	inline constexpr std::uint64_t SWAR_ALL_DIGITS{ 0x3333333333333333ULL };
+
+	/** @brief Mask selecting digit pairs 0 and 4 after the first combining step. */
+	inline constexpr std::uint64_t SWAR_PAIR_MASK{ 0x000000FF000000FFULL };
+
+	/** @brief Multiplier combining pairs into 4-digit groups (100 + 1000000 << 32). */
+	inline constexpr std::uint64_t SWAR_PAIR_MULTIPLIER_HIGH{ 0x000F424000000064ULL };
+
+	/** @brief Multiplier combining pairs into 4-digit groups (1 + 10000 << 32). */
+	inline constexpr std::uint64_t SWAR_PAIR_MULTIPLIER_LOW{ 0x0000271000000001ULL };
+
+	/** @brief Most digits the Decimal fast path accepts (every such mantissa fits 96 bits). */
+	inline constexpr std::size_t BATCH_DECIMAL_FAST_DIGITS{ 28UL };
+
+	/** @brief Most digits the Int128 fast path accepts (every such magnitude fits 127 bits). */
+	inline constexpr std::size_t BATCH_INT128_FAST_DIGITS{ 32UL };
+
+	//----------------------------------------------
+	// Batch formatting
+	//----------------------------------------------
+
+	/** @brief Longest Decimal text without a fixed scale ("-0." plus 28 digits, or "-" plus 29 digits and a point). */
+	inline constexpr std::size_t BATCH_DECIMAL_MAX_FORMATTED_LENGTH{ 31UL };
+
+	/** @brief Longest Int128 text (sign plus 39 digits). */
+	inline constexpr std::size_t BATCH_INT128_MAX_FORMATTED_LENGTH{ 40UL };
+
+	/** @brief Digits produced per chunk when formatting magnitudes wider than 64 bits. */
+	inline constexpr std::size_t BATCH_FORMAT_CHUNK_DIGITS{ 19UL };
+
+	/** @brief Two ASCII digits for every value 0-99, indexed by 2 * value. */
+	inline constexpr char DIGIT_PAIRS[]{
+		"0001020304050607080910111213141516171819"
+		"2021222324252627282930313233343536373839"
+		"4041424344454647484950515253545556575859"
+		"6061626364656667686970717273747576777879"
+		"8081828384858687888990919293949596979899" };
+
+	//=====================================================================
+	// Int128 kernel constants
+	//=====================================================================
+
+	/** @brief Int128 values per 256-bit vector (one low and one high 64-bit lane each). */
+	inline constexpr std::size_t INT128_KERNEL_AVX2_VALUES{ 2UL };
+
+	/** @brief Int128 values per 512-bit vector. */
+	inline constexpr std::size_t INT128_KERNEL_AVX512_VALUES{ 4UL };
+
+	/** @brief Values summed per block before the 64-bit lane accumulators of 32-bit halves are folded (2^31, so no lane can wrap). */
+	inline constexpr std::size_t INT128_KERNEL_SUM_BLOCK_VALUES{ 1UL << 31 };
+
+	//=====================================================================
+	// Decimal filter constants
+	//=====================================================================
+
+	/** @brief Aligned bounds are clamped to +/-2^97, outside the range of every 96-bit mantissa. */
+	inline constexpr std::size_t DECIMAL_FILTER_THRESHOLD_BITS{ 97UL };
+
+	/** @brief Column rows compared per 256-bit vector (one 64-bit lane each). */
+	inline constexpr std::size_t DECIMAL_FILTER_AVX2_VALUES{ 4UL };
+
+	/** @brief Column rows compared per 512-bit vector. */
+	inline constexpr std::size_t DECIMAL_FILTER_AVX512_VALUES{ 8UL };
+
+	//=====================================================================
+	// Decimal accumulator constants
+	//=====================================================================
+
+	/** @brief Same-scale values summed in 128 bits before folding into the 256-bit total (2^31 96-bit mantissas stay below 2^127). */
+	inline constexpr std::uint32_t DECIMAL_ACCUMULATOR_PENDING_VALUES{ 1U << 31 };
+
+	/** @brief Accumulator totals are exact below 2^254, so that adding two of them cannot wrap 256 bits. */
+	inline constexpr std::size_t DECIMAL_ACCUMULATOR_EXACT_BITS{ 254UL };
+
+	/** @brief Largest power of 10 applied to a 192-bit product without a range check (10^18 < 2^62). */
+	inline constexpr std::uint8_t DECIMAL_ACCUMULATOR_PRODUCT_LIFT{ 18U };
+
+	//=====================================================================
+	// Parallel reduction constants
+	//=====================================================================
+
+	/** @brief Smallest chunk handed to a thread; shorter spans use fewer threads. */
+	inline constexpr std::size_t PARALLEL_MIN_CHUNK_VALUES{ 1UL << 16 };
+
+	//=====================================================================
+	// Radix sort constants
+	//=====================================================================
+
+	/** @brief Key bits consumed by one radix sort pass (2048 buckets: 16 KiB histograms, fewer passes than bytes). */
+	inline constexpr std::size_t RADIX_SORT_DIGIT_BITS{ 11UL };
+
+	/** @brief Buckets per radix sort pass (one per digit value). */
+	inline constexpr std::size_t RADIX_SORT_BUCKETS{ 1UL << RADIX_SORT_DIGIT_BITS };
+
+	/** @brief Shortest input sorted by radix; shorter inputs compare keys instead. */
+	inline constexpr std::size_t RADIX_SORT_MIN_VALUES{ 1024UL };
+
+	/** @brief Bits of a narrow sort key: scale-aligned magnitudes below 2^127 plus the sign. */
+	inline constexpr std::size_t RADIX_SORT_NARROW_KEY_BITS{ 128UL };
+
+	/** @brief Bits of a wide sort key: mantissas aligned by up to 28 digits need up to 190 bits. */
+	inline constexpr std::size_t RADIX_SORT_WIDE_KEY_BITS{ 256UL };
+
+	//=====================================================================
+	// Ordered key constants
+	//=====================================================================
+
+	/** @brief Size of an Int128 ordered key (big-endian, sign bit flipped). */
+	inline constexpr std::size_t ORDERED_KEY_INT128_SIZE{ 16UL };
+
+	/** @brief Largest Decimal ordered key: header byte plus 15 digit pairs (29 digits). */
+	inline constexpr std::size_t ORDERED_KEY_DECIMAL_MAX_SIZE{ 16UL };
+
+	/** @brief Header byte of zero; positive headers are above it, negative ones below. */
+	inline constexpr std::uint8_t ORDERED_KEY_ZERO{ 0x80U };
+
+	/** @brief Smallest exponent E of a non-zero Decimal written as 0.d1d2... x 10^E (10^-28 = 0.1 x 10^-27). */
+	inline constexpr std::int32_t ORDERED_KEY_MIN_EXPONENT{ -27 };
+
+	/** @brief Largest exponent E of a non-zero Decimal (29 integer digits). */
+	inline constexpr std::int32_t ORDERED_KEY_MAX_EXPONENT{ 29 };
+
+	/** @brief Digit pair values per key byte; a pair p is stored as 2p, plus 1 when more pairs follow. */
+	inline constexpr std::uint32_t ORDERED_KEY_PAIR_BASE{ 100U };
+
+	//=====================================================================
+	// Hash constants
+	//=====================================================================
+
+	/** @brief Mersenne prime 2^61 - 1; Decimal hashes reduce value = mantissa / 10^scale modulo it. */
+	inline constexpr std::uint64_t HASH_MODULUS{ 0x1FFFFFFFFFFFFFFFULL };
+
+	/** @brief Bit width of HASH_MODULUS (2^61 is congruent to 1). */
+	inline constexpr int HASH_MODULUS_BITS{ 61 };
+
+	/** @brief First multiplier of the 64-bit finalizer (MurmurHash3 fmix64). */
+	inline constexpr std::uint64_t HASH_MIX_MULTIPLIER_1{ 0xFF51AFD7ED558CCDULL };
+
+	/** @brief Second multiplier of the 64-bit finalizer (MurmurHash3 fmix64). */
+	inline constexpr std::uint64_t HASH_MIX_MULTIPLIER_2{ 0xC4CEB9FE1A85EC53ULL };
+
+	//=====================================================================
+	// Flat hash map constants
+	//=====================================================================
+
+	/** @brief Control bytes probed together; one SSE2 register. */
+	inline constexpr std::size_t FLAT_MAP_GROUP_SIZE{ 16UL };
+
+	/** @brief Control byte of a never used slot; ends a probe sequence. */
+	inline constexpr std::uint8_t FLAT_MAP_EMPTY{ 0x80U };
+
+	/** @brief Control byte of an erased slot; probing continues past it. */
+	inline constexpr std::uint8_t FLAT_MAP_DELETED{ 0xFEU };
+
+	/** @brief Bits of the hash stored in the control byte of a full slot (top bit clear). */
+	inline constexpr int FLAT_MAP_TAG_BITS{ 7 };
+
+	/** @brief Maximum load factor numerator: tables rehash beyond 7/8 full. */
+	inline constexpr std::size_t FLAT_MAP_MAX_LOAD_NUMERATOR{ 7UL };
+
+	/** @brief Maximum load factor denominator. */
+	inline constexpr std::size_t FLAT_MAP_MAX_LOAD_DENOMINATOR{ 8UL };
+
+	//=====================================================================
+	// Price ladder constants
+	//=====================================================================
+
+	/** @brief Smallest price ladder ring: one 64-bit occupancy word. */
+	inline constexpr std::size_t PRICE_LADDER_MIN_CAPACITY{ 64UL };
+
+	//=====================================================================
+	// Atomic decimal constants
+	//=====================================================================
+
+	/** @brief Largest scale gap aligned in 128-bit arithmetic by fetchAdd (a 96-bit mantissa times 10^9 stays below 2^127). */
+	inline constexpr std::uint8_t ATOMIC_DECIMAL_MAX_ALIGN_DIGITS{ 9U };
+
+	//=====================================================================
+	// Concurrent adder constants
+	//=====================================================================
+
+	/** @brief Alignment of each adder shard; two cache lines, since adjacent-line prefetch pairs them. */
+	inline constexpr std::size_t CONCURRENT_ADDER_SHARD_ALIGNMENT{ 128UL };
+
+	/** @brief Upper bound of the default shard count. */
+	inline constexpr std::size_t CONCURRENT_ADDER_MAX_DEFAULT_SHARDS{ 256UL };
+
+	//=====================================================================
+	// Column file constants
+	//=====================================================================
+
+	/** @brief File magic, the bytes "NFXCOLMN" read as a little-endian word. */
+	inline constexpr std::uint64_t COLUMN_FILE_MAGIC{ 0x4E4D4C4F4358464EULL };
+
+	/** @brief Format version written by ColumnFileWriter. */
+	inline constexpr std::uint16_t COLUMN_FILE_VERSION{ 1U };
+
+	/** @brief Header size; also the payload offset, keeping values 64-byte aligned. */
+	inline constexpr std::size_t COLUMN_FILE_HEADER_SIZE{ 64UL };
+
+	/** @brief Byte order marker; reads back differently on a host of the other byte order. */
+	inline constexpr std::uint32_t COLUMN_FILE_BYTE_ORDER_MARKER{ 0x01020304U };
+
+	/** @brief XXH64 prime 1. */
+	inline constexpr std::uint64_t CHECKSUM_PRIME_1{ 0x9E3779B185EBCA87ULL };
+
+	/** @brief XXH64 prime 2. */
+	inline constexpr std::uint64_t CHECKSUM_PRIME_2{ 0xC2B2AE3D27D4EB4FULL };
+
+	/** @brief XXH64 prime 3. */
+	inline constexpr std::uint64_t CHECKSUM_PRIME_3{ 0x165667B19E3779F9ULL };
+
+	/** @brief XXH64 prime 4. */
+	inline constexpr std::uint64_t CHECKSUM_PRIME_4{ 0x85EBCA77C2B2AE63ULL };
+
+	/** @brief XXH64 prime 5. */
+	inline constexpr std::uint64_t CHECKSUM_PRIME_5{ 0x27D4EB2F165667C5ULL };
+} // namespace nfx::datatypes::constants
@@ -27,8 +27,477 @@
  * @brief Inline implementations for cross-platform Decimal class
  */
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+#include "nfx/detail/datatypes/Constants.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
 namespace nfx::datatypes
 {
+	namespace internal
+	{
+		//=====================================================================
+		// Internal helper functions
+		//=====================================================================
+
+		/**
+		 * @brief Get power of 10 as Int128 for any scale 0-28
+		 * @param power The power (0-28)
+		 * @return Int128 representing 10^power
+		 */
+		inline constexpr Int128 getPowerOf10( std::uint8_t power ) noexcept
+		{
+			if ( power < constants::DECIMAL_POWER_TABLE_SIZE && constants::DECIMAL_POWERS_OF_10[power] != 0 )
+			{
+				// Use 64-bit lookup table for powers 0-19
+				return Int128{ constants::DECIMAL_POWERS_OF_10[power] };
+			}
+			else if ( power >= constants::DECIMAL_EXTENDED_POWER_MIN && power <= constants::DECIMAL_EXTENDED_POWER_MAX )
+			{
+				// Use pre-computed 128-bit values for powers 20-28
+				const auto& extended{ constants::DECIMAL_EXTENDED_POWERS_OF_10[power - constants::DECIMAL_EXTENDED_POWER_MIN] };
+				return Int128{ extended.first, extended.second };
+			}
+			else
+			{
+				// Fallback to iterative computation for invalid powers (shouldn't happen)
+				Int128 result{ 1 };
+				for ( std::uint8_t i{ 0 }; i < power; ++i )
+				{
+					result = result * Int128{ constants::DECIMAL_BASE };
+				}
+				return result;
+			}
+		}
+
+		/**
+		 * @brief Extract 128-bit mantissa value from Decimal
+		 * @param decimal The decimal value to extract mantissa from
+		 * @return Int128 representation of the mantissa
+		 */
+		inline constexpr Int128 mantissaAsInt128( const Decimal& decimal ) noexcept
+		{
+#if NFX_DATATYPES_HAS_NATIVE_INT128
+			const auto& mantissaArray{ decimal.mantissa() };
+			NFX_DATATYPES_NATIVE_INT128 value{ static_cast<NFX_DATATYPES_NATIVE_INT128>( mantissaArray[2] ) << constants::BITS_PER_UINT64 |
+											   static_cast<NFX_DATATYPES_NATIVE_INT128>( mantissaArray[1] ) << constants::BITS_PER_UINT32 |
+											   static_cast<NFX_DATATYPES_NATIVE_INT128>( mantissaArray[0] ) };
+
+			return Int128{ value };
+#else
+			const auto& mantissaArray{ decimal.mantissa() };
+			std::uint64_t low{ static_cast<std::uint64_t>( mantissaArray[1] ) << constants::BITS_PER_UINT32 | mantissaArray[0] };
+			std::uint64_t high{ mantissaArray[2] };
+
+			return Int128{ low, high };
+#endif
+		}
+
+		/**
+		 * @brief Align scales of two decimals for arithmetic operations
+		 * @param decimal First decimal value
+		 * @param other Second decimal value
+		 * @return Pair of Int128 mantissas with aligned scales
+		 */
+		inline constexpr std::pair<Int128, Int128> alignScale( const Decimal& decimal, const Decimal& other )
+		{
+			Int128 left{ mantissaAsInt128( decimal ) };
+			Int128 right{ mantissaAsInt128( other ) };
+
+			std::uint8_t leftScale{ decimal.scale() };
+			std::uint8_t rightScale{ other.scale() };
+
+			// Optimized scaling using enhanced power-of-10 lookup with 128-bit support
+			if ( leftScale < rightScale )
+			{
+				std::uint8_t scaleDiff{ static_cast<std::uint8_t>( rightScale - leftScale ) };
+				left = left * getPowerOf10( scaleDiff );
+			}
+			else if ( rightScale < leftScale )
+			{
+				std::uint8_t scaleDiff{ static_cast<std::uint8_t>( leftScale - rightScale ) };
+				right = right * getPowerOf10( scaleDiff );
+			}
+
+			return { std::move( left ), std::move( right ) };
+		}
+
+		/**
+		 * @brief Set mantissa value in Decimal from Int128
+		 * @param decimal The decimal to modify
+		 * @param value The Int128 mantissa value to set
+		 */
+		inline constexpr void setMantissa( Decimal& decimal, const Int128& value ) noexcept
+		{
+#if NFX_DATATYPES_HAS_NATIVE_INT128
+			auto nativeValue{ value.toNative() };
+			auto& mantissa{ decimal.mantissa() };
+			mantissa[0] = static_cast<std::uint32_t>( nativeValue );
+			mantissa[1] = static_cast<std::uint32_t>( nativeValue >> constants::BITS_PER_UINT32 );
+			mantissa[2] = static_cast<std::uint32_t>( nativeValue >> constants::BITS_PER_UINT64 );
+#else
+			auto& mantissa{ decimal.mantissa() };
+			std::uint64_t low{ value.toLow() };
+			std::uint64_t high{ value.toHigh() };
+
+			mantissa[0] = static_cast<std::uint32_t>( low );
+			mantissa[1] = static_cast<std::uint32_t>( low >> constants::BITS_PER_UINT32 );
+			mantissa[2] = static_cast<std::uint32_t>( high );
+#endif
+		}
+
+		/**
+		 * @brief Divide decimal mantissa by power of 10
+		 * @param decimal The decimal to modify
+		 * @param power The power of 10 to divide by (0-28)
+		 */
+		inline constexpr void divideByPowerOf10( Decimal& decimal, std::uint8_t power )
+		{
+			Int128 mantissa{ mantissaAsInt128( decimal ) };
+
+			// Use enhanced power-of-10 lookup with full 128-bit support
+			mantissa = mantissa / getPowerOf10( power );
+
+			setMantissa( decimal, mantissa );
+		}
+
+		/**
+		 * @brief Normalize decimal by removing trailing zeros and reducing scale
+		 * @param decimal The decimal to normalize
+		 */
+		inline constexpr void normalize( Decimal& decimal ) noexcept
+		{
+			// Remove trailing zeros and reduce scale
+			while ( decimal.scale() > 0 && ( mantissaAsInt128( decimal ) % Int128{ constants::DECIMAL_BASE } ) == Int128{ 0 } )
+			{
+				divideByPowerOf10( decimal, 1U );
+				std::uint8_t currentScale{ decimal.scale() };
+				decimal.flags() = ( decimal.flags() & ~constants::DECIMAL_SCALE_MASK ) |
+								  ( static_cast<std::uint32_t>( currentScale - 1U )
+									  << constants::DECIMAL_SCALE_SHIFT );
+			}
+		}
+
+		/**
+		 * @brief Determine if rounding up is needed for ToNearest mode (Banker's rounding)
+		 */
+		inline constexpr bool shouldRoundUpToNearest( const Int128& roundingDigit, const Int128& mantissa,
+			const Int128& divisor, std::uint8_t digitsToRemove,
+			const Decimal& result ) noexcept
+		{
+			if ( roundingDigit.toLow() > constants::DECIMAL_ROUNDING_THRESHOLD )
+			{
+				return true; // > 5: always round away from zero
+			}
+			else if ( roundingDigit.toLow() == constants::DECIMAL_ROUNDING_THRESHOLD )
+			{
+				// == 5: check if there are any non-zero digits after this one
+				bool hasRemainingFraction{ false };
+				if ( digitsToRemove > 1U )
+				{
+					Int128 remainderDivisor{ divisor };
+					Int128 remainder{ mantissa % remainderDivisor };
+					Int128 roundingDigitContribution{ roundingDigit * ( divisor / Int128{ constants::DECIMAL_BASE } ) };
+					hasRemainingFraction = ( remainder != roundingDigitContribution );
+				}
+
+				if ( hasRemainingFraction )
+				{
+					return true; // Ties away from zero when there's additional fractional part
+				}
+				else
+				{
+					// Exact tie: round to even
+					Int128 resultMantissa{ mantissaAsInt128( result ) };
+					bool isEven{ ( resultMantissa % Int128{ 2 } ) == Int128{ 0 } };
+					return !isEven; // Round up if currently odd
+				}
+			}
+			return false;
+		}
+
+		/**
+		 * @brief Determine if rounding up is needed for ToNearestTiesAway mode
+		 */
+		inline constexpr bool shouldRoundUpToNearestTiesAway( const Int128& roundingDigit ) noexcept
+		{
+			return ( roundingDigit.toLow() >= constants::DECIMAL_ROUNDING_THRESHOLD );
+		}
+
+		/**
+		 * @brief Determine if rounding up is needed for ToPositiveInfinity mode (Ceiling)
+		 */
+		inline constexpr bool shouldRoundUpToPositiveInfinity( const Int128& mantissa, std::uint8_t digitsToRemove,
+			bool isNegative ) noexcept
+		{
+			if ( isNegative )
+			{
+				return false; // Negative numbers round toward zero for ceiling
+			}
+
+			// Check if ANY fractional digits exist
+			if ( digitsToRemove > 0 )
+			{
+				Int128 fractionalDivisor{ getPowerOf10( digitsToRemove ) };
+				Int128 fractionalPart{ mantissa % fractionalDivisor };
+				return !fractionalPart.isZero();
+			}
+			return false;
+		}
+
+		/**
+		 * @brief Determine if rounding up is needed for ToNegativeInfinity mode (Floor)
+		 */
+		inline constexpr bool shouldRoundUpToNegativeInfinity( const Int128& mantissa, std::uint8_t digitsToRemove,
+			bool isNegative ) noexcept
+		{
+			if ( !isNegative )
+			{
+				return false; // Positive numbers round toward zero for floor
+			}
+
+			// Check if ANY fractional digits exist
+			if ( digitsToRemove > 0 )
+			{
+				Int128 fractionalDivisor{ getPowerOf10( digitsToRemove ) };
+				Int128 fractionalPart{ mantissa % fractionalDivisor };
+				return !fractionalPart.isZero();
+			}
+			return false;
+		}
+
+		/**
+		 * @brief Divide a non-negative mantissa by a power of 10, rounding the discarded digits
+		 * @param mantissa Non-negative mantissa to divide
+		 * @param power The power of 10 to divide by
+		 * @param mode Rounding mode applied to the discarded digits
+		 * @param isNegative Sign of the value the mantissa belongs to (used by directional modes)
+		 * @return Rounded quotient
+		 */
+		inline constexpr Int128 divideByPowerOf10Rounded( const Int128& mantissa, std::uint8_t power,
+			Decimal::RoundingMode mode, bool isNegative ) noexcept
+		{
+			if ( power == 0 )
+			{
+				return mantissa;
+			}
+
+			// A 96-bit mantissa is below 10^29, so larger powers always leave a zero quotient
+			if ( power > constants::DECIMAL_MAXIMUM_PLACES + 1U )
+			{
+				bool hasFraction{ !mantissa.isZero() };
+				bool roundUp{ ( mode == Decimal::RoundingMode::ToPositiveInfinity && !isNegative && hasFraction ) ||
+							  ( mode == Decimal::RoundingMode::ToNegativeInfinity && isNegative && hasFraction ) };
+
+				return roundUp ? Int128{ 1 } : Int128{ 0 };
+			}
+
+			const Int128 divisor{ getPowerOf10( power ) };
+			Int128 quotient{ mantissa / divisor };
+			Int128 remainder{ mantissa - quotient * divisor };
+
+			if ( remainder.isZero() )
+			{
+				return quotient;
+			}
+
+			const Int128 half{ divisor / Int128{ 2 } };
+			bool roundUp{ false };
+
+			switch ( mode )
+			{
+				case Decimal::RoundingMode::ToNearest:
+				{
+					roundUp = remainder > half || ( remainder == half && ( quotient.toLow() & constants::BIT_MASK_ONE ) != 0 );
+					break;
+				}
+				case Decimal::RoundingMode::ToNearestTiesAway:
+				{
+					roundUp = remainder >= half;
+					break;
+				}
+				case Decimal::RoundingMode::ToZero:
+				{
+					roundUp = false;
+					break;
+				}
+				case Decimal::RoundingMode::ToPositiveInfinity:
+				{
+					roundUp = !isNegative;
+					break;
+				}
+				case Decimal::RoundingMode::ToNegativeInfinity:
+				{
+					roundUp = isNegative;
+					break;
+				}
+			}
+
+			return roundUp ? quotient + Int128{ 1 } : quotient;
+		}
+
+		/**
+		 * @brief Replace the scale bits of a decimal, leaving sign and mantissa untouched
+		 * @param decimal The decimal to modify
+		 * @param scale The new scale (0-28)
+		 */
+		inline constexpr void setScale( Decimal& decimal, std::uint8_t scale ) noexcept
+		{
+			decimal.flags() = ( decimal.flags() & ~constants::DECIMAL_SCALE_MASK ) |
+							  ( static_cast<std::uint32_t>( scale ) << constants::DECIMAL_SCALE_SHIFT );
+		}
+		/**
+		 * @brief Build the result of a non-throwing operation from an exact magnitude
+		 * @param magnitude Result magnitude
+		 * @param scale Scale of magnitude (may be negative or above 28)
+		 * @param negative Sign of the result
+		 * @param inexact true if the magnitude itself was already truncated
+		 * @param status Sticky flags to raise
+		 * @return Normalized Decimal, truncated toward zero to 28 places and 96 bits like the
+		 *         operators; clamped to ±maxValue() with Overflow if the integer part does not fit
+		 */
+		inline constexpr Decimal checkedResult( UInt256 magnitude, std::int32_t scale, bool negative, bool inexact,
+			ArithmeticStatus& status ) noexcept
+		{
+			constexpr std::size_t mantissaBits{ 96U };
+
+			bool overflow{ false };
+			if ( scale < 0 )
+			{
+				// Integer result that must be scaled up to reach scale 0
+				overflow = -scale > static_cast<std::int32_t>( constants::DECIMAL_MAXIMUM_PLACES ) ||
+						   !magnitude.fitsIn( mantissaBits );
+				if ( !overflow )
+				{
+					magnitude = multiplyByPowerOf10Wide( magnitude, static_cast<std::uint8_t>( -scale ) );
+					scale = 0;
+				}
+			}
+
+			std::uint32_t power{ scale > static_cast<std::int32_t>( constants::DECIMAL_MAXIMUM_PLACES )
+									 ? static_cast<std::uint32_t>( scale ) - constants::DECIMAL_MAXIMUM_PLACES
+									 : 0U };
+
+			// 10^p <= 2^(L - 1 - 96) cannot bring an L-bit magnitude below 2^96
+			const std::size_t length{ magnitude.bitLength() };
+			if ( length > mantissaBits + 1U )
+			{
+				power = std::max( power, static_cast<std::uint32_t>( ( length - mantissaBits - 1U ) * 30102U / 100000U ) );
+			}
+
+			UInt256 reduced{ magnitude };
+			bool exact{ divideByPowerOf10Truncated( reduced, power ) };
+			while ( !overflow && !reduced.fitsIn( mantissaBits ) )
+			{
+				exact = reduced.divideBy( constants::DECIMAL_BASE ) == 0 && exact;
+				++power;
+				overflow = static_cast<std::int32_t>( power ) > scale;
+			}
+
+			if ( overflow || static_cast<std::int32_t>( power ) > scale )
+			{
+				status |= ArithmeticStatus::Overflow | ArithmeticStatus::Inexact;
+				return negative ? Decimal::minValue() : Decimal::maxValue();
+			}
+
+			if ( inexact || !exact )
+			{
+				status |= ArithmeticStatus::Inexact;
+			}
+
+			Decimal result;
+			result.mantissa()[0] = static_cast<std::uint32_t>( reduced.word( 0 ) );
+			result.mantissa()[1] = static_cast<std::uint32_t>( reduced.word( 0 ) >> constants::BITS_PER_UINT32 );
+			result.mantissa()[2] = static_cast<std::uint32_t>( reduced.word( 1 ) );
+			result.flags() = static_cast<std::uint32_t>( scale - static_cast<std::int32_t>( power ) ) << constants::DECIMAL_SCALE_SHIFT;
+			if ( negative && !reduced.isZero() )
+			{
+				result.flags() |= constants::DECIMAL_SIGN_MASK;
+			}
+
+			normalize( result );
+
+			return result;
+		}
+
+		/**
+		 * @brief Get the mantissa of a Decimal as a 256-bit magnitude
+		 * @param decimal The decimal to read
+		 * @return Unsigned mantissa
+		 */
+		inline constexpr UInt256 mantissaAsUInt256( const Decimal& decimal ) noexcept
+		{
+			const auto& mantissa{ decimal.mantissa() };
+			return UInt256{ static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 | mantissa[0], mantissa[2] };
+		}
+
+		//----------------------------------------------
+		// Hashing
+		//----------------------------------------------
+
+		/**
+		 * @brief Reduce a 64-bit value modulo 2^61 - 1
+		 * @param value Value to reduce
+		 * @return value mod HASH_MODULUS
+		 */
+		inline constexpr std::uint64_t reduceHashModulus( std::uint64_t value ) noexcept
+		{
+			// 2^61 is congruent to 1, so the bits above 61 fold onto the low bits
+			const std::uint64_t folded{ ( value & constants::HASH_MODULUS ) + ( value >> constants::HASH_MODULUS_BITS ) };
+
+			return folded >= constants::HASH_MODULUS ? folded - constants::HASH_MODULUS : folded;
+		}
+
+		/**
+		 * @brief Multiply modulo 2^61 - 1
+		 * @param a First factor (below HASH_MODULUS)
+		 * @param b Second factor (below HASH_MODULUS)
+		 * @return a * b mod HASH_MODULUS
+		 */
+		inline constexpr std::uint64_t multiplyHashModulus( std::uint64_t a, std::uint64_t b ) noexcept
+		{
+			const auto [low, high]{ multiply64( a, b ) };
+
+			return reduceHashModulus( ( low & constants::HASH_MODULUS ) + ( low >> constants::HASH_MODULUS_BITS | high << ( constants::BITS_PER_UINT64 - constants::HASH_MODULUS_BITS ) ) );
+		}
+
+		/**
+		 * @brief Build the table of 10^-scale modulo 2^61 - 1
+		 * @return Inverse powers of ten for scales 0-28
+		 */
+		inline constexpr std::array<std::uint64_t, constants::DECIMAL_MAXIMUM_PLACES + 1> makeHashInversePowersOf10() noexcept
+		{
+			// Fermat: 10^-1 = 10^(p - 2) mod p
+			std::uint64_t inverse{ 1 };
+			std::uint64_t base{ 10 };
+			for ( std::uint64_t exponent{ constants::HASH_MODULUS - 2 }; exponent != 0; exponent >>= 1 )
+			{
+				if ( ( exponent & 1U ) != 0 )
+				{
+					inverse = multiplyHashModulus( inverse, base );
+				}
+				base = multiplyHashModulus( base, base );
+			}
+
+			std::array<std::uint64_t, constants::DECIMAL_MAXIMUM_PLACES + 1> table{};
+			table[0] = 1;
+			for ( std::size_t scale{ 1 }; scale < table.size(); ++scale )
+			{
+				table[scale] = multiplyHashModulus( table[scale - 1], inverse );
+			}
+
+			return table;
+		}
+
+		/** @brief 10^-scale modulo 2^61 - 1, indexed by scale */
+		inline constexpr std::array<std::uint64_t, constants::DECIMAL_MAXIMUM_PLACES + 1> HASH_INVERSE_POWERS_OF_10{ makeHashInversePowersOf10() };
+	} // namespace internal
+
 	//=====================================================================
 	// Decimal class
 	//=====================================================================
@@ -47,6 +516,119 @@ namespace nfx::datatypes
 	{
 	}
 
+	inline constexpr Decimal::Decimal( std::int32_t value ) noexcept
+		: m_layout{ 0, { { 0, 0, 0 } } }
+	{
+		if ( value < 0 )
+		{
+			m_layout.flags |= constants::DECIMAL_SIGN_MASK;
+			value = -value;
+		}
+
+		m_layout.mantissa[0] = static_cast<std::uint32_t>( value );
+	}
+
+	inline constexpr Decimal::Decimal( std::int64_t value ) noexcept
+		: m_layout{ 0, { { 0, 0, 0 } } }
+	{
+		if ( value < 0 )
+		{
+			m_layout.flags |= constants::DECIMAL_SIGN_MASK;
+			value = -value;
+		}
+
+		m_layout.mantissa[0] = static_cast<std::uint32_t>( value );
+		m_layout.mantissa[1] = static_cast<std::uint32_t>( value >> constants::BITS_PER_UINT32 );
+	}
+
+	inline constexpr Decimal::Decimal( std::uint32_t value ) noexcept
+		: m_layout{ 0, { { 0, 0, 0 } } }
+	{
+		m_layout.mantissa[0] = value;
+	}
+
+	inline constexpr Decimal::Decimal( std::uint64_t value ) noexcept
+		: m_layout{ 0, { { 0, 0, 0 } } }
+	{
+		m_layout.mantissa[0] = static_cast<std::uint32_t>( value );
+		m_layout.mantissa[1] = static_cast<std::uint32_t>( value >> constants::BITS_PER_UINT32 );
+	}
+
+	inline constexpr Decimal::Decimal( std::string_view str )
+		: m_layout{ 0, { { 0, 0, 0 } } }
+	{
+		if ( !tryParse( str, *this ) )
+		{
+			throw std::invalid_argument{ "Invalid decimal string format" };
+		}
+	}
+
+	inline constexpr Decimal::Decimal( const Int128& val )
+		: m_layout{ 0, { { 0, 0, 0 } } }
+	{
+		// Handle zero case
+		if ( val.isZero() )
+		{
+			return;
+		}
+
+		// Extract sign and get absolute value
+		bool isNegative = val.isNegative();
+
+		// Handle the special case of minimum Int128 value (-2^127)
+		// This value cannot be represented positively in 128-bit signed integer
+		Int128 absoluteValue;
+#if NFX_DATATYPES_HAS_NATIVE_INT128
+		if ( val.toNative() == static_cast<NFX_DATATYPES_NATIVE_INT128>( constants::INT_128_MIN_NEGATIVE_HIGH ) << constants::BITS_PER_UINT64 )
+#else
+		if ( val.toHigh() == constants::INT_128_MIN_NEGATIVE_HIGH && val.toLow() == constants::INT_128_MIN_NEGATIVE_LOW )
+#endif
+		{
+			// For the minimum value, we manually construct the absolute value
+			// Since -2^127 cannot be represented as a positive Int128, we clamp to Decimal max
+			m_layout.mantissa[0] = constants::DECIMAL_MAX_MANTISSA_0; // Lower 32 bits: all 1s
+			m_layout.mantissa[1] = constants::DECIMAL_MAX_MANTISSA_1; // Middle 32 bits: all 1s
+			m_layout.mantissa[2] = constants::DECIMAL_MAX_MANTISSA_2; // Upper 32 bits: all 1s
+
+			// Set sign flag if negative
+			if ( isNegative )
+			{
+				m_layout.flags |= constants::DECIMAL_SIGN_MASK;
+			}
+			return;
+		}
+		else
+		{
+			absoluteValue = val.abs();
+		}
+
+		// Set sign flag if negative
+		if ( isNegative )
+		{
+			m_layout.flags |= constants::DECIMAL_SIGN_MASK;
+		}
+
+		// Check if the absolute value fits in Decimal's 96-bit mantissa capacity
+		// Maximum 96-bit unsigned value: 2^96 - 1 = 79,228,162,514,264,337,593,543,950,335
+		// This is much smaller than Int128 max value: 2^127 - 1 = 170,141,183,460,469,231,731,687,303,715,884,105,727
+
+		// Check if the high 64 bits contain anything beyond what fits in 32 bits (mantissa[2])
+		std::uint64_t high64 = absoluteValue.toHigh();
+		if ( high64 > constants::UINT32_MAX_VALUE )
+		{
+			// Value exceeds Decimal's capacity - clamp to maximum representable value
+			// Use the maximum 96-bit value: 2^96 - 1
+			m_layout.mantissa[0] = constants::DECIMAL_MAX_MANTISSA_0; // Lower 32 bits: all 1s
+			m_layout.mantissa[1] = constants::DECIMAL_MAX_MANTISSA_1; // Middle 32 bits: all 1s
+			m_layout.mantissa[2] = constants::DECIMAL_MAX_MANTISSA_2; // Upper 32 bits: all 1s
+		}
+		else
+		{
+			// Value fits in 96 bits - store it directly
+			internal::setMantissa( *this, absoluteValue );
+		}
+	}
+
 	//----------------------------------------------
 	// Decimal constants
 	//----------------------------------------------
@@ -64,31 +646,51 @@ namespace nfx::datatypes
 		return result;
 	}
 
+	inline constexpr Decimal Decimal::minValue() noexcept
+	{
+		Decimal result{};
+		result.m_layout.mantissa[0] = constants::DECIMAL_MIN_MANTISSA_0;
+		result.m_layout.mantissa[1] = constants::DECIMAL_MIN_MANTISSA_1;
+		result.m_layout.mantissa[2] = constants::DECIMAL_MIN_MANTISSA_2;
+		result.m_layout.flags = ( constants::DECIMAL_MAXIMUM_PLACES << constants::DECIMAL_SCALE_SHIFT );
+
+		return result;
+	}
+
+	inline constexpr Decimal Decimal::maxValue() noexcept
+	{
+		Decimal result{};
+		result.m_layout.mantissa[0] = constants::DECIMAL_MAX_MANTISSA_0;
+		result.m_layout.mantissa[1] = constants::DECIMAL_MAX_MANTISSA_1;
+		result.m_layout.mantissa[2] = constants::DECIMAL_MAX_MANTISSA_2;
+
+		return result;
+	}
 	//----------------------------------------------
 	// Static mathematical operations
 	//----------------------------------------------
 
-	inline Decimal Decimal::truncate( const Decimal& value ) noexcept
+	inline constexpr Decimal Decimal::truncate( const Decimal& value ) noexcept
 	{
 		return value.truncate();
 	}
 
-	inline Decimal Decimal::floor( Decimal& value ) noexcept
+	inline constexpr Decimal Decimal::floor( Decimal& value ) noexcept
 	{
 		return value.floor();
 	}
 
-	inline Decimal Decimal::ceiling( Decimal& value ) noexcept
+	inline constexpr Decimal Decimal::ceiling( Decimal& value ) noexcept
 	{
 		return value.ceiling();
 	}
 
-	inline Decimal Decimal::round( Decimal& value, std::int32_t decimalsPlacesCount, RoundingMode mode ) noexcept
+	inline constexpr Decimal Decimal::round( Decimal& value, std::int32_t decimalsPlacesCount, RoundingMode mode ) noexcept
 	{
 		return value.round( decimalsPlacesCount, mode );
 	}
 
-	inline Decimal Decimal::abs( const Decimal& value ) noexcept
+	inline constexpr Decimal Decimal::abs( const Decimal& value ) noexcept
 	{
 		return value.abs();
 	}
@@ -97,50 +699,379 @@ namespace nfx::datatypes
 	// Arithmetic operators
 	//----------------------------------------------
 
-	inline Decimal& Decimal::operator+=( const Decimal& other )
+	inline constexpr Decimal Decimal::operator+( const Decimal& other ) const
+	{
+		if ( isZero() )
+		{
+			return other;
+		}
+		if ( other.isZero() )
+		{
+			return *this;
+		}
+
+		Decimal result;
+		auto [left, right]{ internal::alignScale( *this, other ) };
+
+		internal::setMantissa( result, left + right );
+		result.m_layout.flags = ( m_layout.flags & ~( constants::DECIMAL_SCALE_MASK | constants::DECIMAL_SIGN_MASK ) ) |
+								( std::max( scale(), other.scale() ) << constants::DECIMAL_SCALE_SHIFT );
+
+		// Handle sign
+		if ( isNegative() == other.isNegative() )
+		{
+			if ( isNegative() )
+			{
+				result.m_layout.flags |= constants::DECIMAL_SIGN_MASK;
+			}
+		}
+		else
+		{
+			// Different signs - need subtraction logic
+			if ( left > right )
+			{
+				internal::setMantissa( result, left - right );
+				if ( isNegative() )
+				{
+					result.m_layout.flags |= constants::DECIMAL_SIGN_MASK;
+				}
+			}
+			else
+			{
+				internal::setMantissa( result, right - left );
+				if ( other.isNegative() )
+				{
+					result.m_layout.flags |= constants::DECIMAL_SIGN_MASK;
+				}
+			}
+		}
+
+		internal::normalize( result );
+
+		return result;
+	}
+
+	inline constexpr Decimal Decimal::operator-( const Decimal& other ) const
+	{
+		Decimal negatedOther{ other };
+
+		negatedOther.m_layout.flags ^= constants::DECIMAL_SIGN_MASK;
+
+		return *this + negatedOther;
+	}
+
+	inline constexpr Decimal Decimal::operator*( const Decimal& other ) const
+	{
+		if ( isZero() || other.isZero() )
+		{
+			return Decimal{};
+		}
+
+		Decimal result;
+		Int128 left{ internal::mantissaAsInt128( *this ) };
+		Int128 right{ internal::mantissaAsInt128( other ) };
+
+		// Calculate the product mantissa without storing it yet
+		Int128 productMantissa{ left * right };
+
+		// Combine scales
+		std::uint8_t newScale{ static_cast<std::uint8_t>( scale() + other.scale() ) };
+
+		// Check if the mantissa fits in 96 bits (max value: 2^96 - 1)
+		const Int128 max96bit{ constants::DECIMAL_96BIT_MAX_LOW, constants::DECIMAL_96BIT_MAX_HIGH };
+
+		// If mantissa exceeds 96 bits OR scale exceeds maximum, we need to truncate precision
+		while ( ( productMantissa > max96bit ) || ( newScale > constants::DECIMAL_MAXIMUM_PLACES ) )
+		{
+			// Divide mantissa by 10 to reduce precision
+			productMantissa = productMantissa / Int128{ constants::DECIMAL_BASE };
+			newScale--;
+
+			// Safety check to prevent infinite loop
+			if ( newScale == 0 && productMantissa > max96bit )
+			{
+				// If we still can't fit in 96 bits even with scale 0,
+				// the number is too large for Decimal representation
+				break;
+			}
+		}
+
+		// Now store the properly scaled mantissa
+		internal::setMantissa( result, productMantissa );
+
+		result.m_layout.flags = ( static_cast<std::uint32_t>( newScale ) << constants::DECIMAL_SCALE_SHIFT );
+
+		// Combine signs
+		if ( isNegative() != other.isNegative() )
+		{
+			result.m_layout.flags |= constants::DECIMAL_SIGN_MASK;
+		}
+
+		internal::normalize( result );
+
+		return result;
+	}
+
+	inline constexpr Decimal Decimal::operator/( const Decimal& other ) const
+	{
+		if ( other.isZero() )
+		{
+			throw std::overflow_error{ "Division by zero" };
+		}
+
+		if ( isZero() )
+		{
+			return Decimal{};
+		}
+
+		Decimal result;
+		Int128 dividend{ internal::mantissaAsInt128( *this ) };
+		Int128 divisor{ internal::mantissaAsInt128( other ) };
+
+		// Scale adjustment for division:
+		// If dividend has scale d and divisor has scale s,
+		// result should have scale (d - s)
+		// To maintain precision, we ALWAYS scale up the dividend
+		std::int32_t targetScale{ static_cast<std::int32_t>( scale() ) - static_cast<std::int32_t>( other.scale() ) };
+
+		// Scale up dividend to maintain precision
+		std::uint8_t extraPrecision{ constants::DECIMAL_DIVISION_EXTRA_PRECISION };
+		for ( std::uint8_t i{ 0U }; i < extraPrecision; ++i )
+		{
+			// Check if scaling would cause overflow
+			if ( dividend.toHigh() > constants::INT128_MUL10_OVERFLOW_THRESHOLD )
+			{
+				break; // Stop scaling to prevent overflow
+			}
+			dividend = dividend * Int128{ constants::DECIMAL_BASE };
+			targetScale++;
+		}
+
+		// If target scale would still be negative, scale up more
+		if ( targetScale < 0 )
+		{
+			std::uint8_t scaleUp{ static_cast<std::uint8_t>( -targetScale ) };
+			for ( std::uint8_t i{ 0U }; i < scaleUp && i < constants::DECIMAL_MAXIMUM_PLACES; ++i )
+			{
+				if ( dividend.toHigh() > constants::INT128_MUL10_OVERFLOW_THRESHOLD )
+				{
+					break; // Stop scaling to prevent overflow
+				}
+				dividend = dividend * Int128{ constants::DECIMAL_BASE };
+				targetScale++;
+			}
+		}
+
+		internal::setMantissa( result, dividend / divisor );
+		result.m_layout.flags = ( static_cast<std::uint32_t>( targetScale ) << constants::DECIMAL_SCALE_SHIFT );
+
+		// Combine signs
+		if ( isNegative() != other.isNegative() )
+		{
+			result.m_layout.flags |= constants::DECIMAL_SIGN_MASK;
+		}
+
+		internal::normalize( result );
+
+		return result;
+	}
+
+	inline constexpr Decimal Decimal::operator-() const noexcept
+	{
+		Decimal result{ *this };
+
+		result.m_layout.flags ^= constants::DECIMAL_SIGN_MASK;
+		return result;
+	}
+	inline constexpr Decimal& Decimal::operator+=( const Decimal& other )
 	{
 		*this = *this + other;
 		return *this;
 	}
 
-	inline Decimal& Decimal::operator-=( const Decimal& other )
+	inline constexpr Decimal& Decimal::operator-=( const Decimal& other )
 	{
 		*this = *this - other;
 		return *this;
 	}
 
-	inline Decimal& Decimal::operator*=( const Decimal& other )
+	inline constexpr Decimal& Decimal::operator*=( const Decimal& other )
 	{
 		*this = *this * other;
 		return *this;
 	}
 
-	inline Decimal& Decimal::operator/=( const Decimal& other )
+	inline constexpr Decimal& Decimal::operator/=( const Decimal& other )
 	{
 		*this = *this / other;
 		return *this;
 	}
 
+	//----------------------------------------------
+	// Non-throwing arithmetic
+	//----------------------------------------------
+
+	inline constexpr Decimal Decimal::add( const Decimal& left, const Decimal& right, ArithmeticStatus& status ) noexcept
+	{
+		if ( left.isZero() )
+		{
+			return right;
+		}
+		if ( right.isZero() )
+		{
+			return left;
+		}
+
+		const std::uint8_t commonScale{ std::max( left.scale(), right.scale() ) };
+		const internal::UInt256 leftMagnitude{ internal::multiplyByPowerOf10Wide(
+			internal::mantissaAsUInt256( left ), static_cast<std::uint8_t>( commonScale - left.scale() ) ) };
+		const internal::UInt256 rightMagnitude{ internal::multiplyByPowerOf10Wide(
+			internal::mantissaAsUInt256( right ), static_cast<std::uint8_t>( commonScale - right.scale() ) ) };
+
+		if ( left.isNegative() == right.isNegative() )
+		{
+			return internal::checkedResult( leftMagnitude + rightMagnitude, commonScale, left.isNegative(), false, status );
+		}
+
+		if ( leftMagnitude >= rightMagnitude )
+		{
+			return internal::checkedResult( leftMagnitude - rightMagnitude, commonScale, left.isNegative(), false, status );
+		}
+
+		return internal::checkedResult( rightMagnitude - leftMagnitude, commonScale, right.isNegative(), false, status );
+	}
+
+	inline constexpr Decimal Decimal::subtract( const Decimal& left, const Decimal& right, ArithmeticStatus& status ) noexcept
+	{
+		return add( left, -right, status );
+	}
+
+	inline constexpr Decimal Decimal::multiply( const Decimal& left, const Decimal& right, ArithmeticStatus& status ) noexcept
+	{
+		if ( left.isZero() || right.isZero() )
+		{
+			return Decimal{};
+		}
+
+		const internal::UInt256 product{ internal::UInt256::multiply(
+			internal::mantissaAsUInt256( left ), internal::mantissaAsUInt256( right ) ) };
+
+		return internal::checkedResult( product, static_cast<std::int32_t>( left.scale() ) + right.scale(),
+			left.isNegative() != right.isNegative(), false, status );
+	}
+
+	inline constexpr Decimal Decimal::divide( const Decimal& left, const Decimal& right, ArithmeticStatus& status ) noexcept
+	{
+		if ( right.isZero() )
+		{
+			status |= ArithmeticStatus::DivisionByZero;
+			return Decimal{};
+		}
+
+		if ( left.isZero() )
+		{
+			return Decimal{};
+		}
+
+		// Same dividend scaling as operator/, so results agree digit for digit
+		Int128 scaled{ internal::mantissaAsInt128( left ) };
+		const internal::UInt256 divisor{ internal::mantissaAsUInt256( right ) };
+		std::int32_t targetScale{ static_cast<std::int32_t>( left.scale() ) - static_cast<std::int32_t>( right.scale() ) };
+
+		for ( std::uint8_t i{ 0U }; i < constants::DECIMAL_DIVISION_EXTRA_PRECISION; ++i )
+		{
+			if ( scaled.toHigh() > constants::INT128_MUL10_OVERFLOW_THRESHOLD )
+			{
+				break;
+			}
+			scaled = scaled * Int128{ constants::DECIMAL_BASE };
+			targetScale++;
+		}
+
+		if ( targetScale < 0 )
+		{
+			const std::int32_t scaleUp{ -targetScale };
+			for ( std::int32_t i{ 0 }; i < scaleUp && i < constants::DECIMAL_MAXIMUM_PLACES; ++i )
+			{
+				if ( scaled.toHigh() > constants::INT128_MUL10_OVERFLOW_THRESHOLD )
+				{
+					break;
+				}
+				scaled = scaled * Int128{ constants::DECIMAL_BASE };
+				targetScale++;
+			}
+		}
+
+		const internal::UInt256 dividend{ scaled.toLow(), scaled.toHigh() };
+		internal::UInt256 quotient{ dividend };
+		internal::UInt256 remainder;
+		if ( divisor.fitsIn( 64 ) )
+		{
+			remainder = internal::UInt256{ quotient.divideBy( divisor.word( 0 ) ) };
+		}
+		else
+		{
+			internal::UInt256::divide( dividend, divisor, quotient, remainder );
+		}
+
+		return internal::checkedResult( quotient, targetScale, left.isNegative() != right.isNegative(), !remainder.isZero(), status );
+	}
+
 	//----------------------------------------------
 	// Comparison operators
 	//----------------------------------------------
 
-	inline bool Decimal::operator!=( const Decimal& other ) const noexcept
+	inline constexpr bool Decimal::operator==( const Decimal& other ) const noexcept
+	{
+		if ( isZero() && other.isZero() )
+		{
+			return true;
+		}
+
+		if ( isNegative() != other.isNegative() )
+		{
+			return false;
+		}
+
+		auto [left, right] = internal::alignScale( *this, other );
+
+		return left == right;
+	}
+
+	inline constexpr bool Decimal::operator<( const Decimal& other ) const noexcept
+	{
+		if ( isNegative() != other.isNegative() )
+		{
+			return isNegative();
+		}
+
+		auto [left, right] = internal::alignScale( *this, other );
+
+		if ( isNegative() )
+		{
+			return left > right;
+		}
+		else
+		{
+			return left < right;
+		}
+	}
+	inline constexpr bool Decimal::operator!=( const Decimal& other ) const noexcept
 	{
 		return !( *this == other );
 	}
 
-	inline bool Decimal::operator<=( const Decimal& other ) const noexcept
+	inline constexpr bool Decimal::operator<=( const Decimal& other ) const noexcept
 	{
 		return *this < other || *this == other;
 	}
 
-	inline bool Decimal::operator>( const Decimal& other ) const noexcept
+	inline constexpr bool Decimal::operator>( const Decimal& other ) const noexcept
 	{
 		return !( *this <= other );
 	}
 
-	inline bool Decimal::operator>=( const Decimal& other ) const noexcept
+	inline constexpr bool Decimal::operator>=( const Decimal& other ) const noexcept
 	{
 		return !( *this < other );
 	}
@@ -240,7 +1171,7 @@ namespace nfx::datatypes
 	// Comparison with built-in integer types
 	//----------------------------------------------
 
-	inline bool Decimal::operator==( std::int64_t val ) const noexcept
+	inline constexpr bool Decimal::operator==( std::int64_t val ) const noexcept
 	{
 		// For integer comparison, we need exact equality
 		if ( scale() > 0 )
@@ -253,34 +1184,34 @@ namespace nfx::datatypes
 		return *this == temp;
 	}
 
-	inline bool Decimal::operator!=( std::int64_t val ) const noexcept
+	inline constexpr bool Decimal::operator!=( std::int64_t val ) const noexcept
 	{
 		return !( *this == val );
 	}
 
-	inline bool Decimal::operator<( std::int64_t val ) const noexcept
+	inline constexpr bool Decimal::operator<( std::int64_t val ) const noexcept
 	{
 		Decimal temp{ val };
 		return *this < temp;
 	}
 
-	inline bool Decimal::operator<=( std::int64_t val ) const noexcept
+	inline constexpr bool Decimal::operator<=( std::int64_t val ) const noexcept
 	{
 		return *this < val || *this == val;
 	}
 
-	inline bool Decimal::operator>( std::int64_t val ) const noexcept
+	inline constexpr bool Decimal::operator>( std::int64_t val ) const noexcept
 	{
 		Decimal temp{ val };
 		return *this > temp;
 	}
 
-	inline bool Decimal::operator>=( std::int64_t val ) const noexcept
+	inline constexpr bool Decimal::operator>=( std::int64_t val ) const noexcept
 	{
 		return *this > val || *this == val;
 	}
 
-	inline bool Decimal::operator==( std::uint64_t val ) const noexcept
+	inline constexpr bool Decimal::operator==( std::uint64_t val ) const noexcept
 	{
 		// For integer comparison, we need exact equality
 		if ( scale() > 0 )
@@ -299,12 +1230,12 @@ namespace nfx::datatypes
 		return *this == temp;
 	}
 
-	inline bool Decimal::operator!=( std::uint64_t val ) const noexcept
+	inline constexpr bool Decimal::operator!=( std::uint64_t val ) const noexcept
 	{
 		return !( *this == val );
 	}
 
-	inline bool Decimal::operator<( std::uint64_t val ) const noexcept
+	inline constexpr bool Decimal::operator<( std::uint64_t val ) const noexcept
 	{
 		// Negative Decimal is always less than positive uint64_t
 		if ( isNegative() )
@@ -316,12 +1247,12 @@ namespace nfx::datatypes
 		return *this < temp;
 	}
 
-	inline bool Decimal::operator<=( std::uint64_t val ) const noexcept
+	inline constexpr bool Decimal::operator<=( std::uint64_t val ) const noexcept
 	{
 		return *this < val || *this == val;
 	}
 
-	inline bool Decimal::operator>( std::uint64_t val ) const noexcept
+	inline constexpr bool Decimal::operator>( std::uint64_t val ) const noexcept
 	{
 		// Negative Decimal is never greater than positive uint64_t
 		if ( isNegative() )
@@ -333,37 +1264,37 @@ namespace nfx::datatypes
 		return *this > temp;
 	}
 
-	inline bool Decimal::operator>=( std::uint64_t val ) const noexcept
+	inline constexpr bool Decimal::operator>=( std::uint64_t val ) const noexcept
 	{
 		return *this > val || *this == val;
 	}
 
-	inline bool Decimal::operator==( std::int32_t val ) const noexcept
+	inline constexpr bool Decimal::operator==( std::int32_t val ) const noexcept
 	{
 		return *this == static_cast<std::int64_t>( val );
 	}
 
-	inline bool Decimal::operator!=( std::int32_t val ) const noexcept
+	inline constexpr bool Decimal::operator!=( std::int32_t val ) const noexcept
 	{
 		return *this != static_cast<std::int64_t>( val );
 	}
 
-	inline bool Decimal::operator<( std::int32_t val ) const noexcept
+	inline constexpr bool Decimal::operator<( std::int32_t val ) const noexcept
 	{
 		return *this < static_cast<std::int64_t>( val );
 	}
 
-	inline bool Decimal::operator<=( std::int32_t val ) const noexcept
+	inline constexpr bool Decimal::operator<=( std::int32_t val ) const noexcept
 	{
 		return *this <= static_cast<std::int64_t>( val );
 	}
 
-	inline bool Decimal::operator>( std::int32_t val ) const noexcept
+	inline constexpr bool Decimal::operator>( std::int32_t val ) const noexcept
 	{
 		return *this > static_cast<std::int64_t>( val );
 	}
 
-	inline bool Decimal::operator>=( std::int32_t val ) const noexcept
+	inline constexpr bool Decimal::operator>=( std::int32_t val ) const noexcept
 	{
 		return *this >= static_cast<std::int64_t>( val );
 	}
@@ -372,46 +1303,362 @@ namespace nfx::datatypes
 	// Comparison with nfx Int128
 	//----------------------------------------------
 
-	inline bool Decimal::operator!=( const Int128& val ) const noexcept
+	inline constexpr bool Decimal::operator==( const Int128& val ) const noexcept
+	{
+		// For integer comparison, we need exact equality
+		if ( scale() > 0 )
+		{
+			// If this has fractional part, it can't equal an integer
+			return false;
+		}
+
+		// Convert this decimal's mantissa to Int128 and compare directly
+		Int128 mantissa{ internal::mantissaAsInt128( *this ) };
+
+		// Handle signs
+		if ( isNegative() )
+		{
+			if ( val >= Int128{ 0 } )
+			{
+				return false; // Different signs
+			}
+			// Both negative - compare absolute values (negate mantissa for comparison)
+			return mantissa == -val;
+		}
+		else
+		{
+			if ( val < Int128{ 0 } )
+			{
+				return false; // Different signs
+			}
+			// Both positive
+			return mantissa == val;
+		}
+	}
+
+	inline constexpr bool Decimal::operator<( const Int128& val ) const noexcept
+	{
+		// Handle different signs
+		if ( isNegative() && val >= Int128{ 0 } )
+		{
+			return true; // Negative < Non-negative
+		}
+		if ( !isNegative() && val < Int128{ 0 } )
+		{
+			return false; // Non-negative > Negative
+		}
+
+		// Same signs - convert decimal to comparable form
+		Int128 mantissa{ internal::mantissaAsInt128( *this ) };
+
+		if ( scale() > 0 )
+		{
+			// This decimal has fractional part - scale up the integer for comparison
+			Int128 scaledVal{ val * internal::getPowerOf10( scale() ) };
+
+			if ( isNegative() )
+			{
+				// Both negative - compare absolute values with flipped result
+				return mantissa > scaledVal.abs();
+			}
+			else
+			{
+				return mantissa < scaledVal;
+			}
+		}
+		else
+		{
+			// No fractional part - direct comparison
+			if ( isNegative() )
+			{
+				// Both negative - compare absolute values with flipped result
+				return mantissa > val.abs();
+			}
+			else
+			{
+				return mantissa < val;
+			}
+		}
+	}
+	inline constexpr bool Decimal::operator!=( const Int128& val ) const noexcept
 	{
 		return !( *this == val );
 	}
 
-	inline bool Decimal::operator<=( const Int128& val ) const noexcept
+	inline constexpr bool Decimal::operator<=( const Int128& val ) const noexcept
 	{
 		return *this < val || *this == val;
 	}
 
-	inline bool Decimal::operator>( const Int128& val ) const noexcept
+	inline constexpr bool Decimal::operator>( const Int128& val ) const noexcept
 	{
 		return !( *this <= val );
 	}
 
-	inline bool Decimal::operator>=( const Int128& val ) const noexcept
+	inline constexpr bool Decimal::operator>=( const Int128& val ) const noexcept
 	{
 		return !( *this < val );
 	}
 
+	//----------------------------------------------
+	// String parsing
+	//----------------------------------------------
+
+	inline constexpr Decimal Decimal::parse( std::string_view str )
+	{
+		Decimal result;
+		if ( !tryParse( str, result ) )
+		{
+			throw std::invalid_argument{ "Invalid decimal string format" };
+		}
+		return result;
+	}
+
+	inline constexpr bool Decimal::tryParse( std::string_view str, Decimal& result ) noexcept
+	{
+		try
+		{
+			result = Decimal{};
+
+			if ( str.empty() )
+			{
+				return false;
+			}
+
+			// Handle sign
+			bool negative{ false };
+			size_t pos{ 0 };
+			if ( str[0] == '-' )
+			{
+				negative = true;
+				pos = 1;
+			}
+			else if ( str[0] == '+' )
+			{
+				pos = 1;
+			}
+
+			// Check if we have at least one character after sign
+			if ( pos >= str.length() )
+			{
+				return false;
+			}
+
+			// Find decimal point and validate there's only one
+			size_t decimalPos{ std::string_view::npos };
+			std::uint8_t currentScale{ 0 };
+			size_t decimalCount{ 0 };
+
+			for ( size_t i{ pos }; i < str.length(); ++i )
+			{
+				if ( str[i] == '.' )
+				{
+					decimalCount++;
+					if ( decimalCount > 1 )
+					{
+						return false;
+					}
+
+					decimalPos = i;
+				}
+			}
+
+			if ( decimalPos != std::string_view::npos )
+			{
+				currentScale = static_cast<std::uint8_t>( str.length() - decimalPos - 1 );
+				if ( currentScale > constants::DECIMAL_MAXIMUM_PLACES )
+				{
+					currentScale = constants::DECIMAL_MAXIMUM_PLACES;
+				}
+			}
+
+			// Optimized digit accumulation
+			Int128 mantissaValue;
+			const Int128 ten{ constants::DECIMAL_BASE };
+			bool hasDigits{ false };
+			std::uint8_t significantDigits{ 0 };
+			std::uint8_t decimalDigitsProcessed{ 0 };
+
+			for ( size_t i{ pos }; i < str.length(); ++i )
+			{
+				if ( str[i] == '.' )
+				{
+					continue;
+				}
+
+				if ( str[i] < '0' || str[i] > '9' )
+				{
+					// Invalid character
+					return false;
+				}
+
+				hasDigits = true;
+				std::uint64_t digit{ static_cast<std::uint64_t>( str[i] - '0' ) };
+
+				// Decimal specification: maximum 28 significant digits
+				if ( significantDigits >= constants::DECIMAL_MAXIMUM_PLACES )
+				{
+					// Truncate excess digits - adjust scale based on actual decimal digits processed
+					if ( decimalPos != std::string_view::npos )
+					{
+						currentScale = decimalDigitsProcessed;
+					}
+					break;
+				}
+
+				// Count significant digits (skip leading zeros only before decimal point)
+				if ( digit != 0 || mantissaValue != Int128{ 0 } || ( decimalPos != std::string_view::npos && i > decimalPos ) )
+				{
+					significantDigits++;
+				}
+
+				// Count decimal digits processed
+				if ( decimalPos != std::string_view::npos && i > decimalPos )
+				{
+					decimalDigitsProcessed++;
+				}
+
+				// Safe to accumulate this digit
+				mantissaValue = mantissaValue * ten + Int128{ digit };
+			}
+
+			// Ensure we have at least one digit (prevents parsing ".", "+", "-", etc.)
+			if ( !hasDigits )
+			{
+				return false;
+			}
+
+			// Check if mantissa fits in our 96-bit storage
+			if ( mantissaValue.toHigh() > constants::UINT32_MAX_VALUE )
+			{
+				// Value too large - truncate excess precision to fit
+				while ( mantissaValue.toHigh() > constants::UINT32_MAX_VALUE && currentScale > 0 )
+				{
+					mantissaValue = mantissaValue / Int128{ constants::DECIMAL_BASE };
+					--currentScale;
+				}
+
+				// If still too large after removing all decimal places, truncate the integer part to fit
+				while ( mantissaValue.toHigh() > constants::UINT32_MAX_VALUE )
+				{
+					mantissaValue = mantissaValue / Int128{ constants::DECIMAL_BASE };
+				}
+			}
+
+			// Set result
+			if ( negative )
+			{
+				result.m_layout.flags |= constants::DECIMAL_SIGN_MASK;
+			}
+
+			result.m_layout.flags |= ( static_cast<std::uint32_t>( currentScale ) << constants::DECIMAL_SCALE_SHIFT );
+
+			// Store the 96-bit mantissa
+			std::uint64_t low{ mantissaValue.toLow() };
+			std::uint64_t high{ mantissaValue.toHigh() };
+
+			result.m_layout.mantissa[0] = static_cast<std::uint32_t>( low );
+			result.m_layout.mantissa[1] = static_cast<std::uint32_t>( low >> constants::BITS_PER_UINT32 );
+			result.m_layout.mantissa[2] = static_cast<std::uint32_t>( high );
+
+			// Normalize to remove trailing zeros
+			internal::normalize( result );
+
+			return true;
+		}
+		catch ( ... )
+		{
+			return false;
+		}
+	}
+	//----------------------------------------------
+	// Type conversion
+	//----------------------------------------------
+
+	inline constexpr std::array<std::int32_t, 4> Decimal::toBits() const noexcept
+	{
+		std::array<std::int32_t, 4> bits{};
+
+		// First three elements are the 96-bit mantissa
+		bits[0] = static_cast<std::int32_t>( m_layout.mantissa[0] );
+		bits[1] = static_cast<std::int32_t>( m_layout.mantissa[1] );
+		bits[2] = static_cast<std::int32_t>( m_layout.mantissa[2] );
+
+		// Fourth element contains scale and sign information
+		bits[3] = static_cast<std::int32_t>( m_layout.flags );
+
+		return bits;
+	}
+
+	inline constexpr Decimal Decimal::fromBits( const std::array<std::int32_t, 4>& bits )
+	{
+		Decimal result;
+		if ( !tryFromBits( bits, result ) )
+		{
+			throw std::invalid_argument{ "Invalid decimal bits" };
+		}
+
+		return result;
+	}
+
+	inline constexpr bool Decimal::tryFromBits( const std::array<std::int32_t, 4>& bits, Decimal& result ) noexcept
+	{
+		const auto flags{ static_cast<std::uint32_t>( bits[3] ) };
+		if ( ( flags & constants::DECIMAL_RESERVED_FLAGS_MASK ) != 0 ||
+			 ( ( flags & constants::DECIMAL_SCALE_MASK ) >> constants::DECIMAL_SCALE_SHIFT ) > constants::DECIMAL_MAXIMUM_PLACES )
+		{
+			return false;
+		}
+
+		result.m_layout.mantissa[0] = static_cast<std::uint32_t>( bits[0] );
+		result.m_layout.mantissa[1] = static_cast<std::uint32_t>( bits[1] );
+		result.m_layout.mantissa[2] = static_cast<std::uint32_t>( bits[2] );
+		result.m_layout.flags = flags;
+
+		return true;
+	}
+
+	inline constexpr Decimal Decimal::fromParts( std::uint32_t lo, std::uint32_t mid, std::uint32_t hi, std::uint8_t scale, bool negative )
+	{
+		if ( scale > constants::DECIMAL_MAXIMUM_PLACES )
+		{
+			throw std::invalid_argument{ "Decimal scale out of range" };
+		}
+
+		Decimal result;
+		result.m_layout.mantissa = { lo, mid, hi };
+		result.m_layout.flags = static_cast<std::uint32_t>( scale ) << constants::DECIMAL_SCALE_SHIFT;
+		if ( negative && ( lo | mid | hi ) != 0 )
+		{
+			result.m_layout.flags |= constants::DECIMAL_SIGN_MASK;
+		}
+
+		return result;
+	}
 	//----------------------------------------------
 	// Property accessors
 	//----------------------------------------------
 
-	inline const std::uint32_t& Decimal::flags() const noexcept
+	inline constexpr std::uint8_t Decimal::scale() const noexcept
+	{
+		return static_cast<std::uint8_t>( ( m_layout.flags & constants::DECIMAL_SCALE_MASK ) >> constants::DECIMAL_SCALE_SHIFT );
+	}
+	inline constexpr const std::uint32_t& Decimal::flags() const noexcept
 	{
 		return m_layout.flags;
 	}
 
-	inline std::uint32_t& Decimal::flags() noexcept
+	inline constexpr std::uint32_t& Decimal::flags() noexcept
 	{
 		return m_layout.flags;
 	}
 
-	inline const std::array<std::uint32_t, 3>& Decimal::mantissa() const noexcept
+	inline constexpr const std::array<std::uint32_t, 3>& Decimal::mantissa() const noexcept
 	{
 		return m_layout.mantissa;
 	}
 
-	inline std::array<std::uint32_t, 3>& Decimal::mantissa() noexcept
+	inline constexpr std::array<std::uint32_t, 3>& Decimal::mantissa() noexcept
 	{
 		return m_layout.mantissa;
 	}
@@ -420,16 +1667,294 @@ namespace nfx::datatypes
 	// State checking
 	//----------------------------------------------
 
-	inline bool Decimal::isZero() const noexcept
+	inline constexpr bool Decimal::isZero() const noexcept
 	{
 		return m_layout.mantissa[0] == 0 && m_layout.mantissa[1] == 0 && m_layout.mantissa[2] == 0;
 	}
 
+	inline constexpr bool Decimal::isNegative() const noexcept
+	{
+		return ( m_layout.flags & constants::DECIMAL_SIGN_MASK ) != 0;
+	}
+
+	//----------------------------------------------
+	// Hashing
+	//----------------------------------------------
+
+	inline constexpr std::uint64_t Decimal::hash() const noexcept
+	{
+		// 2^64 is congruent to 2^3 modulo 2^61 - 1
+		const std::uint64_t low{ static_cast<std::uint64_t>( m_layout.mantissa[1] ) << constants::BITS_PER_UINT32 | m_layout.mantissa[0] };
+		const std::uint64_t high{ static_cast<std::uint64_t>( m_layout.mantissa[2] ) << ( constants::BITS_PER_UINT64 - constants::HASH_MODULUS_BITS ) };
+		const std::uint64_t mantissa{ internal::reduceHashModulus( internal::reduceHashModulus( low ) + high ) };
+
+		// Equal values share mantissa * 10^-scale, whatever the scale
+		std::uint64_t residue{ internal::multiplyHashModulus( mantissa, internal::HASH_INVERSE_POWERS_OF_10[scale()] ) };
+		if ( isNegative() && residue != 0 )
+		{
+			residue = constants::HASH_MODULUS - residue;
+		}
+
+		return internal::mixHash( residue );
+	}
+
 	//----------------------------------------------
 	// Mathematical operations
 	//----------------------------------------------
 
-	inline Decimal Decimal::abs() const noexcept
+	inline constexpr Decimal Decimal::truncate() const noexcept
+	{
+		return round( 0, RoundingMode::ToZero );
+	}
+
+	inline constexpr Decimal Decimal::floor() const noexcept
+	{
+		return round( 0, RoundingMode::ToNegativeInfinity );
+	}
+
+	inline constexpr Decimal Decimal::ceiling() const noexcept
+	{
+		return round( 0, RoundingMode::ToPositiveInfinity );
+	}
+
+	inline constexpr Decimal Decimal::round( std::int32_t decimalsPlacesCount, RoundingMode mode ) const noexcept
+	{
+		if ( decimalsPlacesCount < 0 )
+		{
+			decimalsPlacesCount = 0;
+		}
+
+		if ( decimalsPlacesCount >= static_cast<std::int32_t>( scale() ) || isZero() )
+		{
+			return *this;
+		}
+
+		Decimal result{ *this };
+		std::uint8_t currentScale{ scale() };
+		std::uint8_t targetScale{ static_cast<std::uint8_t>( decimalsPlacesCount ) };
+		std::uint8_t digitsToRemove{ static_cast<std::uint8_t>( currentScale - targetScale ) };
+
+		// Get the digit that determines rounding direction
+		Int128 mantissa{ internal::mantissaAsInt128( *this ) };
+		Int128 divisor{ 1 };
+		if ( digitsToRemove > 1U )
+		{
+			std::uint8_t divisorPowers = static_cast<std::uint8_t>( digitsToRemove - 1U );
+			for ( std::uint8_t i{ 0 }; i < divisorPowers; ++i )
+			{
+				divisor = divisor * Int128{ constants::DECIMAL_BASE };
+			}
+		}
+
+		Int128 roundingDigit{ ( mantissa / divisor ) % Int128{ constants::DECIMAL_BASE } };
+
+		// Perform truncation to target scale
+		for ( std::uint8_t i = 0; i < digitsToRemove; ++i )
+		{
+			internal::divideByPowerOf10( result, 1U );
+		}
+
+		result.m_layout.flags =
+			( result.m_layout.flags & ~constants::DECIMAL_SCALE_MASK ) |
+			( static_cast<std::uint32_t>( targetScale ) << constants::DECIMAL_SCALE_SHIFT );
+
+		// Determine if we should round up based on the rounding mode
+		bool shouldRoundUp{ false };
+
+		switch ( mode )
+		{
+			case RoundingMode::ToNearest:
+			{
+				shouldRoundUp = internal::shouldRoundUpToNearest( roundingDigit, mantissa, divisor, digitsToRemove, result );
+				break;
+			}
+			case RoundingMode::ToNearestTiesAway:
+			{
+				shouldRoundUp = internal::shouldRoundUpToNearestTiesAway( roundingDigit );
+				break;
+			}
+			case RoundingMode::ToZero:
+			{
+				shouldRoundUp = false; // Truncate (never round up)
+				break;
+			}
+			case RoundingMode::ToPositiveInfinity:
+			{
+				shouldRoundUp = internal::shouldRoundUpToPositiveInfinity( mantissa, digitsToRemove, isNegative() );
+				break;
+			}
+			case RoundingMode::ToNegativeInfinity:
+			{
+				shouldRoundUp = internal::shouldRoundUpToNegativeInfinity( mantissa, digitsToRemove, isNegative() );
+				break;
+			}
+		}
+
+		// Apply rounding adjustment
+		if ( shouldRoundUp )
+		{
+			Int128 resultMantissa{ internal::mantissaAsInt128( result ) };
+			if ( isNegative() )
+			{
+				// For negative numbers, "rounding up" means increasing the absolute value (magnitude)
+				// Since mantissa is unsigned, we ADD to make the number more negative
+				// Example: -123 → -124 means mantissa goes from 123 to 124
+				resultMantissa = resultMantissa + Int128{ 1 };
+			}
+			else
+			{
+				// For positive numbers, rounding up means adding to the mantissa
+				resultMantissa = resultMantissa + Int128{ 1 };
+			}
+			internal::setMantissa( result, resultMantissa );
+		}
+
+		return result;
+	}
+
+	inline constexpr Decimal Decimal::rescale( std::int32_t targetScale, RoundingMode mode ) const
+	{
+		Decimal result;
+		if ( !tryRescale( targetScale, result, mode ) )
+		{
+			throw std::overflow_error{ "Decimal rescale overflow" };
+		}
+
+		return result;
+	}
+
+	inline constexpr bool Decimal::tryRescale( std::int32_t targetScale, Decimal& result, RoundingMode mode ) const noexcept
+	{
+		if ( targetScale < 0 )
+		{
+			targetScale = 0;
+		}
+		if ( targetScale > static_cast<std::int32_t>( constants::DECIMAL_MAXIMUM_PLACES ) )
+		{
+			targetScale = constants::DECIMAL_MAXIMUM_PLACES;
+		}
+
+		const std::uint8_t currentScale{ scale() };
+		const std::uint8_t newScale{ static_cast<std::uint8_t>( targetScale ) };
+
+		if ( newScale == currentScale )
+		{
+			result = *this;
+
+			return true;
+		}
+
+		Decimal rescaled{ *this };
+		Int128 mantissa{ internal::mantissaAsInt128( *this ) };
+
+		if ( newScale < currentScale )
+		{
+			// Lowering the scale discards digits
+			mantissa = internal::divideByPowerOf10Rounded(
+				mantissa, static_cast<std::uint8_t>( currentScale - newScale ), mode, isNegative() );
+		}
+		else
+		{
+			// Raising the scale appends trailing zeros, which must fit the 96-bit mantissa
+			const Int128 max96bit{ constants::DECIMAL_96BIT_MAX_LOW, constants::DECIMAL_96BIT_MAX_HIGH };
+			const Int128 power{ internal::getPowerOf10( static_cast<std::uint8_t>( newScale - currentScale ) ) };
+
+			if ( mantissa > max96bit / power )
+			{
+				return false;
+			}
+
+			mantissa = mantissa * power;
+		}
+
+		internal::setMantissa( rescaled, mantissa );
+		internal::setScale( rescaled, newScale );
+		result = rescaled;
+
+		return true;
+	}
+
+	inline constexpr Decimal Decimal::movePointLeft( std::int32_t places ) const noexcept
+	{
+		// Larger shifts cannot change the result; clamping keeps the negation and scale sum in range
+		places = std::clamp( places, -constants::DECIMAL_MAXIMUM_POINT_SHIFT, constants::DECIMAL_MAXIMUM_POINT_SHIFT );
+
+		if ( places < 0 )
+		{
+			return movePointRight( -places );
+		}
+
+		const std::int32_t newScale{ static_cast<std::int32_t>( scale() ) + places };
+
+		Decimal result{ *this };
+
+		if ( newScale <= static_cast<std::int32_t>( constants::DECIMAL_MAXIMUM_PLACES ) )
+		{
+			// Representable: only the scale bits change
+			internal::setScale( result, static_cast<std::uint8_t>( newScale ) );
+
+			return result;
+		}
+
+		// Drop the digits that fall beyond the maximum scale
+		const std::int32_t excessDigits{ newScale - static_cast<std::int32_t>( constants::DECIMAL_MAXIMUM_PLACES ) };
+		const std::uint8_t power{ static_cast<std::uint8_t>( excessDigits ) };
+
+		internal::setMantissa( result, internal::divideByPowerOf10Rounded(
+										   internal::mantissaAsInt128( *this ), power, RoundingMode::ToNearest, isNegative() ) );
+		internal::setScale( result, constants::DECIMAL_MAXIMUM_PLACES );
+
+		return result;
+	}
+
+	inline constexpr Decimal Decimal::movePointRight( std::int32_t places ) const noexcept
+	{
+		// Larger shifts cannot change the result; clamping keeps the negation in range
+		places = std::clamp( places, -constants::DECIMAL_MAXIMUM_POINT_SHIFT, constants::DECIMAL_MAXIMUM_POINT_SHIFT );
+
+		if ( places < 0 )
+		{
+			return movePointLeft( -places );
+		}
+
+		const std::uint8_t currentScale{ scale() };
+
+		Decimal result{ *this };
+
+		if ( places <= static_cast<std::int32_t>( currentScale ) )
+		{
+			// Representable: only the scale bits change
+			internal::setScale( result, static_cast<std::uint8_t>( currentScale - places ) );
+
+			return result;
+		}
+
+		internal::setScale( result, 0U );
+
+		if ( isZero() )
+		{
+			return result;
+		}
+
+		// Remaining places must be applied to the mantissa
+		const Int128 max96bit{ constants::DECIMAL_96BIT_MAX_LOW, constants::DECIMAL_96BIT_MAX_HIGH };
+		const std::int32_t remainingPlaces{ places - static_cast<std::int32_t>( currentScale ) };
+		const Int128 mantissa{ internal::mantissaAsInt128( *this ) };
+
+		if ( remainingPlaces > static_cast<std::int32_t>( constants::DECIMAL_MAXIMUM_PLACES ) ||
+			 mantissa > max96bit / internal::getPowerOf10( static_cast<std::uint8_t>( remainingPlaces ) ) )
+		{
+			// Out of range - clamp to the largest representable magnitude
+			internal::setMantissa( result, max96bit );
+
+			return result;
+		}
+
+		internal::setMantissa( result, mantissa * internal::getPowerOf10( static_cast<std::uint8_t>( remainingPlaces ) ) );
+
+		return result;
+	}
+	inline constexpr Decimal Decimal::abs() const noexcept
 	{
 		if ( isNegative() )
 		{
@@ -438,4 +1963,111 @@ namespace nfx::datatypes
 
 		return *this;
 	}
+
+	//----------------------------------------------
+	// Utilities
+	//----------------------------------------------
+
+	inline constexpr std::uint8_t Decimal::decimalPlacesCount() const noexcept
+	{
+		// If the value is zero, it has 0 decimal places
+		if ( isZero() )
+		{
+			return 0;
+		}
+
+		// Get the current scale
+		std::uint8_t currentScale = scale();
+
+		// If scale is 0, it's an integer - no decimal places
+		if ( currentScale == 0 )
+		{
+			return 0;
+		}
+
+		// Convert mantissa to Int128 for proper arithmetic
+		const auto& mantissaArray = mantissa();
+#if NFX_DATATYPES_HAS_NATIVE_INT128
+		NFX_DATATYPES_NATIVE_INT128 mantissaValue{ static_cast<NFX_DATATYPES_NATIVE_INT128>( mantissaArray[2] ) << constants::BITS_PER_UINT64 |
+												   static_cast<NFX_DATATYPES_NATIVE_INT128>( mantissaArray[1] ) << constants::BITS_PER_UINT32 |
+												   static_cast<NFX_DATATYPES_NATIVE_INT128>( mantissaArray[0] ) };
+		Int128 mantissa128{ mantissaValue };
+#else
+		std::uint64_t low{ static_cast<std::uint64_t>( mantissaArray[1] ) << constants::BITS_PER_UINT32 | mantissaArray[0] };
+		std::uint64_t high{ mantissaArray[2] };
+		Int128 mantissa128{ low, high };
+#endif
+
+		std::uint8_t trailingZeros = 0;
+		Int128 ten{ constants::DECIMAL_BASE };
+
+		// Count trailing zeros by testing divisibility by 10 iteratively
+		while ( trailingZeros < currentScale )
+		{
+			// If there's a remainder, we can't divide evenly by 10
+			if ( mantissa128 % ten != Int128{ 0 } )
+			{
+				break;
+			}
+
+			// Continue testing with the next power of 10
+			mantissa128 = mantissa128 / ten;
+			trailingZeros++;
+		}
+
+		return currentScale - trailingZeros;
+	}
+
+	//=====================================================================
+	// User-defined literals
+	//=====================================================================
+
+	namespace literals
+	{
+		consteval Decimal operator""_dec( const char* str )
+		{
+			std::string_view literal{ str };
+			std::size_t exponentPos{ literal.find_first_of( "eE" ) };
+
+			Decimal value{ Decimal::parse( literal.substr( 0, exponentPos ) ) };
+			if ( exponentPos == std::string_view::npos )
+			{
+				return value;
+			}
+
+			// Scientific notation: shift the decimal point by the exponent
+			std::string_view exponentDigits{ literal.substr( exponentPos + 1 ) };
+			bool negativeExponent{ false };
+			if ( !exponentDigits.empty() && ( exponentDigits[0] == '-' || exponentDigits[0] == '+' ) )
+			{
+				negativeExponent = exponentDigits[0] == '-';
+				exponentDigits.remove_prefix( 1 );
+			}
+
+			if ( exponentDigits.empty() )
+			{
+				throw std::invalid_argument{ "Invalid decimal string format" };
+			}
+
+			std::int32_t exponent{ 0 };
+			for ( char c : exponentDigits )
+			{
+				if ( c < '0' || c > '9' || exponent > constants::DECIMAL_MAXIMUM_PLACES * 2 )
+				{
+					throw std::invalid_argument{ "Invalid decimal string format" };
+				}
+				exponent = exponent * 10 + ( c - '0' );
+			}
+
+			Decimal result{ negativeExponent ? value.movePointLeft( exponent ) : value.movePointRight( exponent ) };
+			if ( !negativeExponent && result.movePointLeft( exponent ) != value )
+			{
+				throw std::overflow_error{ "Decimal literal out of range" };
+			}
+
+			internal::normalize( result );
+
+			return result;
+		}
+	} // namespace literals
 } // namespace nfx::datatypes
@@ -0,0 +1,881 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Decimal38.inl
+ * @brief Inline implementations for the Decimal38 class
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+#include "nfx/detail/datatypes/Constants.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Internal helper functions
+		//=====================================================================
+
+		/**
+		 * @brief Power of 10 as a 256-bit value for powers beyond the 128-bit range
+		 * @param power The power (0-76)
+		 * @return 10^power
+		 */
+		inline constexpr UInt256 powerOf10Wider( std::uint8_t power ) noexcept
+		{
+			if ( power <= constants::DECIMAL38_MAXIMUM_PLACES )
+			{
+				return powerOf10Wide( power );
+			}
+
+			return UInt256::multiply( powerOf10Wide( constants::DECIMAL38_MAXIMUM_PLACES ),
+				powerOf10Wide( static_cast<std::uint8_t>( power - constants::DECIMAL38_MAXIMUM_PLACES ) ) );
+		}
+
+		/**
+		 * @brief Decide whether a truncated quotient must be incremented
+		 * @param quotient Truncated quotient
+		 * @param remainder Remainder of the division
+		 * @param divisor Divisor used
+		 * @param mode Rounding mode
+		 * @param negative Sign of the value being rounded
+		 * @param sticky true if non-zero digits were discarded below the remainder
+		 * @return true if the magnitude must be rounded away from zero
+		 */
+		inline constexpr bool shouldRoundAwayWide( const UInt256& quotient, const UInt256& remainder, const UInt256& divisor,
+			Decimal::RoundingMode mode, bool negative, bool sticky ) noexcept
+		{
+			const bool inexact{ !remainder.isZero() || sticky };
+
+			switch ( mode )
+			{
+				case Decimal::RoundingMode::ToNearest:
+				{
+					const UInt256 twice{ remainder.shiftLeftOne() };
+					return twice > divisor || ( twice == divisor && ( sticky || ( quotient.word( 0 ) & constants::BIT_MASK_ONE ) != 0 ) );
+				}
+				case Decimal::RoundingMode::ToNearestTiesAway:
+				{
+					return remainder.shiftLeftOne() >= divisor;
+				}
+				case Decimal::RoundingMode::ToZero:
+				{
+					return false;
+				}
+				case Decimal::RoundingMode::ToPositiveInfinity:
+				{
+					return inexact && !negative;
+				}
+				case Decimal::RoundingMode::ToNegativeInfinity:
+				{
+					return inexact && negative;
+				}
+			}
+
+			return false;
+		}
+
+		/**
+		 * @brief Divide a magnitude by a power of 10 with a configurable rounding mode
+		 * @param value Magnitude to divide (below 2^255)
+		 * @param power The power (any value; above 76 the quotient is zero before rounding)
+		 * @param mode Rounding mode
+		 * @param negative Sign of the value being rounded
+		 * @param sticky true if non-zero digits were already discarded below value
+		 * @return Rounded value / 10^power
+		 */
+		inline constexpr UInt256 divideByPowerOf10RoundedWide( const UInt256& value, std::uint32_t power,
+			Decimal::RoundingMode mode, bool negative, bool sticky ) noexcept
+		{
+			if ( power > constants::DECIMAL38_MAX_WIDE_POWER )
+			{
+				// value < 10^77 / 2: only the directed modes move away from zero
+				const UInt256 remainder{ ( value.isZero() && !sticky ) ? 0U : 1U };
+				return shouldRoundAwayWide( UInt256{}, remainder, UInt256{ constants::DECIMAL_BASE }, mode, negative, false ) ? UInt256{ 1 } : UInt256{};
+			}
+
+			constexpr std::uint8_t maxTablePower{ constants::DECIMAL_POWER_TABLE_SIZE - 1U };
+			UInt256 quotient{ value };
+			UInt256 remainder;
+			UInt256 divisor;
+			if ( power <= maxTablePower )
+			{
+				remainder = UInt256{ quotient.divideBy( constants::DECIMAL_POWERS_OF_10[power] ) };
+				divisor = UInt256{ constants::DECIMAL_POWERS_OF_10[power] };
+			}
+			else if ( power <= constants::DECIMAL38_MAXIMUM_PLACES )
+			{
+				// Two 64-bit divisions: remainder = r2 * 10^19 + r1
+				std::uint64_t lowRemainder{ quotient.divideBy( constants::DECIMAL_POWERS_OF_10[maxTablePower] ) };
+				std::uint64_t highRemainder{ quotient.divideBy( constants::DECIMAL_POWERS_OF_10[power - maxTablePower] ) };
+				remainder = UInt256{ highRemainder }.multiply( constants::DECIMAL_POWERS_OF_10[maxTablePower] ) + UInt256{ lowRemainder };
+				divisor = powerOf10Wide( static_cast<std::uint8_t>( power ) );
+			}
+			else
+			{
+				divisor = powerOf10Wider( static_cast<std::uint8_t>( power ) );
+				UInt256::divide( value, divisor, quotient, remainder );
+			}
+
+			if ( shouldRoundAwayWide( quotient, remainder, divisor, mode, negative, sticky ) )
+			{
+				return quotient + UInt256{ 1 };
+			}
+
+			return quotient;
+		}
+
+		/**
+		 * @brief Round a scaled magnitude until it fits a mantissa width and scale limit
+		 * @param magnitude Magnitude of the value (below 2^255)
+		 * @param scale Number of decimal places of magnitude
+		 * @param remainder Fraction below one unit of magnitude, as remainder / divisor (zero if exact)
+		 * @param divisor Denominator of that fraction (non-zero)
+		 * @param maxScale Largest scale of the target type
+		 * @param bits Mantissa width of the target type
+		 * @param mode Rounding mode
+		 * @param negative Sign of the value
+		 * @param resultMagnitude Output magnitude
+		 * @param resultScale Output scale
+		 * @return false if the integer part does not fit in bits
+		 * @details Decimal places are removed one power at a time, each candidate rounded from
+		 *          the exact input, so a carry out of the top bit never rounds twice.
+		 */
+		inline constexpr bool fitScaledMagnitude( const UInt256& magnitude, std::uint32_t scale, const UInt256& remainder,
+			const UInt256& divisor, std::uint8_t maxScale, std::size_t bits, Decimal::RoundingMode mode, bool negative,
+			UInt256& resultMagnitude, std::uint8_t& resultScale ) noexcept
+		{
+			std::uint32_t power{ scale > maxScale ? scale - maxScale : 0U };
+
+			// 10^p <= 2^(L - 1 - bits) cannot bring an L-bit magnitude below 2^bits
+			const std::size_t length{ magnitude.bitLength() };
+			if ( length > bits + 1U )
+			{
+				power = std::max( power, static_cast<std::uint32_t>( ( length - bits - 1U ) * 30102U / 100000U ) );
+			}
+
+			for ( ; power <= scale; ++power )
+			{
+				UInt256 candidate{ magnitude };
+				if ( power == 0 )
+				{
+					if ( shouldRoundAwayWide( magnitude, remainder, divisor, mode, negative, false ) )
+					{
+						candidate = candidate + UInt256{ 1 };
+					}
+				}
+				else
+				{
+					candidate = divideByPowerOf10RoundedWide( magnitude, power, mode, negative, !remainder.isZero() );
+				}
+
+				if ( candidate.fitsIn( bits ) )
+				{
+					resultMagnitude = candidate;
+					resultScale = static_cast<std::uint8_t>( scale - power );
+
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		/**
+		 * @brief Remove trailing zeros of a magnitude
+		 * @param magnitude Magnitude to normalize (in-place)
+		 * @param scale Scale to lower accordingly (in-place)
+		 */
+		inline constexpr void normalizeWide( UInt256& magnitude, std::uint8_t& scale ) noexcept
+		{
+			if ( magnitude.isZero() )
+			{
+				scale = 0;
+				return;
+			}
+
+			while ( scale > 0 && ( magnitude.word( 0 ) & constants::BIT_MASK_ONE ) == 0 )
+			{
+				UInt256 reduced{ magnitude };
+				if ( reduced.divideBy( constants::DECIMAL_BASE ) != 0 )
+				{
+					break;
+				}
+
+				magnitude = reduced;
+				--scale;
+			}
+		}
+
+		/**
+		 * @brief Get the mantissa of a Decimal38 as a 256-bit magnitude
+		 * @param value Decimal38 to read
+		 * @return Unsigned mantissa
+		 */
+		inline constexpr UInt256 decimal38Magnitude( const Decimal38& value ) noexcept
+		{
+			return UInt256{ value.mantissa()[0], value.mantissa()[1] };
+		}
+
+		/**
+		 * @brief Store a magnitude, scale and sign into a Decimal38
+		 * @param value Decimal38 to write
+		 * @param magnitude Mantissa (below 2^127)
+		 * @param scale Scale (0-38)
+		 * @param negative Sign (ignored for zero)
+		 */
+		inline constexpr void setDecimal38( Decimal38& value, const UInt256& magnitude, std::uint8_t scale, bool negative ) noexcept
+		{
+			value.mantissa()[0] = magnitude.word( 0 );
+			value.mantissa()[1] = magnitude.word( 1 );
+			value.flags() = static_cast<std::uint32_t>( scale ) << constants::DECIMAL_SCALE_SHIFT;
+			if ( negative && !magnitude.isZero() )
+			{
+				value.flags() |= constants::DECIMAL_SIGN_MASK;
+			}
+		}
+
+		/**
+		 * @brief Build a normalized Decimal38 arithmetic result
+		 * @param magnitude Exact (or truncated) result magnitude
+		 * @param scale Scale of magnitude
+		 * @param negative Sign of the result
+		 * @param remainder Truncated fraction below one unit of magnitude, as remainder / divisor
+		 * @param divisor Denominator of that fraction
+		 * @return Result rounded to nearest, ties to even
+		 * @throws std::overflow_error if the integer part does not fit in 127 bits
+		 */
+		inline constexpr Decimal38 makeDecimal38( const UInt256& magnitude, std::uint32_t scale, bool negative,
+			const UInt256& remainder = UInt256{}, const UInt256& divisor = UInt256{ 1 } )
+		{
+			UInt256 resultMagnitude;
+			std::uint8_t resultScale{ 0 };
+			if ( !fitScaledMagnitude( magnitude, scale, remainder, divisor, constants::DECIMAL38_MAXIMUM_PLACES,
+					 constants::DECIMAL38_MANTISSA_BITS, Decimal::RoundingMode::ToNearest, negative, resultMagnitude, resultScale ) )
+			{
+				throw std::overflow_error{ "Decimal38 overflow" };
+			}
+
+			normalizeWide( resultMagnitude, resultScale );
+
+			Decimal38 result;
+			setDecimal38( result, resultMagnitude, resultScale, negative );
+
+			return result;
+		}
+
+		/**
+		 * @brief Bring the magnitudes of two Decimal38 values to a common scale
+		 * @param left First value
+		 * @param right Second value
+		 * @param leftMagnitude Output magnitude of left at the common scale
+		 * @param rightMagnitude Output magnitude of right at the common scale
+		 * @return Common scale (the larger of the two)
+		 */
+		inline constexpr std::uint8_t alignDecimal38( const Decimal38& left, const Decimal38& right,
+			UInt256& leftMagnitude, UInt256& rightMagnitude ) noexcept
+		{
+			const std::uint8_t scale{ std::max( left.scale(), right.scale() ) };
+			leftMagnitude = multiplyByPowerOf10Wide( decimal38Magnitude( left ), static_cast<std::uint8_t>( scale - left.scale() ) );
+			rightMagnitude = multiplyByPowerOf10Wide( decimal38Magnitude( right ), static_cast<std::uint8_t>( scale - right.scale() ) );
+
+			return scale;
+		}
+
+		/**
+		 * @brief Three-way numeric comparison of two Decimal38 values
+		 * @param left First value
+		 * @param right Second value
+		 * @return Negative, zero or positive as left is less than, equal to or greater than right
+		 */
+		inline constexpr int compareDecimal38( const Decimal38& left, const Decimal38& right ) noexcept
+		{
+			if ( left.isNegative() != right.isNegative() )
+			{
+				return left.isNegative() ? -1 : 1;
+			}
+
+			UInt256 leftMagnitude;
+			UInt256 rightMagnitude;
+			alignDecimal38( left, right, leftMagnitude, rightMagnitude );
+
+			int result{ leftMagnitude < rightMagnitude ? -1 : ( leftMagnitude > rightMagnitude ? 1 : 0 ) };
+
+			return left.isNegative() ? -result : result;
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// Decimal38 class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline constexpr Decimal38::Decimal38() noexcept
+		: m_layout{ 0, { { 0, 0 } } }
+	{
+	}
+
+	inline constexpr Decimal38::Decimal38( std::int32_t value ) noexcept
+		: Decimal38{ static_cast<std::int64_t>( value ) }
+	{
+	}
+
+	inline constexpr Decimal38::Decimal38( std::int64_t value ) noexcept
+		: m_layout{ 0, { { 0, 0 } } }
+	{
+		if ( value < 0 )
+		{
+			m_layout.flags = constants::DECIMAL_SIGN_MASK;
+			m_layout.mantissa[0] = 0ULL - static_cast<std::uint64_t>( value );
+		}
+		else
+		{
+			m_layout.mantissa[0] = static_cast<std::uint64_t>( value );
+		}
+	}
+
+	inline constexpr Decimal38::Decimal38( std::uint32_t value ) noexcept
+		: m_layout{ 0, { { value, 0 } } }
+	{
+	}
+
+	inline constexpr Decimal38::Decimal38( std::uint64_t value ) noexcept
+		: m_layout{ 0, { { value, 0 } } }
+	{
+	}
+
+	inline constexpr Decimal38::Decimal38( const Int128& value )
+		: m_layout{ 0, { { 0, 0 } } }
+	{
+		const internal::UInt256 magnitude{ internal::UInt256::magnitude( value ) };
+		if ( !magnitude.fitsIn( constants::DECIMAL38_MANTISSA_BITS ) )
+		{
+			throw std::overflow_error{ "Decimal38 overflow" };
+		}
+
+		internal::setDecimal38( *this, magnitude, 0, value < Int128{ 0 } );
+	}
+
+	inline constexpr Decimal38::Decimal38( const Decimal& value ) noexcept
+		: m_layout{ value.flags(),
+			  { { static_cast<std::uint64_t>( value.mantissa()[0] ) | ( static_cast<std::uint64_t>( value.mantissa()[1] ) << 32 ),
+				  value.mantissa()[2] } } }
+	{
+	}
+
+	inline constexpr Decimal38::Decimal38( std::string_view str )
+		: Decimal38{ parse( str ) }
+	{
+	}
+
+	//----------------------------------------------
+	// Decimal38 constants
+	//----------------------------------------------
+
+	inline constexpr Decimal38 Decimal38::zero() noexcept
+	{
+		return Decimal38{};
+	}
+
+	inline constexpr Decimal38 Decimal38::one() noexcept
+	{
+		return Decimal38{ 1 };
+	}
+
+	inline constexpr Decimal38 Decimal38::minValue() noexcept
+	{
+		return -maxValue();
+	}
+
+	inline constexpr Decimal38 Decimal38::maxValue() noexcept
+	{
+		Decimal38 result;
+		result.m_layout.mantissa[0] = constants::DECIMAL38_MAX_MANTISSA_LOW;
+		result.m_layout.mantissa[1] = constants::DECIMAL38_MAX_MANTISSA_HIGH;
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Arithmetic operators
+	//----------------------------------------------
+
+	inline constexpr Decimal38 Decimal38::operator+( const Decimal38& other ) const
+	{
+		if ( isZero() )
+		{
+			return other;
+		}
+		if ( other.isZero() )
+		{
+			return *this;
+		}
+
+		internal::UInt256 left;
+		internal::UInt256 right;
+		const std::uint8_t commonScale{ internal::alignDecimal38( *this, other, left, right ) };
+
+		if ( isNegative() == other.isNegative() )
+		{
+			return internal::makeDecimal38( left + right, commonScale, isNegative() );
+		}
+
+		// Different signs - subtract the smaller magnitude from the larger one
+		if ( left >= right )
+		{
+			return internal::makeDecimal38( left - right, commonScale, isNegative() );
+		}
+
+		return internal::makeDecimal38( right - left, commonScale, other.isNegative() );
+	}
+
+	inline constexpr Decimal38 Decimal38::operator-( const Decimal38& other ) const
+	{
+		return *this + -other;
+	}
+
+	inline constexpr Decimal38 Decimal38::operator*( const Decimal38& other ) const
+	{
+		if ( isZero() || other.isZero() )
+		{
+			return Decimal38{};
+		}
+
+		// 127 x 127 bits fits the 256-bit intermediate, scales add up to at most 76
+		const internal::UInt256 product{ internal::UInt256::multiply(
+			internal::decimal38Magnitude( *this ), internal::decimal38Magnitude( other ) ) };
+
+		return internal::makeDecimal38( product, static_cast<std::uint32_t>( scale() ) + other.scale(), isNegative() != other.isNegative() );
+	}
+
+	inline constexpr Decimal38 Decimal38::operator/( const Decimal38& other ) const
+	{
+		if ( other.isZero() )
+		{
+			throw std::overflow_error{ "Division by zero" };
+		}
+
+		if ( isZero() )
+		{
+			return Decimal38{};
+		}
+
+		const internal::UInt256 dividend{ internal::decimal38Magnitude( *this ) };
+		const internal::UInt256 divisor{ internal::decimal38Magnitude( other ) };
+
+		// Scale the dividend so the quotient carries 38 decimal places, as far as 256 bits allow.
+		// The bound is at least 38, so the quotient scale never goes negative.
+		const std::uint32_t headroom{ static_cast<std::uint32_t>( ( 256U - dividend.bitLength() ) * 30102U / 100000U ) };
+		const std::uint32_t power{ std::min( static_cast<std::uint32_t>( constants::DECIMAL38_MAXIMUM_PLACES ) + other.scale() - scale(), headroom ) };
+
+		internal::UInt256 numerator{ dividend };
+		if ( power > constants::DECIMAL38_MAXIMUM_PLACES )
+		{
+			numerator = internal::multiplyByPowerOf10Wide( numerator, constants::DECIMAL38_MAXIMUM_PLACES );
+			numerator = internal::multiplyByPowerOf10Wide( numerator, static_cast<std::uint8_t>( power - constants::DECIMAL38_MAXIMUM_PLACES ) );
+		}
+		else
+		{
+			numerator = internal::multiplyByPowerOf10Wide( numerator, static_cast<std::uint8_t>( power ) );
+		}
+
+		internal::UInt256 quotient;
+		internal::UInt256 remainder;
+		if ( divisor.fitsIn( 64 ) )
+		{
+			quotient = numerator;
+			remainder = internal::UInt256{ quotient.divideBy( divisor.word( 0 ) ) };
+		}
+		else
+		{
+			internal::UInt256::divide( numerator, divisor, quotient, remainder );
+		}
+
+		return internal::makeDecimal38( quotient, scale() + power - other.scale(), isNegative() != other.isNegative(), remainder, divisor );
+	}
+
+	inline constexpr Decimal38& Decimal38::operator+=( const Decimal38& other )
+	{
+		*this = *this + other;
+		return *this;
+	}
+
+	inline constexpr Decimal38& Decimal38::operator-=( const Decimal38& other )
+	{
+		*this = *this - other;
+		return *this;
+	}
+
+	inline constexpr Decimal38& Decimal38::operator*=( const Decimal38& other )
+	{
+		*this = *this * other;
+		return *this;
+	}
+
+	inline constexpr Decimal38& Decimal38::operator/=( const Decimal38& other )
+	{
+		*this = *this / other;
+		return *this;
+	}
+
+	inline constexpr Decimal38 Decimal38::operator-() const noexcept
+	{
+		Decimal38 result{ *this };
+		if ( !isZero() )
+		{
+			result.m_layout.flags ^= constants::DECIMAL_SIGN_MASK;
+		}
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Comparison operators
+	//----------------------------------------------
+
+	inline constexpr bool Decimal38::operator==( const Decimal38& other ) const noexcept
+	{
+		return internal::compareDecimal38( *this, other ) == 0;
+	}
+
+	inline constexpr bool Decimal38::operator!=( const Decimal38& other ) const noexcept
+	{
+		return !( *this == other );
+	}
+
+	inline constexpr bool Decimal38::operator<( const Decimal38& other ) const noexcept
+	{
+		return internal::compareDecimal38( *this, other ) < 0;
+	}
+
+	inline constexpr bool Decimal38::operator<=( const Decimal38& other ) const noexcept
+	{
+		return internal::compareDecimal38( *this, other ) <= 0;
+	}
+
+	inline constexpr bool Decimal38::operator>( const Decimal38& other ) const noexcept
+	{
+		return internal::compareDecimal38( *this, other ) > 0;
+	}
+
+	inline constexpr bool Decimal38::operator>=( const Decimal38& other ) const noexcept
+	{
+		return internal::compareDecimal38( *this, other ) >= 0;
+	}
+
+	//----------------------------------------------
+	// String parsing and conversion
+	//----------------------------------------------
+
+	inline constexpr Decimal38 Decimal38::parse( std::string_view str )
+	{
+		Decimal38 result;
+		if ( !tryParse( str, result ) )
+		{
+			throw std::invalid_argument{ "Invalid decimal string format" };
+		}
+		return result;
+	}
+
+	inline constexpr bool Decimal38::tryParse( std::string_view str, Decimal38& result ) noexcept
+	{
+		result = Decimal38{};
+
+		if ( str.empty() )
+		{
+			return false;
+		}
+
+		// Handle sign
+		bool negative{ false };
+		std::size_t pos{ 0 };
+		if ( str[0] == '-' )
+		{
+			negative = true;
+			pos = 1;
+		}
+		else if ( str[0] == '+' )
+		{
+			pos = 1;
+		}
+
+		// Up to 76 significant digits are accumulated exactly (10^76 < 2^256); any further
+		// fractional digits only matter through whether they are all zero
+		constexpr std::uint32_t maxDigits{ constants::DECIMAL38_MAX_WIDE_POWER };
+		internal::UInt256 magnitude;
+		std::uint32_t currentScale{ 0 };
+		std::uint32_t significantDigits{ 0 };
+		bool hasDigits{ false };
+		bool hasPoint{ false };
+		bool sticky{ false };
+
+		for ( std::size_t i{ pos }; i < str.length(); ++i )
+		{
+			const char c{ str[i] };
+			if ( c == '.' )
+			{
+				if ( hasPoint )
+				{
+					return false;
+				}
+				hasPoint = true;
+				continue;
+			}
+
+			if ( c < '0' || c > '9' )
+			{
+				return false;
+			}
+
+			hasDigits = true;
+			const std::uint64_t digit{ static_cast<std::uint64_t>( c - '0' ) };
+
+			if ( significantDigits >= maxDigits || ( hasPoint && currentScale > maxDigits ) )
+			{
+				if ( !hasPoint )
+				{
+					// Integer part far beyond 127 bits
+					return false;
+				}
+				sticky = sticky || digit != 0;
+				continue;
+			}
+
+			magnitude = magnitude.multiply( constants::DECIMAL_BASE ) + internal::UInt256{ digit };
+			if ( hasPoint )
+			{
+				++currentScale;
+			}
+			if ( !magnitude.isZero() )
+			{
+				++significantDigits;
+			}
+		}
+
+		if ( !hasDigits )
+		{
+			return false;
+		}
+
+		// Dropped digits only occur when the magnitude has to lose digits anyway,
+		// so a remainder below half a unit is enough to record them
+		internal::UInt256 resultMagnitude;
+		std::uint8_t resultScale{ 0 };
+		if ( !internal::fitScaledMagnitude( magnitude, currentScale, internal::UInt256{ sticky ? 1U : 0U }, internal::UInt256{ constants::DECIMAL_BASE },
+				 constants::DECIMAL38_MAXIMUM_PLACES, constants::DECIMAL38_MANTISSA_BITS, RoundingMode::ToNearest, negative,
+				 resultMagnitude, resultScale ) )
+		{
+			return false;
+		}
+
+		internal::normalizeWide( resultMagnitude, resultScale );
+		internal::setDecimal38( result, resultMagnitude, resultScale, negative );
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Type conversion
+	//----------------------------------------------
+
+	inline constexpr Decimal Decimal38::toDecimal( RoundingMode mode ) const
+	{
+		Decimal result;
+		if ( !tryToDecimal( result, mode ) )
+		{
+			throw std::overflow_error{ "Decimal38 value out of Decimal range" };
+		}
+
+		return result;
+	}
+
+	inline constexpr bool Decimal38::tryToDecimal( Decimal& result, RoundingMode mode ) const noexcept
+	{
+		internal::UInt256 magnitude;
+		std::uint8_t resultScale{ 0 };
+		if ( !internal::fitScaledMagnitude( internal::decimal38Magnitude( *this ), scale(), internal::UInt256{}, internal::UInt256{ 1 },
+				 constants::DECIMAL_MAXIMUM_PLACES, constants::DECIMAL_MANTISSA_BITS, mode, isNegative(), magnitude, resultScale ) )
+		{
+			return false;
+		}
+
+		Decimal converted;
+		converted.mantissa()[0] = static_cast<std::uint32_t>( magnitude.word( 0 ) );
+		converted.mantissa()[1] = static_cast<std::uint32_t>( magnitude.word( 0 ) >> 32 );
+		converted.mantissa()[2] = static_cast<std::uint32_t>( magnitude.word( 1 ) );
+		converted.flags() = static_cast<std::uint32_t>( resultScale ) << constants::DECIMAL_SCALE_SHIFT;
+		if ( isNegative() && !magnitude.isZero() )
+		{
+			converted.flags() |= constants::DECIMAL_SIGN_MASK;
+		}
+
+		result = converted;
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Property accessors
+	//----------------------------------------------
+
+	inline constexpr std::uint8_t Decimal38::scale() const noexcept
+	{
+		return static_cast<std::uint8_t>( ( m_layout.flags & constants::DECIMAL_SCALE_MASK ) >> constants::DECIMAL_SCALE_SHIFT );
+	}
+
+	inline constexpr const std::uint32_t& Decimal38::flags() const noexcept
+	{
+		return m_layout.flags;
+	}
+
+	inline constexpr std::uint32_t& Decimal38::flags() noexcept
+	{
+		return m_layout.flags;
+	}
+
+	inline constexpr const std::array<std::uint64_t, 2>& Decimal38::mantissa() const noexcept
+	{
+		return m_layout.mantissa;
+	}
+
+	inline constexpr std::array<std::uint64_t, 2>& Decimal38::mantissa() noexcept
+	{
+		return m_layout.mantissa;
+	}
+
+	//----------------------------------------------
+	// State checking
+	//----------------------------------------------
+
+	inline constexpr bool Decimal38::isZero() const noexcept
+	{
+		return ( m_layout.mantissa[0] | m_layout.mantissa[1] ) == 0;
+	}
+
+	inline constexpr bool Decimal38::isNegative() const noexcept
+	{
+		return ( m_layout.flags & constants::DECIMAL_SIGN_MASK ) != 0;
+	}
+
+	//----------------------------------------------
+	// Mathematical operations
+	//----------------------------------------------
+
+	inline constexpr Decimal38 Decimal38::truncate() const noexcept
+	{
+		return round( 0, RoundingMode::ToZero );
+	}
+
+	inline constexpr Decimal38 Decimal38::floor() const noexcept
+	{
+		return round( 0, RoundingMode::ToNegativeInfinity );
+	}
+
+	inline constexpr Decimal38 Decimal38::ceiling() const noexcept
+	{
+		return round( 0, RoundingMode::ToPositiveInfinity );
+	}
+
+	inline constexpr Decimal38 Decimal38::round( std::int32_t decimalsPlacesCount, RoundingMode mode ) const noexcept
+	{
+		if ( decimalsPlacesCount < 0 )
+		{
+			decimalsPlacesCount = 0;
+		}
+
+		if ( decimalsPlacesCount >= static_cast<std::int32_t>( scale() ) || isZero() )
+		{
+			return *this;
+		}
+
+		// Removing at least one digit leaves room for the rounding carry
+		const std::uint8_t targetScale{ static_cast<std::uint8_t>( decimalsPlacesCount ) };
+		const internal::UInt256 magnitude{ internal::divideByPowerOf10RoundedWide(
+			internal::decimal38Magnitude( *this ), static_cast<std::uint32_t>( scale() - targetScale ), mode, isNegative(), false ) };
+
+		Decimal38 result;
+		internal::setDecimal38( result, magnitude, targetScale, isNegative() );
+
+		return result;
+	}
+
+	inline constexpr Decimal38 Decimal38::rescale( std::int32_t targetScale, RoundingMode mode ) const
+	{
+		Decimal38 result;
+		if ( !tryRescale( targetScale, result, mode ) )
+		{
+			throw std::overflow_error{ "Decimal38 rescale overflow" };
+		}
+
+		return result;
+	}
+
+	inline constexpr bool Decimal38::tryRescale( std::int32_t targetScale, Decimal38& result, RoundingMode mode ) const noexcept
+	{
+		targetScale = std::clamp( targetScale, 0, static_cast<std::int32_t>( constants::DECIMAL38_MAXIMUM_PLACES ) );
+
+		if ( targetScale <= static_cast<std::int32_t>( scale() ) )
+		{
+			result = round( targetScale, mode );
+			if ( result.isZero() )
+			{
+				internal::setDecimal38( result, internal::UInt256{}, static_cast<std::uint8_t>( targetScale ), false );
+			}
+
+			return true;
+		}
+
+		internal::UInt256 magnitude{ internal::decimal38Magnitude( *this ) };
+		for ( std::uint8_t currentScale{ scale() }; currentScale < targetScale; ++currentScale )
+		{
+			magnitude = magnitude.multiply( constants::DECIMAL_BASE );
+			if ( !magnitude.fitsIn( constants::DECIMAL38_MANTISSA_BITS ) )
+			{
+				return false;
+			}
+		}
+
+		internal::setDecimal38( result, magnitude, static_cast<std::uint8_t>( targetScale ), isNegative() );
+
+		return true;
+	}
+
+	inline constexpr Decimal38 Decimal38::abs() const noexcept
+	{
+		Decimal38 result{ *this };
+		result.m_layout.flags &= ~constants::DECIMAL_SIGN_MASK;
+
+		return result;
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,496 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Decimal64.inl
+ * @brief Inline implementations for the Decimal64 class
+ */
+
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+#include "nfx/detail/datatypes/Constants.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Decimal64 helpers
+		//=====================================================================
+
+		/**
+		 * @brief Build a normalized Decimal from a 64-bit magnitude
+		 * @param magnitude Unsigned mantissa
+		 * @param scale Scale of the mantissa (0-28)
+		 * @param negative Sign of the value
+		 * @return Decimal with trailing zeros removed, as produced by Decimal arithmetic
+		 */
+		inline constexpr Decimal normalizedDecimal( std::uint64_t magnitude, std::uint8_t scale, bool negative ) noexcept
+		{
+			while ( scale > 0 && magnitude % constants::DECIMAL_BASE == 0 )
+			{
+				magnitude /= constants::DECIMAL_BASE;
+				--scale;
+			}
+
+			Decimal result;
+			auto& mantissa{ result.mantissa() };
+			mantissa[0] = static_cast<std::uint32_t>( magnitude );
+			mantissa[1] = static_cast<std::uint32_t>( magnitude >> constants::BITS_PER_UINT32 );
+			mantissa[2] = 0U;
+			result.flags() = ( static_cast<std::uint32_t>( scale ) << constants::DECIMAL_SCALE_SHIFT ) |
+							 ( negative ? constants::DECIMAL_SIGN_MASK : 0U );
+
+			return result;
+		}
+
+		/**
+		 * @brief Pack a Decimal into Decimal64 bits
+		 * @param value Decimal to pack
+		 * @param bits Receives the packed representation
+		 * @return true if the mantissa fits in 56 bits
+		 */
+		inline constexpr bool packDecimal64( const Decimal& value, std::uint64_t& bits ) noexcept
+		{
+			const auto& mantissa{ value.mantissa() };
+			constexpr int highMantissaBits{ constants::DECIMAL64_MANTISSA_BITS - constants::BITS_PER_UINT32 };
+			if ( mantissa[2] != 0U || ( mantissa[1] >> highMantissaBits ) != 0U )
+			{
+				return false;
+			}
+
+			bits = ( static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 ) | mantissa[0] |
+				   ( static_cast<std::uint64_t>( value.scale() ) << constants::DECIMAL64_SCALE_SHIFT ) |
+				   ( value.isNegative() ? constants::DECIMAL64_SIGN_MASK : 0ULL );
+
+			return true;
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// Decimal64 class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline constexpr Decimal64::Decimal64() noexcept
+		: m_bits{ 0ULL }
+	{
+	}
+
+	inline constexpr Decimal64::Decimal64( std::int64_t value )
+		: m_bits{ 0ULL }
+	{
+		const std::uint64_t magnitude{ value < 0 ? 0ULL - static_cast<std::uint64_t>( value ) : static_cast<std::uint64_t>( value ) };
+		if ( magnitude > constants::DECIMAL64_MANTISSA_MASK )
+		{
+			throw std::overflow_error{ "Decimal64 overflow" };
+		}
+
+		m_bits = magnitude | ( value < 0 ? constants::DECIMAL64_SIGN_MASK : 0ULL );
+	}
+
+	inline constexpr Decimal64::Decimal64( const Decimal& value )
+		: m_bits{ 0ULL }
+	{
+		if ( !internal::packDecimal64( value, m_bits ) )
+		{
+			throw std::overflow_error{ "Decimal64 overflow" };
+		}
+	}
+
+	inline constexpr Decimal64::Decimal64( std::string_view str )
+		: Decimal64{ Decimal::parse( str ) }
+	{
+	}
+
+	inline constexpr bool Decimal64::tryFromDecimal( const Decimal& value, Decimal64& result ) noexcept
+	{
+		std::uint64_t bits{ 0ULL };
+		if ( !internal::packDecimal64( value, bits ) )
+		{
+			return false;
+		}
+
+		result.m_bits = bits;
+
+		return true;
+	}
+
+	inline constexpr bool Decimal64::fits( const Decimal& value ) noexcept
+	{
+		std::uint64_t bits{ 0ULL };
+
+		return internal::packDecimal64( value, bits );
+	}
+
+	//----------------------------------------------
+	// Bulk conversion
+	//----------------------------------------------
+
+	inline constexpr void Decimal64::toDecimals( std::span<const Decimal64> source, std::span<Decimal> destination )
+	{
+		if ( destination.size() < source.size() )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		for ( std::size_t i{ 0 }; i < source.size(); ++i )
+		{
+			destination[i] = source[i].toDecimal();
+		}
+	}
+
+	inline constexpr void Decimal64::fromDecimals( std::span<const Decimal> source, std::span<Decimal64> destination )
+	{
+		if ( destination.size() < source.size() )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		if ( tryFromDecimals( source, destination ) != source.size() )
+		{
+			throw std::overflow_error{ "Decimal64 overflow" };
+		}
+	}
+
+	inline constexpr std::size_t Decimal64::tryFromDecimals( std::span<const Decimal> source, std::span<Decimal64> destination ) noexcept
+	{
+		const std::size_t count{ source.size() < destination.size() ? source.size() : destination.size() };
+		for ( std::size_t i{ 0 }; i < count; ++i )
+		{
+			if ( !internal::packDecimal64( source[i], destination[i].m_bits ) )
+			{
+				return i;
+			}
+		}
+
+		return count;
+	}
+
+	//----------------------------------------------
+	// Static factory methods
+	//----------------------------------------------
+
+	inline constexpr Decimal64 Decimal64::minValue() noexcept
+	{
+		Decimal64 result;
+		result.m_bits = constants::DECIMAL64_MANTISSA_MASK | constants::DECIMAL64_SIGN_MASK;
+
+		return result;
+	}
+
+	inline constexpr Decimal64 Decimal64::maxValue() noexcept
+	{
+		Decimal64 result;
+		result.m_bits = constants::DECIMAL64_MANTISSA_MASK;
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Type conversion
+	//----------------------------------------------
+
+	inline constexpr Decimal64::operator Decimal() const noexcept
+	{
+		return toDecimal();
+	}
+
+	inline constexpr Decimal Decimal64::toDecimal() const noexcept
+	{
+		Decimal result;
+		auto& mantissa{ result.mantissa() };
+		mantissa[0] = static_cast<std::uint32_t>( m_bits );
+		mantissa[1] = static_cast<std::uint32_t>( ( m_bits & constants::DECIMAL64_MANTISSA_MASK ) >> constants::BITS_PER_UINT32 );
+		mantissa[2] = 0U;
+		result.flags() = ( static_cast<std::uint32_t>( scale() ) << constants::DECIMAL_SCALE_SHIFT ) |
+						 ( isNegative() ? constants::DECIMAL_SIGN_MASK : 0U );
+
+		return result;
+	}
+
+	inline std::string Decimal64::toString() const
+	{
+		return toDecimal().toString();
+	}
+
+	//----------------------------------------------
+	// Arithmetic operators
+	//----------------------------------------------
+
+	inline constexpr Decimal Decimal64::operator+( const Decimal64& other ) const
+	{
+		if ( scale() != other.scale() || isZero() || other.isZero() )
+		{
+			return toDecimal() + other.toDecimal();
+		}
+
+		// Same scale: 56-bit magnitudes cannot overflow 64 bits, sign rules follow Decimal::operator+
+		const std::uint64_t left{ mantissa() };
+		const std::uint64_t right{ other.mantissa() };
+		if ( isNegative() == other.isNegative() )
+		{
+			return internal::normalizedDecimal( left + right, scale(), isNegative() );
+		}
+		if ( left > right )
+		{
+			return internal::normalizedDecimal( left - right, scale(), isNegative() );
+		}
+
+		return internal::normalizedDecimal( right - left, scale(), other.isNegative() );
+	}
+
+	inline constexpr Decimal Decimal64::operator-( const Decimal64& other ) const
+	{
+		return *this + -other;
+	}
+
+	inline constexpr Decimal Decimal64::operator*( const Decimal64& other ) const
+	{
+		const std::uint8_t productScale{ static_cast<std::uint8_t>( scale() + other.scale() ) };
+		const auto [low, high]{ internal::multiply64( mantissa(), other.mantissa() ) };
+		if ( high != 0 || productScale > constants::DECIMAL_MAXIMUM_PLACES )
+		{
+			return toDecimal() * other.toDecimal();
+		}
+
+		if ( low == 0 )
+		{
+			return Decimal{};
+		}
+
+		return internal::normalizedDecimal( low, productScale, isNegative() != other.isNegative() );
+	}
+
+	inline constexpr Decimal Decimal64::operator/( const Decimal64& other ) const
+	{
+		return toDecimal() / other.toDecimal();
+	}
+
+	inline constexpr Decimal Decimal64::operator+( const Decimal& other ) const
+	{
+		return toDecimal() + other;
+	}
+
+	inline constexpr Decimal Decimal64::operator-( const Decimal& other ) const
+	{
+		return toDecimal() - other;
+	}
+
+	inline constexpr Decimal Decimal64::operator*( const Decimal& other ) const
+	{
+		return toDecimal() * other;
+	}
+
+	inline constexpr Decimal Decimal64::operator/( const Decimal& other ) const
+	{
+		return toDecimal() / other;
+	}
+
+	inline constexpr Decimal64 Decimal64::operator-() const noexcept
+	{
+		Decimal64 result;
+		result.m_bits = m_bits ^ constants::DECIMAL64_SIGN_MASK;
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Comparison operators
+	//----------------------------------------------
+
+	inline constexpr bool Decimal64::operator==( const Decimal64& other ) const noexcept
+	{
+		if ( scale() == other.scale() )
+		{
+			return signedMantissa() == other.signedMantissa();
+		}
+
+		return toDecimal() == other.toDecimal();
+	}
+
+	inline constexpr bool Decimal64::operator!=( const Decimal64& other ) const noexcept
+	{
+		return !( *this == other );
+	}
+
+	inline constexpr bool Decimal64::operator<( const Decimal64& other ) const noexcept
+	{
+		if ( scale() == other.scale() )
+		{
+			return signedMantissa() < other.signedMantissa();
+		}
+
+		return toDecimal() < other.toDecimal();
+	}
+
+	inline constexpr bool Decimal64::operator<=( const Decimal64& other ) const noexcept
+	{
+		return !( other < *this );
+	}
+
+	inline constexpr bool Decimal64::operator>( const Decimal64& other ) const noexcept
+	{
+		return other < *this;
+	}
+
+	inline constexpr bool Decimal64::operator>=( const Decimal64& other ) const noexcept
+	{
+		return !( *this < other );
+	}
+
+	inline constexpr bool Decimal64::operator==( const Decimal& other ) const noexcept
+	{
+		return toDecimal() == other;
+	}
+
+	inline constexpr bool Decimal64::operator!=( const Decimal& other ) const noexcept
+	{
+		return toDecimal() != other;
+	}
+
+	inline constexpr bool Decimal64::operator<( const Decimal& other ) const noexcept
+	{
+		return toDecimal() < other;
+	}
+
+	inline constexpr bool Decimal64::operator<=( const Decimal& other ) const noexcept
+	{
+		return toDecimal() <= other;
+	}
+
+	inline constexpr bool Decimal64::operator>( const Decimal& other ) const noexcept
+	{
+		return toDecimal() > other;
+	}
+
+	inline constexpr bool Decimal64::operator>=( const Decimal& other ) const noexcept
+	{
+		return toDecimal() >= other;
+	}
+
+	//----------------------------------------------
+	// String parsing
+	//----------------------------------------------
+
+	inline constexpr Decimal64 Decimal64::parse( std::string_view str )
+	{
+		return Decimal64{ Decimal::parse( str ) };
+	}
+
+	inline constexpr bool Decimal64::tryParse( std::string_view str, Decimal64& result ) noexcept
+	{
+		Decimal value;
+		if ( !Decimal::tryParse( str, value ) )
+		{
+			return false;
+		}
+
+		return tryFromDecimal( value, result );
+	}
+
+	//----------------------------------------------
+	// Property accessors
+	//----------------------------------------------
+
+	inline constexpr std::uint8_t Decimal64::scale() const noexcept
+	{
+		return static_cast<std::uint8_t>( ( m_bits & constants::DECIMAL64_SCALE_MASK ) >> constants::DECIMAL64_SCALE_SHIFT );
+	}
+
+	inline constexpr std::uint64_t Decimal64::mantissa() const noexcept
+	{
+		return m_bits & constants::DECIMAL64_MANTISSA_MASK;
+	}
+
+	inline constexpr std::uint64_t Decimal64::toBits() const noexcept
+	{
+		return m_bits;
+	}
+
+	//----------------------------------------------
+	// State checking
+	//----------------------------------------------
+
+	inline constexpr bool Decimal64::isZero() const noexcept
+	{
+		return mantissa() == 0;
+	}
+
+	inline constexpr bool Decimal64::isNegative() const noexcept
+	{
+		return ( m_bits & constants::DECIMAL64_SIGN_MASK ) != 0;
+	}
+
+	//----------------------------------------------
+	// Mathematical operations
+	//----------------------------------------------
+
+	inline constexpr Decimal64 Decimal64::abs() const noexcept
+	{
+		Decimal64 result;
+		result.m_bits = m_bits & ~constants::DECIMAL64_SIGN_MASK;
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Private helpers
+	//----------------------------------------------
+
+	inline constexpr std::int64_t Decimal64::signedMantissa() const noexcept
+	{
+		const auto magnitude{ static_cast<std::int64_t>( mantissa() ) };
+
+		return isNegative() ? -magnitude : magnitude;
+	}
+
+	//=====================================================================
+	// Stream operators
+	//=====================================================================
+
+	inline std::ostream& operator<<( std::ostream& os, const Decimal64& value )
+	{
+		return os << value.toString();
+	}
+
+	inline std::istream& operator>>( std::istream& is, Decimal64& value )
+	{
+		std::string str;
+		is >> str;
+
+		if ( !Decimal64::tryParse( str, value ) )
+		{
+			is.setstate( std::ios::failbit );
+		}
+
+		return is;
+	}
+} // namespace nfx::datatypes
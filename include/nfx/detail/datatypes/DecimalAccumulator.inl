@@ -0,0 +1,537 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DecimalAccumulator.inl
+ * @brief Inline implementations for the DecimalAccumulator class
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "nfx/detail/datatypes/Constants.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Accumulator helpers
+		//=====================================================================
+
+		/**
+		 * @brief Get the scale field of a Decimal flags word
+		 * @param flags Flags word
+		 * @return Scale (0-28)
+		 */
+		inline constexpr std::uint8_t accumulatorScale( std::uint32_t flags ) noexcept
+		{
+			return static_cast<std::uint8_t>( ( flags & constants::DECIMAL_SCALE_MASK ) >> constants::DECIMAL_SCALE_SHIFT );
+		}
+
+		/**
+		 * @brief Check the sign of a two's complement 256-bit total
+		 * @param total Total to check
+		 * @return true if bit 255 is set
+		 */
+		inline constexpr bool isNegativeTotal( const UInt256& total ) noexcept
+		{
+			return ( total.word( 3 ) >> ( constants::BITS_PER_UINT64 - 1U ) ) != 0U;
+		}
+
+		/**
+		 * @brief Add a signed magnitude to a two's complement total without branching on the sign
+		 * @param total Total to add to
+		 * @param magnitude Magnitude of the addend
+		 * @param negative true to subtract
+		 * @return total + magnitude or total - magnitude, modulo 2^256
+		 */
+		inline constexpr UInt256 addSigned( const UInt256& total, const UInt256& magnitude, bool negative ) noexcept
+		{
+			// -x == ~x + 1: the mask complements the words, the sign bit supplies the + 1
+			const std::uint64_t mask{ std::uint64_t{ 0 } - static_cast<std::uint64_t>( negative ) };
+
+			return total +
+				   UInt256::fromWords( magnitude.word( 0 ) ^ mask, magnitude.word( 1 ) ^ mask, magnitude.word( 2 ) ^ mask, magnitude.word( 3 ) ^ mask ) +
+				   UInt256{ static_cast<std::uint64_t>( negative ) };
+		}
+
+		/**
+		 * @brief Add a signed 96-bit mantissa to a 128-bit partial sum without branching on the sign
+		 * @param low Bits 0-63 of the partial sum
+		 * @param high Bits 64-127 of the partial sum
+		 * @param lo64 Mantissa bits 0-63
+		 * @param hi32 Mantissa bits 64-95
+		 * @param negative true to subtract
+		 */
+		inline constexpr void addSigned96( std::uint64_t& low, std::uint64_t& high, std::uint64_t lo64, std::uint32_t hi32, bool negative ) noexcept
+		{
+			const std::uint64_t mask{ std::uint64_t{ 0 } - static_cast<std::uint64_t>( negative ) };
+			const std::uint64_t addend{ lo64 ^ mask };
+			const std::uint64_t partial{ low + addend };
+			const std::uint64_t sum{ partial + static_cast<std::uint64_t>( negative ) };
+
+			high += ( static_cast<std::uint64_t>( hi32 ) ^ mask ) + static_cast<std::uint64_t>( partial < addend ) + static_cast<std::uint64_t>( sum < partial );
+			low = sum;
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// DecimalAccumulator class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline constexpr DecimalAccumulator::DecimalAccumulator() noexcept
+		: m_total{},
+		  m_pending{},
+		  m_pendingCount{ 0U },
+		  m_scale{ 0U },
+		  m_count{ 0U },
+		  m_overflow{ false },
+		  m_overflowNegative{ false }
+	{
+	}
+
+	//----------------------------------------------
+	// Accumulation
+	//----------------------------------------------
+
+	inline constexpr void DecimalAccumulator::add( const Decimal& value ) noexcept
+	{
+		const auto& mantissa{ value.mantissa() };
+		addWords( static_cast<std::uint64_t>( mantissa[0] ) | ( static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 ),
+			mantissa[2], value.flags() );
+	}
+
+	inline constexpr void DecimalAccumulator::add( std::span<const Decimal> values ) noexcept
+	{
+		addRows( values.size(), [values]( std::size_t index, std::uint64_t& lo64, std::uint32_t& hi32, std::uint32_t& flags ) {
+			const auto& mantissa{ values[index].mantissa() };
+			lo64 = static_cast<std::uint64_t>( mantissa[0] ) | ( static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 );
+			hi32 = mantissa[2];
+			flags = values[index].flags();
+
+			return true;
+		} );
+	}
+
+	inline void DecimalAccumulator::add( const DecimalColumn& column ) noexcept
+	{
+		const std::uint64_t* lo64{ column.lo64().data() };
+		const std::uint32_t* hi32{ column.hi32().data() };
+		const std::uint32_t* scaleSign{ column.scaleSign().data() };
+		const std::span<const std::uint64_t> validity{ column.validity() };
+		const std::size_t rows{ column.size() };
+
+		if ( validity.empty() )
+		{
+			addRows( rows, [lo64, hi32, scaleSign]( std::size_t row, std::uint64_t& low, std::uint32_t& high, std::uint32_t& flags ) {
+				low = lo64[row];
+				high = hi32[row];
+				flags = scaleSign[row];
+
+				return true;
+			} );
+
+			return;
+		}
+
+		addRows( rows, [lo64, hi32, scaleSign, validity]( std::size_t row, std::uint64_t& low, std::uint32_t& high, std::uint32_t& flags ) {
+			low = lo64[row];
+			high = hi32[row];
+			flags = scaleSign[row];
+
+			return ( ( validity[row / internal::VALIDITY_WORD_BITS] >> ( row % internal::VALIDITY_WORD_BITS ) ) & 1U ) != 0U;
+		} );
+	}
+
+	inline constexpr void DecimalAccumulator::addWeighted( const Decimal& value, const Decimal& weight ) noexcept
+	{
+		// 96 x 96-bit product: exact in 192 bits, at the sum of both scales
+		const internal::UInt256 product{ internal::UInt256::multiply(
+			internal::mantissaAsUInt256( value ), internal::mantissaAsUInt256( weight ) ) };
+		const auto scale{ static_cast<std::uint8_t>( internal::accumulatorScale( value.flags() ) + internal::accumulatorScale( weight.flags() ) ) };
+		const bool negative{ ( ( value.flags() ^ weight.flags() ) & constants::DECIMAL_SIGN_MASK ) != 0U };
+		++m_count;
+
+		if ( scale != m_scale )
+		{
+			addProductRescaled( product, scale, negative );
+
+			return;
+		}
+
+		addToTotal( product, negative );
+	}
+
+	inline constexpr void DecimalAccumulator::addWeighted( std::span<const Decimal> values, std::span<const Decimal> weights )
+	{
+		if ( values.size() != weights.size() )
+		{
+			throw std::invalid_argument{ "Operand spans differ in size" };
+		}
+
+		// Tight runs at a fixed internal scale; every other case is handled between runs
+		std::size_t i{ 0 };
+		while ( i < values.size() )
+		{
+			const std::uint8_t scale{ m_scale };
+			internal::UInt256 total{ m_total };
+			std::uint64_t added{ 0 };
+			for ( ; i < values.size(); ++i )
+			{
+				const std::uint32_t valueFlags{ values[i].flags() };
+				const std::uint32_t weightFlags{ weights[i].flags() };
+				const auto productScale{ static_cast<std::uint8_t>( internal::accumulatorScale( valueFlags ) + internal::accumulatorScale( weightFlags ) ) };
+				if ( productScale > scale || scale - productScale > constants::DECIMAL_ACCUMULATOR_PRODUCT_LIFT )
+				{
+					break;
+				}
+
+				internal::UInt256 product{ internal::UInt256::multiply( internal::mantissaAsUInt256( values[i] ), internal::mantissaAsUInt256( weights[i] ) ) };
+				if ( productScale != scale )
+				{
+					product = internal::multiplyByPowerOf10Wide( product, static_cast<std::uint8_t>( scale - productScale ) );
+				}
+				const internal::UInt256 sum{ internal::addSigned( total, product, ( ( valueFlags ^ weightFlags ) & constants::DECIMAL_SIGN_MASK ) != 0U ) };
+
+				// Leave the run if the total leaves the exact range
+				const std::uint64_t top{ sum.word( 3 ) };
+				if ( ( ( top ^ ( top << 1U ) ) >> ( constants::BITS_PER_UINT64 - 1U ) ) != 0U )
+				{
+					break;
+				}
+
+				total = sum;
+				++added;
+			}
+
+			m_total = total;
+			m_count += added;
+
+			if ( i < values.size() )
+			{
+				addWeighted( values[i], weights[i] );
+				++i;
+			}
+		}
+	}
+
+	inline constexpr void DecimalAccumulator::merge( const DecimalAccumulator& other ) noexcept
+	{
+		// Read other first: it may be this accumulator
+		const internal::UInt256 otherTotal{ other.combinedTotal() };
+		const std::uint8_t otherScale{ other.m_scale };
+		const std::uint64_t otherCount{ other.m_count };
+		const bool otherOverflow{ other.m_overflow };
+		const bool otherOverflowNegative{ other.m_overflowNegative };
+
+		if ( otherOverflow )
+		{
+			markOverflow( otherOverflowNegative );
+		}
+
+		if ( otherScale > m_scale )
+		{
+			raiseScale( otherScale );
+		}
+
+		const bool negative{ internal::isNegativeTotal( otherTotal ) };
+		const internal::UInt256 magnitude{ negative ? internal::UInt256{} - otherTotal : otherTotal };
+		addToTotal( lift( magnitude, static_cast<std::uint8_t>( m_scale - otherScale ), negative ), negative );
+		m_count += otherCount;
+	}
+
+	inline constexpr void DecimalAccumulator::reset() noexcept
+	{
+		*this = DecimalAccumulator{};
+	}
+
+	//----------------------------------------------
+	// Result
+	//----------------------------------------------
+
+	inline constexpr Decimal DecimalAccumulator::result() const
+	{
+		ArithmeticStatus status{ ArithmeticStatus::None };
+		const Decimal sum{ result( status ) };
+		if ( hasStatus( status, ArithmeticStatus::Overflow ) )
+		{
+			throw std::overflow_error{ "Decimal sum overflow" };
+		}
+
+		return sum;
+	}
+
+	inline constexpr Decimal DecimalAccumulator::result( ArithmeticStatus& status ) const noexcept
+	{
+		if ( m_overflow )
+		{
+			// A magnitude of 2^192 at scale 0 is clamped like every other overflow
+			return internal::checkedResult( internal::UInt256::fromWords( 0U, 0U, 0U, 1U ), 0, m_overflowNegative, false, status );
+		}
+
+		const internal::UInt256 total{ combinedTotal() };
+		const bool negative{ internal::isNegativeTotal( total ) };
+
+		return internal::checkedResult( negative ? internal::UInt256{} - total : total, m_scale, negative, false, status );
+	}
+
+	inline constexpr Decimal DecimalAccumulator::dot( std::span<const Decimal> values, std::span<const Decimal> weights )
+	{
+		DecimalAccumulator accumulator;
+		accumulator.addWeighted( values, weights );
+
+		return accumulator.result();
+	}
+
+	inline constexpr Decimal DecimalAccumulator::dot( std::span<const Decimal> values, std::span<const Decimal> weights, ArithmeticStatus& status )
+	{
+		DecimalAccumulator accumulator;
+		accumulator.addWeighted( values, weights );
+
+		return accumulator.result( status );
+	}
+
+	inline constexpr std::uint64_t DecimalAccumulator::count() const noexcept
+	{
+		return m_count;
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	template <typename Rows>
+	inline constexpr void DecimalAccumulator::addRows( std::size_t rows, Rows read ) noexcept
+	{
+		// Tight runs at a fixed internal scale; raising the scale and folding a full partial sum happen between runs
+		std::size_t row{ 0 };
+		while ( row < rows )
+		{
+			const std::uint8_t scale{ m_scale };
+			const bool liftInRun{ scale <= constants::DECIMAL_MAXIMUM_PLACES };
+			const std::size_t end{ row + std::min<std::size_t>( rows - row, constants::DECIMAL_ACCUMULATOR_PENDING_VALUES - 1U - m_pendingCount ) };
+			std::uint64_t pendingLow{ m_pending.toLow() };
+			std::uint64_t pendingHigh{ m_pending.toHigh() };
+			std::uint64_t pendingAdded{ 0 };
+			std::uint64_t added{ 0 };
+			internal::UInt256 total{ m_total };
+
+			std::uint64_t lo64{ 0 };
+			std::uint32_t hi32{ 0 };
+			std::uint32_t flags{ 0 };
+			bool rescale{ false };
+			for ( ; row < end; ++row )
+			{
+				if ( !read( row, lo64, hi32, flags ) )
+				{
+					continue;
+				}
+
+				const std::uint8_t valueScale{ internal::accumulatorScale( flags ) };
+				const bool negative{ ( flags & constants::DECIMAL_SIGN_MASK ) != 0U };
+				if ( valueScale == scale )
+				{
+					internal::addSigned96( pendingLow, pendingHigh, lo64, hi32, negative );
+					++pendingAdded;
+				}
+				else if ( valueScale < scale && liftInRun )
+				{
+					// Lifted by at most 10^28: below 2^190, and fewer than 2^31 of them cannot wrap the total
+					total = internal::addSigned( total,
+						internal::multiplyByPowerOf10Wide( internal::UInt256{ lo64, hi32 }, static_cast<std::uint8_t>( scale - valueScale ) ), negative );
+				}
+				else
+				{
+					rescale = true;
+
+					break;
+				}
+
+				++added;
+			}
+
+			m_pending = Int128{ pendingLow, pendingHigh };
+			m_pendingCount += static_cast<std::uint32_t>( pendingAdded );
+			m_count += added;
+			m_total = total;
+			checkTotalRange();
+
+			if ( rescale )
+			{
+				addWords( lo64, hi32, flags );
+				++row;
+			}
+			else if ( row < rows )
+			{
+				// The partial sum is full
+				flushPending();
+			}
+		}
+	}
+
+	inline constexpr void DecimalAccumulator::addWords( std::uint64_t lo64, std::uint32_t hi32, std::uint32_t flags ) noexcept
+	{
+		const std::uint8_t scale{ internal::accumulatorScale( flags ) };
+		const bool negative{ ( flags & constants::DECIMAL_SIGN_MASK ) != 0U };
+		++m_count;
+
+		if ( scale != m_scale )
+		{
+			addRescaled( lo64, hi32, scale, negative );
+
+			return;
+		}
+
+		addPending( lo64, hi32, negative );
+	}
+
+	inline constexpr void DecimalAccumulator::addPending( std::uint64_t lo64, std::uint32_t hi32, bool negative ) noexcept
+	{
+		std::uint64_t low{ m_pending.toLow() };
+		std::uint64_t high{ m_pending.toHigh() };
+		internal::addSigned96( low, high, lo64, hi32, negative );
+		m_pending = Int128{ low, high };
+		if ( ++m_pendingCount == constants::DECIMAL_ACCUMULATOR_PENDING_VALUES )
+		{
+			flushPending();
+		}
+	}
+
+	inline constexpr void DecimalAccumulator::addRescaled( std::uint64_t lo64, std::uint32_t hi32, std::uint8_t scale, bool negative ) noexcept
+	{
+		if ( scale > m_scale )
+		{
+			raiseScale( scale );
+			addPending( lo64, hi32, negative );
+
+			return;
+		}
+
+		// One multiply lifts the value to the internal scale; below 2^190 unless products raised it past 28
+		const auto power{ static_cast<std::uint8_t>( m_scale - scale ) };
+		const internal::UInt256 magnitude{ lo64, hi32 };
+		addToTotal( m_scale <= constants::DECIMAL_MAXIMUM_PLACES ? internal::multiplyByPowerOf10Wide( magnitude, power )
+																: lift( magnitude, power, negative ),
+			negative );
+	}
+
+	inline constexpr void DecimalAccumulator::addProductRescaled( const internal::UInt256& magnitude, std::uint8_t scale, bool negative ) noexcept
+	{
+		if ( scale > m_scale )
+		{
+			raiseScale( scale );
+			addToTotal( magnitude, negative );
+
+			return;
+		}
+
+		addToTotal( lift( magnitude, static_cast<std::uint8_t>( m_scale - scale ), negative ), negative );
+	}
+
+	inline constexpr void DecimalAccumulator::addToTotal( const internal::UInt256& magnitude, bool negative ) noexcept
+	{
+		// Both operands are below 2^254, so the sum cannot wrap and its top bits tell the range
+		m_total = internal::addSigned( m_total, magnitude, negative );
+		checkTotalRange();
+	}
+
+	inline constexpr void DecimalAccumulator::checkTotalRange() noexcept
+	{
+		const std::uint64_t top{ m_total.word( 3 ) };
+		if ( ( ( top ^ ( top << 1U ) ) >> ( constants::BITS_PER_UINT64 - 1U ) ) != 0U )
+		{
+			markOverflow( internal::isNegativeTotal( m_total ) );
+			m_total = internal::UInt256{};
+		}
+	}
+
+	inline constexpr internal::UInt256 DecimalAccumulator::lift( const internal::UInt256& magnitude, std::uint8_t power, bool negative ) noexcept
+	{
+		if ( magnitude.isZero() )
+		{
+			return magnitude;
+		}
+
+		// bit_width(10^power) <= floor(power * log2(10)) + 1, with log2(10) rounded up to 3.3220
+		const std::size_t powerBits{ power == 0U ? 0U : static_cast<std::size_t>( power ) * 33220U / 10000U + 1U };
+		if ( magnitude.bitLength() + powerBits > constants::DECIMAL_ACCUMULATOR_EXACT_BITS )
+		{
+			markOverflow( negative );
+
+			return internal::UInt256{};
+		}
+
+		// multiplyByPowerOf10Wide covers two table steps per call
+		constexpr std::uint8_t maxStep{ 2U * ( constants::DECIMAL_POWER_TABLE_SIZE - 1U ) };
+		internal::UInt256 lifted{ magnitude };
+		for ( std::uint8_t remaining{ power }; remaining > 0U; )
+		{
+			const std::uint8_t step{ remaining < maxStep ? remaining : maxStep };
+			lifted = internal::multiplyByPowerOf10Wide( lifted, step );
+			remaining = static_cast<std::uint8_t>( remaining - step );
+		}
+
+		return lifted;
+	}
+
+	inline constexpr void DecimalAccumulator::markOverflow( bool negative ) noexcept
+	{
+		if ( !m_overflow )
+		{
+			m_overflow = true;
+			m_overflowNegative = negative;
+		}
+	}
+
+	inline constexpr void DecimalAccumulator::raiseScale( std::uint8_t scale ) noexcept
+	{
+		flushPending();
+
+		const bool negative{ internal::isNegativeTotal( m_total ) };
+		const internal::UInt256 magnitude{ negative ? internal::UInt256{} - m_total : m_total };
+		const internal::UInt256 lifted{ lift( magnitude, static_cast<std::uint8_t>( scale - m_scale ), negative ) };
+		m_total = negative ? internal::UInt256{} - lifted : lifted;
+		m_scale = scale;
+	}
+
+	inline constexpr void DecimalAccumulator::flushPending() noexcept
+	{
+		addToTotal( internal::UInt256::magnitude( m_pending ), m_pending.isNegative() );
+		m_pending = Int128{};
+		m_pendingCount = 0U;
+	}
+
+	inline constexpr internal::UInt256 DecimalAccumulator::combinedTotal() const noexcept
+	{
+		// Sign-extend the partial sum to 256 bits
+		const std::uint64_t extension{ m_pending.isNegative() ? ~std::uint64_t{ 0 } : std::uint64_t{ 0 } };
+
+		return m_total + internal::UInt256::fromWords( m_pending.toLow(), m_pending.toHigh(), extension, extension );
+	}
+} // namespace nfx::datatypes
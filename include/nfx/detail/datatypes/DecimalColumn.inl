@@ -0,0 +1,383 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DecimalColumn.inl
+ * @brief Inline implementations for the DecimalColumn class
+ */
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+#include "nfx/detail/datatypes/Constants.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Validity bitmap helpers
+		//=====================================================================
+
+		/** @brief Number of rows covered by one validity word */
+		inline constexpr std::size_t VALIDITY_WORD_BITS{ static_cast<std::size_t>( constants::BITS_PER_UINT64 ) };
+
+		/**
+		 * @brief Get the number of validity words needed for a row count
+		 * @param rows Row count
+		 * @return ceil(rows / 64)
+		 */
+		inline constexpr std::size_t validityWordCount( std::size_t rows ) noexcept
+		{
+			return ( rows + VALIDITY_WORD_BITS - 1 ) / VALIDITY_WORD_BITS;
+		}
+
+		/**
+		 * @brief Copy a bit range of a validity bitmap to the start of another bitmap
+		 * @param source Source bitmap
+		 * @param offset First source bit
+		 * @param count Number of bits to copy
+		 * @param destination Output bitmap (validityWordCount(count) words, fully overwritten)
+		 */
+		inline void copyValidityBits( const std::uint64_t* source, std::size_t offset, std::size_t count, std::uint64_t* destination ) noexcept
+		{
+			const std::size_t words{ validityWordCount( count ) };
+			const std::size_t sourceWords{ validityWordCount( offset + count ) };
+			const std::size_t first{ offset / VALIDITY_WORD_BITS };
+			const std::size_t shift{ offset % VALIDITY_WORD_BITS };
+
+			for ( std::size_t i{ 0 }; i < words; ++i )
+			{
+				std::uint64_t word{ source[first + i] >> shift };
+				if ( shift != 0 && first + i + 1 < sourceWords )
+				{
+					word |= source[first + i + 1] << ( VALIDITY_WORD_BITS - shift );
+				}
+				destination[i] = word;
+			}
+
+			// Keep the bits past the last row cleared
+			const std::size_t tail{ count % VALIDITY_WORD_BITS };
+			if ( tail != 0 )
+			{
+				destination[words - 1] &= ( std::uint64_t{ 1 } << tail ) - 1;
+			}
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// DecimalColumn class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline DecimalColumn::DecimalColumn( std::span<const Decimal> values )
+	{
+		append( values );
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	inline std::size_t DecimalColumn::size() const noexcept
+	{
+		return m_lo64.size();
+	}
+
+	inline bool DecimalColumn::empty() const noexcept
+	{
+		return m_lo64.empty();
+	}
+
+	inline void DecimalColumn::reserve( std::size_t capacity )
+	{
+		m_lo64.reserve( capacity );
+		m_hi32.reserve( capacity );
+		m_scaleSign.reserve( capacity );
+		if ( !m_validity.empty() )
+		{
+			m_validity.reserve( internal::validityWordCount( capacity ) );
+		}
+	}
+
+	inline void DecimalColumn::clear() noexcept
+	{
+		m_lo64.clear();
+		m_hi32.clear();
+		m_scaleSign.clear();
+		m_validity.clear();
+	}
+
+	//----------------------------------------------
+	// Appending
+	//----------------------------------------------
+
+	inline void DecimalColumn::append( const Decimal& value )
+	{
+		const auto& mantissa{ value.mantissa() };
+		m_lo64.push_back( static_cast<std::uint64_t>( mantissa[0] ) |
+						  ( static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 ) );
+		m_hi32.push_back( mantissa[2] );
+		m_scaleSign.push_back( value.flags() );
+
+		if ( !m_validity.empty() )
+		{
+			pushValidity( true );
+		}
+	}
+
+	inline void DecimalColumn::append( std::span<const Decimal> values )
+	{
+		const std::size_t start{ size() };
+		const std::size_t rows{ start + values.size() };
+		m_lo64.resize( rows );
+		m_hi32.resize( rows );
+		m_scaleSign.resize( rows );
+
+		for ( std::size_t i{ 0 }; i < values.size(); ++i )
+		{
+			const auto& mantissa{ values[i].mantissa() };
+			m_lo64[start + i] = static_cast<std::uint64_t>( mantissa[0] ) |
+								( static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 );
+			m_hi32[start + i] = mantissa[2];
+			m_scaleSign[start + i] = values[i].flags();
+		}
+
+		if ( !m_validity.empty() && !values.empty() )
+		{
+			// Set the bits of the new rows word by word
+			m_validity.resize( internal::validityWordCount( rows ), 0U );
+			for ( std::size_t row{ start }; row < rows; )
+			{
+				const std::size_t bit{ row % internal::VALIDITY_WORD_BITS };
+				const std::size_t run{ std::min( internal::VALIDITY_WORD_BITS - bit, rows - row ) };
+				const std::uint64_t mask{ run == internal::VALIDITY_WORD_BITS ? ~std::uint64_t{ 0 } : ( ( std::uint64_t{ 1 } << run ) - 1 ) << bit };
+				m_validity[row / internal::VALIDITY_WORD_BITS] |= mask;
+				row += run;
+			}
+		}
+	}
+
+	inline void DecimalColumn::appendNull()
+	{
+		if ( m_validity.empty() )
+		{
+			materializeValidity();
+		}
+
+		m_lo64.push_back( 0U );
+		m_hi32.push_back( 0U );
+		m_scaleSign.push_back( 0U );
+		pushValidity( false );
+	}
+
+	//----------------------------------------------
+	// Element access
+	//----------------------------------------------
+
+	inline Decimal DecimalColumn::operator[]( std::size_t index ) const noexcept
+	{
+		Decimal result;
+		auto& mantissa{ result.mantissa() };
+		mantissa[0] = static_cast<std::uint32_t>( m_lo64[index] );
+		mantissa[1] = static_cast<std::uint32_t>( m_lo64[index] >> constants::BITS_PER_UINT32 );
+		mantissa[2] = m_hi32[index];
+		result.flags() = m_scaleSign[index];
+
+		return result;
+	}
+
+	inline bool DecimalColumn::isValid( std::size_t index ) const noexcept
+	{
+		if ( m_validity.empty() )
+		{
+			return true;
+		}
+
+		return ( ( m_validity[index / internal::VALIDITY_WORD_BITS] >> ( index % internal::VALIDITY_WORD_BITS ) ) & 1U ) != 0;
+	}
+
+	inline bool DecimalColumn::hasNulls() const noexcept
+	{
+		return nullCount() != 0;
+	}
+
+	inline std::size_t DecimalColumn::nullCount() const noexcept
+	{
+		if ( m_validity.empty() )
+		{
+			return 0;
+		}
+
+		std::size_t validRows{ 0 };
+		for ( const std::uint64_t word : m_validity )
+		{
+			validRows += static_cast<std::size_t>( std::popcount( word ) );
+		}
+
+		return size() - validRows;
+	}
+
+	//----------------------------------------------
+	// Column arrays
+	//----------------------------------------------
+
+	inline std::span<const std::uint64_t> DecimalColumn::lo64() const noexcept
+	{
+		return m_lo64;
+	}
+
+	inline std::span<const std::uint32_t> DecimalColumn::hi32() const noexcept
+	{
+		return m_hi32;
+	}
+
+	inline std::span<const std::uint32_t> DecimalColumn::scaleSign() const noexcept
+	{
+		return m_scaleSign;
+	}
+
+	inline std::span<const std::uint64_t> DecimalColumn::validity() const noexcept
+	{
+		return m_validity;
+	}
+
+	//----------------------------------------------
+	// Selection
+	//----------------------------------------------
+
+	inline DecimalColumn DecimalColumn::gather( std::span<const std::size_t> indices ) const
+	{
+		const std::size_t rows{ size() };
+		for ( const std::size_t index : indices )
+		{
+			if ( index >= rows )
+			{
+				throw std::out_of_range{ "DecimalColumn index out of range" };
+			}
+		}
+
+		DecimalColumn result;
+		result.m_lo64.resize( indices.size() );
+		result.m_hi32.resize( indices.size() );
+		result.m_scaleSign.resize( indices.size() );
+
+		for ( std::size_t i{ 0 }; i < indices.size(); ++i )
+		{
+			result.m_lo64[i] = m_lo64[indices[i]];
+			result.m_hi32[i] = m_hi32[indices[i]];
+			result.m_scaleSign[i] = m_scaleSign[indices[i]];
+		}
+
+		if ( !m_validity.empty() && !indices.empty() )
+		{
+			result.m_validity.assign( internal::validityWordCount( indices.size() ), 0U );
+			for ( std::size_t i{ 0 }; i < indices.size(); ++i )
+			{
+				if ( isValid( indices[i] ) )
+				{
+					result.m_validity[i / internal::VALIDITY_WORD_BITS] |= std::uint64_t{ 1 } << ( i % internal::VALIDITY_WORD_BITS );
+				}
+			}
+		}
+
+		return result;
+	}
+
+	inline DecimalColumn DecimalColumn::slice( std::size_t offset, std::size_t count ) const
+	{
+		if ( offset > size() || count > size() - offset )
+		{
+			throw std::out_of_range{ "DecimalColumn slice out of range" };
+		}
+
+		const auto first{ static_cast<std::ptrdiff_t>( offset ) };
+		const auto last{ static_cast<std::ptrdiff_t>( offset + count ) };
+
+		DecimalColumn result;
+		result.m_lo64.assign( m_lo64.begin() + first, m_lo64.begin() + last );
+		result.m_hi32.assign( m_hi32.begin() + first, m_hi32.begin() + last );
+		result.m_scaleSign.assign( m_scaleSign.begin() + first, m_scaleSign.begin() + last );
+
+		if ( !m_validity.empty() && count != 0 )
+		{
+			result.m_validity.resize( internal::validityWordCount( count ) );
+			internal::copyValidityBits( m_validity.data(), offset, count, result.m_validity.data() );
+		}
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Bulk conversion
+	//----------------------------------------------
+
+	inline void DecimalColumn::toDecimals( std::span<Decimal> destination ) const
+	{
+		if ( destination.size() < size() )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		for ( std::size_t i{ 0 }; i < size(); ++i )
+		{
+			destination[i] = ( *this )[i];
+		}
+	}
+
+	//----------------------------------------------
+	// Private helpers
+	//----------------------------------------------
+
+	inline void DecimalColumn::materializeValidity()
+	{
+		const std::size_t rows{ size() };
+		m_validity.assign( internal::validityWordCount( rows ), ~std::uint64_t{ 0 } );
+
+		const std::size_t tail{ rows % internal::VALIDITY_WORD_BITS };
+		if ( tail != 0 )
+		{
+			m_validity.back() = ( std::uint64_t{ 1 } << tail ) - 1;
+		}
+	}
+
+	inline void DecimalColumn::pushValidity( bool valid )
+	{
+		// Called after the value arrays grew, so the new row is size() - 1
+		const std::size_t row{ size() - 1 };
+		if ( row % internal::VALIDITY_WORD_BITS == 0 )
+		{
+			m_validity.push_back( 0U );
+		}
+
+		if ( valid )
+		{
+			m_validity.back() |= std::uint64_t{ 1 } << ( row % internal::VALIDITY_WORD_BITS );
+		}
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,226 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DecimalView.inl
+ * @brief Inline implementations for the DecimalView class
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Record decoding
+		//=====================================================================
+
+		/**
+		 * @brief Reverse the bytes of a 32-bit word
+		 * @param word Word to swap
+		 * @return Byte-swapped word
+		 */
+		inline constexpr std::uint32_t byteSwap32( std::uint32_t word ) noexcept
+		{
+			return ( word >> 24 ) | ( ( word >> 8 ) & 0x0000FF00U ) | ( ( word << 8 ) & 0x00FF0000U ) | ( word << 24 );
+		}
+
+		/**
+		 * @brief Read a record as toBits() words (lo, mid, hi, flags)
+		 * @param record First byte of the 16-byte record
+		 * @param layout Word order of the record
+		 * @return Words ready for Decimal::tryFromBits()
+		 */
+		inline std::array<std::int32_t, 4> readDecimalRecord( const std::byte* record, DecimalView::Layout layout ) noexcept
+		{
+			std::array<std::uint32_t, 4> words;
+			std::memcpy( words.data(), record, sizeof( words ) );
+
+			if ( layout != DecimalView::Layout::Native && std::endian::native == std::endian::big )
+			{
+				for ( auto& word : words )
+				{
+					word = byteSwap32( word );
+				}
+			}
+
+			switch ( layout )
+			{
+				case DecimalView::Layout::DotNetBits:
+				{
+					return std::bit_cast<std::array<std::int32_t, 4>>( words );
+				}
+				case DecimalView::Layout::DotNetMemory:
+				{
+					return std::bit_cast<std::array<std::int32_t, 4>>( std::array<std::uint32_t, 4>{ words[2], words[3], words[1], words[0] } );
+				}
+				case DecimalView::Layout::Native:
+				default:
+				{
+					return std::bit_cast<std::array<std::int32_t, 4>>( std::array<std::uint32_t, 4>{ words[1], words[2], words[3], words[0] } );
+				}
+			}
+		}
+
+		/**
+		 * @brief Check the size of a record buffer
+		 * @param bytes Buffer to check
+		 * @throws std::invalid_argument if the size is not a multiple of 16
+		 */
+		inline void checkRecordBuffer( std::span<const std::byte> bytes )
+		{
+			if ( bytes.size() % sizeof( Decimal ) != 0 )
+			{
+				throw std::invalid_argument{ "Buffer size is not a multiple of 16 bytes" };
+			}
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// DecimalView class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline constexpr DecimalView::DecimalView() noexcept
+		: m_bytes{},
+		  m_layout{ Layout::Native }
+	{
+	}
+
+	inline DecimalView::DecimalView( std::span<const std::byte> bytes, Layout layout )
+		: m_bytes{ bytes },
+		  m_layout{ layout }
+	{
+		internal::checkRecordBuffer( bytes );
+	}
+
+	//----------------------------------------------
+	// Element access
+	//----------------------------------------------
+
+	inline Decimal DecimalView::operator[]( std::size_t index ) const
+	{
+		return Decimal::fromBits( internal::readDecimalRecord( m_bytes.data() + index * sizeof( Decimal ), m_layout ) );
+	}
+
+	inline bool DecimalView::tryGet( std::size_t index, Decimal& result ) const noexcept
+	{
+		return Decimal::tryFromBits( internal::readDecimalRecord( m_bytes.data() + index * sizeof( Decimal ), m_layout ), result );
+	}
+
+	inline std::size_t DecimalView::findInvalid() const noexcept
+	{
+		const std::size_t count{ size() };
+		for ( std::size_t i{ 0 }; i < count; ++i )
+		{
+			Decimal value;
+			if ( !tryGet( i, value ) )
+			{
+				return i;
+			}
+		}
+
+		return count;
+	}
+
+	//----------------------------------------------
+	// Bulk conversion
+	//----------------------------------------------
+
+	inline void DecimalView::toDecimals( std::span<Decimal> destination ) const
+	{
+		if ( destination.size() < size() )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		if ( tryToDecimals( destination ) != size() )
+		{
+			throw std::invalid_argument{ "Invalid decimal bits" };
+		}
+	}
+
+	inline std::size_t DecimalView::tryToDecimals( std::span<Decimal> destination ) const noexcept
+	{
+		const std::size_t count{ std::min( size(), destination.size() ) };
+		for ( std::size_t i{ 0 }; i < count; ++i )
+		{
+			if ( !tryGet( i, destination[i] ) )
+			{
+				return i;
+			}
+		}
+
+		return count;
+	}
+
+	inline std::span<const Decimal> DecimalView::asDecimals( std::span<const std::byte> bytes )
+	{
+		internal::checkRecordBuffer( bytes );
+		if ( reinterpret_cast<std::uintptr_t>( bytes.data() ) % alignof( Decimal ) != 0 )
+		{
+			throw std::invalid_argument{ "Buffer is not aligned for Decimal" };
+		}
+
+		if ( DecimalView{ bytes, Layout::Native }.findInvalid() != bytes.size() / sizeof( Decimal ) )
+		{
+			throw std::invalid_argument{ "Invalid decimal bits" };
+		}
+
+		// Decimal is trivially copyable with a fixed 16-byte layout (see Decimal.h)
+		return { reinterpret_cast<const Decimal*>( bytes.data() ), bytes.size() / sizeof( Decimal ) };
+	}
+
+	//----------------------------------------------
+	// Property accessors
+	//----------------------------------------------
+
+	inline constexpr std::size_t DecimalView::size() const noexcept
+	{
+		return m_bytes.size() / sizeof( Decimal );
+	}
+
+	inline constexpr bool DecimalView::isEmpty() const noexcept
+	{
+		return m_bytes.size() < sizeof( Decimal );
+	}
+
+	inline constexpr DecimalView::Layout DecimalView::layout() const noexcept
+	{
+		return m_layout;
+	}
+
+	inline constexpr std::span<const std::byte> DecimalView::bytes() const noexcept
+	{
+		return m_bytes;
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,678 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FixedDecimal.inl
+ * @brief Inline implementations for the FixedDecimal class template
+ */
+
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "nfx/detail/datatypes/Constants.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// FixedDecimal helper functions
+		//=====================================================================
+
+		/**
+		 * @brief Signed division of Int128 values, ties to even
+		 * @param dividend Value to divide
+		 * @param divisor Non-zero divisor
+		 * @return Rounded quotient
+		 */
+		inline constexpr Int128 divideRoundedHalfEven( const Int128& dividend, const Int128& divisor )
+		{
+			Int128 quotient{ dividend / divisor };
+			const Int128 remainder{ dividend - quotient * divisor };
+			if ( remainder.isZero() )
+			{
+				return quotient;
+			}
+
+			const Int128 twice{ remainder.abs() + remainder.abs() };
+			const Int128 absoluteDivisor{ divisor.abs() };
+			if ( twice > absoluteDivisor || ( twice == absoluteDivisor && ( quotient.toLow() & constants::BIT_MASK_ONE ) != 0 ) )
+			{
+				quotient = ( dividend.isNegative() != divisor.isNegative() ) ? quotient - Int128{ 1 } : quotient + Int128{ 1 };
+			}
+
+			return quotient;
+		}
+
+		/**
+		 * @brief Magnitude of a FixedDecimal storage value
+		 * @param value Raw storage value
+		 * @return |value| as UInt256
+		 */
+		template <typename Storage>
+		inline constexpr UInt256 storageMagnitude( const Storage& value ) noexcept
+		{
+			return UInt256::magnitude( Int128{ value } );
+		}
+
+		/**
+		 * @brief Check whether a signed magnitude fits a FixedDecimal storage type
+		 * @param magnitude Absolute value
+		 * @param negative Sign of the value
+		 * @return true if the value is representable
+		 */
+		template <typename Storage>
+		inline constexpr bool fitsStorage( const UInt256& magnitude, bool negative ) noexcept
+		{
+			constexpr std::size_t valueBits{ std::is_same_v<Storage, std::int64_t> ? 63U : 127U };
+			if ( magnitude.fitsIn( valueBits ) )
+			{
+				return true;
+			}
+
+			// Only the minimum value -2^(bits-1) has a magnitude one bit wider
+			const UInt256 minimumMagnitude{ valueBits == 63U ? UInt256{ constants::BIT_MASK_ONE << 63 }
+															  : UInt256{ 0, constants::BIT_MASK_ONE << 63 } };
+
+			return negative && magnitude == minimumMagnitude;
+		}
+
+		/**
+		 * @brief Build a storage value from sign and magnitude
+		 * @param magnitude Absolute value (must satisfy fitsStorage)
+		 * @param negative Sign of the value
+		 * @return Raw storage value
+		 */
+		template <typename Storage>
+		inline constexpr Storage storageFromMagnitude( const UInt256& magnitude, bool negative ) noexcept
+		{
+			if constexpr ( std::is_same_v<Storage, std::int64_t> )
+			{
+				const std::uint64_t bits{ negative ? 0U - magnitude.word( 0 ) : magnitude.word( 0 ) };
+
+				return static_cast<std::int64_t>( bits );
+			}
+			else
+			{
+				const Int128 value{ magnitude.word( 0 ), magnitude.word( 1 ) };
+
+				return negative ? -value : value;
+			}
+		}
+
+		/**
+		 * @brief Narrow a signed magnitude to storage, throwing on overflow
+		 * @param magnitude Absolute value
+		 * @param negative Sign of the value
+		 * @return Raw storage value
+		 * @throws std::overflow_error if the value is not representable
+		 */
+		template <typename Storage>
+		inline constexpr Storage narrowToStorage( const UInt256& magnitude, bool negative )
+		{
+			if ( !fitsStorage<Storage>( magnitude, negative ) )
+			{
+				throw std::overflow_error{ "FixedDecimal overflow" };
+			}
+
+			return storageFromMagnitude<Storage>( magnitude, negative );
+		}
+
+		/**
+		 * @brief Narrow an Int128 intermediate to 64-bit storage, throwing on overflow
+		 * @param value Intermediate result
+		 * @return value as std::int64_t
+		 * @throws std::overflow_error if the value is not representable
+		 */
+		inline constexpr std::int64_t narrowToInt64( const Int128& value )
+		{
+			if ( value > Int128{ std::numeric_limits<std::int64_t>::max() } || value < Int128{ std::numeric_limits<std::int64_t>::min() } )
+			{
+				throw std::overflow_error{ "FixedDecimal overflow" };
+			}
+
+			return static_cast<std::int64_t>( value.toLow() );
+		}
+		/**
+		 * @brief Parse a decimal string directly into a scaled magnitude
+		 * @param str String in the Decimal::parse format ([+-]digits[.digits])
+		 * @param scale Number of fractional digits to keep
+		 * @param magnitude Receives the absolute value scaled by 10^scale
+		 * @param negative Receives the sign
+		 * @return true if the format is valid and the value fits 256 bits
+		 * @details Digits beyond the scale are rounded half-even, so every significant
+		 *          digit of a wide Int128 value is honoured instead of Decimal's 28.
+		 */
+		inline constexpr bool parseScaledMagnitude( std::string_view str, std::uint8_t scale, UInt256& magnitude, bool& negative ) noexcept
+		{
+			magnitude = UInt256{};
+			negative = false;
+
+			std::size_t pos{ 0 };
+			if ( !str.empty() && ( str[0] == '-' || str[0] == '+' ) )
+			{
+				negative = str[0] == '-';
+				pos = 1;
+			}
+
+			bool hasDigits{ false };
+			bool seenPoint{ false };
+			std::uint8_t fractionDigits{ 0 };
+			std::uint8_t roundingDigit{ 0 };
+			bool sticky{ false };
+			bool roundingDigitSeen{ false };
+
+			for ( ; pos < str.length(); ++pos )
+			{
+				const char c{ str[pos] };
+				if ( c == '.' )
+				{
+					if ( seenPoint )
+					{
+						return false;
+					}
+					seenPoint = true;
+
+					continue;
+				}
+
+				if ( c < '0' || c > '9' )
+				{
+					return false;
+				}
+
+				hasDigits = true;
+				const std::uint64_t digit{ static_cast<std::uint64_t>( c - '0' ) };
+
+				if ( seenPoint && fractionDigits >= scale )
+				{
+					// Beyond the scale: keep the first dropped digit and whether any later one is non-zero
+					if ( !roundingDigitSeen )
+					{
+						roundingDigit = static_cast<std::uint8_t>( digit );
+						roundingDigitSeen = true;
+					}
+					else
+					{
+						sticky = sticky || digit != 0;
+					}
+
+					continue;
+				}
+
+				// Leave headroom so the final rescale by up to 10^28 cannot wrap
+				if ( !magnitude.fitsIn( 152U ) )
+				{
+					return false;
+				}
+
+				magnitude = magnitude.multiply( constants::DECIMAL_BASE ) + UInt256{ digit };
+				if ( seenPoint )
+				{
+					++fractionDigits;
+				}
+			}
+
+			if ( !hasDigits )
+			{
+				return false;
+			}
+
+			magnitude = multiplyByPowerOf10Wide( magnitude, static_cast<std::uint8_t>( scale - fractionDigits ) );
+
+			if ( roundingDigit > 5U ||
+				 ( roundingDigit == 5U && ( sticky || ( magnitude.word( 0 ) & constants::BIT_MASK_ONE ) != 0 ) ) )
+			{
+				magnitude = magnitude + UInt256{ 1 };
+			}
+
+			return true;
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// FixedDecimal class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage>::FixedDecimal() noexcept
+		: m_value{}
+	{
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage>::FixedDecimal( std::int64_t value )
+		: m_value{}
+	{
+		const internal::UInt256 magnitude{ internal::multiplyByPowerOf10Wide( internal::UInt256::magnitude( Int128{ value } ), Scale ) };
+		m_value = internal::narrowToStorage<Storage>( magnitude, value < 0 );
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage>::FixedDecimal( const Decimal& value, Decimal::RoundingMode mode )
+		: m_value{}
+	{
+		// When the 96-bit mantissa cannot hold Scale digits, rounded keeps its scale and the wide product covers the rest
+		Decimal rounded{ value };
+		(void)value.tryRescale( Scale, rounded, mode );
+		const Int128 mantissa{ internal::mantissaAsInt128( rounded ) };
+		const internal::UInt256 magnitude{ internal::multiplyByPowerOf10Wide( internal::UInt256{ mantissa.toLow(), mantissa.toHigh() },
+			static_cast<std::uint8_t>( Scale - rounded.scale() ) ) };
+
+		m_value = internal::narrowToStorage<Storage>( magnitude, rounded.isNegative() );
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage>::FixedDecimal( std::string_view str )
+		: FixedDecimal{ parse( str ) }
+	{
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage> FixedDecimal<Scale, Storage>::fromRaw( Storage raw ) noexcept
+	{
+		FixedDecimal result;
+		result.m_value = raw;
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Constants
+	//----------------------------------------------
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr std::uint8_t FixedDecimal<Scale, Storage>::scale() noexcept
+	{
+		return Scale;
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage> FixedDecimal<Scale, Storage>::minValue() noexcept
+	{
+		if constexpr ( std::is_same_v<Storage, std::int64_t> )
+		{
+			return fromRaw( std::numeric_limits<std::int64_t>::min() );
+		}
+		else
+		{
+			return fromRaw( Int128{ constants::INT_128_MIN_NEGATIVE_LOW, constants::INT_128_MIN_NEGATIVE_HIGH } );
+		}
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage> FixedDecimal<Scale, Storage>::maxValue() noexcept
+	{
+		if constexpr ( std::is_same_v<Storage, std::int64_t> )
+		{
+			return fromRaw( std::numeric_limits<std::int64_t>::max() );
+		}
+		else
+		{
+			return fromRaw( Int128{ constants::INT_128_MAX_POSITIVE_LOW, constants::INT_128_MAX_POSITIVE_HIGH } );
+		}
+	}
+
+	//----------------------------------------------
+	// Arithmetic operators
+	//----------------------------------------------
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage> FixedDecimal<Scale, Storage>::operator+( const FixedDecimal& other ) const
+	{
+		// Checked against the storage bounds before adding, so the sum itself never overflows
+		const Storage zero{};
+		if ( ( other.m_value > zero && m_value > maxValue().m_value - other.m_value ) ||
+			 ( other.m_value < zero && m_value < minValue().m_value - other.m_value ) )
+		{
+			throw std::overflow_error{ "FixedDecimal overflow" };
+		}
+
+		return fromRaw( m_value + other.m_value );
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage> FixedDecimal<Scale, Storage>::operator-( const FixedDecimal& other ) const
+	{
+		const Storage zero{};
+		if ( ( other.m_value < zero && m_value > maxValue().m_value + other.m_value ) ||
+			 ( other.m_value > zero && m_value < minValue().m_value + other.m_value ) )
+		{
+			throw std::overflow_error{ "FixedDecimal overflow" };
+		}
+
+		return fromRaw( m_value - other.m_value );
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage> FixedDecimal<Scale, Storage>::operator*( const FixedDecimal& other ) const
+	{
+		if constexpr ( std::is_same_v<Storage, std::int64_t> )
+		{
+			// |a * b| < 2^126, so the full product fits Int128
+			const Int128 product{ Int128{ m_value } * Int128{ other.m_value } };
+
+			return fromRaw( internal::narrowToInt64( internal::divideRoundedHalfEven( product, internal::getPowerOf10( Scale ) ) ) );
+		}
+		else
+		{
+			const internal::UInt256 product{ internal::UInt256::multiply( internal::storageMagnitude( m_value ), internal::storageMagnitude( other.m_value ) ) };
+			const internal::UInt256 magnitude{ internal::divideByPowerOf10RoundedWide( product, Scale ) };
+
+			return fromRaw( internal::narrowToStorage<Storage>( magnitude, isNegative() != other.isNegative() ) );
+		}
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage> FixedDecimal<Scale, Storage>::operator/( const FixedDecimal& other ) const
+	{
+		if ( other.isZero() )
+		{
+			throw std::overflow_error{ "Division by zero" };
+		}
+
+		if constexpr ( std::is_same_v<Storage, std::int64_t> )
+		{
+			// |a| * 10^18 < 2^123, so the scaled dividend fits Int128
+			const Int128 dividend{ Int128{ m_value } * internal::getPowerOf10( Scale ) };
+
+			return fromRaw( internal::narrowToInt64( internal::divideRoundedHalfEven( dividend, Int128{ other.m_value } ) ) );
+		}
+		else
+		{
+			const internal::UInt256 dividend{ internal::multiplyByPowerOf10Wide( internal::storageMagnitude( m_value ), Scale ) };
+			const internal::UInt256 divisor{ internal::storageMagnitude( other.m_value ) };
+
+			internal::UInt256 quotient;
+			internal::UInt256 remainder;
+			internal::UInt256::divide( dividend, divisor, quotient, remainder );
+
+			const internal::UInt256 magnitude{ internal::roundHalfEven( quotient, remainder, divisor ) };
+
+			return fromRaw( internal::narrowToStorage<Storage>( magnitude, isNegative() != other.isNegative() ) );
+		}
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage> FixedDecimal<Scale, Storage>::operator-() const
+	{
+		// The storage minimum has no positive counterpart
+		if ( m_value == minValue().m_value )
+		{
+			throw std::overflow_error{ "FixedDecimal overflow" };
+		}
+
+		return fromRaw( -m_value );
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage>& FixedDecimal<Scale, Storage>::operator+=( const FixedDecimal& other )
+	{
+		*this = *this + other;
+		return *this;
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage>& FixedDecimal<Scale, Storage>::operator-=( const FixedDecimal& other )
+	{
+		*this = *this - other;
+		return *this;
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage>& FixedDecimal<Scale, Storage>::operator*=( const FixedDecimal& other )
+	{
+		*this = *this * other;
+		return *this;
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage>& FixedDecimal<Scale, Storage>::operator/=( const FixedDecimal& other )
+	{
+		*this = *this / other;
+		return *this;
+	}
+
+	//----------------------------------------------
+	// Comparison operators
+	//----------------------------------------------
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr bool FixedDecimal<Scale, Storage>::operator==( const FixedDecimal& other ) const noexcept
+	{
+		return m_value == other.m_value;
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr bool FixedDecimal<Scale, Storage>::operator!=( const FixedDecimal& other ) const noexcept
+	{
+		return m_value != other.m_value;
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr bool FixedDecimal<Scale, Storage>::operator<( const FixedDecimal& other ) const noexcept
+	{
+		return m_value < other.m_value;
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr bool FixedDecimal<Scale, Storage>::operator<=( const FixedDecimal& other ) const noexcept
+	{
+		return m_value <= other.m_value;
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr bool FixedDecimal<Scale, Storage>::operator>( const FixedDecimal& other ) const noexcept
+	{
+		return m_value > other.m_value;
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr bool FixedDecimal<Scale, Storage>::operator>=( const FixedDecimal& other ) const noexcept
+	{
+		return m_value >= other.m_value;
+	}
+
+	//----------------------------------------------
+	// String parsing
+	//----------------------------------------------
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage> FixedDecimal<Scale, Storage>::parse( std::string_view str )
+	{
+		internal::UInt256 magnitude;
+		bool negative{ false };
+		if ( !internal::parseScaledMagnitude( str, Scale, magnitude, negative ) )
+		{
+			throw std::invalid_argument{ "Invalid decimal string format" };
+		}
+
+		return fromRaw( internal::narrowToStorage<Storage>( magnitude, negative ) );
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr bool FixedDecimal<Scale, Storage>::tryParse( std::string_view str, FixedDecimal& result ) noexcept
+	{
+		internal::UInt256 magnitude;
+		bool negative{ false };
+		if ( !internal::parseScaledMagnitude( str, Scale, magnitude, negative ) ||
+			 !internal::fitsStorage<Storage>( magnitude, negative ) )
+		{
+			return false;
+		}
+
+		result = fromRaw( internal::storageFromMagnitude<Storage>( magnitude, negative ) );
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Type conversion
+	//----------------------------------------------
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr Decimal FixedDecimal<Scale, Storage>::toDecimal() const
+	{
+		internal::UInt256 magnitude{ internal::storageMagnitude( m_value ) };
+		std::uint8_t resultScale{ Scale };
+
+		// Wide Int128 values may need fractional digits dropped to fit the 96-bit mantissa
+		constexpr std::size_t mantissaBits{ 96U };
+		if ( !magnitude.fitsIn( mantissaBits ) )
+		{
+			bool fitted{ false };
+			for ( std::uint8_t dropped{ 1U }; dropped <= Scale && !fitted; ++dropped )
+			{
+				const internal::UInt256 rounded{ internal::divideByPowerOf10RoundedWide( magnitude, dropped ) };
+				if ( rounded.fitsIn( mantissaBits ) )
+				{
+					magnitude = rounded;
+					resultScale = static_cast<std::uint8_t>( Scale - dropped );
+					fitted = true;
+				}
+			}
+
+			if ( !fitted )
+			{
+				throw std::overflow_error{ "FixedDecimal overflow" };
+			}
+		}
+
+		Decimal result;
+		internal::setMantissa( result, Int128{ magnitude.word( 0 ), magnitude.word( 1 ) } );
+		internal::setScale( result, resultScale );
+		if ( isNegative() )
+		{
+			result.flags() |= constants::DECIMAL_SIGN_MASK;
+		}
+		internal::normalize( result );
+
+		return result;
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline std::string FixedDecimal<Scale, Storage>::toString() const
+	{
+		std::string digits;
+		if constexpr ( std::is_same_v<Storage, std::int64_t> )
+		{
+			digits = std::to_string( m_value );
+		}
+		else
+		{
+			digits = m_value.toString();
+		}
+
+		const bool negative{ digits.front() == '-' };
+		if ( negative )
+		{
+			digits.erase( 0, 1 );
+		}
+
+		if constexpr ( Scale > 0 )
+		{
+			if ( digits.size() <= Scale )
+			{
+				digits.insert( 0, Scale + 1U - digits.size(), '0' );
+			}
+			digits.insert( digits.size() - Scale, 1, '.' );
+		}
+
+		if ( negative )
+		{
+			digits.insert( 0, 1, '-' );
+		}
+
+		return digits;
+	}
+
+	//----------------------------------------------
+	// Property accessors
+	//----------------------------------------------
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr Storage FixedDecimal<Scale, Storage>::raw() const noexcept
+	{
+		return m_value;
+	}
+
+	//----------------------------------------------
+	// State checking
+	//----------------------------------------------
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr bool FixedDecimal<Scale, Storage>::isZero() const noexcept
+	{
+		return m_value == 0;
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr bool FixedDecimal<Scale, Storage>::isNegative() const noexcept
+	{
+		return m_value < 0;
+	}
+
+	//----------------------------------------------
+	// Mathematical operations
+	//----------------------------------------------
+
+	template <std::uint8_t Scale, typename Storage>
+	inline constexpr FixedDecimal<Scale, Storage> FixedDecimal<Scale, Storage>::abs() const
+	{
+		return isNegative() ? -*this : *this;
+	}
+
+	//=====================================================================
+	// Stream operators
+	//=====================================================================
+
+	template <std::uint8_t Scale, typename Storage>
+	std::ostream& operator<<( std::ostream& os, const FixedDecimal<Scale, Storage>& value )
+	{
+		return os << value.toString();
+	}
+
+	template <std::uint8_t Scale, typename Storage>
+	std::istream& operator>>( std::istream& is, FixedDecimal<Scale, Storage>& value )
+	{
+		std::string str;
+		is >> str;
+
+		if ( !FixedDecimal<Scale, Storage>::tryParse( str, value ) )
+		{
+			is.setstate( std::ios::failbit );
+		}
+
+		return is;
+	}
+} // namespace nfx::datatypes
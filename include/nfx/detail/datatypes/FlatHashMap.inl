@@ -0,0 +1,503 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FlatHashMap.inl
+ * @brief Inline implementations for the FlatHashMap class template
+ */
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+#include "nfx/detail/datatypes/Constants.h"
+
+#if defined( __SSE2__ ) || defined( _M_X64 )
+#	define NFX_DATATYPES_FLAT_MAP_SSE2 1
+#	include <emmintrin.h>
+#else
+#	define NFX_DATATYPES_FLAT_MAP_SSE2 0
+#endif
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Canonical keys
+		//=====================================================================
+
+		template <>
+		struct FlatMapKeyTraits<Decimal>
+		{
+			/**
+			 * @brief Get the canonical words of a Decimal
+			 * @param value Key to convert
+			 * @return Words of value with trailing zeros removed (and zero as all bits clear)
+			 */
+			static inline FlatMapKey toKey( const Decimal& value ) noexcept
+			{
+				const auto& mantissa{ value.mantissa() };
+				std::uint32_t word0{ mantissa[0] };
+				std::uint32_t word1{ mantissa[1] };
+				std::uint32_t word2{ mantissa[2] };
+				if ( ( word0 | word1 | word2 ) == 0 )
+				{
+					return FlatMapKey{ 0, 0 };
+				}
+
+				// 2^32 and 2^64 are both 6 modulo 10, which rules out most values without dividing;
+				// the long division by 10 in 32-bit limbs compiles to multiplications
+				std::uint32_t scale{ value.scale() };
+				while ( scale > 0 && ( 6U * ( static_cast<std::uint64_t>( word2 ) + word1 ) + word0 ) % 10U == 0 )
+				{
+					std::uint64_t current{ word2 };
+					const auto quotient2{ static_cast<std::uint32_t>( current / 10U ) };
+					current = ( current % 10U ) << constants::BITS_PER_UINT32 | word1;
+					const auto quotient1{ static_cast<std::uint32_t>( current / 10U ) };
+					current = ( current % 10U ) << constants::BITS_PER_UINT32 | word0;
+					word0 = static_cast<std::uint32_t>( current / 10U );
+					word1 = quotient1;
+					word2 = quotient2;
+					--scale;
+				}
+
+				const std::uint32_t flags{ scale << constants::DECIMAL_SCALE_SHIFT | ( value.isNegative() ? constants::DECIMAL_SIGN_MASK : 0U ) };
+
+				return FlatMapKey{ static_cast<std::uint64_t>( word1 ) << constants::BITS_PER_UINT32 | word0,
+					static_cast<std::uint64_t>( flags ) << constants::BITS_PER_UINT32 | word2 };
+			}
+
+			/**
+			 * @brief Rebuild a Decimal from canonical words
+			 * @param key Canonical words
+			 * @return Decimal at its smallest scale
+			 */
+			static inline Decimal fromKey( const FlatMapKey& key ) noexcept
+			{
+				Decimal value{};
+				value.mantissa()[0] = static_cast<std::uint32_t>( key.low );
+				value.mantissa()[1] = static_cast<std::uint32_t>( key.low >> constants::BITS_PER_UINT32 );
+				value.mantissa()[2] = static_cast<std::uint32_t>( key.high );
+				value.flags() = static_cast<std::uint32_t>( key.high >> constants::BITS_PER_UINT32 );
+
+				return value;
+			}
+		};
+
+		template <>
+		struct FlatMapKeyTraits<Int128>
+		{
+			/**
+			 * @brief Get the words of an Int128
+			 * @param value Key to convert
+			 * @return Low and high words
+			 */
+			static inline FlatMapKey toKey( const Int128& value ) noexcept
+			{
+				return FlatMapKey{ value.toLow(), value.toHigh() };
+			}
+
+			/**
+			 * @brief Rebuild an Int128 from its words
+			 * @param key Low and high words
+			 * @return Int128 value
+			 */
+			static inline Int128 fromKey( const FlatMapKey& key ) noexcept
+			{
+				return Int128{ key.low, key.high };
+			}
+		};
+
+		/**
+		 * @brief Hash canonical key words
+		 * @param key Canonical key
+		 * @return 64-bit hash; the low 7 bits are the slot tag, the rest select the group
+		 */
+		inline std::uint64_t hashFlatMapKey( const FlatMapKey& key ) noexcept
+		{
+			return mixHash( key.low ^ key.high * constants::HASH_MIX_MULTIPLIER_2 );
+		}
+
+		//=====================================================================
+		// Control byte groups
+		//=====================================================================
+
+		/**
+		 * @brief Find the slots of a group whose control byte equals a value
+		 * @param group First control byte of the group
+		 * @param value Control byte to match
+		 * @return Bit i set if slot i matches
+		 */
+		inline std::uint32_t matchControl( const std::uint8_t* group, std::uint8_t value ) noexcept
+		{
+#if NFX_DATATYPES_FLAT_MAP_SSE2
+			const __m128i control{ _mm_loadu_si128( reinterpret_cast<const __m128i*>( group ) ) };
+
+			return static_cast<std::uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( control, _mm_set1_epi8( static_cast<char>( value ) ) ) ) );
+#else
+			std::uint32_t mask{ 0 };
+			for ( std::size_t i{ 0 }; i < constants::FLAT_MAP_GROUP_SIZE; ++i )
+			{
+				mask |= ( group[i] == value ? 1U : 0U ) << i;
+			}
+
+			return mask;
+#endif
+		}
+
+		/**
+		 * @brief Find the empty or deleted slots of a group
+		 * @param group First control byte of the group
+		 * @return Bit i set if slot i is free
+		 */
+		inline std::uint32_t matchFree( const std::uint8_t* group ) noexcept
+		{
+#if NFX_DATATYPES_FLAT_MAP_SSE2
+			// Free control bytes are exactly those with the top bit set
+			return static_cast<std::uint32_t>( _mm_movemask_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( group ) ) ) );
+#else
+			std::uint32_t mask{ 0 };
+			for ( std::size_t i{ 0 }; i < constants::FLAT_MAP_GROUP_SIZE; ++i )
+			{
+				mask |= static_cast<std::uint32_t>( group[i] >> 7 ) << i;
+			}
+
+			return mask;
+#endif
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// FlatHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename Key, typename Value>
+	inline FlatHashMap<Key, Value>::FlatHashMap( std::size_t count )
+	{
+		reserve( count );
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename Key, typename Value>
+	inline Value* FlatHashMap<Key, Value>::find( const Key& key ) noexcept
+	{
+		const internal::FlatMapKey words{ internal::FlatMapKeyTraits<Key>::toKey( key ) };
+		const std::size_t index{ findIndex( words, internal::hashFlatMapKey( words ) ) };
+
+		return index == capacity() ? nullptr : &m_slots[index].value;
+	}
+
+	template <typename Key, typename Value>
+	inline const Value* FlatHashMap<Key, Value>::find( const Key& key ) const noexcept
+	{
+		const internal::FlatMapKey words{ internal::FlatMapKeyTraits<Key>::toKey( key ) };
+		const std::size_t index{ findIndex( words, internal::hashFlatMapKey( words ) ) };
+
+		return index == capacity() ? nullptr : &m_slots[index].value;
+	}
+
+	template <typename Key, typename Value>
+	inline bool FlatHashMap<Key, Value>::contains( const Key& key ) const noexcept
+	{
+		return find( key ) != nullptr;
+	}
+
+	//----------------------------------------------
+	// Modification
+	//----------------------------------------------
+
+	template <typename Key, typename Value>
+	inline Value& FlatHashMap<Key, Value>::operator[]( const Key& key )
+	{
+		bool inserted{ false };
+
+		return m_slots[findOrInsertIndex( internal::FlatMapKeyTraits<Key>::toKey( key ), inserted )].value;
+	}
+
+	template <typename Key, typename Value>
+	inline bool FlatHashMap<Key, Value>::insert( const Key& key, Value value )
+	{
+		bool inserted{ false };
+		const std::size_t index{ findOrInsertIndex( internal::FlatMapKeyTraits<Key>::toKey( key ), inserted ) };
+		if ( inserted )
+		{
+			m_slots[index].value = std::move( value );
+		}
+
+		return inserted;
+	}
+
+	template <typename Key, typename Value>
+	inline bool FlatHashMap<Key, Value>::insertOrAssign( const Key& key, Value value )
+	{
+		bool inserted{ false };
+		m_slots[findOrInsertIndex( internal::FlatMapKeyTraits<Key>::toKey( key ), inserted )].value = std::move( value );
+
+		return inserted;
+	}
+
+	template <typename Key, typename Value>
+	inline bool FlatHashMap<Key, Value>::erase( const Key& key )
+	{
+		const internal::FlatMapKey words{ internal::FlatMapKeyTraits<Key>::toKey( key ) };
+		const std::size_t index{ findIndex( words, internal::hashFlatMapKey( words ) ) };
+		if ( index == capacity() )
+		{
+			return false;
+		}
+
+		// A group that still has an empty slot never overflowed, so no probe sequence runs through it
+		const std::uint8_t* group{ m_control.data() + ( index & ~( constants::FLAT_MAP_GROUP_SIZE - 1 ) ) };
+		if ( internal::matchControl( group, constants::FLAT_MAP_EMPTY ) != 0 )
+		{
+			m_control[index] = constants::FLAT_MAP_EMPTY;
+		}
+		else
+		{
+			m_control[index] = constants::FLAT_MAP_DELETED;
+			++m_deleted;
+		}
+
+		m_slots[index].value = Value{};
+		--m_size;
+
+		return true;
+	}
+
+	template <typename Key, typename Value>
+	inline void FlatHashMap<Key, Value>::clear()
+	{
+		std::fill( m_control.begin(), m_control.end(), constants::FLAT_MAP_EMPTY );
+		for ( Slot& slot : m_slots )
+		{
+			slot.value = Value{};
+		}
+
+		m_size = 0;
+		m_deleted = 0;
+	}
+
+	template <typename Key, typename Value>
+	inline void FlatHashMap<Key, Value>::reserve( std::size_t count )
+	{
+		std::size_t slotCount{ constants::FLAT_MAP_GROUP_SIZE };
+		while ( slotCount * constants::FLAT_MAP_MAX_LOAD_NUMERATOR < count * constants::FLAT_MAP_MAX_LOAD_DENOMINATOR )
+		{
+			slotCount *= 2;
+		}
+
+		if ( slotCount > capacity() )
+		{
+			rehash( slotCount );
+		}
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	template <typename Key, typename Value>
+	template <typename Function>
+	inline void FlatHashMap<Key, Value>::forEach( Function&& function )
+	{
+		for ( std::size_t i{ 0 }; i < m_control.size(); ++i )
+		{
+			if ( m_control[i] < constants::FLAT_MAP_EMPTY )
+			{
+				function( internal::FlatMapKeyTraits<Key>::fromKey( m_slots[i].key ), m_slots[i].value );
+			}
+		}
+	}
+
+	template <typename Key, typename Value>
+	template <typename Function>
+	inline void FlatHashMap<Key, Value>::forEach( Function&& function ) const
+	{
+		for ( std::size_t i{ 0 }; i < m_control.size(); ++i )
+		{
+			if ( m_control[i] < constants::FLAT_MAP_EMPTY )
+			{
+				function( internal::FlatMapKeyTraits<Key>::fromKey( m_slots[i].key ), std::as_const( m_slots[i].value ) );
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <typename Key, typename Value>
+	inline std::size_t FlatHashMap<Key, Value>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename Key, typename Value>
+	inline bool FlatHashMap<Key, Value>::isEmpty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename Key, typename Value>
+	inline std::size_t FlatHashMap<Key, Value>::capacity() const noexcept
+	{
+		return m_control.size();
+	}
+
+	//----------------------------------------------
+	// Probing
+	//----------------------------------------------
+
+	template <typename Key, typename Value>
+	inline std::size_t FlatHashMap<Key, Value>::findIndex( const internal::FlatMapKey& key, std::uint64_t hash ) const noexcept
+	{
+		if ( m_control.empty() )
+		{
+			return 0;
+		}
+
+		const std::size_t groupMask{ m_control.size() / constants::FLAT_MAP_GROUP_SIZE - 1 };
+		const auto tag{ static_cast<std::uint8_t>( hash & ( ( 1U << constants::FLAT_MAP_TAG_BITS ) - 1 ) ) };
+		std::size_t group{ static_cast<std::size_t>( hash >> constants::FLAT_MAP_TAG_BITS ) & groupMask };
+
+		// Triangular steps visit every group of a power-of-two table
+		for ( std::size_t step{ 1 };; ++step )
+		{
+			const std::size_t first{ group * constants::FLAT_MAP_GROUP_SIZE };
+			const std::uint8_t* control{ m_control.data() + first };
+			for ( std::uint32_t matches{ internal::matchControl( control, tag ) }; matches != 0; matches &= matches - 1 )
+			{
+				const std::size_t index{ first + static_cast<std::size_t>( std::countr_zero( matches ) ) };
+				const internal::FlatMapKey& candidate{ m_slots[index].key };
+				if ( candidate.low == key.low && candidate.high == key.high )
+				{
+					return index;
+				}
+			}
+
+			if ( internal::matchControl( control, constants::FLAT_MAP_EMPTY ) != 0 )
+			{
+				return m_control.size();
+			}
+
+			group = ( group + step ) & groupMask;
+		}
+	}
+
+	template <typename Key, typename Value>
+	inline std::size_t FlatHashMap<Key, Value>::findOrInsertIndex( const internal::FlatMapKey& key, bool& inserted )
+	{
+		const std::uint64_t hash{ internal::hashFlatMapKey( key ) };
+		const std::size_t existing{ findIndex( key, hash ) };
+		if ( existing != capacity() )
+		{
+			inserted = false;
+
+			return existing;
+		}
+
+		const std::size_t maxLoad{ capacity() / constants::FLAT_MAP_MAX_LOAD_DENOMINATOR * constants::FLAT_MAP_MAX_LOAD_NUMERATOR };
+		if ( m_size + 1 > maxLoad )
+		{
+			rehash( std::max( capacity() * 2, constants::FLAT_MAP_GROUP_SIZE ) );
+		}
+		else if ( m_size + m_deleted + 1 > maxLoad )
+		{
+			// Mostly tombstones: rebuild at the same size
+			rehash( capacity() );
+		}
+
+		const std::size_t groupMask{ m_control.size() / constants::FLAT_MAP_GROUP_SIZE - 1 };
+		std::size_t group{ static_cast<std::size_t>( hash >> constants::FLAT_MAP_TAG_BITS ) & groupMask };
+		for ( std::size_t step{ 1 };; ++step )
+		{
+			const std::size_t first{ group * constants::FLAT_MAP_GROUP_SIZE };
+			const std::uint32_t free{ internal::matchFree( m_control.data() + first ) };
+			if ( free != 0 )
+			{
+				const std::size_t index{ first + static_cast<std::size_t>( std::countr_zero( free ) ) };
+				if ( m_control[index] == constants::FLAT_MAP_DELETED )
+				{
+					--m_deleted;
+				}
+
+				m_control[index] = static_cast<std::uint8_t>( hash & ( ( 1U << constants::FLAT_MAP_TAG_BITS ) - 1 ) );
+				m_slots[index].key = key;
+				++m_size;
+				inserted = true;
+
+				return index;
+			}
+
+			group = ( group + step ) & groupMask;
+		}
+	}
+
+	template <typename Key, typename Value>
+	inline void FlatHashMap<Key, Value>::rehash( std::size_t slotCount )
+	{
+		std::vector<std::uint8_t> control( slotCount, constants::FLAT_MAP_EMPTY );
+		std::vector<Slot> slots( slotCount );
+		std::swap( control, m_control );
+		std::swap( slots, m_slots );
+
+		const std::size_t groupMask{ slotCount / constants::FLAT_MAP_GROUP_SIZE - 1 };
+		for ( std::size_t i{ 0 }; i < control.size(); ++i )
+		{
+			if ( control[i] >= constants::FLAT_MAP_EMPTY )
+			{
+				continue;
+			}
+
+			// Keys are unique, so each goes to the first free slot of its probe sequence
+			const std::uint64_t hash{ internal::hashFlatMapKey( slots[i].key ) };
+			std::size_t group{ static_cast<std::size_t>( hash >> constants::FLAT_MAP_TAG_BITS ) & groupMask };
+			for ( std::size_t step{ 1 };; ++step )
+			{
+				const std::size_t first{ group * constants::FLAT_MAP_GROUP_SIZE };
+				const std::uint32_t free{ internal::matchFree( m_control.data() + first ) };
+				if ( free != 0 )
+				{
+					const std::size_t index{ first + static_cast<std::size_t>( std::countr_zero( free ) ) };
+					m_control[index] = control[i];
+					m_slots[index].key = slots[i].key;
+					m_slots[index].value = std::move( slots[i].value );
+					break;
+				}
+
+				group = ( group + step ) & groupMask;
+			}
+		}
+
+		m_deleted = 0;
+	}
+} // namespace nfx::datatypes
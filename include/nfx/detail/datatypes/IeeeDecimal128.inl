@@ -0,0 +1,564 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file IeeeDecimal128.inl
+ * @brief Inline implementations for the IeeeDecimal128 class
+ */
+
+#include <array>
+#include <stdexcept>
+
+#include "nfx/detail/datatypes/Constants.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Densely packed decimal tables
+		//=====================================================================
+
+		/**
+		 * @brief Encode three decimal digits as a DPD declet
+		 * @param value Value to encode (0-999)
+		 * @return Canonical 10-bit declet
+		 */
+		inline constexpr std::uint16_t encodeDeclet( std::uint16_t value ) noexcept
+		{
+			const std::uint16_t hundreds{ static_cast<std::uint16_t>( value / 100U ) };
+			const std::uint16_t tens{ static_cast<std::uint16_t>( value / 10U % 10U ) };
+			const std::uint16_t units{ static_cast<std::uint16_t>( value % 10U ) };
+
+			// Digits 8 and 9 keep only their low bit; the remaining bits are rearranged
+			const std::uint16_t c{ static_cast<std::uint16_t>( hundreds & 1U ) };
+			const std::uint16_t f{ static_cast<std::uint16_t>( tens & 1U ) };
+			const std::uint16_t i{ static_cast<std::uint16_t>( units & 1U ) };
+			const std::uint16_t de{ static_cast<std::uint16_t>( ( tens >> 1 ) & 3U ) };
+			const std::uint16_t gh{ static_cast<std::uint16_t>( ( units >> 1 ) & 3U ) };
+
+			switch ( ( hundreds >= 8 ? 4U : 0U ) | ( tens >= 8 ? 2U : 0U ) | ( units >= 8 ? 1U : 0U ) )
+			{
+				case 0U:
+					return static_cast<std::uint16_t>( ( hundreds << 7 ) | ( tens << 4 ) | units );
+				case 1U:
+					return static_cast<std::uint16_t>( ( hundreds << 7 ) | ( tens << 4 ) | 0x8U | i );
+				case 2U:
+					return static_cast<std::uint16_t>( ( hundreds << 7 ) | ( gh << 5 ) | ( f << 4 ) | 0xAU | i );
+				case 4U:
+					return static_cast<std::uint16_t>( ( gh << 8 ) | ( c << 7 ) | ( tens << 4 ) | 0xCU | i );
+				case 6U:
+					return static_cast<std::uint16_t>( ( gh << 8 ) | ( c << 7 ) | ( f << 4 ) | 0xEU | i );
+				case 5U:
+					return static_cast<std::uint16_t>( ( de << 8 ) | ( c << 7 ) | 0x20U | ( f << 4 ) | 0xEU | i );
+				case 3U:
+					return static_cast<std::uint16_t>( ( hundreds << 7 ) | 0x40U | ( f << 4 ) | 0xEU | i );
+				default:
+					return static_cast<std::uint16_t>( ( c << 7 ) | 0x60U | ( f << 4 ) | 0xEU | i );
+			}
+		}
+
+		/**
+		 * @brief Decode a DPD declet to three decimal digits
+		 * @param declet 10-bit declet, canonical or not
+		 * @return Decoded value (0-999)
+		 */
+		inline constexpr std::uint16_t decodeDeclet( std::uint16_t declet ) noexcept
+		{
+			const auto bit{ [declet]( int index ) { return static_cast<std::uint16_t>( ( declet >> index ) & 1U ); } };
+			const std::uint16_t high{ static_cast<std::uint16_t>( ( declet >> 7 ) & 7U ) };
+			const std::uint16_t middle{ static_cast<std::uint16_t>( ( declet >> 4 ) & 7U ) };
+			const std::uint16_t low{ static_cast<std::uint16_t>( declet & 7U ) };
+			const std::uint16_t upperPair{ static_cast<std::uint16_t>( ( declet >> 8 ) & 3U ) };
+			const std::uint16_t middlePair{ static_cast<std::uint16_t>( ( declet >> 5 ) & 3U ) };
+
+			std::uint16_t hundreds{ high };
+			std::uint16_t tens{ middle };
+			std::uint16_t units{ low };
+			if ( bit( 3 ) != 0U )
+			{
+				const std::uint16_t largeHundreds{ static_cast<std::uint16_t>( 8U + bit( 7 ) ) };
+				const std::uint16_t largeTens{ static_cast<std::uint16_t>( 8U + bit( 4 ) ) };
+				const std::uint16_t largeUnits{ static_cast<std::uint16_t>( 8U + bit( 0 ) ) };
+				switch ( ( declet >> 1 ) & 3U )
+				{
+					case 0U:
+						units = largeUnits;
+						break;
+					case 1U:
+						tens = largeTens;
+						units = static_cast<std::uint16_t>( ( middlePair << 1 ) | bit( 0 ) );
+						break;
+					case 2U:
+						hundreds = largeHundreds;
+						units = static_cast<std::uint16_t>( ( upperPair << 1 ) | bit( 0 ) );
+						break;
+					default:
+						switch ( middlePair )
+						{
+							case 0U:
+								hundreds = largeHundreds;
+								tens = largeTens;
+								units = static_cast<std::uint16_t>( ( upperPair << 1 ) | bit( 0 ) );
+								break;
+							case 1U:
+								hundreds = largeHundreds;
+								tens = static_cast<std::uint16_t>( ( upperPair << 1 ) | bit( 4 ) );
+								units = largeUnits;
+								break;
+							case 2U:
+								tens = largeTens;
+								units = largeUnits;
+								break;
+							default:
+								hundreds = largeHundreds;
+								tens = largeTens;
+								units = largeUnits;
+								break;
+						}
+						break;
+				}
+			}
+
+			return static_cast<std::uint16_t>( hundreds * 100U + tens * 10U + units );
+		}
+
+		/** @brief Declet for every value 0-999 */
+		inline constexpr std::array<std::uint16_t, 1000> DPD_ENCODE_TABLE{ [] {
+			std::array<std::uint16_t, 1000> table{};
+			for ( std::uint16_t value{ 0 }; value < table.size(); ++value )
+			{
+				table[value] = encodeDeclet( value );
+			}
+
+			return table;
+		}() };
+
+		/** @brief Value 0-999 for every 10-bit declet */
+		inline constexpr std::array<std::uint16_t, 1024> DPD_DECODE_TABLE{ [] {
+			std::array<std::uint16_t, 1024> table{};
+			for ( std::uint16_t declet{ 0 }; declet < table.size(); ++declet )
+			{
+				table[declet] = decodeDeclet( declet );
+			}
+
+			return table;
+		}() };
+
+		//=====================================================================
+		// IeeeDecimal128 helpers
+		//=====================================================================
+
+		/**
+		 * @brief Divide a 96-bit mantissa in place by a 32-bit divisor
+		 * @param limbs Little-endian 32-bit limbs
+		 * @param divisor Non-zero divisor
+		 * @return Remainder of the division
+		 */
+		inline constexpr std::uint32_t divideMantissa( std::array<std::uint32_t, 3>& limbs, std::uint32_t divisor ) noexcept
+		{
+			std::uint64_t remainder{ 0 };
+			for ( std::size_t i{ limbs.size() }; i-- > 0; )
+			{
+				const std::uint64_t current{ ( remainder << constants::BITS_PER_UINT32 ) | limbs[i] };
+				limbs[i] = static_cast<std::uint32_t>( current / divisor );
+				remainder = current % divisor;
+			}
+
+			return static_cast<std::uint32_t>( remainder );
+		}
+
+		/**
+		 * @brief Extract one declet from the DPD coefficient continuation
+		 * @param high Bits 64-127
+		 * @param low Bits 0-63
+		 * @param index Declet index (0 = least significant)
+		 * @return 10-bit declet
+		 */
+		inline constexpr std::uint16_t extractDeclet( std::uint64_t high, std::uint64_t low, std::size_t index ) noexcept
+		{
+			const std::size_t position{ index * constants::DECIMAL128_DECLET_BITS };
+			std::uint64_t bits{ 0 };
+			if ( position >= constants::BITS_PER_UINT64 )
+			{
+				bits = high >> ( position - constants::BITS_PER_UINT64 );
+			}
+			else
+			{
+				bits = low >> position;
+				if ( position + constants::DECIMAL128_DECLET_BITS > constants::BITS_PER_UINT64 )
+				{
+					bits |= high << ( constants::BITS_PER_UINT64 - position );
+				}
+			}
+
+			return static_cast<std::uint16_t>( bits & constants::DECIMAL128_DECLET_MASK );
+		}
+
+		/**
+		 * @brief Build a Decimal from a decimal128 coefficient and exponent
+		 * @param coefficientLow Coefficient bits 0-63
+		 * @param coefficientHigh Coefficient bits 64-127 (coefficient below 10^34)
+		 * @param exponent Unbiased exponent
+		 * @param negative Sign of the value
+		 * @param result Receives the Decimal (unchanged on failure)
+		 * @return true if the value fits in Decimal after half-even rounding of fractional digits
+		 */
+		inline constexpr bool coefficientToDecimal( std::uint64_t coefficientLow, std::uint64_t coefficientHigh,
+			std::int32_t exponent, bool negative, Decimal& result ) noexcept
+		{
+			UInt256 magnitude{ coefficientLow, coefficientHigh };
+			std::uint8_t scale{ 0 };
+			if ( exponent <= 0 && exponent >= -constants::DECIMAL_MAXIMUM_PLACES && ( coefficientHigh >> constants::BITS_PER_UINT32 ) == 0 )
+			{
+				// Fast path: every value produced from a Decimal lands here
+				scale = static_cast<std::uint8_t>( -exponent );
+			}
+			else if ( exponent > 0 )
+			{
+				if ( !magnitude.isZero() )
+				{
+					if ( exponent > constants::DECIMAL_MAXIMUM_PLACES )
+					{
+						return false;
+					}
+
+					magnitude = multiplyByPowerOf10Wide( magnitude, static_cast<std::uint8_t>( exponent ) );
+					if ( !magnitude.fitsIn( 96 ) )
+					{
+						return false;
+					}
+				}
+			}
+			else
+			{
+				// Drop the fewest fractional digits that bring the mantissa within 96 bits,
+				// rounding from the exact coefficient each time to avoid double rounding
+				const std::int32_t fractionalDigits{ -exponent };
+				std::int32_t power{ fractionalDigits > constants::DECIMAL_MAXIMUM_PLACES ? fractionalDigits - constants::DECIMAL_MAXIMUM_PLACES : 0 };
+				if ( power > constants::DECIMAL128_COEFFICIENT_DIGITS )
+				{
+					magnitude = UInt256{};
+				}
+				else
+				{
+					const UInt256 coefficient{ magnitude };
+					magnitude = divideByPowerOf10RoundedWide( coefficient, static_cast<std::uint8_t>( power ) );
+					while ( !magnitude.fitsIn( 96 ) )
+					{
+						if ( power == fractionalDigits )
+						{
+							return false;
+						}
+
+						++power;
+						magnitude = divideByPowerOf10RoundedWide( coefficient, static_cast<std::uint8_t>( power ) );
+					}
+				}
+
+				scale = static_cast<std::uint8_t>( fractionalDigits - power );
+			}
+
+			auto& mantissa{ result.mantissa() };
+			mantissa[0] = static_cast<std::uint32_t>( magnitude.word( 0 ) );
+			mantissa[1] = static_cast<std::uint32_t>( magnitude.word( 0 ) >> constants::BITS_PER_UINT32 );
+			mantissa[2] = static_cast<std::uint32_t>( magnitude.word( 1 ) );
+			result.flags() = ( static_cast<std::uint32_t>( scale ) << constants::DECIMAL_SCALE_SHIFT ) |
+							 ( negative ? constants::DECIMAL_SIGN_MASK : 0U );
+
+			return true;
+		}
+
+		/**
+		 * @brief Decode finite decimal128 bits to a Decimal
+		 * @param high Bits 64-127
+		 * @param low Bits 0-63
+		 * @param encoding Coefficient encoding of the bits
+		 * @param result Receives the Decimal (unchanged on failure)
+		 * @return true if the value is finite and fits in Decimal
+		 */
+		inline constexpr bool decodeDecimal128( std::uint64_t high, std::uint64_t low, IeeeDecimal128::Encoding encoding, Decimal& result ) noexcept
+		{
+			if ( ( high & constants::DECIMAL128_SPECIAL_MASK ) == constants::DECIMAL128_SPECIAL_MASK )
+			{
+				return false;
+			}
+
+			const bool negative{ ( high & constants::DECIMAL128_SIGN_MASK ) != 0 };
+			std::int32_t biasedExponent{ 0 };
+			std::uint64_t coefficientLow{ 0 };
+			std::uint64_t coefficientHigh{ 0 };
+
+			if ( encoding == IeeeDecimal128::Encoding::Bid )
+			{
+				if ( ( high & constants::DECIMAL128_BID_LARGE_FORM_MASK ) == constants::DECIMAL128_BID_LARGE_FORM_MASK )
+				{
+					// The large form implies a coefficient of at least 2^113, which is never canonical
+					biasedExponent = static_cast<std::int32_t>( ( high >> constants::DECIMAL128_BID_LARGE_EXPONENT_SHIFT ) & constants::DECIMAL128_BID_EXPONENT_MASK );
+				}
+				else
+				{
+					biasedExponent = static_cast<std::int32_t>( ( high >> constants::DECIMAL128_BID_EXPONENT_SHIFT ) & constants::DECIMAL128_BID_EXPONENT_MASK );
+					coefficientHigh = high & constants::DECIMAL128_BID_COEFFICIENT_HIGH_MASK;
+					coefficientLow = low;
+					if ( coefficientHigh > constants::DECIMAL128_MAX_COEFFICIENT_HIGH ||
+						 ( coefficientHigh == constants::DECIMAL128_MAX_COEFFICIENT_HIGH && coefficientLow > constants::DECIMAL128_MAX_COEFFICIENT_LOW ) )
+					{
+						coefficientHigh = 0;
+						coefficientLow = 0;
+					}
+				}
+			}
+			else
+			{
+				const auto combination{ static_cast<std::uint32_t>( high >> constants::DECIMAL128_DPD_COMBINATION_SHIFT ) & 0x1FU };
+				std::uint32_t exponentHigh{ combination >> 3 };
+				std::uint32_t leadingDigit{ combination & 7U };
+				if ( exponentHigh == 3U )
+				{
+					exponentHigh = ( combination >> 1 ) & 3U;
+					leadingDigit = 8U + ( combination & 1U );
+				}
+				biasedExponent = static_cast<std::int32_t>( ( exponentHigh << constants::DECIMAL128_DPD_EXPONENT_BITS ) |
+															( ( high >> constants::DECIMAL128_DPD_EXPONENT_SHIFT ) & constants::DECIMAL128_DPD_EXPONENT_MASK ) );
+
+				// Group declets into 9-digit chunks so the binary coefficient needs a single wide multiply
+				std::array<std::uint64_t, 4> chunks{};
+				for ( std::size_t chunk{ 0 }; chunk < chunks.size(); ++chunk )
+				{
+					std::uint64_t value{ 0 };
+					for ( std::size_t declet{ 3 }; declet-- > 0; )
+					{
+						const std::size_t index{ chunk * 3 + declet };
+						const std::uint64_t digits{ index < constants::DECIMAL128_DECLET_COUNT
+														? DPD_DECODE_TABLE[extractDeclet( high, low, index )]
+														: leadingDigit };
+						value = value * 1000U + digits;
+					}
+					chunks[chunk] = value;
+				}
+
+				constexpr std::uint64_t chunkBase{ constants::DECIMAL_POWERS_OF_10[9] };
+				const std::uint64_t upper{ chunks[3] * chunkBase + chunks[2] };
+				const std::uint64_t lower{ chunks[1] * chunkBase + chunks[0] };
+				const auto [productLow, productHigh]{ multiply64( upper, constants::DECIMAL_POWERS_OF_10[18] ) };
+				coefficientLow = productLow + lower;
+				coefficientHigh = productHigh + ( coefficientLow < lower ? 1U : 0U );
+			}
+
+			return coefficientToDecimal( coefficientLow, coefficientHigh, biasedExponent - constants::DECIMAL128_EXPONENT_BIAS, negative, result );
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// IeeeDecimal128 class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline constexpr IeeeDecimal128::IeeeDecimal128() noexcept
+		: m_low{ 0ULL },
+		  m_high{ 0ULL }
+	{
+	}
+
+	inline constexpr IeeeDecimal128::IeeeDecimal128( std::uint64_t high, std::uint64_t low ) noexcept
+		: m_low{ low },
+		  m_high{ high }
+	{
+	}
+
+	inline constexpr IeeeDecimal128 IeeeDecimal128::fromDecimal( const Decimal& value, Encoding encoding ) noexcept
+	{
+		const auto& mantissa{ value.mantissa() };
+		const auto biasedExponent{ static_cast<std::uint64_t>( constants::DECIMAL128_EXPONENT_BIAS - value.scale() ) };
+		const std::uint64_t sign{ value.isNegative() ? constants::DECIMAL128_SIGN_MASK : 0ULL };
+
+		if ( encoding == Encoding::Bid )
+		{
+			return IeeeDecimal128{
+				sign | ( biasedExponent << constants::DECIMAL128_BID_EXPONENT_SHIFT ) | mantissa[2],
+				( static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 ) | mantissa[0] };
+		}
+
+		// A 96-bit mantissa has at most 29 digits: three 9-digit chunks plus a top chunk below 100
+		std::array<std::uint32_t, 3> limbs{ mantissa };
+		std::array<std::uint64_t, constants::DECIMAL128_DECLET_COUNT> declets{};
+		for ( std::size_t chunk{ 0 }; chunk < 3; ++chunk )
+		{
+			std::uint32_t digits{ internal::divideMantissa( limbs, static_cast<std::uint32_t>( constants::DECIMAL_POWERS_OF_10[9] ) ) };
+			for ( std::size_t declet{ 0 }; declet < 3; ++declet )
+			{
+				declets[chunk * 3 + declet] = internal::DPD_ENCODE_TABLE[digits % 1000U];
+				digits /= 1000U;
+			}
+		}
+		declets[9] = internal::DPD_ENCODE_TABLE[limbs[0]];
+
+		std::uint64_t low{ 0 };
+		std::uint64_t high{ 0 };
+		for ( std::size_t index{ 0 }; index < declets.size(); ++index )
+		{
+			const std::size_t position{ index * constants::DECIMAL128_DECLET_BITS };
+			if ( position >= constants::BITS_PER_UINT64 )
+			{
+				high |= declets[index] << ( position - constants::BITS_PER_UINT64 );
+			}
+			else
+			{
+				low |= declets[index] << position;
+				if ( position + constants::DECIMAL128_DECLET_BITS > constants::BITS_PER_UINT64 )
+				{
+					high |= declets[index] >> ( constants::BITS_PER_UINT64 - position );
+				}
+			}
+		}
+
+		// Leading digit is zero, so the combination field only carries the two exponent MSBs
+		const std::uint64_t combination{ ( biasedExponent >> constants::DECIMAL128_DPD_EXPONENT_BITS ) << 3 };
+		high |= sign | ( combination << constants::DECIMAL128_DPD_COMBINATION_SHIFT ) |
+				( ( biasedExponent & constants::DECIMAL128_DPD_EXPONENT_MASK ) << constants::DECIMAL128_DPD_EXPONENT_SHIFT );
+
+		return IeeeDecimal128{ high, low };
+	}
+
+	//----------------------------------------------
+	// Bulk conversion
+	//----------------------------------------------
+
+	inline constexpr void IeeeDecimal128::fromDecimals( std::span<const Decimal> source, std::span<IeeeDecimal128> destination, Encoding encoding )
+	{
+		if ( destination.size() < source.size() )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		for ( std::size_t i{ 0 }; i < source.size(); ++i )
+		{
+			destination[i] = fromDecimal( source[i], encoding );
+		}
+	}
+
+	inline constexpr void IeeeDecimal128::toDecimals( std::span<const IeeeDecimal128> source, std::span<Decimal> destination, Encoding encoding )
+	{
+		if ( destination.size() < source.size() )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		for ( std::size_t i{ 0 }; i < source.size(); ++i )
+		{
+			destination[i] = source[i].toDecimal( encoding );
+		}
+	}
+
+	inline constexpr std::size_t IeeeDecimal128::tryToDecimals( std::span<const IeeeDecimal128> source, std::span<Decimal> destination, Encoding encoding ) noexcept
+	{
+		const std::size_t count{ source.size() < destination.size() ? source.size() : destination.size() };
+		for ( std::size_t i{ 0 }; i < count; ++i )
+		{
+			if ( !internal::decodeDecimal128( source[i].m_high, source[i].m_low, encoding, destination[i] ) )
+			{
+				return i;
+			}
+		}
+
+		return count;
+	}
+
+	//----------------------------------------------
+	// Type conversion
+	//----------------------------------------------
+
+	inline constexpr Decimal IeeeDecimal128::toDecimal( Encoding encoding ) const
+	{
+		if ( isNaN() || isInfinite() )
+		{
+			throw std::invalid_argument{ "decimal128 value is not finite" };
+		}
+
+		Decimal result;
+		if ( !internal::decodeDecimal128( m_high, m_low, encoding, result ) )
+		{
+			throw std::overflow_error{ "Decimal overflow" };
+		}
+
+		return result;
+	}
+
+	inline constexpr bool IeeeDecimal128::tryToDecimal( Encoding encoding, Decimal& result ) const noexcept
+	{
+		return internal::decodeDecimal128( m_high, m_low, encoding, result );
+	}
+
+	//----------------------------------------------
+	// Property accessors
+	//----------------------------------------------
+
+	inline constexpr std::uint64_t IeeeDecimal128::highBits() const noexcept
+	{
+		return m_high;
+	}
+
+	inline constexpr std::uint64_t IeeeDecimal128::lowBits() const noexcept
+	{
+		return m_low;
+	}
+
+	//----------------------------------------------
+	// State checking
+	//----------------------------------------------
+
+	inline constexpr bool IeeeDecimal128::isNaN() const noexcept
+	{
+		return ( m_high & constants::DECIMAL128_NAN_MASK ) == constants::DECIMAL128_NAN_MASK;
+	}
+
+	inline constexpr bool IeeeDecimal128::isInfinite() const noexcept
+	{
+		return ( m_high & constants::DECIMAL128_NAN_MASK ) == constants::DECIMAL128_SPECIAL_MASK;
+	}
+
+	inline constexpr bool IeeeDecimal128::isNegative() const noexcept
+	{
+		return ( m_high & constants::DECIMAL128_SIGN_MASK ) != 0;
+	}
+
+	//----------------------------------------------
+	// Comparison operators
+	//----------------------------------------------
+
+	inline constexpr bool IeeeDecimal128::operator==( const IeeeDecimal128& other ) const noexcept
+	{
+		return m_low == other.m_low && m_high == other.m_high;
+	}
+
+	inline constexpr bool IeeeDecimal128::operator!=( const IeeeDecimal128& other ) const noexcept
+	{
+		return !( *this == other );
+	}
+} // namespace nfx::datatypes
@@ -31,6 +31,8 @@
 #include <stdexcept>
 #include <string_view>
 
+#include "nfx/detail/datatypes/Constants.h"
+
 namespace nfx::datatypes
 {
 	//=====================================================================
@@ -68,12 +70,17 @@ namespace nfx::datatypes
 	{
 	}
 
+	inline constexpr Int128::Int128( std::uint64_t low, std::uint64_t high ) noexcept
+		: m_value{ static_cast<NFX_DATATYPES_NATIVE_INT128>( high ) << constants::BITS_PER_UINT64 | low }
+	{
+	}
+
 	inline constexpr Int128::Int128( NFX_DATATYPES_NATIVE_INT128 val ) noexcept
 		: m_value{ val }
 	{
 	}
 
-	inline Int128::Int128( std::string_view str )
+	inline constexpr Int128::Int128( std::string_view str )
 	{
 		if ( !tryParse( str, *this ) )
 		{
@@ -85,7 +92,32 @@ namespace nfx::datatypes
 	// Arithmetic operations
 	//----------------------------------------------
 
-	inline Int128 Int128::operator%( const Int128& other ) const
+	inline constexpr Int128 Int128::operator+( const Int128& other ) const noexcept
+	{
+		return Int128{ m_value + other.m_value };
+	}
+
+	inline constexpr Int128 Int128::operator-( const Int128& other ) const noexcept
+	{
+		return Int128{ m_value - other.m_value };
+	}
+
+	inline constexpr Int128 Int128::operator*( const Int128& other ) const noexcept
+	{
+		return Int128{ m_value * other.m_value };
+	}
+
+	inline constexpr Int128 Int128::operator/( const Int128& other ) const
+	{
+		if ( other.m_value == 0 )
+		{
+			throw std::overflow_error{ "Division by zero" };
+		}
+
+		return Int128{ m_value / other.m_value };
+	}
+
+	inline constexpr Int128 Int128::operator%( const Int128& other ) const
 	{
 		if ( other.m_value == 0 )
 		{
@@ -95,7 +127,7 @@ namespace nfx::datatypes
 		return Int128{ m_value % other.m_value };
 	}
 
-	inline Int128 Int128::operator-() const noexcept
+	inline constexpr Int128 Int128::operator-() const noexcept
 	{
 		return Int128{ -m_value };
 	}
@@ -104,32 +136,32 @@ namespace nfx::datatypes
 	// Comparison operations
 	//----------------------------------------------
 
-	inline bool Int128::operator==( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator==( const Int128& other ) const noexcept
 	{
 		return m_value == other.m_value;
 	}
 
-	inline bool Int128::operator!=( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator!=( const Int128& other ) const noexcept
 	{
 		return m_value != other.m_value;
 	}
 
-	inline bool Int128::operator<( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator<( const Int128& other ) const noexcept
 	{
 		return m_value < other.m_value;
 	}
 
-	inline bool Int128::operator<=( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator<=( const Int128& other ) const noexcept
 	{
 		return m_value <= other.m_value;
 	}
 
-	inline bool Int128::operator>( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator>( const Int128& other ) const noexcept
 	{
 		return m_value > other.m_value;
 	}
 
-	inline bool Int128::operator>=( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator>=( const Int128& other ) const noexcept
 	{
 		return m_value >= other.m_value;
 	}
@@ -138,92 +170,92 @@ namespace nfx::datatypes
 	// Comparison with built-in integer types
 	//----------------------------------------------
 
-	inline bool Int128::operator==( int val ) const noexcept
+	inline constexpr bool Int128::operator==( int val ) const noexcept
 	{
 		return m_value == val;
 	}
 
-	inline bool Int128::operator!=( int val ) const noexcept
+	inline constexpr bool Int128::operator!=( int val ) const noexcept
 	{
 		return m_value != val;
 	}
 
-	inline bool Int128::operator<( int val ) const noexcept
+	inline constexpr bool Int128::operator<( int val ) const noexcept
 	{
 		return m_value < val;
 	}
 
-	inline bool Int128::operator<=( int val ) const noexcept
+	inline constexpr bool Int128::operator<=( int val ) const noexcept
 	{
 		return m_value <= val;
 	}
 
-	inline bool Int128::operator>( int val ) const noexcept
+	inline constexpr bool Int128::operator>( int val ) const noexcept
 	{
 		return m_value > val;
 	}
 
-	inline bool Int128::operator>=( int val ) const noexcept
+	inline constexpr bool Int128::operator>=( int val ) const noexcept
 	{
 		return m_value >= val;
 	}
 
-	inline bool Int128::operator==( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator==( std::int64_t val ) const noexcept
 	{
 		return m_value == val;
 	}
 
-	inline bool Int128::operator!=( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator!=( std::int64_t val ) const noexcept
 	{
 		return m_value != val;
 	}
 
-	inline bool Int128::operator<( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator<( std::int64_t val ) const noexcept
 	{
 		return m_value < val;
 	}
 
-	inline bool Int128::operator<=( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator<=( std::int64_t val ) const noexcept
 	{
 		return m_value <= val;
 	}
 
-	inline bool Int128::operator>( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator>( std::int64_t val ) const noexcept
 	{
 		return m_value > val;
 	}
 
-	inline bool Int128::operator>=( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator>=( std::int64_t val ) const noexcept
 	{
 		return m_value >= val;
 	}
 
-	inline bool Int128::operator==( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator==( std::uint64_t val ) const noexcept
 	{
 		return m_value >= 0 && static_cast<std::uint64_t>( m_value ) == val;
 	}
 
-	inline bool Int128::operator!=( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator!=( std::uint64_t val ) const noexcept
 	{
 		return m_value < 0 || static_cast<std::uint64_t>( m_value ) != val;
 	}
 
-	inline bool Int128::operator<( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator<( std::uint64_t val ) const noexcept
 	{
 		return m_value < 0 || static_cast<std::uint64_t>( m_value ) < val;
 	}
 
-	inline bool Int128::operator<=( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator<=( std::uint64_t val ) const noexcept
 	{
 		return m_value < 0 || static_cast<std::uint64_t>( m_value ) <= val;
 	}
 
-	inline bool Int128::operator>( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator>( std::uint64_t val ) const noexcept
 	{
 		return m_value >= 0 && static_cast<std::uint64_t>( m_value ) > val;
 	}
 
-	inline bool Int128::operator>=( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator>=( std::uint64_t val ) const noexcept
 	{
 		return m_value >= 0 && static_cast<std::uint64_t>( m_value ) >= val;
 	}
@@ -281,12 +313,12 @@ namespace nfx::datatypes
 	// State checking
 	//----------------------------------------------
 
-	inline bool Int128::isZero() const noexcept
+	inline constexpr bool Int128::isZero() const noexcept
 	{
 		return m_value == 0;
 	}
 
-	inline bool Int128::isNegative() const noexcept
+	inline constexpr bool Int128::isNegative() const noexcept
 	{
 		return m_value < 0;
 	}
@@ -295,7 +327,7 @@ namespace nfx::datatypes
 	// Mathematical operations
 	//----------------------------------------------
 
-	inline Int128 Int128::abs() const noexcept
+	inline constexpr Int128 Int128::abs() const noexcept
 	{
 		return Int128{ m_value < 0
 						   ? -m_value
@@ -337,7 +369,12 @@ namespace nfx::datatypes
 	{
 	}
 
-	inline Int128::Int128( std::string_view str )
+	inline constexpr Int128::Int128( std::uint64_t low, std::uint64_t high ) noexcept
+		: m_layout{ low, high }
+	{
+	}
+
+	inline constexpr Int128::Int128( std::string_view str )
 	{
 		if ( !tryParse( str, *this ) )
 		{
@@ -377,25 +414,25 @@ namespace nfx::datatypes
 
 #if NFX_DATATYPES_HAS_NATIVE_INT128
 
-	inline Int128& Int128::operator+=( const Int128& other ) noexcept
+	inline constexpr Int128& Int128::operator+=( const Int128& other ) noexcept
 	{
 		m_value += other.m_value;
 		return *this;
 	}
 
-	inline Int128& Int128::operator-=( const Int128& other ) noexcept
+	inline constexpr Int128& Int128::operator-=( const Int128& other ) noexcept
 	{
 		m_value -= other.m_value;
 		return *this;
 	}
 
-	inline Int128& Int128::operator*=( const Int128& other ) noexcept
+	inline constexpr Int128& Int128::operator*=( const Int128& other ) noexcept
 	{
 		m_value *= other.m_value;
 		return *this;
 	}
 
-	inline Int128& Int128::operator/=( const Int128& other )
+	inline constexpr Int128& Int128::operator/=( const Int128& other )
 	{
 		if ( other.m_value == 0 )
 		{
@@ -405,7 +442,7 @@ namespace nfx::datatypes
 		return *this;
 	}
 
-	inline Int128& Int128::operator%=( const Int128& other )
+	inline constexpr Int128& Int128::operator%=( const Int128& other )
 	{
 		if ( other.m_value == 0 )
 		{
@@ -415,31 +452,31 @@ namespace nfx::datatypes
 		return *this;
 	}
 #else
-	inline Int128& Int128::operator+=( const Int128& other ) noexcept
+	inline constexpr Int128& Int128::operator+=( const Int128& other ) noexcept
 	{
 		*this = *this + other;
 		return *this;
 	}
 
-	inline Int128& Int128::operator-=( const Int128& other ) noexcept
+	inline constexpr Int128& Int128::operator-=( const Int128& other ) noexcept
 	{
 		*this = *this - other;
 		return *this;
 	}
 
-	inline Int128& Int128::operator*=( const Int128& other ) noexcept
+	inline constexpr Int128& Int128::operator*=( const Int128& other ) noexcept
 	{
 		*this = *this * other;
 		return *this;
 	}
 
-	inline Int128& Int128::operator/=( const Int128& other )
+	inline constexpr Int128& Int128::operator/=( const Int128& other )
 	{
 		*this = *this / other; // Division operator handles zero check
 		return *this;
 	}
 
-	inline Int128& Int128::operator%=( const Int128& other )
+	inline constexpr Int128& Int128::operator%=( const Int128& other )
 	{
 		if ( other.isZero() )
 		{
@@ -449,7 +486,182 @@ namespace nfx::datatypes
 		return *this;
 	}
 
-	inline Int128 Int128::operator%( const Int128& other ) const
+	inline constexpr Int128 Int128::operator+( const Int128& other ) const noexcept
+	{
+		// 128-bit addition with carry propagation
+		std::uint64_t result_low{ m_layout.lower64bits + other.m_layout.lower64bits };
+		std::uint64_t carry{ ( result_low < m_layout.lower64bits ) ? constants::BIT_MASK_ONE : constants::BIT_MASK_ZERO };
+		std::uint64_t result_high{ m_layout.upper64bits + other.m_layout.upper64bits + carry };
+		return Int128{ result_low, result_high };
+	}
+
+	inline constexpr Int128 Int128::operator-( const Int128& other ) const noexcept
+	{
+		// 128-bit subtraction with borrow propagation
+		std::uint64_t result_low{ m_layout.lower64bits - other.m_layout.lower64bits };
+		std::uint64_t borrow{ ( m_layout.lower64bits < other.m_layout.lower64bits ) ? constants::BIT_MASK_ONE : constants::BIT_MASK_ZERO };
+		std::uint64_t result_high{ m_layout.upper64bits - other.m_layout.upper64bits - borrow };
+		return Int128{ result_low, result_high };
+	}
+
+	inline constexpr Int128 Int128::operator*( const Int128& other ) const noexcept
+	{
+		// 128-bit multiplication using Karatsuba-style algorithm (https://en.wikipedia.org/wiki/Karatsuba_algorithm)
+		// Performance: Breaks 64x64 multiplication into 32x32 operations
+		// to leverage hardware multipliers efficiently on all platforms
+		std::uint64_t a_low{ m_layout.lower64bits & constants::UINT32_MAX_VALUE };
+		std::uint64_t a_high{ m_layout.lower64bits >> constants::BITS_PER_UINT32 };
+		std::uint64_t b_low{ other.m_layout.lower64bits & constants::UINT32_MAX_VALUE };
+		std::uint64_t b_high{ other.m_layout.lower64bits >> constants::BITS_PER_UINT32 }; // Four 32x32->64 multiplications
+		std::uint64_t p0{ a_low * b_low };
+		std::uint64_t p1{ a_low * b_high };
+		std::uint64_t p2{ a_high * b_low };
+		std::uint64_t p3{ a_high * b_high };
+
+		// Carry computation for intermediate sum
+		std::uint64_t carry{
+			( ( p0 >> constants::BITS_PER_UINT32 ) +
+				( p1 & constants::UINT32_MAX_VALUE ) +
+				( p2 & constants::UINT32_MAX_VALUE ) ) >>
+			constants::BITS_PER_UINT32 }; // Final result assembly
+
+		std::uint64_t result_low{
+			p0 +
+			( p1 << constants::BITS_PER_UINT32 ) +
+			( p2 << constants::BITS_PER_UINT32 ) };
+
+		std::uint64_t result_high{
+			p3 +
+			( p1 >> constants::BITS_PER_UINT32 ) +
+			( p2 >> constants::BITS_PER_UINT32 ) +
+			carry +
+			m_layout.upper64bits * other.m_layout.lower64bits +
+			m_layout.lower64bits * other.m_layout.upper64bits };
+
+		return Int128{ result_low, result_high };
+	}
+
+	inline constexpr Int128 Int128::operator/( const Int128& other ) const
+	{
+		if ( other.isZero() )
+		{
+			throw std::overflow_error{ "Division by zero" };
+		}
+
+		// Performance optimization: Fast path for 64-bit values
+		// Avoids expensive 128-bit division when possible
+		if ( m_layout.upper64bits == 0 && other.m_layout.upper64bits == 0 )
+		{
+			// Both fit in 64-bit - use native division
+			return Int128{ m_layout.lower64bits / other.m_layout.lower64bits, 0 };
+		}
+
+		// Optimized path: dividend is 128-bit but divisor fits in 64-bit
+		// Use precise 128/64 division algorithm
+		if ( other.m_layout.upper64bits == 0 && !isNegative() )
+		{
+			std::uint64_t divisor{ other.m_layout.lower64bits };
+
+			// Divide high part first
+			std::uint64_t high_quotient{ m_layout.upper64bits / divisor };
+			std::uint64_t high_remainder{ m_layout.upper64bits % divisor };
+
+			// Now divide (high_remainder << 64 + m_layout.lower64bits) by divisor
+			// This is equivalent to dividing a 128-bit number by a 64-bit number
+			if ( high_remainder == 0 )
+			{
+				// Simple case: high part divides evenly
+				std::uint64_t low_quotient{ m_layout.lower64bits / divisor };
+				return Int128{ low_quotient, high_quotient };
+			}
+			else
+			{
+				// Complex case: use long division for the remainder
+				// We need to compute (high_remainder * 2^64 + m_layout.lower64bits) / divisor
+
+				// Split the lower 64 bits into two 32-bit parts for easier handling
+				std::uint64_t low_high{ m_layout.lower64bits >> constants::BITS_PER_UINT32 };
+				std::uint64_t low_low{ m_layout.lower64bits & constants::UINT32_MAX_VALUE }; // Divide (high_remainder << 32 + low_high) by divisor
+				std::uint64_t temp_dividend{ ( high_remainder << constants::BITS_PER_UINT32 ) + low_high };
+				std::uint64_t temp_quotient{ temp_dividend / divisor };
+				std::uint64_t temp_remainder{ temp_dividend % divisor };
+
+				// Divide (temp_remainder << 32 + low_low) by divisor
+				std::uint64_t final_dividend{ ( temp_remainder << constants::BITS_PER_UINT32 ) + low_low };
+				std::uint64_t final_quotient{ final_dividend / divisor };
+
+				// Combine the quotients */
+				std::uint64_t low_quotient{ ( temp_quotient << constants::BITS_PER_UINT32 ) + final_quotient };
+				return Int128{ low_quotient, high_quotient };
+			}
+		}
+
+		// General case: 128-bit / 128-bit division using binary long division
+		// This handles all cases where both operands require the full 128-bit range
+
+		// Handle sign for signed division
+		const bool result_negative{ isNegative() != other.isNegative() };
+
+		// Magnitudes are compared as unsigned words: negating the minimum gives 2^127,
+		// which only reads correctly unsigned, and the shifted remainder can reach 2^128 - 1
+		const Int128 abs_dividend{ isNegative() ? -*this : *this };
+		const Int128 abs_divisor{ other.isNegative() ? -other : other };
+
+		constexpr auto unsignedLess{ []( const Int128& left, const Int128& right ) noexcept {
+			return left.m_layout.upper64bits < right.m_layout.upper64bits ||
+				   ( left.m_layout.upper64bits == right.m_layout.upper64bits && left.m_layout.lower64bits < right.m_layout.lower64bits );
+		} };
+
+		// Early exit for simple cases
+		if ( unsignedLess( abs_dividend, abs_divisor ) )
+		{
+			return Int128{ 0, 0 };
+		}
+
+		if ( abs_dividend == abs_divisor )
+		{
+			return result_negative ? Int128{ 0, 0 } - Int128{ 1, 0 } : Int128{ 1, 0 };
+		}
+
+		// Binary long division algorithm
+		Int128 quotient{ 0, 0 };
+		Int128 remainder{ 0, 0 };
+
+		// Process bits from most significant to least significant
+		for ( int i{ constants::INT_128_MAX_BIT_INDEX }; i >= 0; --i )
+		{
+			// Shift remainder left by 1
+			remainder = remainder + remainder; // equivalent to << 1
+
+			// Set the least significant bit of remainder to the i-th bit of dividend
+			if ( ( i >= constants::BITS_PER_UINT64 &&
+					 ( ( abs_dividend.m_layout.upper64bits >> ( i - constants::BITS_PER_UINT64 ) ) & 1 ) ) ||
+				 ( i < constants::BITS_PER_UINT64 &&
+					 ( ( abs_dividend.m_layout.lower64bits >> i ) & 1 ) ) )
+			{
+				remainder = remainder + Int128{ 1, 0 };
+			}
+
+			// If remainder >= divisor, subtract divisor and set quotient bit
+			if ( !unsignedLess( remainder, abs_divisor ) )
+			{
+				remainder = remainder - abs_divisor;
+
+				// Set the i-th bit of quotient
+				if ( i >= constants::BITS_PER_UINT64 )
+				{
+					quotient.m_layout.upper64bits |= ( constants::BIT_MASK_ONE << ( i - constants::BITS_PER_UINT64 ) );
+				}
+				else
+				{
+					quotient.m_layout.lower64bits |= ( constants::BIT_MASK_ONE << i );
+				}
+			}
+		}
+		return result_negative ? Int128{ 0, 0 } - quotient : quotient;
+	}
+
+	inline constexpr Int128 Int128::operator%( const Int128& other ) const
 	{
 		if ( other.isZero() )
 		{
@@ -468,7 +680,7 @@ namespace nfx::datatypes
 		return *this - ( quotient * other );
 	}
 
-	inline Int128 Int128::operator-() const noexcept
+	inline constexpr Int128 Int128::operator-() const noexcept
 	{
 		// Two's complement negation
 		Int128 result{ Int128{ ~m_layout.lower64bits, ~m_layout.upper64bits } };
@@ -480,17 +692,17 @@ namespace nfx::datatypes
 	// Comparison operations
 	//----------------------------------------------
 
-	inline bool Int128::operator==( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator==( const Int128& other ) const noexcept
 	{
 		return m_layout.lower64bits == other.m_layout.lower64bits && m_layout.upper64bits == other.m_layout.upper64bits;
 	}
 
-	inline bool Int128::operator!=( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator!=( const Int128& other ) const noexcept
 	{
 		return m_layout.lower64bits != other.m_layout.lower64bits || m_layout.upper64bits != other.m_layout.upper64bits;
 	}
 
-	inline bool Int128::operator<( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator<( const Int128& other ) const noexcept
 	{
 		if ( m_layout.upper64bits != other.m_layout.upper64bits )
 		{
@@ -499,7 +711,7 @@ namespace nfx::datatypes
 		return m_layout.lower64bits < other.m_layout.lower64bits;
 	}
 
-	inline bool Int128::operator<=( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator<=( const Int128& other ) const noexcept
 	{
 		if ( m_layout.upper64bits != other.m_layout.upper64bits )
 		{
@@ -508,7 +720,7 @@ namespace nfx::datatypes
 		return m_layout.lower64bits <= other.m_layout.lower64bits;
 	}
 
-	inline bool Int128::operator>( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator>( const Int128& other ) const noexcept
 	{
 		if ( m_layout.upper64bits != other.m_layout.upper64bits )
 		{
@@ -517,7 +729,7 @@ namespace nfx::datatypes
 		return m_layout.lower64bits > other.m_layout.lower64bits;
 	}
 
-	inline bool Int128::operator>=( const Int128& other ) const noexcept
+	inline constexpr bool Int128::operator>=( const Int128& other ) const noexcept
 	{
 		if ( m_layout.upper64bits != other.m_layout.upper64bits )
 		{
@@ -530,37 +742,37 @@ namespace nfx::datatypes
 	// Comparison with built-in integer types
 	//----------------------------------------------
 
-	inline bool Int128::operator==( int val ) const noexcept
+	inline constexpr bool Int128::operator==( int val ) const noexcept
 	{
 		return *this == static_cast<std::int64_t>( val );
 	}
 
-	inline bool Int128::operator!=( int val ) const noexcept
+	inline constexpr bool Int128::operator!=( int val ) const noexcept
 	{
 		return *this != static_cast<std::int64_t>( val );
 	}
 
-	inline bool Int128::operator<( int val ) const noexcept
+	inline constexpr bool Int128::operator<( int val ) const noexcept
 	{
 		return *this < static_cast<std::int64_t>( val );
 	}
 
-	inline bool Int128::operator<=( int val ) const noexcept
+	inline constexpr bool Int128::operator<=( int val ) const noexcept
 	{
 		return *this <= static_cast<std::int64_t>( val );
 	}
 
-	inline bool Int128::operator>( int val ) const noexcept
+	inline constexpr bool Int128::operator>( int val ) const noexcept
 	{
 		return *this > static_cast<std::int64_t>( val );
 	}
 
-	inline bool Int128::operator>=( int val ) const noexcept
+	inline constexpr bool Int128::operator>=( int val ) const noexcept
 	{
 		return *this >= static_cast<std::int64_t>( val );
 	}
 
-	inline bool Int128::operator==( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator==( std::int64_t val ) const noexcept
 	{
 		// For negative values, upper64bits should be all 1s (sign extension)
 		// For positive values, upper64bits should be 0
@@ -570,43 +782,43 @@ namespace nfx::datatypes
 			   m_layout.lower64bits == static_cast<std::uint64_t>( val );
 	}
 
-	inline bool Int128::operator!=( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator!=( std::int64_t val ) const noexcept
 	{
 		return !( *this == val );
 	}
 
-	inline bool Int128::operator<( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator<( std::int64_t val ) const noexcept
 	{
 		return *this < Int128{ val };
 	}
 
-	inline bool Int128::operator<=( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator<=( std::int64_t val ) const noexcept
 	{
 		return *this <= Int128{ val };
 	}
 
-	inline bool Int128::operator>( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator>( std::int64_t val ) const noexcept
 	{
 		return *this > Int128{ val };
 	}
 
-	inline bool Int128::operator>=( std::int64_t val ) const noexcept
+	inline constexpr bool Int128::operator>=( std::int64_t val ) const noexcept
 	{
 		return *this >= Int128{ val };
 	}
 
-	inline bool Int128::operator==( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator==( std::uint64_t val ) const noexcept
 	{
 		// For unsigned comparison, this Int128 must be non-negative
 		return m_layout.upper64bits == 0 && m_layout.lower64bits == val;
 	}
 
-	inline bool Int128::operator!=( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator!=( std::uint64_t val ) const noexcept
 	{
 		return !( *this == val );
 	}
 
-	inline bool Int128::operator<( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator<( std::uint64_t val ) const noexcept
 	{
 		// If this is negative, it's always less than any positive uint64_t
 		if ( isNegative() )
@@ -624,7 +836,7 @@ namespace nfx::datatypes
 		return m_layout.lower64bits < val;
 	}
 
-	inline bool Int128::operator<=( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator<=( std::uint64_t val ) const noexcept
 	{
 		// If this is negative, it's always less than any positive uint64_t
 		if ( isNegative() )
@@ -642,7 +854,7 @@ namespace nfx::datatypes
 		return m_layout.lower64bits <= val;
 	}
 
-	inline bool Int128::operator>( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator>( std::uint64_t val ) const noexcept
 	{
 		// If this is negative, it's never greater than any positive uint64_t
 		if ( isNegative() )
@@ -660,7 +872,7 @@ namespace nfx::datatypes
 		return m_layout.lower64bits > val;
 	}
 
-	inline bool Int128::operator>=( std::uint64_t val ) const noexcept
+	inline constexpr bool Int128::operator>=( std::uint64_t val ) const noexcept
 	{
 		// If this is negative, it's never greater than or equal to any positive uint64_t
 		if ( isNegative() )
@@ -730,12 +942,12 @@ namespace nfx::datatypes
 	// State checking
 	//----------------------------------------------
 
-	inline bool Int128::isZero() const noexcept
+	inline constexpr bool Int128::isZero() const noexcept
 	{
 		return m_layout.lower64bits == 0 && m_layout.upper64bits == 0;
 	}
 
-	inline bool Int128::isNegative() const noexcept
+	inline constexpr bool Int128::isNegative() const noexcept
 	{
 		return static_cast<std::int64_t>( m_layout.upper64bits ) < 0;
 	}
@@ -744,7 +956,7 @@ namespace nfx::datatypes
 	// Mathematical operations
 	//----------------------------------------------
 
-	inline Int128 Int128::abs() const noexcept
+	inline constexpr Int128 Int128::abs() const noexcept
 	{
 		if ( !isNegative() )
 		{
@@ -753,4 +965,340 @@ namespace nfx::datatypes
 		return -*this;
 	}
 #endif
+
+	//----------------------------------------------
+	// Non-throwing arithmetic
+	//----------------------------------------------
+
+	namespace internal
+	{
+		/**
+		 * @brief Saturated result for an out-of-range Int128 operation
+		 * @param negative true if the exact result is negative
+		 * @return Minimum value if negative, otherwise maximum value
+		 */
+		inline constexpr Int128 saturatedInt128( bool negative ) noexcept
+		{
+			return negative ? Int128{ constants::INT_128_MIN_NEGATIVE_LOW, constants::INT_128_MIN_NEGATIVE_HIGH }
+							: Int128{ constants::INT_128_MAX_POSITIVE_LOW, constants::INT_128_MAX_POSITIVE_HIGH };
+		}
+	} // namespace internal
+
+	inline constexpr Int128 Int128::add( const Int128& left, const Int128& right, ArithmeticStatus& status ) noexcept
+	{
+		// Word-wise addition wraps modulo 2^128 on both representations
+		const std::uint64_t low{ left.toLow() + right.toLow() };
+		const std::uint64_t high{ left.toHigh() + right.toHigh() + ( low < left.toLow() ? 1U : 0U ) };
+		const Int128 result{ low, high };
+
+		if ( left.isNegative() == right.isNegative() && result.isNegative() != left.isNegative() )
+		{
+			status |= ArithmeticStatus::Overflow;
+			return internal::saturatedInt128( left.isNegative() );
+		}
+
+		return result;
+	}
+
+	inline constexpr Int128 Int128::subtract( const Int128& left, const Int128& right, ArithmeticStatus& status ) noexcept
+	{
+		const std::uint64_t low{ left.toLow() - right.toLow() };
+		const std::uint64_t high{ left.toHigh() - right.toHigh() - ( left.toLow() < right.toLow() ? 1U : 0U ) };
+		const Int128 result{ low, high };
+
+		if ( left.isNegative() != right.isNegative() && result.isNegative() != left.isNegative() )
+		{
+			status |= ArithmeticStatus::Overflow;
+			return internal::saturatedInt128( left.isNegative() );
+		}
+
+		return result;
+	}
+
+	inline constexpr Int128 Int128::multiply( const Int128& left, const Int128& right, ArithmeticStatus& status ) noexcept
+	{
+		const bool negative{ left.isNegative() != right.isNegative() };
+
+#if NFX_DATATYPES_HAS_NATIVE_INT128
+		NFX_DATATYPES_NATIVE_INT128 product{ 0 };
+		if ( __builtin_mul_overflow( left.toNative(), right.toNative(), &product ) )
+		{
+			status |= ArithmeticStatus::Overflow;
+			return internal::saturatedInt128( negative );
+		}
+
+		return Int128{ product };
+#else
+		if ( left.isZero() || right.isZero() )
+		{
+			return Int128{};
+		}
+
+		// Multiply the magnitudes as unsigned words (negating the minimum gives 2^127, exact
+		// when read unsigned); a product below 2^128 needs one factor under 2^64
+		const Int128 leftMagnitude{ left.isNegative() ? -left : left };
+		const Int128 rightMagnitude{ right.isNegative() ? -right : right };
+		if ( leftMagnitude.toHigh() != 0 && rightMagnitude.toHigh() != 0 )
+		{
+			status |= ArithmeticStatus::Overflow;
+			return internal::saturatedInt128( negative );
+		}
+
+		const Int128& wide{ leftMagnitude.toHigh() != 0 ? leftMagnitude : rightMagnitude };
+		const std::uint64_t narrow{ leftMagnitude.toHigh() != 0 ? rightMagnitude.toLow() : leftMagnitude.toLow() };
+
+		// 64x64 partial products are exact in 128 bits
+		const Int128 lowProduct{ Int128{ wide.toLow() } * Int128{ narrow } };
+		const Int128 crossProduct{ Int128{ wide.toHigh() } * Int128{ narrow } };
+		const std::uint64_t high{ lowProduct.toHigh() + crossProduct.toLow() };
+
+		// The magnitude must fit 127 bits, or be exactly 2^127 for a negative result
+		const bool wrapped{ crossProduct.toHigh() != 0 || high < lowProduct.toHigh() };
+		const bool fitsSigned{ high <= constants::INT_128_MAX_POSITIVE_HIGH ||
+							   ( negative && high == constants::INT_128_MIN_NEGATIVE_HIGH && lowProduct.toLow() == 0 ) };
+		if ( wrapped || !fitsSigned )
+		{
+			status |= ArithmeticStatus::Overflow;
+			return internal::saturatedInt128( negative );
+		}
+
+		const Int128 product{ lowProduct.toLow(), high };
+
+		return negative ? -product : product;
+#endif
+	}
+
+	inline constexpr Int128 Int128::divide( const Int128& left, const Int128& right, ArithmeticStatus& status ) noexcept
+	{
+		if ( right.isZero() )
+		{
+			status |= ArithmeticStatus::DivisionByZero;
+			return Int128{};
+		}
+
+		if ( right == Int128{ -1 } && left == Int128{ constants::INT_128_MIN_NEGATIVE_LOW, constants::INT_128_MIN_NEGATIVE_HIGH } )
+		{
+			status |= ArithmeticStatus::Overflow;
+			return internal::saturatedInt128( false );
+		}
+
+		const Int128 quotient{ left / right };
+		if ( left - quotient * right != Int128{} )
+		{
+			status |= ArithmeticStatus::Inexact;
+		}
+
+		return quotient;
+	}
+
+	inline constexpr Int128 Int128::remainder( const Int128& left, const Int128& right, ArithmeticStatus& status ) noexcept
+	{
+		if ( right.isZero() )
+		{
+			status |= ArithmeticStatus::DivisionByZero;
+			return Int128{};
+		}
+
+		// minimum % -1 is mathematically zero but traps on native division
+		if ( right == Int128{ -1 } )
+		{
+			return Int128{};
+		}
+
+		return left % right;
+	}
+
+	//----------------------------------------------
+	// String parsing
+	//----------------------------------------------
+
+	inline constexpr Int128 Int128::parse( std::string_view str )
+	{
+		Int128 result;
+		if ( !tryParse( str, result ) )
+		{
+			throw std::invalid_argument{ "Invalid Int128 string format" };
+		}
+
+		return result;
+	}
+
+	inline constexpr bool Int128::tryParse( std::string_view str, Int128& result ) noexcept
+	{
+		try
+		{
+			if ( str.empty() )
+			{
+				return false;
+			}
+
+			// Handle sign
+			bool isNegative = false;
+			size_t pos = 0;
+
+			if ( str[0] == '-' )
+			{
+				isNegative = true;
+				pos = 1;
+			}
+			else if ( str[0] == '+' )
+			{
+				pos = 1;
+			}
+
+			// Check if we have digits after sign
+			if ( pos >= str.length() )
+			{
+				return false;
+			}
+
+			// Parse digits and build the number
+			result = Int128{ 0 };
+
+			// Quick overflow check: if string is too long, it's definitely overflow
+			size_t digitCount = str.length() - pos;
+			if ( digitCount > constants::INT_128_MAX_DIGIT_COUNT )
+			{
+				return false;
+			}
+
+			// For exactly 39 digits, we need to check against max values
+			if ( digitCount == constants::INT_128_MAX_DIGIT_COUNT )
+			{
+				std::string_view digits = str.substr( pos );
+
+				if ( !isNegative )
+				{
+					// Check against max positive
+					if ( digits > constants::INT_128_MAX_POSITIVE_STRING )
+					{
+						return false;
+					}
+				}
+				else
+				{
+					// Check against max negative (absolute value)
+					if ( digits > constants::INT_128_MAX_NEGATIVE_STRING )
+					{
+						return false;
+					}
+				}
+			}
+
+			for ( size_t i = pos; i < str.length(); ++i )
+			{
+				char c{ str[i] };
+				if ( c < '0' || c > '9' )
+				{
+					return false; // Invalid character
+				}
+
+				int digit = c - '0';
+				result = result * Int128{ constants::INT_128_BASE } + Int128{ digit };
+			}
+
+			// Apply sign
+			if ( isNegative )
+			{
+				result = -result;
+			}
+
+			return true;
+		}
+		catch ( ... )
+		{
+			return false;
+		}
+	}
+
+	//----------------------------------------------
+	// Type conversion
+	//----------------------------------------------
+
+	inline constexpr std::array<std::int32_t, 4> Int128::toBits() const noexcept
+	{
+		std::array<std::int32_t, 4> bits{};
+
+		// Extract from low/high 64-bit words (works on both platforms via toLow/toHigh)
+		std::uint64_t low = toLow();
+		std::uint64_t high = toHigh();
+
+		bits[0] = static_cast<std::int32_t>( low );
+		bits[1] = static_cast<std::int32_t>( low >> constants::BITS_PER_UINT32 );
+		bits[2] = static_cast<std::int32_t>( high );
+		bits[3] = static_cast<std::int32_t>( high >> constants::BITS_PER_UINT32 );
+		return bits;
+	}
+
+	//----------------------------------------------
+	// Access operations
+	//----------------------------------------------
+
+#if NFX_DATATYPES_HAS_NATIVE_INT128
+
+	inline constexpr std::uint64_t Int128::toLow() const noexcept
+	{
+		return static_cast<std::uint64_t>( m_value );
+	}
+
+	inline constexpr std::uint64_t Int128::toHigh() const noexcept
+	{
+		return static_cast<std::uint64_t>( m_value >> constants::BITS_PER_UINT64 );
+	}
+
+	inline constexpr NFX_DATATYPES_NATIVE_INT128 Int128::toNative() const noexcept
+	{
+		return m_value;
+	}
+#else
+	inline constexpr std::uint64_t Int128::toLow() const noexcept
+	{
+		return m_layout.lower64bits;
+	}
+
+	inline constexpr std::uint64_t Int128::toHigh() const noexcept
+	{
+		return m_layout.upper64bits;
+	}
+#endif
+
+	//----------------------------------------------
+	// Hashing
+	//----------------------------------------------
+
+	namespace internal
+	{
+		/**
+		 * @brief Finalize a 64-bit hash so that every input bit affects every output bit
+		 * @param value Value to mix
+		 * @return Mixed value (a bijection; zero maps to zero)
+		 */
+		inline constexpr std::uint64_t mixHash( std::uint64_t value ) noexcept
+		{
+			value ^= value >> 33;
+			value *= constants::HASH_MIX_MULTIPLIER_1;
+			value ^= value >> 33;
+			value *= constants::HASH_MIX_MULTIPLIER_2;
+			value ^= value >> 33;
+
+			return value;
+		}
+	} // namespace internal
+
+	inline constexpr std::uint64_t Int128::hash() const noexcept
+	{
+		return internal::mixHash( toLow() ^ internal::mixHash( toHigh() ) );
+	}
+
+	//=====================================================================
+	// User-defined literals
+	//=====================================================================
+
+	namespace literals
+	{
+		consteval Int128 operator""_i128( const char* str )
+		{
+			return Int128::parse( str );
+		}
+	} // namespace literals
 } // namespace nfx::datatypes
@@ -0,0 +1,387 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file OrderedKey.inl
+ * @brief Inline implementations for the OrderedKey class
+ */
+
+#include <array>
+#include <stdexcept>
+
+#include "nfx/detail/datatypes/Constants.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Ordered key helpers
+		//=====================================================================
+
+		/**
+		 * @brief Write the significant digits of a non-zero Decimal mantissa
+		 * @param value Non-zero value
+		 * @param digits Receives the digits, most significant first, right-aligned
+		 * @return Index of the leading digit in digits
+		 */
+		inline constexpr std::size_t orderedKeyDigits( const Decimal& value, std::array<std::uint8_t, 29>& digits ) noexcept
+		{
+			const auto& mantissa{ value.mantissa() };
+			UInt256 upper{ static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 | mantissa[0], mantissa[2] };
+			std::uint64_t lower{ upper.divideBy( constants::DECIMAL_POWERS_OF_10[constants::BATCH_FORMAT_CHUNK_DIGITS] ) };
+			std::uint64_t high{ upper.word( 0 ) };
+
+			std::size_t position{ digits.size() };
+			if ( high == 0 )
+			{
+				while ( lower != 0 )
+				{
+					digits[--position] = static_cast<std::uint8_t>( lower % 10U );
+					lower /= 10U;
+				}
+
+				return position;
+			}
+
+			// The low chunk keeps its leading zeros below a non-zero high chunk
+			for ( std::size_t i{ 0 }; i < constants::BATCH_FORMAT_CHUNK_DIGITS; ++i )
+			{
+				digits[--position] = static_cast<std::uint8_t>( lower % 10U );
+				lower /= 10U;
+			}
+
+			while ( high != 0 )
+			{
+				digits[--position] = static_cast<std::uint8_t>( high % 10U );
+				high /= 10U;
+			}
+
+			return position;
+		}
+
+		/**
+		 * @brief Reject a malformed ordered key
+		 * @throws std::invalid_argument always
+		 */
+		[[noreturn]] inline void throwInvalidOrderedKey()
+		{
+			throw std::invalid_argument{ "Invalid ordered key" };
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// OrderedKey class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Int128 keys
+	//----------------------------------------------
+
+	inline constexpr OrderedKey::Int128Key OrderedKey::encode( const Int128& value ) noexcept
+	{
+		// Flipping the sign bit maps two's complement order onto unsigned byte order
+		const std::uint64_t high{ value.toHigh() ^ ( 1ULL << ( constants::BITS_PER_UINT64 - 1 ) ) };
+		const std::uint64_t low{ value.toLow() };
+
+		Int128Key key{};
+		for ( std::size_t i{ 0 }; i < 8; ++i )
+		{
+			key[i] = static_cast<std::uint8_t>( high >> ( 56 - 8 * i ) );
+			key[8 + i] = static_cast<std::uint8_t>( low >> ( 56 - 8 * i ) );
+		}
+
+		return key;
+	}
+
+	inline constexpr Int128 OrderedKey::decodeInt128( std::span<const std::uint8_t> key )
+	{
+		if ( key.size() < constants::ORDERED_KEY_INT128_SIZE )
+		{
+			internal::throwInvalidOrderedKey();
+		}
+
+		std::uint64_t high{ 0 };
+		std::uint64_t low{ 0 };
+		for ( std::size_t i{ 0 }; i < 8; ++i )
+		{
+			high = high << 8 | key[i];
+			low = low << 8 | key[8 + i];
+		}
+
+		return Int128{ low, high ^ ( 1ULL << ( constants::BITS_PER_UINT64 - 1 ) ) };
+	}
+
+	//----------------------------------------------
+	// Decimal keys
+	//----------------------------------------------
+
+	inline constexpr std::size_t OrderedKey::encodedSize( const Decimal& value ) noexcept
+	{
+		if ( value.isZero() )
+		{
+			return 1;
+		}
+
+		std::array<std::uint8_t, 29> digits{};
+		const std::size_t first{ internal::orderedKeyDigits( value, digits ) };
+		std::size_t last{ digits.size() };
+		while ( digits[last - 1] == 0 )
+		{
+			--last;
+		}
+
+		return 1 + ( last - first + 1 ) / 2;
+	}
+
+	inline constexpr std::size_t OrderedKey::encode( const Decimal& value, std::span<std::uint8_t> destination )
+	{
+		if ( value.isZero() )
+		{
+			if ( destination.empty() )
+			{
+				throw std::invalid_argument{ "Destination span is too small" };
+			}
+
+			destination[0] = constants::ORDERED_KEY_ZERO;
+
+			return 1;
+		}
+
+		std::array<std::uint8_t, 29> digits{};
+		const std::size_t first{ internal::orderedKeyDigits( value, digits ) };
+		std::size_t last{ digits.size() };
+		while ( digits[last - 1] == 0 )
+		{
+			--last;
+		}
+
+		const std::size_t digitCount{ last - first };
+		const std::size_t pairCount{ ( digitCount + 1 ) / 2 };
+		if ( destination.size() < 1 + pairCount )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		// Value is 0.d1d2...dn x 10^exponent with d1 non-zero
+		const std::int32_t exponent{ static_cast<std::int32_t>( digits.size() - first ) - static_cast<std::int32_t>( value.scale() ) };
+		const auto offset{ static_cast<std::uint8_t>( exponent - constants::ORDERED_KEY_MIN_EXPONENT ) };
+		const bool negative{ value.isNegative() };
+		const std::uint8_t flip{ negative ? std::uint8_t{ 0xFF } : std::uint8_t{ 0 } };
+
+		destination[0] = negative ? static_cast<std::uint8_t>( constants::ORDERED_KEY_ZERO - 1 - offset )
+								  : static_cast<std::uint8_t>( constants::ORDERED_KEY_ZERO + 1 + offset );
+
+		for ( std::size_t pair{ 0 }; pair < pairCount; ++pair )
+		{
+			const std::size_t index{ first + 2 * pair };
+			const std::uint32_t tens{ digits[index] };
+			const std::uint32_t units{ index + 1 < last ? digits[index + 1] : 0U };
+			const std::uint32_t more{ pair + 1 < pairCount ? 1U : 0U };
+
+			destination[1 + pair] = static_cast<std::uint8_t>( ( 2U * ( tens * 10U + units ) + more ) ^ flip );
+		}
+
+		return 1 + pairCount;
+	}
+
+	inline constexpr Decimal OrderedKey::decodeDecimal( std::span<const std::uint8_t> key, std::size_t& consumed )
+	{
+		if ( key.empty() )
+		{
+			internal::throwInvalidOrderedKey();
+		}
+
+		const std::uint8_t header{ key[0] };
+		if ( header == constants::ORDERED_KEY_ZERO )
+		{
+			consumed = 1;
+
+			return Decimal{};
+		}
+
+		const bool negative{ header < constants::ORDERED_KEY_ZERO };
+		const std::int32_t offset{ negative ? constants::ORDERED_KEY_ZERO - 1 - header : header - constants::ORDERED_KEY_ZERO - 1 };
+		if ( offset > constants::ORDERED_KEY_MAX_EXPONENT - constants::ORDERED_KEY_MIN_EXPONENT )
+		{
+			internal::throwInvalidOrderedKey();
+		}
+
+		const std::uint8_t flip{ negative ? std::uint8_t{ 0xFF } : std::uint8_t{ 0 } };
+		const std::size_t maxPairs{ constants::ORDERED_KEY_DECIMAL_MAX_SIZE - 1 };
+
+		// The first 18 digits accumulate in 64 bits, the rest in 256 bits
+		std::uint64_t head{ 0 };
+		internal::UInt256 mantissa{};
+		std::int32_t digitCount{ 0 };
+		std::size_t pair{ 0 };
+		bool more{ true };
+		while ( more )
+		{
+			if ( pair == maxPairs || 1 + pair >= key.size() )
+			{
+				internal::throwInvalidOrderedKey();
+			}
+
+			const std::uint32_t byte{ static_cast<std::uint32_t>( key[1 + pair] ^ flip ) };
+			std::uint32_t digits{ byte >> 1 };
+			more = ( byte & 1U ) != 0;
+			if ( digits >= constants::ORDERED_KEY_PAIR_BASE || ( pair == 0 && digits < 10U ) || ( !more && digits == 0 ) )
+			{
+				internal::throwInvalidOrderedKey();
+			}
+
+			// A final pair ending in 0 carries a single digit
+			std::uint32_t factor{ constants::ORDERED_KEY_PAIR_BASE };
+			if ( !more && digits % 10U == 0 )
+			{
+				digits /= 10U;
+				factor = 10U;
+			}
+
+			if ( digitCount < 18 )
+			{
+				head = head * factor + digits;
+			}
+			else
+			{
+				if ( digitCount == 18 )
+				{
+					mantissa = internal::UInt256{ head };
+				}
+				mantissa = mantissa.multiply( factor ) + internal::UInt256{ digits };
+			}
+
+			digitCount += factor == 10U ? 1 : 2;
+			++pair;
+		}
+
+		if ( digitCount <= 18 )
+		{
+			mantissa = internal::UInt256{ head };
+		}
+
+		const std::int32_t exponent{ offset + constants::ORDERED_KEY_MIN_EXPONENT };
+		std::int32_t scale{ digitCount - exponent };
+		if ( scale < 0 )
+		{
+			mantissa = internal::multiplyByPowerOf10Wide( mantissa, static_cast<std::uint8_t>( -scale ) );
+			scale = 0;
+		}
+
+		if ( scale > constants::DECIMAL_MAXIMUM_PLACES || !mantissa.fitsIn( 96 ) )
+		{
+			internal::throwInvalidOrderedKey();
+		}
+
+		Decimal result{};
+		result.mantissa()[0] = static_cast<std::uint32_t>( mantissa.word( 0 ) );
+		result.mantissa()[1] = static_cast<std::uint32_t>( mantissa.word( 0 ) >> constants::BITS_PER_UINT32 );
+		result.mantissa()[2] = static_cast<std::uint32_t>( mantissa.word( 1 ) );
+		result.flags() = static_cast<std::uint32_t>( scale ) << constants::DECIMAL_SCALE_SHIFT | ( negative ? constants::DECIMAL_SIGN_MASK : 0U );
+		consumed = 1 + pair;
+
+		return result;
+	}
+
+	inline constexpr Decimal OrderedKey::decodeDecimal( std::span<const std::uint8_t> key )
+	{
+		std::size_t consumed{ 0 };
+
+		return decodeDecimal( key, consumed );
+	}
+
+	//----------------------------------------------
+	// Batch encoding
+	//----------------------------------------------
+
+	inline constexpr void OrderedKey::encode( std::span<const Int128> values, std::span<std::uint8_t> destination )
+	{
+		if ( destination.size() / constants::ORDERED_KEY_INT128_SIZE < values.size() )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		for ( std::size_t i{ 0 }; i < values.size(); ++i )
+		{
+			const Int128Key key{ encode( values[i] ) };
+			for ( std::size_t j{ 0 }; j < key.size(); ++j )
+			{
+				destination[i * key.size() + j] = key[j];
+			}
+		}
+	}
+
+	inline constexpr void OrderedKey::decode( std::span<const std::uint8_t> keys, std::span<Int128> destination )
+	{
+		if ( keys.size() / constants::ORDERED_KEY_INT128_SIZE < destination.size() )
+		{
+			internal::throwInvalidOrderedKey();
+		}
+
+		for ( std::size_t i{ 0 }; i < destination.size(); ++i )
+		{
+			destination[i] = decodeInt128( keys.subspan( i * constants::ORDERED_KEY_INT128_SIZE ) );
+		}
+	}
+
+	inline constexpr std::size_t OrderedKey::encode( std::span<const Decimal> values, std::span<std::uint8_t> destination, std::span<std::size_t> offsets )
+	{
+		if ( !offsets.empty() && offsets.size() < values.size() + 1 )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		std::size_t written{ 0 };
+		for ( std::size_t i{ 0 }; i < values.size(); ++i )
+		{
+			if ( !offsets.empty() )
+			{
+				offsets[i] = written;
+			}
+			written += encode( values[i], destination.subspan( written ) );
+		}
+
+		if ( !offsets.empty() )
+		{
+			offsets[values.size()] = written;
+		}
+
+		return written;
+	}
+
+	inline constexpr std::size_t OrderedKey::decode( std::span<const std::uint8_t> keys, std::span<Decimal> destination )
+	{
+		std::size_t consumed{ 0 };
+		for ( Decimal& value : destination )
+		{
+			std::size_t size{ 0 };
+			value = decodeDecimal( keys.subspan( consumed ), size );
+			consumed += size;
+		}
+
+		return consumed;
+	}
+} // namespace nfx::datatypes
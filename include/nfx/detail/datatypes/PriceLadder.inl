@@ -0,0 +1,582 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file PriceLadder.inl
+ * @brief Inline implementations for the PriceGrid and PriceLadder classes
+ */
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+#include "nfx/detail/datatypes/Constants.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Price grid helpers
+		//=====================================================================
+
+		/**
+		 * @brief Express a Decimal as an integer number of 10^-scale units
+		 * @param value Value to convert
+		 * @param scale Target scale
+		 * @param units Receives value * 10^scale
+		 * @return false if value has non-zero digits beyond scale, or the units overflow 128 bits
+		 */
+		inline bool decimalUnits( const Decimal& value, std::uint8_t scale, Int128& units ) noexcept
+		{
+			const auto& mantissa{ value.mantissa() };
+			Int128 magnitude{ static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 | mantissa[0], mantissa[2] };
+
+			if ( value.scale() > scale )
+			{
+				// Extra digits must be trailing zeros
+				const std::uint8_t power{ static_cast<std::uint8_t>( value.scale() - scale ) };
+				const Int128 divisor{ power < constants::DECIMAL_POWER_TABLE_SIZE
+										  ? Int128{ constants::DECIMAL_POWERS_OF_10[power] }
+										  : Int128{ constants::DECIMAL_POWERS_OF_10[constants::DECIMAL_POWER_TABLE_SIZE - 1] } *
+												Int128{ constants::DECIMAL_POWERS_OF_10[power - constants::DECIMAL_POWER_TABLE_SIZE + 1] } };
+				if ( !( magnitude % divisor ).isZero() )
+				{
+					return false;
+				}
+				magnitude = magnitude / divisor;
+			}
+			else if ( value.scale() < scale )
+			{
+				ArithmeticStatus status{ ArithmeticStatus::None };
+				std::uint8_t power{ static_cast<std::uint8_t>( scale - value.scale() ) };
+				while ( power != 0 )
+				{
+					const std::uint8_t step{ std::min( power, static_cast<std::uint8_t>( constants::DECIMAL_POWER_TABLE_SIZE - 1 ) ) };
+					magnitude = Int128::multiply( magnitude, Int128{ constants::DECIMAL_POWERS_OF_10[step] }, status );
+					power = static_cast<std::uint8_t>( power - step );
+				}
+
+				if ( hasStatus( status, ArithmeticStatus::Overflow ) )
+				{
+					return false;
+				}
+			}
+
+			units = value.isNegative() ? -magnitude : magnitude;
+
+			return true;
+		}
+
+		/**
+		 * @brief Check if an Int128 fits in 64 signed bits
+		 * @param value Value to check
+		 * @return true if the high word is the sign extension of the low word
+		 */
+		inline constexpr bool fitsInt64( const Int128& value ) noexcept
+		{
+			return value.toHigh() == static_cast<std::uint64_t>( static_cast<std::int64_t>( value.toLow() ) >> ( constants::BITS_PER_UINT64 - 1 ) );
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// PriceGrid class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline PriceGrid::PriceGrid( const Decimal& tickSize, const Decimal& basePrice )
+		: m_tickSize{ tickSize },
+		  m_basePrice{ basePrice },
+		  m_baseUnits{},
+		  m_tickUnits{ 0 },
+		  m_scale{ std::max( tickSize.scale(), basePrice.scale() ) }
+	{
+		if ( tickSize.isZero() || tickSize.isNegative() )
+		{
+			throw std::invalid_argument{ "Tick size must be positive" };
+		}
+
+		Int128 tickUnits{};
+		if ( !internal::decimalUnits( tickSize, m_scale, tickUnits ) || !internal::fitsInt64( tickUnits ) ||
+			 !internal::decimalUnits( basePrice, m_scale, m_baseUnits ) )
+		{
+			throw std::invalid_argument{ "Tick size and base price do not fit a common scale" };
+		}
+
+		m_tickUnits = static_cast<std::int64_t>( tickUnits.toLow() );
+	}
+
+	//----------------------------------------------
+	// Price mapping
+	//----------------------------------------------
+
+	inline bool PriceGrid::tryTickOf( const Decimal& price, std::int64_t& tick ) const noexcept
+	{
+		Int128 units{};
+		if ( !internal::decimalUnits( price, m_scale, units ) )
+		{
+			return false;
+		}
+
+		ArithmeticStatus status{ ArithmeticStatus::None };
+		const Int128 offset{ Int128::subtract( units, m_baseUnits, status ) };
+		if ( hasStatus( status, ArithmeticStatus::Overflow ) || !internal::fitsInt64( offset ) )
+		{
+			return false;
+		}
+
+		// One 64-bit division maps the offset to a tick
+		const auto offsetUnits{ static_cast<std::int64_t>( offset.toLow() ) };
+		if ( offsetUnits % m_tickUnits != 0 )
+		{
+			return false;
+		}
+
+		tick = offsetUnits / m_tickUnits;
+
+		return true;
+	}
+
+	inline std::int64_t PriceGrid::tickOf( const Decimal& price ) const
+	{
+		std::int64_t tick{ 0 };
+		if ( !tryTickOf( price, tick ) )
+		{
+			throw std::invalid_argument{ "Price is not on the tick grid" };
+		}
+
+		return tick;
+	}
+
+	inline Decimal PriceGrid::priceOf( std::int64_t tick ) const
+	{
+		ArithmeticStatus status{ ArithmeticStatus::None };
+		const Int128 units{ Int128::add( m_baseUnits, Int128::multiply( Int128{ tick }, Int128{ m_tickUnits }, status ), status ) };
+		const Int128 magnitude{ units.isNegative() ? -units : units };
+		if ( hasStatus( status, ArithmeticStatus::Overflow ) || ( magnitude.toHigh() >> constants::BITS_PER_UINT32 ) != 0 )
+		{
+			throw std::overflow_error{ "Price is outside the Decimal range" };
+		}
+
+		Decimal price{};
+		price.mantissa()[0] = static_cast<std::uint32_t>( magnitude.toLow() );
+		price.mantissa()[1] = static_cast<std::uint32_t>( magnitude.toLow() >> constants::BITS_PER_UINT32 );
+		price.mantissa()[2] = static_cast<std::uint32_t>( magnitude.toHigh() );
+		price.flags() = static_cast<std::uint32_t>( m_scale ) << constants::DECIMAL_SCALE_SHIFT | ( units.isNegative() ? constants::DECIMAL_SIGN_MASK : 0U );
+
+		return price;
+	}
+
+	inline bool PriceGrid::isOnGrid( const Decimal& price ) const noexcept
+	{
+		std::int64_t tick{ 0 };
+
+		return tryTickOf( price, tick );
+	}
+
+	//----------------------------------------------
+	// Property accessors
+	//----------------------------------------------
+
+	inline const Decimal& PriceGrid::tickSize() const noexcept
+	{
+		return m_tickSize;
+	}
+
+	inline const Decimal& PriceGrid::basePrice() const noexcept
+	{
+		return m_basePrice;
+	}
+
+	inline std::uint8_t PriceGrid::scale() const noexcept
+	{
+		return m_scale;
+	}
+
+	//=====================================================================
+	// PriceLadder class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename Level>
+	inline PriceLadder<Level>::PriceLadder( Side side, const Decimal& tickSize, const Decimal& basePrice, std::size_t capacity )
+		: m_grid{ tickSize, basePrice },
+		  m_levels( std::bit_ceil( std::max( capacity, constants::PRICE_LADDER_MIN_CAPACITY ) ) ),
+		  m_occupied( m_levels.size() / constants::BITS_PER_UINT64, 0 ),
+		  m_windowLow{ -static_cast<std::int64_t>( m_levels.size() / 2 ) },
+		  m_side{ side }
+	{
+	}
+
+	//----------------------------------------------
+	// Level access
+	//----------------------------------------------
+
+	template <typename Level>
+	inline Level& PriceLadder<Level>::operator[]( const Decimal& price )
+	{
+		const std::int64_t tick{ m_grid.tickOf( price ) };
+		if ( !isInWindow( tick ) )
+		{
+			throw std::out_of_range{ "Price is outside the ladder window" };
+		}
+
+		const std::size_t slot{ slotOf( tick ) };
+		if ( !isOccupied( tick ) )
+		{
+			m_occupied[slot / constants::BITS_PER_UINT64] |= 1ULL << ( slot % constants::BITS_PER_UINT64 );
+			if ( m_size == 0 || ( m_side == Side::Bid ? tick > m_bestTick : tick < m_bestTick ) )
+			{
+				m_bestTick = tick;
+			}
+			++m_size;
+		}
+
+		return m_levels[slot];
+	}
+
+	template <typename Level>
+	inline Level* PriceLadder<Level>::find( const Decimal& price ) noexcept
+	{
+		std::int64_t tick{ 0 };
+		if ( !m_grid.tryTickOf( price, tick ) || !isInWindow( tick ) || !isOccupied( tick ) )
+		{
+			return nullptr;
+		}
+
+		return &m_levels[slotOf( tick )];
+	}
+
+	template <typename Level>
+	inline const Level* PriceLadder<Level>::find( const Decimal& price ) const noexcept
+	{
+		std::int64_t tick{ 0 };
+		if ( !m_grid.tryTickOf( price, tick ) || !isInWindow( tick ) || !isOccupied( tick ) )
+		{
+			return nullptr;
+		}
+
+		return &m_levels[slotOf( tick )];
+	}
+
+	template <typename Level>
+	inline bool PriceLadder<Level>::erase( const Decimal& price )
+	{
+		std::int64_t tick{ 0 };
+		if ( !m_grid.tryTickOf( price, tick ) || !isInWindow( tick ) || !isOccupied( tick ) )
+		{
+			return false;
+		}
+
+		release( tick );
+		if ( tick == m_bestTick )
+		{
+			updateBest();
+		}
+
+		return true;
+	}
+
+	template <typename Level>
+	inline void PriceLadder<Level>::clear()
+	{
+		const std::int64_t windowHigh{ m_windowLow + static_cast<std::int64_t>( capacity() ) - 1 };
+		std::int64_t tick{ m_windowLow };
+		while ( tick <= windowHigh && findOccupiedUp( tick, windowHigh, tick ) )
+		{
+			release( tick );
+			++tick;
+		}
+	}
+
+	//----------------------------------------------
+	// Best level
+	//----------------------------------------------
+
+	template <typename Level>
+	inline Level& PriceLadder<Level>::best()
+	{
+		return m_levels[slotOf( bestTick() )];
+	}
+
+	template <typename Level>
+	inline const Level& PriceLadder<Level>::best() const
+	{
+		return m_levels[slotOf( bestTick() )];
+	}
+
+	template <typename Level>
+	inline std::int64_t PriceLadder<Level>::bestTick() const
+	{
+		if ( m_size == 0 )
+		{
+			throw std::out_of_range{ "PriceLadder is empty" };
+		}
+
+		return m_bestTick;
+	}
+
+	template <typename Level>
+	inline Decimal PriceLadder<Level>::bestPrice() const
+	{
+		return m_grid.priceOf( bestTick() );
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	template <typename Level>
+	template <typename Function>
+	inline void PriceLadder<Level>::forEach( Function&& function )
+	{
+		if ( m_size == 0 )
+		{
+			return;
+		}
+
+		const std::int64_t windowHigh{ m_windowLow + static_cast<std::int64_t>( capacity() ) - 1 };
+		std::int64_t tick{ m_bestTick };
+		if ( m_side == Side::Bid )
+		{
+			while ( tick >= m_windowLow && findOccupiedDown( tick, m_windowLow, tick ) )
+			{
+				function( m_grid.priceOf( tick ), m_levels[slotOf( tick )] );
+				--tick;
+			}
+		}
+		else
+		{
+			while ( tick <= windowHigh && findOccupiedUp( tick, windowHigh, tick ) )
+			{
+				function( m_grid.priceOf( tick ), m_levels[slotOf( tick )] );
+				++tick;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Window
+	//----------------------------------------------
+
+	template <typename Level>
+	inline std::size_t PriceLadder<Level>::recenter( const Decimal& price )
+	{
+		const std::int64_t center{ m_grid.tickOf( price ) };
+		const auto half{ static_cast<std::int64_t>( capacity() / 2 ) };
+		const std::int64_t windowLow{ center - half };
+		const std::int64_t windowHigh{ windowLow + static_cast<std::int64_t>( capacity() ) - 1 };
+
+		// Levels outside the new window are dropped; the others keep their slots
+		std::size_t dropped{ 0 };
+		std::int64_t tick{ 0 };
+		std::int64_t from{ m_windowLow };
+		const std::int64_t oldHigh{ m_windowLow + static_cast<std::int64_t>( capacity() ) - 1 };
+		while ( from <= oldHigh && findOccupiedUp( from, oldHigh, tick ) )
+		{
+			if ( tick >= windowLow && tick <= windowHigh )
+			{
+				// Skip the ticks kept by the new window
+				from = windowHigh + 1;
+				continue;
+			}
+
+			release( tick );
+			++dropped;
+			from = tick + 1;
+		}
+
+		m_windowLow = windowLow;
+		if ( dropped != 0 )
+		{
+			updateBest();
+		}
+
+		return dropped;
+	}
+
+	template <typename Level>
+	inline bool PriceLadder<Level>::isInWindow( const Decimal& price ) const noexcept
+	{
+		std::int64_t tick{ 0 };
+
+		return m_grid.tryTickOf( price, tick ) && isInWindow( tick );
+	}
+
+	template <typename Level>
+	inline std::int64_t PriceLadder<Level>::windowLowTick() const noexcept
+	{
+		return m_windowLow;
+	}
+
+	//----------------------------------------------
+	// Property accessors
+	//----------------------------------------------
+
+	template <typename Level>
+	inline const PriceGrid& PriceLadder<Level>::grid() const noexcept
+	{
+		return m_grid;
+	}
+
+	template <typename Level>
+	inline typename PriceLadder<Level>::Side PriceLadder<Level>::side() const noexcept
+	{
+		return m_side;
+	}
+
+	template <typename Level>
+	inline std::size_t PriceLadder<Level>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename Level>
+	inline bool PriceLadder<Level>::isEmpty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename Level>
+	inline std::size_t PriceLadder<Level>::capacity() const noexcept
+	{
+		return m_levels.size();
+	}
+
+	//----------------------------------------------
+	// Ring slots
+	//----------------------------------------------
+
+	template <typename Level>
+	inline std::size_t PriceLadder<Level>::slotOf( std::int64_t tick ) const noexcept
+	{
+		// Two's complement wrap keeps consecutive ticks in consecutive slots
+		return static_cast<std::size_t>( static_cast<std::uint64_t>( tick ) & ( capacity() - 1 ) );
+	}
+
+	template <typename Level>
+	inline bool PriceLadder<Level>::isInWindow( std::int64_t tick ) const noexcept
+	{
+		return static_cast<std::uint64_t>( tick ) - static_cast<std::uint64_t>( m_windowLow ) < capacity();
+	}
+
+	template <typename Level>
+	inline bool PriceLadder<Level>::isOccupied( std::int64_t tick ) const noexcept
+	{
+		const std::size_t slot{ slotOf( tick ) };
+
+		return ( m_occupied[slot / constants::BITS_PER_UINT64] >> ( slot % constants::BITS_PER_UINT64 ) & 1U ) != 0;
+	}
+
+	template <typename Level>
+	inline bool PriceLadder<Level>::findOccupiedDown( std::int64_t from, std::int64_t to, std::int64_t& tick ) const noexcept
+	{
+		// Each step covers the rest of one occupancy word; ticks map to slots without gaps
+		while ( from >= to )
+		{
+			const std::size_t slot{ slotOf( from ) };
+			const std::size_t bit{ slot % constants::BITS_PER_UINT64 };
+			const std::uint64_t below{ bit + 1 == constants::BITS_PER_UINT64 ? ~0ULL : ( 1ULL << ( bit + 1 ) ) - 1 };
+			const std::uint64_t bits{ m_occupied[slot / constants::BITS_PER_UINT64] & below };
+			if ( bits != 0 )
+			{
+				const std::int64_t found{ from - static_cast<std::int64_t>( bit ) + ( constants::BITS_PER_UINT64 - 1 - std::countl_zero( bits ) ) };
+				if ( found < to )
+				{
+					return false;
+				}
+
+				tick = found;
+
+				return true;
+			}
+
+			from -= static_cast<std::int64_t>( bit ) + 1;
+		}
+
+		return false;
+	}
+
+	template <typename Level>
+	inline bool PriceLadder<Level>::findOccupiedUp( std::int64_t from, std::int64_t to, std::int64_t& tick ) const noexcept
+	{
+		while ( from <= to )
+		{
+			const std::size_t slot{ slotOf( from ) };
+			const std::size_t bit{ slot % constants::BITS_PER_UINT64 };
+			const std::uint64_t bits{ m_occupied[slot / constants::BITS_PER_UINT64] & ( ~0ULL << bit ) };
+			if ( bits != 0 )
+			{
+				const std::int64_t found{ from - static_cast<std::int64_t>( bit ) + std::countr_zero( bits ) };
+				if ( found > to )
+				{
+					return false;
+				}
+
+				tick = found;
+
+				return true;
+			}
+
+			from += static_cast<std::int64_t>( constants::BITS_PER_UINT64 - bit );
+		}
+
+		return false;
+	}
+
+	template <typename Level>
+	inline void PriceLadder<Level>::updateBest() noexcept
+	{
+		if ( m_size == 0 )
+		{
+			return;
+		}
+
+		// The new best is never better than the old one, so the scan starts there
+		const std::int64_t windowHigh{ m_windowLow + static_cast<std::int64_t>( capacity() ) - 1 };
+		if ( m_side == Side::Bid )
+		{
+			(void)findOccupiedDown( std::min( m_bestTick, windowHigh ), m_windowLow, m_bestTick );
+		}
+		else
+		{
+			(void)findOccupiedUp( std::max( m_bestTick, m_windowLow ), windowHigh, m_bestTick );
+		}
+	}
+
+	template <typename Level>
+	inline void PriceLadder<Level>::release( std::int64_t tick )
+	{
+		const std::size_t slot{ slotOf( tick ) };
+		m_occupied[slot / constants::BITS_PER_UINT64] &= ~( 1ULL << ( slot % constants::BITS_PER_UINT64 ) );
+		m_levels[slot] = Level{};
+		--m_size;
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file RadixSort.inl
+ * @brief Inline implementations for the RadixSort key-value sorts
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Permutation helpers
+		//=====================================================================
+
+		/**
+		 * @brief Reorder a span by a permutation
+		 * @param values Values to reorder in place
+		 * @param order order[i] is the current position of the value that moves to position i
+		 */
+		template <typename T>
+		inline void applyPermutation( std::span<T> values, std::span<const std::size_t> order )
+		{
+			std::vector<T> permuted;
+			permuted.reserve( values.size() );
+			for ( const std::size_t index : order )
+			{
+				permuted.push_back( std::move( values[index] ) );
+			}
+
+			std::move( permuted.begin(), permuted.end(), values.begin() );
+		}
+
+		/**
+		 * @brief Sort keys through argsort and reorder both spans
+		 * @param keys Keys to sort in place
+		 * @param values Values to permute like keys
+		 * @param threadCount Maximum number of threads
+		 */
+		template <typename Key, typename T>
+		inline void sortByKey( std::span<Key> keys, std::span<T> values, std::size_t threadCount )
+		{
+			if ( keys.size() != values.size() )
+			{
+				throw std::invalid_argument{ "Operand spans differ in size" };
+			}
+
+			std::vector<std::size_t> order( keys.size() );
+			RadixSort::argsort( std::span<const Key>{ keys }, order, threadCount );
+			applyPermutation( keys, std::span<const std::size_t>{ order } );
+			applyPermutation( values, std::span<const std::size_t>{ order } );
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// RadixSort class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Key-value sort
+	//----------------------------------------------
+
+	template <typename T>
+	inline void RadixSort::radixSortByKey( std::span<Decimal> keys, std::span<T> values, std::size_t threadCount )
+	{
+		internal::sortByKey( keys, values, threadCount );
+	}
+
+	template <typename T>
+	inline void RadixSort::radixSortByKey( std::span<Int128> keys, std::span<T> values, std::size_t threadCount )
+	{
+		internal::sortByKey( keys, values, threadCount );
+	}
+} // namespace nfx::datatypes
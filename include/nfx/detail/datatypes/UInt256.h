@@ -0,0 +1,552 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file UInt256.h
+ * @brief Internal unsigned 256-bit integer used for exact wide intermediates
+ * @details Holds full 128 x 128-bit products so that scaled multiplication and
+ *          division can round exactly before narrowing back to 128 bits.
+ *          Only the operations needed by the fixed-point and interchange types are provided.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <utility>
+
+#include "nfx/datatypes/Int128.h"
+#include "nfx/detail/datatypes/Constants.h"
+
+namespace nfx::datatypes::internal
+{
+	//=====================================================================
+	// Wide multiplication helpers
+	//=====================================================================
+
+	/**
+	 * @brief Full 64 x 64-bit unsigned multiplication
+	 * @param a First factor
+	 * @param b Second factor
+	 * @return Pair of {low, high} 64-bit words of the 128-bit product
+	 */
+	inline constexpr std::pair<std::uint64_t, std::uint64_t> multiply64( std::uint64_t a, std::uint64_t b ) noexcept
+	{
+#if NFX_DATATYPES_HAS_NATIVE_INT128
+		unsigned NFX_DATATYPES_NATIVE_INT128 product{ static_cast<unsigned NFX_DATATYPES_NATIVE_INT128>( a ) * b };
+
+		return { static_cast<std::uint64_t>( product ), static_cast<std::uint64_t>( product >> 64 ) };
+#else
+		std::uint64_t aLow{ a & 0xFFFFFFFFULL };
+		std::uint64_t aHigh{ a >> 32 };
+		std::uint64_t bLow{ b & 0xFFFFFFFFULL };
+		std::uint64_t bHigh{ b >> 32 };
+
+		std::uint64_t p0{ aLow * bLow };
+		std::uint64_t p1{ aLow * bHigh };
+		std::uint64_t p2{ aHigh * bLow };
+		std::uint64_t p3{ aHigh * bHigh };
+
+		std::uint64_t middle{ ( p0 >> 32 ) + ( p1 & 0xFFFFFFFFULL ) + ( p2 & 0xFFFFFFFFULL ) };
+		std::uint64_t low{ ( middle << 32 ) | ( p0 & 0xFFFFFFFFULL ) };
+		std::uint64_t high{ p3 + ( p1 >> 32 ) + ( p2 >> 32 ) + ( middle >> 32 ) };
+
+		return { low, high };
+#endif
+	}
+
+	//=====================================================================
+	// UInt256 class
+	//=====================================================================
+
+	/**
+	 * @brief Minimal constexpr unsigned 256-bit integer
+	 * @details Stored as four little-endian 64-bit words. Arithmetic wraps modulo 2^256.
+	 */
+	class UInt256 final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Default constructor, initializes to zero */
+		constexpr UInt256() noexcept
+			: m_words{ { 0, 0, 0, 0 } }
+		{
+		}
+
+		/**
+		 * @brief Construct from a 128-bit value given as two words
+		 * @param low Least significant 64 bits
+		 * @param high Bits 64-127
+		 */
+		constexpr UInt256( std::uint64_t low, std::uint64_t high = 0 ) noexcept
+			: m_words{ { low, high, 0, 0 } }
+		{
+		}
+
+		/**
+		 * @brief Construct from four little-endian words
+		 * @param w0 Bits 0-63
+		 * @param w1 Bits 64-127
+		 * @param w2 Bits 128-191
+		 * @param w3 Bits 192-255
+		 * @return UInt256 assembled from the words
+		 */
+		[[nodiscard]] static constexpr UInt256 fromWords( std::uint64_t w0, std::uint64_t w1, std::uint64_t w2, std::uint64_t w3 ) noexcept
+		{
+			UInt256 result;
+			result.m_words = { { w0, w1, w2, w3 } };
+
+			return result;
+		}
+
+		/**
+		 * @brief Magnitude of a signed 128-bit integer
+		 * @param value Signed value (the minimum value maps to 2^127)
+		 * @return |value| as an unsigned 256-bit integer
+		 */
+		[[nodiscard]] static constexpr UInt256 magnitude( const Int128& value ) noexcept
+		{
+			const Int128 absolute{ value.isNegative() ? -value : value };
+
+			return UInt256{ absolute.toLow(), absolute.toHigh() };
+		}
+
+		//----------------------------------------------
+		// Arithmetic
+		//----------------------------------------------
+
+		/**
+		 * @brief Full product of two 128-bit unsigned values
+		 * @param a First factor (high words must be zero)
+		 * @param b Second factor (high words must be zero)
+		 * @return Exact 256-bit product
+		 */
+		[[nodiscard]] static constexpr UInt256 multiply( const UInt256& a, const UInt256& b ) noexcept
+		{
+			UInt256 result;
+			for ( std::size_t i{ 0 }; i < 2; ++i )
+			{
+				std::uint64_t carry{ 0 };
+				for ( std::size_t j{ 0 }; j < 2; ++j )
+				{
+					auto [low, high]{ multiply64( a.m_words[i], b.m_words[j] ) };
+
+					std::uint64_t sum{ result.m_words[i + j] + low };
+					high += ( sum < low ) ? 1U : 0U;
+					sum += carry;
+					high += ( sum < carry ) ? 1U : 0U;
+
+					result.m_words[i + j] = sum;
+					carry = high;
+				}
+				result.m_words[i + 2] = carry;
+			}
+
+			return result;
+		}
+
+		/**
+		 * @brief Multiply by a 64-bit factor
+		 * @param factor Multiplier
+		 * @return Product truncated to 256 bits
+		 */
+		[[nodiscard]] constexpr UInt256 multiply( std::uint64_t factor ) const noexcept
+		{
+			UInt256 result;
+			std::uint64_t carry{ 0 };
+			for ( std::size_t i{ 0 }; i < 4; ++i )
+			{
+				auto [low, high]{ multiply64( m_words[i], factor ) };
+
+				std::uint64_t sum{ low + carry };
+				high += ( sum < carry ) ? 1U : 0U;
+
+				result.m_words[i] = sum;
+				carry = high;
+			}
+
+			return result;
+		}
+
+		/**
+		 * @brief Addition modulo 2^256
+		 * @param other Value to add
+		 * @return Sum
+		 */
+		constexpr UInt256 operator+( const UInt256& other ) const noexcept
+		{
+			UInt256 result;
+			std::uint64_t carry{ 0 };
+			for ( std::size_t i{ 0 }; i < 4; ++i )
+			{
+				std::uint64_t sum{ m_words[i] + other.m_words[i] };
+				std::uint64_t nextCarry{ ( sum < m_words[i] ) ? 1U : 0U };
+				sum += carry;
+				nextCarry += ( sum < carry ) ? 1U : 0U;
+
+				result.m_words[i] = sum;
+				carry = nextCarry;
+			}
+
+			return result;
+		}
+
+		/**
+		 * @brief Subtraction modulo 2^256
+		 * @param other Value to subtract
+		 * @return Difference
+		 */
+		constexpr UInt256 operator-( const UInt256& other ) const noexcept
+		{
+			UInt256 result;
+			std::uint64_t borrow{ 0 };
+			for ( std::size_t i{ 0 }; i < 4; ++i )
+			{
+				std::uint64_t difference{ m_words[i] - other.m_words[i] };
+				std::uint64_t nextBorrow{ ( m_words[i] < other.m_words[i] ) ? 1U : 0U };
+				nextBorrow += ( difference < borrow ) ? 1U : 0U;
+				difference -= borrow;
+
+				result.m_words[i] = difference;
+				borrow = nextBorrow;
+			}
+
+			return result;
+		}
+
+		/**
+		 * @brief Logical left shift by one bit
+		 * @return Shifted value
+		 */
+		[[nodiscard]] constexpr UInt256 shiftLeftOne() const noexcept
+		{
+			return fromWords( m_words[0] << 1,
+				( m_words[1] << 1 ) | ( m_words[0] >> 63 ),
+				( m_words[2] << 1 ) | ( m_words[1] >> 63 ),
+				( m_words[3] << 1 ) | ( m_words[2] >> 63 ) );
+		}
+
+		/**
+		 * @brief Divide in place by a 64-bit divisor
+		 * @param divisor Non-zero divisor
+		 * @return Remainder of the division
+		 */
+		constexpr std::uint64_t divideBy( std::uint64_t divisor ) noexcept
+		{
+#if NFX_DATATYPES_HAS_NATIVE_INT128
+			unsigned NFX_DATATYPES_NATIVE_INT128 remainder{ 0 };
+			for ( std::size_t i{ 4 }; i-- > 0; )
+			{
+				unsigned NFX_DATATYPES_NATIVE_INT128 current{ ( remainder << 64 ) | m_words[i] };
+				m_words[i] = static_cast<std::uint64_t>( current / divisor );
+				remainder = current % divisor;
+			}
+
+			return static_cast<std::uint64_t>( remainder );
+#else
+			if ( divisor <= 0xFFFFFFFFULL )
+			{
+				// Schoolbook division on 32-bit digits keeps every partial dividend within 64 bits
+				std::uint64_t remainder{ 0 };
+				for ( std::size_t i{ 4 }; i-- > 0; )
+				{
+					std::uint64_t upper{ ( remainder << 32 ) | ( m_words[i] >> 32 ) };
+					std::uint64_t upperQuotient{ upper / divisor };
+					remainder = upper % divisor;
+
+					std::uint64_t lower{ ( remainder << 32 ) | ( m_words[i] & 0xFFFFFFFFULL ) };
+					std::uint64_t lowerQuotient{ lower / divisor };
+					remainder = lower % divisor;
+
+					m_words[i] = ( upperQuotient << 32 ) | lowerQuotient;
+				}
+
+				return remainder;
+			}
+
+			UInt256 quotient;
+			UInt256 remainder;
+			divide( *this, UInt256{ divisor }, quotient, remainder );
+			*this = quotient;
+
+			return remainder.m_words[0];
+#endif
+		}
+
+		/**
+		 * @brief Unsigned long division
+		 * @param dividend Value to divide
+		 * @param divisor Non-zero divisor
+		 * @param quotient Receives dividend / divisor
+		 * @param remainder Receives dividend % divisor
+		 */
+		static constexpr void divide( const UInt256& dividend, const UInt256& divisor, UInt256& quotient, UInt256& remainder ) noexcept
+		{
+			quotient = UInt256{};
+			remainder = UInt256{};
+
+			if ( dividend < divisor )
+			{
+				remainder = dividend;
+				return;
+			}
+
+			if ( divisor.m_words[1] == 0 && divisor.m_words[2] == 0 && divisor.m_words[3] == 0 )
+			{
+#if NFX_DATATYPES_HAS_NATIVE_INT128
+				quotient = dividend;
+				remainder = UInt256{ quotient.divideBy( divisor.m_words[0] ) };
+				return;
+#else
+				if ( divisor.m_words[0] <= 0xFFFFFFFFULL )
+				{
+					quotient = dividend;
+					remainder = UInt256{ quotient.divideBy( divisor.m_words[0] ) };
+					return;
+				}
+#endif
+			}
+
+			// Binary long division from the highest set bit of the dividend
+			for ( std::size_t bit{ dividend.bitLength() }; bit-- > 0; )
+			{
+				remainder = remainder.shiftLeftOne();
+				remainder.m_words[0] |= ( dividend.m_words[bit / 64] >> ( bit % 64 ) ) & 1U;
+
+				if ( !( remainder < divisor ) )
+				{
+					remainder = remainder - divisor;
+					quotient.m_words[bit / 64] |= std::uint64_t{ 1 } << ( bit % 64 );
+				}
+			}
+		}
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		constexpr bool operator==( const UInt256& other ) const noexcept
+		{
+			return m_words == other.m_words;
+		}
+
+		constexpr bool operator!=( const UInt256& other ) const noexcept
+		{
+			return !( *this == other );
+		}
+
+		constexpr bool operator<( const UInt256& other ) const noexcept
+		{
+			for ( std::size_t i{ 4 }; i-- > 0; )
+			{
+				if ( m_words[i] != other.m_words[i] )
+				{
+					return m_words[i] < other.m_words[i];
+				}
+			}
+
+			return false;
+		}
+
+		constexpr bool operator>( const UInt256& other ) const noexcept
+		{
+			return other < *this;
+		}
+
+		constexpr bool operator<=( const UInt256& other ) const noexcept
+		{
+			return !( other < *this );
+		}
+
+		constexpr bool operator>=( const UInt256& other ) const noexcept
+		{
+			return !( *this < other );
+		}
+
+		//----------------------------------------------
+		// State and access
+		//----------------------------------------------
+
+		/**
+		 * @brief Check for zero
+		 * @return true if all words are zero
+		 */
+		[[nodiscard]] constexpr bool isZero() const noexcept
+		{
+			return ( m_words[0] | m_words[1] | m_words[2] | m_words[3] ) == 0;
+		}
+
+		/**
+		 * @brief Number of significant bits
+		 * @return Index of the highest set bit plus one, 0 for zero
+		 */
+		[[nodiscard]] constexpr std::size_t bitLength() const noexcept
+		{
+			for ( std::size_t i{ 4 }; i-- > 0; )
+			{
+				if ( m_words[i] != 0 )
+				{
+					return i * 64 + static_cast<std::size_t>( std::bit_width( m_words[i] ) );
+				}
+			}
+
+			return 0;
+		}
+
+		/**
+		 * @brief Check whether the value is below 2^bits
+		 * @param bits Bit width to test against (0-256)
+		 * @return true if the value fits in the given number of bits
+		 */
+		[[nodiscard]] constexpr bool fitsIn( std::size_t bits ) const noexcept
+		{
+			return bitLength() <= bits;
+		}
+
+		/**
+		 * @brief Access a 64-bit word
+		 * @param index Word index (0 = least significant)
+		 * @return Word value
+		 */
+		[[nodiscard]] constexpr std::uint64_t word( std::size_t index ) const noexcept
+		{
+			return m_words[index];
+		}
+
+	private:
+		/** @brief Little-endian 64-bit words */
+		std::array<std::uint64_t, 4> m_words;
+	};
+
+	//=====================================================================
+	// Decimal scaling helpers
+	//=====================================================================
+
+	/**
+	 * @brief Power of 10 as a 256-bit value
+	 * @param power The power (0-38)
+	 * @return 10^power
+	 */
+	inline constexpr UInt256 powerOf10Wide( std::uint8_t power ) noexcept
+	{
+		constexpr std::uint8_t maxTablePower{ constants::DECIMAL_POWER_TABLE_SIZE - 1U };
+		if ( power <= maxTablePower )
+		{
+			return UInt256{ constants::DECIMAL_POWERS_OF_10[power] };
+		}
+
+		return UInt256{ constants::DECIMAL_POWERS_OF_10[maxTablePower] }.multiply( constants::DECIMAL_POWERS_OF_10[power - maxTablePower] );
+	}
+
+	/**
+	 * @brief Multiply a magnitude by a power of 10
+	 * @param value Magnitude to scale
+	 * @param power The power (0-38)
+	 * @return value * 10^power (exact below 2^256)
+	 */
+	inline constexpr UInt256 multiplyByPowerOf10Wide( const UInt256& value, std::uint8_t power ) noexcept
+	{
+		constexpr std::uint8_t maxTablePower{ constants::DECIMAL_POWER_TABLE_SIZE - 1U };
+		if ( power <= maxTablePower )
+		{
+			return value.multiply( constants::DECIMAL_POWERS_OF_10[power] );
+		}
+
+		return value.multiply( constants::DECIMAL_POWERS_OF_10[maxTablePower] )
+			.multiply( constants::DECIMAL_POWERS_OF_10[power - maxTablePower] );
+	}
+
+	/**
+	 * @brief Round a quotient to nearest, ties to even
+	 * @param quotient Truncated quotient
+	 * @param remainder Remainder of the division
+	 * @param divisor Divisor used
+	 * @return Rounded quotient
+	 */
+	inline constexpr UInt256 roundHalfEven( const UInt256& quotient, const UInt256& remainder, const UInt256& divisor ) noexcept
+	{
+		const UInt256 twice{ remainder.shiftLeftOne() };
+		if ( twice > divisor || ( twice == divisor && ( quotient.word( 0 ) & constants::BIT_MASK_ONE ) != 0 ) )
+		{
+			return quotient + UInt256{ 1 };
+		}
+
+		return quotient;
+	}
+
+	/**
+	 * @brief Divide a magnitude by a power of 10, ties to even
+	 * @param value Magnitude to divide
+	 * @param power The power (0-38)
+	 * @return Rounded value / 10^power
+	 */
+	inline constexpr UInt256 divideByPowerOf10RoundedWide( const UInt256& value, std::uint8_t power ) noexcept
+	{
+		if ( power == 0 )
+		{
+			return value;
+		}
+
+		constexpr std::uint8_t maxTablePower{ constants::DECIMAL_POWER_TABLE_SIZE - 1U };
+		UInt256 quotient{ value };
+		UInt256 remainder;
+		if ( power <= maxTablePower )
+		{
+			remainder = UInt256{ quotient.divideBy( constants::DECIMAL_POWERS_OF_10[power] ) };
+		}
+		else
+		{
+			// Two 64-bit divisions: remainder = r2 * 10^19 + r1
+			std::uint64_t lowRemainder{ quotient.divideBy( constants::DECIMAL_POWERS_OF_10[maxTablePower] ) };
+			std::uint64_t highRemainder{ quotient.divideBy( constants::DECIMAL_POWERS_OF_10[power - maxTablePower] ) };
+			remainder = UInt256{ highRemainder }.multiply( constants::DECIMAL_POWERS_OF_10[maxTablePower] ) + UInt256{ lowRemainder };
+		}
+
+		return roundHalfEven( quotient, remainder, powerOf10Wide( power ) );
+	}
+
+	/**
+	 * @brief Divide a magnitude by a power of 10, truncating toward zero
+	 * @param value Magnitude to divide (in-place)
+	 * @param power The power (any value; divided in steps of at most 10^19)
+	 * @return true if no non-zero digit was discarded
+	 */
+	inline constexpr bool divideByPowerOf10Truncated( UInt256& value, std::uint32_t power ) noexcept
+	{
+		constexpr std::uint8_t maxTablePower{ constants::DECIMAL_POWER_TABLE_SIZE - 1U };
+		bool exact{ true };
+		while ( power > 0 && !value.isZero() )
+		{
+			const std::uint32_t step{ power < maxTablePower ? power : maxTablePower };
+			exact = value.divideBy( constants::DECIMAL_POWERS_OF_10[step] ) == 0 && exact;
+			power -= step;
+		}
+
+		return exact;
+	}
+} // namespace nfx::datatypes::internal
@@ -0,0 +1,325 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BatchFormatter.cpp
+ * @brief Implementation of batch Decimal and Int128 formatting
+ */
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#include "nfx/datatypes/BatchFormatter.h"
+
+#include "nfx/detail/datatypes/Constants.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Digit generation
+		//=====================================================================
+
+		/** @brief Scratch space for the digits of one magnitude (up to 39 digits) */
+		using DigitBuffer = std::array<char, constants::INT_128_MAX_DIGIT_COUNT + 1>;
+
+		/**
+		 * @brief Write the digits of a value so that they end just before end
+		 * @param end One past the last digit position
+		 * @param value Value to write (0 writes "0")
+		 * @return Pointer to the first digit
+		 */
+		static char* writeDigitsBackward( char* end, std::uint64_t value ) noexcept
+		{
+			while ( value >= 100U )
+			{
+				end -= 2;
+				std::memcpy( end, &constants::DIGIT_PAIRS[( value % 100U ) * 2U], 2 );
+				value /= 100U;
+			}
+
+			if ( value >= constants::DECIMAL_BASE )
+			{
+				end -= 2;
+				std::memcpy( end, &constants::DIGIT_PAIRS[value * 2U], 2 );
+			}
+			else
+			{
+				*--end = static_cast<char>( '0' + value );
+			}
+
+			return end;
+		}
+
+		/**
+		 * @brief Write exactly BATCH_FORMAT_CHUNK_DIGITS digits, zero-padded, ending just before end
+		 * @param end One past the last digit position
+		 * @param value Value to write (below 10^19)
+		 * @return Pointer to the first digit
+		 */
+		static char* writeChunkBackward( char* end, std::uint64_t value ) noexcept
+		{
+			char* const begin{ end - constants::BATCH_FORMAT_CHUNK_DIGITS };
+			while ( end - begin >= 2 )
+			{
+				end -= 2;
+				std::memcpy( end, &constants::DIGIT_PAIRS[( value % 100U ) * 2U], 2 );
+				value /= 100U;
+			}
+
+			if ( end != begin )
+			{
+				*--end = static_cast<char>( '0' + value );
+			}
+
+			return begin;
+		}
+
+		/**
+		 * @brief Write the digits of an unsigned magnitude of up to 128 bits
+		 * @param magnitude Value to write (destroyed)
+		 * @param digits Scratch buffer; digits end at digits.end()
+		 * @return Number of digits written
+		 */
+		static std::size_t writeMagnitude( UInt256 magnitude, DigitBuffer& digits ) noexcept
+		{
+			char* const end{ digits.data() + digits.size() };
+			char* begin{ end };
+
+			// One 128/64 division per 19 digits, then plain 64-bit pairs
+			while ( magnitude.word( 1 ) != 0 )
+			{
+				begin = writeChunkBackward( begin, magnitude.divideBy( constants::DECIMAL_POWERS_OF_10[constants::BATCH_FORMAT_CHUNK_DIGITS] ) );
+			}
+			begin = writeDigitsBackward( begin, magnitude.word( 0 ) );
+
+			return static_cast<std::size_t>( end - begin );
+		}
+
+		//=====================================================================
+		// Value writers
+		//=====================================================================
+
+		/**
+		 * @brief Write one Decimal
+		 * @param value Value to write
+		 * @param options Output options (fixedScale already validated)
+		 * @param out Destination with room for the longest possible text
+		 * @return Number of bytes written
+		 */
+		static std::size_t writeDecimal( const Decimal& value, const BatchFormatOptions& options, char* out ) noexcept
+		{
+			const Decimal rounded{ options.fixedScale && value.scale() > *options.fixedScale ? value.rescale( *options.fixedScale, options.rounding ) : value };
+
+			const auto& mantissa{ rounded.mantissa() };
+			const std::uint64_t low{ static_cast<std::uint64_t>( mantissa[0] ) | ( static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 ) };
+			DigitBuffer digits;
+			const char* const first{ mantissa[2] == 0 ? writeDigitsBackward( digits.data() + digits.size(), low )
+													  : digits.data() + digits.size() - writeMagnitude( UInt256{ low, mantissa[2] }, digits ) };
+			const std::size_t digitCount{ static_cast<std::size_t>( digits.data() + digits.size() - first ) };
+
+			// Zero prints as "0" whatever its scale and sign, like toString()
+			const bool zero{ rounded.isZero() };
+			const std::size_t scale{ zero ? 0U : rounded.scale() };
+			const std::size_t targetScale{ options.fixedScale ? *options.fixedScale : scale };
+
+			char* position{ out };
+			if ( !zero && rounded.isNegative() )
+			{
+				*position++ = '-';
+			}
+
+			if ( scale == 0 )
+			{
+				std::memcpy( position, first, digitCount );
+				position += digitCount;
+			}
+			else if ( digitCount > scale )
+			{
+				const std::size_t integerDigits{ digitCount - scale };
+				std::memcpy( position, first, integerDigits );
+				position += integerDigits;
+				*position++ = '.';
+				std::memcpy( position, first + integerDigits, scale );
+				position += scale;
+			}
+			else
+			{
+				*position++ = '0';
+				*position++ = '.';
+				std::memset( position, '0', scale - digitCount );
+				position += scale - digitCount;
+				std::memcpy( position, first, digitCount );
+				position += digitCount;
+			}
+
+			if ( targetScale > scale )
+			{
+				if ( scale == 0 )
+				{
+					*position++ = '.';
+				}
+				std::memset( position, '0', targetScale - scale );
+				position += targetScale - scale;
+			}
+
+			return static_cast<std::size_t>( position - out );
+		}
+
+		/**
+		 * @brief Write one Int128
+		 * @param value Value to write
+		 * @param out Destination with room for the longest possible text
+		 * @return Number of bytes written
+		 */
+		static std::size_t writeInt128( const Int128& value, const BatchFormatOptions&, char* out ) noexcept
+		{
+			DigitBuffer digits;
+			const std::size_t digitCount{ writeMagnitude( UInt256::magnitude( value ), digits ) };
+
+			char* position{ out };
+			if ( value.isNegative() )
+			{
+				*position++ = '-';
+			}
+			std::memcpy( position, digits.data() + digits.size() - digitCount, digitCount );
+
+			return static_cast<std::size_t>( position - out ) + digitCount;
+		}
+
+		//=====================================================================
+		// Buffer filling
+		//=====================================================================
+
+		/**
+		 * @brief Format every value into the output buffer
+		 * @param values Values to format
+		 * @param output Destination buffer
+		 * @param offsets Optional value start offsets
+		 * @param options Output options
+		 * @param maxLength Longest text a single value can produce
+		 * @param write Value writer (writeDecimal or writeInt128)
+		 * @return Number of bytes written
+		 */
+		template <typename T, typename Writer>
+		static std::size_t formatAll( std::span<const T> values, std::span<char> output, std::span<std::size_t> offsets,
+			const BatchFormatOptions& options, std::size_t maxLength, Writer write )
+		{
+			if ( !offsets.empty() && offsets.size() <= values.size() )
+			{
+				throw std::invalid_argument{ "Offsets span is too small" };
+			}
+
+			std::size_t position{ 0 };
+			for ( std::size_t i{ 0 }; i < values.size(); ++i )
+			{
+				if ( !offsets.empty() )
+				{
+					offsets[i] = position;
+				}
+
+				if ( output.size() - position >= maxLength )
+				{
+					position += write( values[i], options, output.data() + position );
+				}
+				else
+				{
+					// Near the end of the buffer: format aside and copy only if it fits
+					std::array<char, constants::DECIMAL_MAX_STRING_LENGTH> text;
+					const std::size_t length{ write( values[i], options, text.data() ) };
+					if ( length > output.size() - position )
+					{
+						throw std::invalid_argument{ "Output buffer is too small" };
+					}
+					std::memcpy( output.data() + position, text.data(), length );
+					position += length;
+				}
+
+				if ( options.delimiter && ( i + 1 < values.size() || options.trailingDelimiter ) )
+				{
+					if ( position == output.size() )
+					{
+						throw std::invalid_argument{ "Output buffer is too small" };
+					}
+					output[position++] = *options.delimiter;
+				}
+			}
+
+			if ( !offsets.empty() )
+			{
+				offsets[values.size()] = position;
+			}
+
+			return position;
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// BatchFormatter class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Output sizing
+	//----------------------------------------------
+
+	std::size_t BatchFormatter::maxDecimalOutputSize( std::size_t count, const BatchFormatOptions& options ) noexcept
+	{
+		const std::size_t fixedDigits{ options.fixedScale ? *options.fixedScale : 0U };
+
+		return count * ( constants::BATCH_DECIMAL_MAX_FORMATTED_LENGTH + fixedDigits + ( options.delimiter ? 1U : 0U ) );
+	}
+
+	std::size_t BatchFormatter::maxInt128OutputSize( std::size_t count, const BatchFormatOptions& options ) noexcept
+	{
+		return count * ( constants::BATCH_INT128_MAX_FORMATTED_LENGTH + ( options.delimiter ? 1U : 0U ) );
+	}
+
+	//----------------------------------------------
+	// Formatting
+	//----------------------------------------------
+
+	std::size_t BatchFormatter::formatDecimals( std::span<const Decimal> values, std::span<char> output,
+		std::span<std::size_t> offsets, const BatchFormatOptions& options )
+	{
+		if ( options.fixedScale && *options.fixedScale > constants::DECIMAL_MAXIMUM_PLACES )
+		{
+			throw std::invalid_argument{ "Fixed scale out of range" };
+		}
+
+		const std::size_t fixedDigits{ options.fixedScale ? *options.fixedScale : 0U };
+
+		return internal::formatAll( values, output, offsets, options,
+			constants::BATCH_DECIMAL_MAX_FORMATTED_LENGTH + fixedDigits, internal::writeDecimal );
+	}
+
+	std::size_t BatchFormatter::formatInt128s( std::span<const Int128> values, std::span<char> output,
+		std::span<std::size_t> offsets, const BatchFormatOptions& options )
+	{
+		return internal::formatAll( values, output, offsets, options,
+			constants::BATCH_INT128_MAX_FORMATTED_LENGTH, internal::writeInt128 );
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,446 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BatchParser.cpp
+ * @brief Implementation of batch Decimal and Int128 parsing
+ */
+
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+#include "nfx/datatypes/BatchParser.h"
+
+#include "nfx/detail/datatypes/Constants.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// SWAR digit helpers
+		//=====================================================================
+
+		/**
+		 * @brief Check that all eight bytes of a word are ASCII digits
+		 * @param word Eight characters, first character in the lowest byte
+		 * @return true if every byte is in '0'-'9'
+		 */
+		static bool isEightDigits( std::uint64_t word ) noexcept
+		{
+			// '0'-'9' keep a high nibble of 3 both before and after adding 6
+			return ( ( word & constants::SWAR_HIGH_NIBBLES ) |
+					   ( ( ( word + constants::SWAR_DIGIT_LIMIT_BIAS ) & constants::SWAR_HIGH_NIBBLES ) >> 4 ) ) ==
+				   constants::SWAR_ALL_DIGITS;
+		}
+
+		/**
+		 * @brief Convert eight ASCII digits to their value
+		 * @param word Eight digits, most significant digit in the lowest byte
+		 * @return Value in 0-99999999
+		 */
+		static std::uint32_t convertEightDigits( std::uint64_t word ) noexcept
+		{
+			word -= constants::SWAR_ASCII_ZEROS;
+			word = ( word * constants::DECIMAL_BASE ) + ( word >> 8 );
+			word = ( ( ( word & constants::SWAR_PAIR_MASK ) * constants::SWAR_PAIR_MULTIPLIER_HIGH ) +
+					   ( ( ( word >> 16 ) & constants::SWAR_PAIR_MASK ) * constants::SWAR_PAIR_MULTIPLIER_LOW ) ) >>
+				   constants::BITS_PER_UINT32;
+
+			return static_cast<std::uint32_t>( word );
+		}
+
+		/**
+		 * @brief Validate a run of digits and append its value to an accumulator
+		 * @param run Digits to append
+		 * @param value In/out accumulator; the caller guarantees the result stays below 10^19
+		 * @return false if any character is not a digit
+		 * @note Every whole 8-digit word is validated and converted in one step; the remaining
+		 *       0-7 digits go one at a time
+		 */
+		static inline bool accumulateDigits( std::string_view run, std::uint64_t& value ) noexcept
+		{
+			constexpr std::size_t wordDigits{ constants::SWAR_DIGITS_PER_WORD };
+			const char* position{ run.data() };
+			const char* const end{ run.data() + run.size() };
+
+			// Accumulate locally: stores through value could alias the characters being read
+			std::uint64_t result{ value };
+
+			if constexpr ( std::endian::native == std::endian::little )
+			{
+				for ( ; static_cast<std::size_t>( end - position ) >= wordDigits; position += wordDigits )
+				{
+					std::uint64_t word;
+					std::memcpy( &word, position, sizeof( word ) );
+					if ( !isEightDigits( word ) )
+					{
+						return false;
+					}
+					result = result * constants::DECIMAL_POWERS_OF_10[wordDigits] + convertEightDigits( word );
+				}
+			}
+
+			for ( ; position < end; ++position )
+			{
+				const auto digit{ static_cast<std::uint8_t>( *position - '0' ) };
+				if ( digit > 9U )
+				{
+					return false;
+				}
+				result = result * constants::DECIMAL_BASE + digit;
+			}
+
+			value = result;
+
+			return true;
+		}
+
+		/**
+		 * @brief Validate and convert 20-32 digits split across two runs
+		 * @param head First run of digits
+		 * @param tail Second run of digits, logically appended to head
+		 * @param high Output: value of all but the trailing 16 digits
+		 * @param low Output: value of the trailing 16 digits
+		 * @return false if any character is not a digit
+		 */
+		static bool convertLongDigitRuns( std::string_view head, std::string_view tail, std::uint64_t& high, std::uint64_t& low ) noexcept
+		{
+			const std::size_t split{ head.size() + tail.size() - constants::SWAR_SPLIT_DIGITS };
+			if ( split <= head.size() )
+			{
+				return accumulateDigits( head.substr( 0, split ), high ) &&
+					   accumulateDigits( head.substr( split ), low ) &&
+					   accumulateDigits( tail, low );
+			}
+
+			return accumulateDigits( head, high ) &&
+				   accumulateDigits( tail.substr( 0, split - head.size() ), high ) &&
+				   accumulateDigits( tail.substr( split - head.size() ), low );
+		}
+
+		/**
+		 * @brief Validate and convert up to 32 digits split across two runs
+		 * @param head First run of digits
+		 * @param tail Second run of digits, logically appended to head
+		 * @param high Output: value of all but the trailing 16 digits (zero for up to 19 digits)
+		 * @param low Output: value of the trailing 16 digits (all digits for up to 19 digits)
+		 * @return false if any character is not a digit
+		 * @note The caller guarantees head.size() + tail.size() <= 32; the value is high * 10^16 + low
+		 */
+		static bool convertDigitRuns( std::string_view head, std::string_view tail, std::uint64_t& high, std::uint64_t& low ) noexcept
+		{
+			high = 0;
+			low = 0;
+
+			// Up to 19 digits fit a single 64-bit accumulator
+			if ( head.size() + tail.size() < constants::DECIMAL_POWER_TABLE_SIZE )
+			{
+				return accumulateDigits( head, low ) && accumulateDigits( tail, low );
+			}
+
+			return convertLongDigitRuns( head, tail, high, low );
+		}
+
+		/**
+		 * @brief Combine the two halves produced by convertDigitRuns
+		 * @param high Value of the leading digits
+		 * @param low Value of the trailing 16 digits
+		 * @return high * 10^16 + low
+		 */
+		static Int128 combineDigitHalves( std::uint64_t high, std::uint64_t low ) noexcept
+		{
+			if ( high == 0 )
+			{
+				return Int128{ low };
+			}
+
+			return Int128{ high } * Int128{ constants::DECIMAL_POWERS_OF_10[constants::SWAR_SPLIT_DIGITS] } + Int128{ low };
+		}
+
+		//=====================================================================
+		// Field parsers
+		//=====================================================================
+
+		/**
+		 * @brief Parse one Decimal field with the same result as Decimal::tryParse
+		 * @param field Field text
+		 * @param result Output value (zero on failure)
+		 * @return true on success
+		 */
+		static bool parseDecimalField( std::string_view field, Decimal& result ) noexcept
+		{
+			const bool negative{ !field.empty() && field[0] == '-' };
+			std::string_view body{ field };
+			if ( !body.empty() && ( body[0] == '-' || body[0] == '+' ) )
+			{
+				body.remove_prefix( 1 );
+			}
+
+			const std::size_t point{ body.find( '.' ) };
+			std::string_view integerPart{ body.substr( 0, point ) };
+			std::string_view fractionPart{ point == std::string_view::npos ? std::string_view{} : body.substr( point + 1 ) };
+
+			const std::size_t digitCount{ integerPart.size() + fractionPart.size() };
+			if ( digitCount == 0 || digitCount > constants::BATCH_DECIMAL_FAST_DIGITS )
+			{
+				return Decimal::tryParse( field, result );
+			}
+
+			// Dropping trailing fractional zeros from the text is what normalization would do
+			while ( !fractionPart.empty() && fractionPart.back() == '0' )
+			{
+				fractionPart.remove_suffix( 1 );
+			}
+
+			std::uint64_t high;
+			std::uint64_t low;
+			if ( !convertDigitRuns( integerPart, fractionPart, high, low ) )
+			{
+				// Second '.', stray characters: let the scalar parser decide
+				return Decimal::tryParse( field, result );
+			}
+
+			const Int128 magnitude{ combineDigitHalves( high, low ) };
+			const std::uint64_t magnitudeLow{ magnitude.toLow() };
+
+			result = Decimal{};
+			result.mantissa()[0] = static_cast<std::uint32_t>( magnitudeLow );
+			result.mantissa()[1] = static_cast<std::uint32_t>( magnitudeLow >> constants::BITS_PER_UINT32 );
+			result.mantissa()[2] = static_cast<std::uint32_t>( magnitude.toHigh() );
+			result.flags() = ( static_cast<std::uint32_t>( fractionPart.size() ) << constants::DECIMAL_SCALE_SHIFT ) |
+							 ( negative ? constants::DECIMAL_SIGN_MASK : 0U );
+
+			return true;
+		}
+
+		/**
+		 * @brief Parse one Int128 field with the same result as Int128::tryParse
+		 * @param field Field text
+		 * @param result Output value (zero on failure)
+		 * @return true on success
+		 */
+		static bool parseInt128Field( std::string_view field, Int128& result ) noexcept
+		{
+			const bool negative{ !field.empty() && field[0] == '-' };
+			std::string_view digits{ field };
+			if ( !digits.empty() && ( digits[0] == '-' || digits[0] == '+' ) )
+			{
+				digits.remove_prefix( 1 );
+			}
+
+			std::uint64_t high;
+			std::uint64_t low;
+			if ( digits.empty() || digits.size() > constants::BATCH_INT128_FAST_DIGITS ||
+				 !convertDigitRuns( digits, std::string_view{}, high, low ) )
+			{
+				if ( !Int128::tryParse( field, result ) )
+				{
+					result = Int128{};
+					return false;
+				}
+				return true;
+			}
+
+			const Int128 magnitude{ combineDigitHalves( high, low ) };
+			result = negative ? -magnitude : magnitude;
+
+			return true;
+		}
+
+		//=====================================================================
+		// Field iteration
+		//=====================================================================
+
+		/**
+		 * @brief Invoke a callback for every field located by offsets
+		 * @param buffer Text holding every field
+		 * @param offsets Field boundaries
+		 * @param callback Called as callback( index, field )
+		 * @return Number of fields
+		 */
+		template <typename Callback>
+		static std::size_t forEachOffsetField( std::string_view buffer, std::span<const std::size_t> offsets, Callback&& callback )
+		{
+			const std::size_t fields{ offsets.empty() ? 0 : offsets.size() - 1 };
+			for ( std::size_t i{ 0 }; i < fields; ++i )
+			{
+				if ( offsets[i + 1] < offsets[i] || offsets[i + 1] > buffer.size() )
+				{
+					throw std::invalid_argument{ "Field offsets out of range" };
+				}
+
+				callback( i, buffer.substr( offsets[i], offsets[i + 1] - offsets[i] ) );
+			}
+
+			return fields;
+		}
+
+		/**
+		 * @brief Invoke a callback for every delimiter-separated field
+		 * @param buffer Text holding every field
+		 * @param delimiter Field separator
+		 * @param callback Called as callback( index, field )
+		 * @return Number of fields
+		 */
+		template <typename Callback>
+		static std::size_t forEachDelimitedField( std::string_view buffer, char delimiter, Callback&& callback )
+		{
+			std::size_t index{ 0 };
+			std::size_t start{ 0 };
+			while ( start < buffer.size() )
+			{
+				std::size_t end{ buffer.find( delimiter, start ) };
+				if ( end == std::string_view::npos )
+				{
+					end = buffer.size();
+				}
+
+				callback( index++, buffer.substr( start, end - start ) );
+				start = end + 1;
+			}
+
+			return index;
+		}
+
+		/**
+		 * @brief Parse fields into a span and record failures in an error bitmap
+		 * @param parseField Field parser (parseDecimalField or parseInt128Field)
+		 * @param destination Output values
+		 * @param errors Error bitmap
+		 * @return Callback suitable for forEachOffsetField / forEachDelimitedField
+		 */
+		template <typename T, typename Parser>
+		static auto spanWriter( Parser parseField, std::span<T> destination, std::span<std::uint64_t> errors )
+		{
+			return [parseField, destination, errors]( std::size_t index, std::string_view field ) {
+				const std::size_t word{ index / VALIDITY_WORD_BITS };
+				if ( index >= destination.size() || word >= errors.size() )
+				{
+					throw std::invalid_argument{ "Destination span is too small" };
+				}
+
+				const std::size_t bit{ index % VALIDITY_WORD_BITS };
+				if ( bit == 0 )
+				{
+					errors[word] = 0U;
+				}
+
+				if ( !parseField( field, destination[index] ) )
+				{
+					destination[index] = T{};
+					errors[word] |= std::uint64_t{ 1 } << bit;
+				}
+			};
+		}
+
+		/**
+		 * @brief Check that the destination and error bitmap can hold every offset-located field
+		 * @param offsets Field boundaries
+		 * @param destinationSize Number of output elements
+		 * @param errorWords Number of error bitmap words
+		 */
+		static void checkOffsetCapacity( std::span<const std::size_t> offsets, std::size_t destinationSize, std::size_t errorWords )
+		{
+			const std::size_t fields{ offsets.empty() ? 0 : offsets.size() - 1 };
+			if ( destinationSize < fields || errorWords < validityWordCount( fields ) )
+			{
+				throw std::invalid_argument{ "Destination span is too small" };
+			}
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// BatchParser class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Decimal parsing
+	//----------------------------------------------
+
+	std::size_t BatchParser::parseDecimals( std::string_view buffer, std::span<const std::size_t> offsets,
+		std::span<Decimal> destination, std::span<std::uint64_t> errors )
+	{
+		internal::checkOffsetCapacity( offsets, destination.size(), errors.size() );
+
+		return internal::forEachOffsetField( buffer, offsets, internal::spanWriter( internal::parseDecimalField, destination, errors ) );
+	}
+
+	std::size_t BatchParser::parseDecimals( std::string_view buffer, char delimiter,
+		std::span<Decimal> destination, std::span<std::uint64_t> errors )
+	{
+		return internal::forEachDelimitedField( buffer, delimiter, internal::spanWriter( internal::parseDecimalField, destination, errors ) );
+	}
+
+	std::size_t BatchParser::parseDecimals( std::string_view buffer, std::span<const std::size_t> offsets, DecimalColumn& column )
+	{
+		column.reserve( column.size() + ( offsets.empty() ? 0 : offsets.size() - 1 ) );
+
+		return internal::forEachOffsetField( buffer, offsets, [&column]( std::size_t, std::string_view field ) {
+			Decimal value;
+			if ( internal::parseDecimalField( field, value ) )
+			{
+				column.append( value );
+			}
+			else
+			{
+				column.appendNull();
+			}
+		} );
+	}
+
+	std::size_t BatchParser::parseDecimals( std::string_view buffer, char delimiter, DecimalColumn& column )
+	{
+		return internal::forEachDelimitedField( buffer, delimiter, [&column]( std::size_t, std::string_view field ) {
+			Decimal value;
+			if ( internal::parseDecimalField( field, value ) )
+			{
+				column.append( value );
+			}
+			else
+			{
+				column.appendNull();
+			}
+		} );
+	}
+
+	//----------------------------------------------
+	// Int128 parsing
+	//----------------------------------------------
+
+	std::size_t BatchParser::parseInt128s( std::string_view buffer, std::span<const std::size_t> offsets,
+		std::span<Int128> destination, std::span<std::uint64_t> errors )
+	{
+		internal::checkOffsetCapacity( offsets, destination.size(), errors.size() );
+
+		return internal::forEachOffsetField( buffer, offsets, internal::spanWriter( internal::parseInt128Field, destination, errors ) );
+	}
+
+	std::size_t BatchParser::parseInt128s( std::string_view buffer, char delimiter,
+		std::span<Int128> destination, std::span<std::uint64_t> errors )
+	{
+		return internal::forEachDelimitedField( buffer, delimiter, internal::spanWriter( internal::parseInt128Field, destination, errors ) );
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,836 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ColumnFile.cpp
+ * @brief Implementation of the column file writer, memory-mapped reader and XXH64 checksum
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined( _WIN32 )
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+#include "nfx/datatypes/ColumnFile.h"
+
+#include "nfx/detail/datatypes/Constants.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		static_assert( sizeof( Decimal64 ) == 8 && std::is_trivially_copyable_v<Decimal64>, "Decimal64 must be 8 trivially copyable bytes" );
+
+		//=====================================================================
+		// Header layout
+		//=====================================================================
+
+		/**
+		 * @brief On-disk header, 64 bytes in host byte order (see ColumnFile.h)
+		 */
+		struct ColumnFileHeader
+		{
+			std::array<std::byte, 8> magic;
+			std::uint16_t version;
+			std::uint8_t type;
+			std::uint8_t scalePolicy;
+			std::uint8_t scale;
+			std::uint8_t valueSize;
+			std::uint16_t reserved0;
+			std::uint32_t byteOrderMarker;
+			std::uint32_t reserved1;
+			std::uint64_t count;
+			std::uint64_t payloadOffset;
+			std::uint64_t payloadChecksum;
+			std::uint64_t reserved2;
+			std::uint64_t headerChecksum;
+		};
+
+		static_assert( sizeof( ColumnFileHeader ) == constants::COLUMN_FILE_HEADER_SIZE && std::is_trivially_copyable_v<ColumnFileHeader> );
+
+		/** @brief Bytes hashed by the header checksum (everything before it) */
+		constexpr std::size_t COLUMN_FILE_HEADER_HASHED_BYTES{ offsetof( ColumnFileHeader, headerChecksum ) };
+
+		/**
+		 * @brief Get the magic bytes "NFXCOLMN"
+		 * @return constants::COLUMN_FILE_MAGIC in little-endian byte order
+		 */
+		static std::array<std::byte, 8> columnFileMagic() noexcept
+		{
+			std::array<std::byte, 8> magic;
+			for ( std::size_t i{ 0 }; i < magic.size(); ++i )
+			{
+				magic[i] = static_cast<std::byte>( constants::COLUMN_FILE_MAGIC >> ( 8 * i ) );
+			}
+
+			return magic;
+		}
+
+		/**
+		 * @brief Get the stored size of one value
+		 * @param type Column type
+		 * @return 16, 8 for Decimal64, or 0 for an unknown type
+		 */
+		static std::size_t valueSize( ColumnType type ) noexcept
+		{
+			switch ( type )
+			{
+				case ColumnType::Decimal:
+				{
+					return sizeof( Decimal );
+				}
+				case ColumnType::Int128:
+				{
+					return sizeof( Int128 );
+				}
+				case ColumnType::Decimal64:
+				{
+					return sizeof( Decimal64 );
+				}
+				default:
+				{
+					return 0;
+				}
+			}
+		}
+
+		//=====================================================================
+		// XXH64 checksum
+		//=====================================================================
+
+		/**
+		 * @brief Read a little-endian 64-bit word
+		 * @param bytes First byte
+		 * @return Word value
+		 */
+		static std::uint64_t readLittleEndian64( const std::byte* bytes ) noexcept
+		{
+			if constexpr ( std::endian::native == std::endian::little )
+			{
+				std::uint64_t word;
+				std::memcpy( &word, bytes, sizeof( word ) );
+
+				return word;
+			}
+			else
+			{
+				std::uint64_t word{ 0 };
+				for ( int i{ 7 }; i >= 0; --i )
+				{
+					word = ( word << 8 ) | std::to_integer<std::uint64_t>( bytes[i] );
+				}
+
+				return word;
+			}
+		}
+
+		/**
+		 * @brief Read a little-endian 32-bit word
+		 * @param bytes First byte
+		 * @return Word value
+		 */
+		static std::uint32_t readLittleEndian32( const std::byte* bytes ) noexcept
+		{
+			std::uint32_t word{ 0 };
+			for ( int i{ 3 }; i >= 0; --i )
+			{
+				word = ( word << 8 ) | std::to_integer<std::uint32_t>( bytes[i] );
+			}
+
+			return word;
+		}
+
+		/**
+		 * @brief Mix one 8-byte lane into an accumulator
+		 * @param accumulator Lane accumulator
+		 * @param lane Input word
+		 * @return Updated accumulator
+		 */
+		static std::uint64_t checksumRound( std::uint64_t accumulator, std::uint64_t lane ) noexcept
+		{
+			accumulator += lane * constants::CHECKSUM_PRIME_2;
+			accumulator = std::rotl( accumulator, 31 );
+
+			return accumulator * constants::CHECKSUM_PRIME_1;
+		}
+
+		/**
+		 * @brief Fold a lane accumulator into the hash
+		 * @param hash Hash so far
+		 * @param accumulator Lane accumulator
+		 * @return Updated hash
+		 */
+		static std::uint64_t checksumMerge( std::uint64_t hash, std::uint64_t accumulator ) noexcept
+		{
+			hash ^= checksumRound( 0, accumulator );
+
+			return hash * constants::CHECKSUM_PRIME_1 + constants::CHECKSUM_PRIME_4;
+		}
+
+		/**
+		 * @brief Reset a streaming checksum (seed 0)
+		 * @param lanes Lane accumulators to initialize
+		 */
+		static void checksumReset( std::array<std::uint64_t, 4>& lanes ) noexcept
+		{
+			lanes = { constants::CHECKSUM_PRIME_1 + constants::CHECKSUM_PRIME_2, constants::CHECKSUM_PRIME_2, 0, 0 - constants::CHECKSUM_PRIME_1 };
+		}
+
+		/**
+		 * @brief Consume whole 32-byte stripes
+		 * @param lanes Lane accumulators
+		 * @param bytes Input (size is a multiple of 32)
+		 */
+		static void checksumStripes( std::array<std::uint64_t, 4>& lanes, std::span<const std::byte> bytes ) noexcept
+		{
+			for ( std::size_t offset{ 0 }; offset < bytes.size(); offset += 32 )
+			{
+				for ( std::size_t lane{ 0 }; lane < 4; ++lane )
+				{
+					lanes[lane] = checksumRound( lanes[lane], readLittleEndian64( bytes.data() + offset + 8 * lane ) );
+				}
+			}
+		}
+
+		/**
+		 * @brief Finish a checksum
+		 * @param lanes Lane accumulators
+		 * @param tail Bytes after the last whole stripe (fewer than 32)
+		 * @param length Total input length
+		 * @return XXH64 digest
+		 */
+		static std::uint64_t checksumDigest( const std::array<std::uint64_t, 4>& lanes, std::span<const std::byte> tail, std::uint64_t length ) noexcept
+		{
+			std::uint64_t hash;
+			if ( length >= 32 )
+			{
+				hash = std::rotl( lanes[0], 1 ) + std::rotl( lanes[1], 7 ) + std::rotl( lanes[2], 12 ) + std::rotl( lanes[3], 18 );
+				for ( const std::uint64_t lane : lanes )
+				{
+					hash = checksumMerge( hash, lane );
+				}
+			}
+			else
+			{
+				hash = constants::CHECKSUM_PRIME_5;
+			}
+
+			hash += length;
+
+			std::size_t offset{ 0 };
+			for ( ; offset + 8 <= tail.size(); offset += 8 )
+			{
+				hash ^= checksumRound( 0, readLittleEndian64( tail.data() + offset ) );
+				hash = std::rotl( hash, 27 ) * constants::CHECKSUM_PRIME_1 + constants::CHECKSUM_PRIME_4;
+			}
+			if ( offset + 4 <= tail.size() )
+			{
+				hash ^= readLittleEndian32( tail.data() + offset ) * constants::CHECKSUM_PRIME_1;
+				hash = std::rotl( hash, 23 ) * constants::CHECKSUM_PRIME_2 + constants::CHECKSUM_PRIME_3;
+				offset += 4;
+			}
+			for ( ; offset < tail.size(); ++offset )
+			{
+				hash ^= std::to_integer<std::uint64_t>( tail[offset] ) * constants::CHECKSUM_PRIME_5;
+				hash = std::rotl( hash, 11 ) * constants::CHECKSUM_PRIME_1;
+			}
+
+			hash ^= hash >> 33;
+			hash *= constants::CHECKSUM_PRIME_2;
+			hash ^= hash >> 29;
+			hash *= constants::CHECKSUM_PRIME_3;
+			hash ^= hash >> 32;
+
+			return hash;
+		}
+
+		/**
+		 * @brief Compute the XXH64 checksum of a buffer (seed 0)
+		 * @param bytes Input
+		 * @return XXH64 digest
+		 */
+		static std::uint64_t checksum( std::span<const std::byte> bytes ) noexcept
+		{
+			std::array<std::uint64_t, 4> lanes;
+			checksumReset( lanes );
+
+			const std::size_t stripeBytes{ bytes.size() & ~std::size_t{ 31 } };
+			checksumStripes( lanes, bytes.first( stripeBytes ) );
+
+			return checksumDigest( lanes, bytes.subspan( stripeBytes ), bytes.size() );
+		}
+
+		//=====================================================================
+		// Errors
+		//=====================================================================
+
+		/**
+		 * @brief Throw the last operating system error
+		 * @param message Description of the failed operation
+		 */
+		[[noreturn]] static void throwSystemError( const char* message )
+		{
+#if defined( _WIN32 )
+			throw std::system_error{ static_cast<int>( ::GetLastError() ), std::system_category(), message };
+#else
+			throw std::system_error{ errno, std::generic_category(), message };
+#endif
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// ColumnFileWriter class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	ColumnFileWriter::ColumnFileWriter( const std::filesystem::path& path, ColumnType type, ColumnScalePolicy policy, std::uint8_t scale )
+		: m_path{ path },
+		  m_checksum{},
+		  m_count{ 0 },
+		  m_type{ type },
+		  m_policy{ policy },
+		  m_scale{ policy == ColumnScalePolicy::Fixed ? scale : std::uint8_t{ 0 } },
+		  m_finished{ false }
+	{
+		if ( internal::valueSize( type ) == 0 )
+		{
+			throw std::invalid_argument{ "Invalid column type" };
+		}
+		if ( policy != ColumnScalePolicy::Preserve &&
+			 ( policy != ColumnScalePolicy::Fixed || type == ColumnType::Int128 || scale > constants::DECIMAL_MAXIMUM_PLACES ) )
+		{
+			throw std::invalid_argument{ "Invalid column scale policy" };
+		}
+
+		internal::checksumReset( m_checksum.lanes );
+
+		m_file.open( path, std::ios::binary | std::ios::trunc );
+		if ( !m_file )
+		{
+			internal::throwSystemError( "Cannot create column file" );
+		}
+
+		// Placeholder header; finish() writes the real one
+		const std::array<std::byte, constants::COLUMN_FILE_HEADER_SIZE> zeros{};
+		if ( !m_file.write( reinterpret_cast<const char*>( zeros.data() ), static_cast<std::streamsize>( zeros.size() ) ) )
+		{
+			internal::throwSystemError( "Cannot write column file" );
+		}
+	}
+
+	ColumnFileWriter::~ColumnFileWriter()
+	{
+		if ( m_finished )
+		{
+			return;
+		}
+
+		// The header is still the zeroed placeholder: drop the partial file
+		m_file.close();
+		std::error_code error;
+		std::filesystem::remove( m_path, error );
+	}
+
+	//----------------------------------------------
+	// Writing
+	//----------------------------------------------
+
+	void ColumnFileWriter::append( std::span<const Decimal> values )
+	{
+		if ( m_type == ColumnType::Int128 )
+		{
+			throw std::invalid_argument{ "Column type mismatch" };
+		}
+		if ( m_policy == ColumnScalePolicy::Fixed &&
+			 std::any_of( values.begin(), values.end(), [this]( const Decimal& value ) { return value.scale() != m_scale; } ) )
+		{
+			throw std::invalid_argument{ "Value scale does not match the column scale" };
+		}
+
+		if ( m_type == ColumnType::Decimal )
+		{
+			writeValues( std::as_bytes( values ), values.size() );
+
+			return;
+		}
+
+		// Pack everything first, so a value that does not fit leaves the file untouched
+		std::vector<Decimal64> packed( values.size() );
+		Decimal64::fromDecimals( values, packed );
+		writeValues( std::as_bytes( std::span<const Decimal64>{ packed } ), packed.size() );
+	}
+
+	void ColumnFileWriter::append( std::span<const Decimal64> values )
+	{
+		if ( m_type != ColumnType::Decimal64 )
+		{
+			throw std::invalid_argument{ "Column type mismatch" };
+		}
+		if ( m_policy == ColumnScalePolicy::Fixed &&
+			 std::any_of( values.begin(), values.end(), [this]( const Decimal64& value ) { return value.scale() != m_scale; } ) )
+		{
+			throw std::invalid_argument{ "Value scale does not match the column scale" };
+		}
+
+		writeValues( std::as_bytes( values ), values.size() );
+	}
+
+	void ColumnFileWriter::append( std::span<const Int128> values )
+	{
+		if ( m_type != ColumnType::Int128 )
+		{
+			throw std::invalid_argument{ "Column type mismatch" };
+		}
+
+		writeValues( std::as_bytes( values ), values.size() );
+	}
+
+	void ColumnFileWriter::finish()
+	{
+		if ( m_finished )
+		{
+			return;
+		}
+		m_finished = true;
+
+		internal::ColumnFileHeader header{};
+		header.magic = internal::columnFileMagic();
+		header.version = constants::COLUMN_FILE_VERSION;
+		header.type = static_cast<std::uint8_t>( m_type );
+		header.scalePolicy = static_cast<std::uint8_t>( m_policy );
+		header.scale = m_scale;
+		header.valueSize = static_cast<std::uint8_t>( internal::valueSize( m_type ) );
+		header.byteOrderMarker = constants::COLUMN_FILE_BYTE_ORDER_MARKER;
+		header.count = m_count;
+		header.payloadOffset = constants::COLUMN_FILE_HEADER_SIZE;
+		header.payloadChecksum = internal::checksumDigest(
+			m_checksum.lanes, std::span<const std::byte>{ m_checksum.pending.data(), m_checksum.pendingSize }, m_checksum.length );
+		header.headerChecksum = internal::checksum( std::as_bytes( std::span{ &header, 1 } ).first( internal::COLUMN_FILE_HEADER_HASHED_BYTES ) );
+
+		m_file.seekp( 0 );
+		m_file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+		m_file.close();
+		if ( !m_file )
+		{
+			internal::throwSystemError( "Cannot write column file" );
+		}
+	}
+
+	//----------------------------------------------
+	// Property accessors
+	//----------------------------------------------
+
+	std::uint64_t ColumnFileWriter::size() const noexcept
+	{
+		return m_count;
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	void ColumnFileWriter::writeValues( std::span<const std::byte> bytes, std::size_t count )
+	{
+		if ( m_finished )
+		{
+			throw std::logic_error{ "Column file is already finished" };
+		}
+
+		if ( !m_file.write( reinterpret_cast<const char*>( bytes.data() ), static_cast<std::streamsize>( bytes.size() ) ) )
+		{
+			internal::throwSystemError( "Cannot write column file" );
+		}
+
+		// Complete the pending stripe, hash whole stripes in place, keep the rest
+		ChecksumState& state{ m_checksum };
+		state.length += bytes.size();
+		if ( state.pendingSize > 0 )
+		{
+			const std::size_t fill{ std::min( bytes.size(), state.pending.size() - state.pendingSize ) };
+			std::memcpy( state.pending.data() + state.pendingSize, bytes.data(), fill );
+			state.pendingSize += fill;
+			bytes = bytes.subspan( fill );
+			if ( state.pendingSize < state.pending.size() )
+			{
+				m_count += count;
+
+				return;
+			}
+
+			internal::checksumStripes( state.lanes, state.pending );
+			state.pendingSize = 0;
+		}
+
+		const std::size_t stripeBytes{ bytes.size() & ~std::size_t{ 31 } };
+		internal::checksumStripes( state.lanes, bytes.first( stripeBytes ) );
+		state.pendingSize = bytes.size() - stripeBytes;
+		std::memcpy( state.pending.data(), bytes.data() + stripeBytes, state.pendingSize );
+
+		m_count += count;
+	}
+
+	//=====================================================================
+	// ColumnFileReader class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	ColumnFileReader::ColumnFileReader( const std::filesystem::path& path )
+		: m_mapping{ nullptr },
+		  m_mappingSize{ 0 },
+		  m_count{ 0 },
+		  m_checksum{ 0 },
+		  m_type{ ColumnType::Decimal },
+		  m_policy{ ColumnScalePolicy::Preserve },
+		  m_scale{ 0 }
+	{
+#if defined( _WIN32 )
+		const HANDLE file{ ::CreateFileW( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr ) };
+		if ( file == INVALID_HANDLE_VALUE )
+		{
+			internal::throwSystemError( "Cannot open column file" );
+		}
+
+		LARGE_INTEGER fileSize;
+		if ( !::GetFileSizeEx( file, &fileSize ) )
+		{
+			::CloseHandle( file );
+			internal::throwSystemError( "Cannot open column file" );
+		}
+		m_mappingSize = static_cast<std::size_t>( fileSize.QuadPart );
+
+		if ( m_mappingSize >= constants::COLUMN_FILE_HEADER_SIZE )
+		{
+			const HANDLE mapping{ ::CreateFileMappingW( file, nullptr, PAGE_READONLY, 0, 0, nullptr ) };
+			::CloseHandle( file );
+			if ( mapping == nullptr )
+			{
+				internal::throwSystemError( "Cannot map column file" );
+			}
+
+			m_mapping = static_cast<const std::byte*>( ::MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+			::CloseHandle( mapping );
+			if ( m_mapping == nullptr )
+			{
+				internal::throwSystemError( "Cannot map column file" );
+			}
+		}
+		else
+		{
+			::CloseHandle( file );
+		}
+#else
+		const int file{ ::open( path.c_str(), O_RDONLY | O_CLOEXEC ) };
+		if ( file < 0 )
+		{
+			internal::throwSystemError( "Cannot open column file" );
+		}
+
+		struct stat status;
+		if ( ::fstat( file, &status ) != 0 )
+		{
+			const int error{ errno };
+			::close( file );
+			throw std::system_error{ error, std::generic_category(), "Cannot open column file" };
+		}
+		m_mappingSize = static_cast<std::size_t>( status.st_size );
+
+		if ( m_mappingSize >= constants::COLUMN_FILE_HEADER_SIZE )
+		{
+			void* mapping{ ::mmap( nullptr, m_mappingSize, PROT_READ, MAP_SHARED, file, 0 ) };
+			const int error{ errno };
+			::close( file );
+			if ( mapping == MAP_FAILED )
+			{
+				throw std::system_error{ error, std::generic_category(), "Cannot map column file" };
+			}
+			m_mapping = static_cast<const std::byte*>( mapping );
+		}
+		else
+		{
+			::close( file );
+		}
+#endif
+
+		// Release the mapping if the header turns out to be invalid
+		ColumnFileReader guard{ std::move( *this ) };
+
+		internal::ColumnFileHeader header;
+		if ( guard.m_mapping == nullptr )
+		{
+			throw std::invalid_argument{ "Invalid column file" };
+		}
+		std::memcpy( &header, guard.m_mapping, sizeof( header ) );
+
+		if ( header.magic != internal::columnFileMagic() || header.version != constants::COLUMN_FILE_VERSION )
+		{
+			throw std::invalid_argument{ "Invalid column file" };
+		}
+		if ( header.byteOrderMarker != constants::COLUMN_FILE_BYTE_ORDER_MARKER )
+		{
+			throw std::invalid_argument{ "Column file byte order does not match this host" };
+		}
+		if ( header.headerChecksum !=
+			 internal::checksum( std::as_bytes( std::span{ &header, 1 } ).first( internal::COLUMN_FILE_HEADER_HASHED_BYTES ) ) )
+		{
+			throw std::invalid_argument{ "Invalid column file" };
+		}
+
+		const auto type{ static_cast<ColumnType>( header.type ) };
+		const std::size_t size{ internal::valueSize( type ) };
+		if ( size == 0 || header.valueSize != size || header.scalePolicy > static_cast<std::uint8_t>( ColumnScalePolicy::Fixed ) ||
+			 header.scale > constants::DECIMAL_MAXIMUM_PLACES || header.payloadOffset != constants::COLUMN_FILE_HEADER_SIZE ||
+			 header.count > ( guard.m_mappingSize - constants::COLUMN_FILE_HEADER_SIZE ) / size ||
+			 guard.m_mappingSize != constants::COLUMN_FILE_HEADER_SIZE + header.count * size )
+		{
+			throw std::invalid_argument{ "Invalid column file" };
+		}
+
+		guard.m_count = static_cast<std::size_t>( header.count );
+		guard.m_checksum = header.payloadChecksum;
+		guard.m_type = type;
+		guard.m_policy = static_cast<ColumnScalePolicy>( header.scalePolicy );
+		guard.m_scale = header.scale;
+
+		*this = std::move( guard );
+	}
+
+	ColumnFileReader::ColumnFileReader( ColumnFileReader&& other ) noexcept
+		: m_mapping{ std::exchange( other.m_mapping, nullptr ) },
+		  m_mappingSize{ std::exchange( other.m_mappingSize, 0 ) },
+		  m_count{ std::exchange( other.m_count, 0 ) },
+		  m_checksum{ other.m_checksum },
+		  m_type{ other.m_type },
+		  m_policy{ other.m_policy },
+		  m_scale{ other.m_scale }
+	{
+	}
+
+	ColumnFileReader& ColumnFileReader::operator=( ColumnFileReader&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			ColumnFileReader released{ std::move( *this ) };
+			m_mapping = std::exchange( other.m_mapping, nullptr );
+			m_mappingSize = std::exchange( other.m_mappingSize, 0 );
+			m_count = std::exchange( other.m_count, 0 );
+			m_checksum = other.m_checksum;
+			m_type = other.m_type;
+			m_policy = other.m_policy;
+			m_scale = other.m_scale;
+		}
+
+		return *this;
+	}
+
+	ColumnFileReader::~ColumnFileReader()
+	{
+		if ( m_mapping == nullptr )
+		{
+			return;
+		}
+
+#if defined( _WIN32 )
+		::UnmapViewOfFile( m_mapping );
+#else
+		::munmap( const_cast<std::byte*>( m_mapping ), m_mappingSize );
+#endif
+	}
+
+	//----------------------------------------------
+	// Values
+	//----------------------------------------------
+
+	std::span<const Decimal> ColumnFileReader::decimals() const
+	{
+		if ( m_type != ColumnType::Decimal )
+		{
+			throw std::invalid_argument{ "Column type mismatch" };
+		}
+
+		// The payload starts 64 bytes into a page-aligned mapping
+		return { reinterpret_cast<const Decimal*>( m_mapping + constants::COLUMN_FILE_HEADER_SIZE ), m_count };
+	}
+
+	std::span<const Int128> ColumnFileReader::int128s() const
+	{
+		if ( m_type != ColumnType::Int128 )
+		{
+			throw std::invalid_argument{ "Column type mismatch" };
+		}
+
+		return { reinterpret_cast<const Int128*>( m_mapping + constants::COLUMN_FILE_HEADER_SIZE ), m_count };
+	}
+
+	std::span<const Decimal64> ColumnFileReader::decimal64s() const
+	{
+		if ( m_type != ColumnType::Decimal64 )
+		{
+			throw std::invalid_argument{ "Column type mismatch" };
+		}
+
+		return { reinterpret_cast<const Decimal64*>( m_mapping + constants::COLUMN_FILE_HEADER_SIZE ), m_count };
+	}
+
+	void ColumnFileReader::toDecimals( std::span<Decimal> destination ) const
+	{
+		if ( destination.size() < m_count )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		switch ( m_type )
+		{
+			case ColumnType::Decimal:
+			{
+				const std::span<const Decimal> values{ decimals() };
+				std::copy( values.begin(), values.end(), destination.begin() );
+				break;
+			}
+			case ColumnType::Decimal64:
+			{
+				Decimal64::toDecimals( decimal64s(), destination );
+				break;
+			}
+			case ColumnType::Int128:
+			default:
+			{
+				throw std::invalid_argument{ "Column type mismatch" };
+			}
+		}
+	}
+
+	std::span<const std::byte> ColumnFileReader::payload() const noexcept
+	{
+		if ( m_mapping == nullptr )
+		{
+			return {};
+		}
+
+		return { m_mapping + constants::COLUMN_FILE_HEADER_SIZE, m_mappingSize - constants::COLUMN_FILE_HEADER_SIZE };
+	}
+
+	//----------------------------------------------
+	// Integrity
+	//----------------------------------------------
+
+	bool ColumnFileReader::verifyChecksum() const noexcept
+	{
+		return internal::checksum( payload() ) == m_checksum;
+	}
+
+	std::size_t ColumnFileReader::findInvalid() const noexcept
+	{
+		const bool fixed{ m_policy == ColumnScalePolicy::Fixed };
+		switch ( m_type )
+		{
+			case ColumnType::Decimal:
+			{
+				const std::span<const Decimal> values{ m_mapping == nullptr ? std::span<const Decimal>{} : decimals() };
+				for ( std::size_t i{ 0 }; i < values.size(); ++i )
+				{
+					Decimal checked;
+					if ( !Decimal::tryFromBits( values[i].toBits(), checked ) || ( fixed && values[i].scale() != m_scale ) )
+					{
+						return i;
+					}
+				}
+				break;
+			}
+			case ColumnType::Decimal64:
+			{
+				const std::span<const Decimal64> values{ m_mapping == nullptr ? std::span<const Decimal64>{} : decimal64s() };
+				for ( std::size_t i{ 0 }; i < values.size(); ++i )
+				{
+					if ( values[i].scale() > constants::DECIMAL_MAXIMUM_PLACES || ( fixed && values[i].scale() != m_scale ) )
+					{
+						return i;
+					}
+				}
+				break;
+			}
+			case ColumnType::Int128:
+			default:
+			{
+				break;
+			}
+		}
+
+		return m_count;
+	}
+
+	//----------------------------------------------
+	// Property accessors
+	//----------------------------------------------
+
+	ColumnType ColumnFileReader::type() const noexcept
+	{
+		return m_type;
+	}
+
+	ColumnScalePolicy ColumnFileReader::scalePolicy() const noexcept
+	{
+		return m_policy;
+	}
+
+	std::uint8_t ColumnFileReader::scale() const noexcept
+	{
+		return m_scale;
+	}
+
+	std::size_t ColumnFileReader::size() const noexcept
+	{
+		return m_count;
+	}
+
+	std::uint64_t ColumnFileReader::checksum() const noexcept
+	{
+		return m_checksum;
+	}
+} // namespace nfx::datatypes
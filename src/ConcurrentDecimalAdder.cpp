@@ -0,0 +1,126 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ConcurrentDecimalAdder.cpp
+ * @brief Implementation of the sharded Decimal adder construction and folding
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <thread>
+
+#include "nfx/datatypes/ConcurrentDecimalAdder.h"
+
+#include "nfx/detail/datatypes/Constants.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// ConcurrentDecimalAdder class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	ConcurrentDecimalAdder::ConcurrentDecimalAdder()
+		: ConcurrentDecimalAdder{ std::min<std::size_t>(
+			  std::max<std::size_t>( 1, std::thread::hardware_concurrency() ), constants::CONCURRENT_ADDER_MAX_DEFAULT_SHARDS ) }
+	{
+	}
+
+	ConcurrentDecimalAdder::ConcurrentDecimalAdder( std::size_t shardCount )
+		: m_shards{ std::make_unique<internal::AdderShard[]>( std::bit_ceil( std::max<std::size_t>( 1, shardCount ) ) ) },
+		  m_mask{ std::bit_ceil( std::max<std::size_t>( 1, shardCount ) ) - 1 }
+	{
+	}
+
+	//----------------------------------------------
+	// Accumulation
+	//----------------------------------------------
+
+	void ConcurrentDecimalAdder::reset() noexcept
+	{
+		visitShards( []( DecimalAccumulator& accumulator ) { accumulator.reset(); } );
+	}
+
+	//----------------------------------------------
+	// Result
+	//----------------------------------------------
+
+	Decimal ConcurrentDecimalAdder::sum() const
+	{
+		return snapshot().result();
+	}
+
+	Decimal ConcurrentDecimalAdder::sum( ArithmeticStatus& status ) const noexcept
+	{
+		return snapshot().result( status );
+	}
+
+	Decimal ConcurrentDecimalAdder::sumThenReset()
+	{
+		return snapshotThenReset().result();
+	}
+
+	DecimalAccumulator ConcurrentDecimalAdder::snapshot() const noexcept
+	{
+		DecimalAccumulator total;
+		visitShards( [&total]( DecimalAccumulator& accumulator ) { total.merge( accumulator ); } );
+
+		return total;
+	}
+
+	DecimalAccumulator ConcurrentDecimalAdder::snapshotThenReset() noexcept
+	{
+		DecimalAccumulator total;
+		visitShards( [&total]( DecimalAccumulator& accumulator ) {
+			total.merge( accumulator );
+			accumulator.reset();
+		} );
+
+		return total;
+	}
+
+	std::uint64_t ConcurrentDecimalAdder::count() const noexcept
+	{
+		std::uint64_t total{ 0 };
+		visitShards( [&total]( DecimalAccumulator& accumulator ) { total += accumulator.count(); } );
+
+		return total;
+	}
+
+	//----------------------------------------------
+	// Internal helpers
+	//----------------------------------------------
+
+	std::size_t ConcurrentDecimalAdder::nextThreadProbe() noexcept
+	{
+		static std::atomic<std::size_t> nextProbe{ 0 };
+
+		return nextProbe.fetch_add( 1, std::memory_order_relaxed );
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,131 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file CpuDispatch.cpp
+ * @brief Implementation of the runtime instruction set detection and override
+ */
+
+#include <atomic>
+#include <stdexcept>
+
+#include "nfx/datatypes/CpuDispatch.h"
+
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#	define NFX_DATATYPES_CPU_DISPATCH_X86 1
+#else
+#	define NFX_DATATYPES_CPU_DISPATCH_X86 0
+#endif
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Detection
+		//=====================================================================
+
+		/**
+		 * @brief Query cpuid for the widest supported instruction set
+		 * @return Detected instruction set
+		 */
+		static CpuDispatch::InstructionSet detectInstructionSet() noexcept
+		{
+#if NFX_DATATYPES_CPU_DISPATCH_X86
+			__builtin_cpu_init();
+			if ( __builtin_cpu_supports( "avx512f" ) )
+			{
+				return CpuDispatch::InstructionSet::Avx512;
+			}
+			if ( __builtin_cpu_supports( "avx2" ) )
+			{
+				return CpuDispatch::InstructionSet::Avx2;
+			}
+#endif
+			return CpuDispatch::InstructionSet::Baseline;
+		}
+
+		/**
+		 * @brief Instruction set detected on first use
+		 * @return Detected instruction set
+		 */
+		static CpuDispatch::InstructionSet detectedInstructionSet() noexcept
+		{
+			static const CpuDispatch::InstructionSet instructionSet{ detectInstructionSet() };
+			return instructionSet;
+		}
+
+		/**
+		 * @brief Instruction set the kernels run, shared by all threads
+		 * @return Active instruction set
+		 */
+		static std::atomic<CpuDispatch::InstructionSet>& activeInstructionSet() noexcept
+		{
+			static std::atomic<CpuDispatch::InstructionSet> instructionSet{ detectedInstructionSet() };
+			return instructionSet;
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// CpuDispatch class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Detection
+	//----------------------------------------------
+
+	CpuDispatch::InstructionSet CpuDispatch::detected() noexcept
+	{
+		return internal::detectedInstructionSet();
+	}
+
+	bool CpuDispatch::isSupported( InstructionSet instructionSet ) noexcept
+	{
+		return instructionSet <= internal::detectedInstructionSet();
+	}
+
+	//----------------------------------------------
+	// Selection
+	//----------------------------------------------
+
+	CpuDispatch::InstructionSet CpuDispatch::active() noexcept
+	{
+		return internal::activeInstructionSet().load( std::memory_order_relaxed );
+	}
+
+	void CpuDispatch::setActive( InstructionSet instructionSet )
+	{
+		if ( !isSupported( instructionSet ) )
+		{
+			throw std::invalid_argument{ "Instruction set is not supported by this CPU" };
+		}
+
+		internal::activeInstructionSet().store( instructionSet, std::memory_order_relaxed );
+	}
+
+	void CpuDispatch::reset() noexcept
+	{
+		internal::activeInstructionSet().store( internal::detectedInstructionSet(), std::memory_order_relaxed );
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Decimal38.cpp
+ * @brief Implementation of Decimal38 string formatting and stream operators
+ */
+
+#include <array>
+#include <istream>
+#include <ostream>
+
+#include "nfx/datatypes/Decimal38.h"
+
+#include "nfx/detail/datatypes/Constants.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
+namespace nfx::datatypes
+{
+	//=====================================================================
+	// Decimal38 class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Type conversion
+	//----------------------------------------------
+
+	std::string Decimal38::toString() const
+	{
+		if ( isZero() )
+		{
+			return "0";
+		}
+
+		// 2^127 has 39 digits; extract 19 at a time with one 64-bit division per chunk
+		std::array<char, constants::DECIMAL_MAX_STRING_LENGTH> digits;
+		std::size_t digitCount{ 0 };
+
+		constexpr std::uint8_t chunkDigits{ constants::DECIMAL_POWER_TABLE_SIZE - 1U };
+		internal::UInt256 magnitude{ internal::decimal38Magnitude( *this ) };
+		while ( !magnitude.isZero() )
+		{
+			std::uint64_t chunk{ magnitude.divideBy( constants::DECIMAL_POWERS_OF_10[chunkDigits] ) };
+			for ( std::uint8_t i{ 0 }; i < chunkDigits && ( chunk != 0 || !magnitude.isZero() ); ++i )
+			{
+				digits[digitCount++] = static_cast<char>( '0' + ( chunk % constants::DECIMAL_BASE ) );
+				chunk /= constants::DECIMAL_BASE;
+			}
+		}
+
+		const std::size_t currentScale{ scale() };
+
+		std::string result;
+		result.reserve( constants::DECIMAL_STRING_BUFFER_SIZE );
+
+		if ( isNegative() )
+		{
+			result.push_back( '-' );
+		}
+
+		if ( currentScale >= digitCount )
+		{
+			// Need leading zeros: "0.00123"
+			result.push_back( '0' );
+			result.push_back( '.' );
+			result.append( currentScale - digitCount, '0' );
+		}
+
+		for ( std::size_t i{ digitCount }; i > 0; --i )
+		{
+			if ( i == currentScale && currentScale < digitCount )
+			{
+				result.push_back( '.' );
+			}
+			result.push_back( digits[i - 1] );
+		}
+
+		return result;
+	}
+
+	//=====================================================================
+	// Stream operators
+	//=====================================================================
+
+	std::ostream& operator<<( std::ostream& os, const Decimal38& value )
+	{
+		return os << value.toString();
+	}
+
+	std::istream& operator>>( std::istream& is, Decimal38& value )
+	{
+		std::string str;
+		is >> str;
+
+		if ( !Decimal38::tryParse( str, value ) )
+		{
+			is.setstate( std::ios::failbit );
+		}
+
+		return is;
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,594 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DecimalFilter.cpp
+ * @brief Implementation of the scalar, AVX2 and AVX-512 Decimal predicate kernels
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <stdexcept>
+#include <tuple>
+
+#include "nfx/datatypes/CpuDispatch.h"
+#include "nfx/datatypes/DecimalFilter.h"
+
+#include "nfx/detail/datatypes/Constants.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#	define NFX_DATATYPES_DECIMAL_FILTER_X86 1
+#	define NFX_DATATYPES_TARGET_AVX2 __attribute__( ( target( "avx2" ) ) )
+#	define NFX_DATATYPES_TARGET_AVX512 __attribute__( ( target( "avx512f" ) ) )
+#	include <immintrin.h>
+#else
+#	define NFX_DATATYPES_DECIMAL_FILTER_X86 0
+#endif
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Bound alignment
+		//=====================================================================
+
+		/**
+		 * @brief How a Decimal bound becomes an integer threshold at a given scale
+		 */
+		enum class BoundKind : std::uint8_t
+		{
+			Unbounded = 0, ///< No bound on this side
+			Ceiling,	   ///< ceil(bound * 10^scale): mantissa >= it means value >= bound
+			FloorPlusOne   ///< floor(bound * 10^scale) + 1: mantissa >= it means value > bound
+		};
+
+		/**
+		 * @brief One side of a range predicate
+		 */
+		struct RangeBound
+		{
+			Decimal value{};
+			BoundKind kind{ BoundKind::Unbounded };
+		};
+
+		/**
+		 * @brief Integer thresholds at one scale: a mantissa m is selected when low <= m < high
+		 */
+		struct ScaleThresholds
+		{
+			Int128 low;
+			Int128 high;
+		};
+
+		/**
+		 * @brief Align a bound to a scale
+		 * @param bound Bound to align
+		 * @param scale Scale of the values it is compared with
+		 * @param lower true for the lower side (an unbounded lower side is the most negative threshold)
+		 * @return Threshold, clamped to +/-2^97
+		 */
+		static Int128 alignBound( const RangeBound& bound, std::uint8_t scale, bool lower ) noexcept
+		{
+			const Int128 limit{ 0ULL, 1ULL << ( constants::DECIMAL_FILTER_THRESHOLD_BITS - constants::BITS_PER_UINT64 ) };
+			if ( bound.kind == BoundKind::Unbounded )
+			{
+				return lower ? -limit : limit;
+			}
+
+			const auto& mantissa{ bound.value.mantissa() };
+			UInt256 magnitude{ static_cast<std::uint64_t>( mantissa[0] ) | ( static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 ), mantissa[2] };
+
+			const std::uint8_t boundScale{ bound.value.scale() };
+			bool exact{ true };
+			if ( scale >= boundScale )
+			{
+				magnitude = multiplyByPowerOf10Wide( magnitude, static_cast<std::uint8_t>( scale - boundScale ) );
+			}
+			else
+			{
+				exact = divideByPowerOf10Truncated( magnitude, static_cast<std::uint32_t>( boundScale - scale ) );
+			}
+
+			Int128 truncated{ limit };
+			if ( magnitude.fitsIn( constants::DECIMAL_FILTER_THRESHOLD_BITS ) )
+			{
+				truncated = Int128{ magnitude.word( 0 ), magnitude.word( 1 ) };
+			}
+			else
+			{
+				exact = true;
+			}
+
+			// Truncation moved a positive bound down and a negative bound up
+			const Int128 inexact{ exact ? 0 : 1 };
+			const Int128 floor{ bound.value.isNegative() ? -truncated - inexact : truncated };
+			const Int128 ceiling{ bound.value.isNegative() ? -truncated : truncated + inexact };
+
+			return bound.kind == BoundKind::Ceiling ? ceiling : floor + Int128{ 1 };
+		}
+
+		/**
+		 * @brief Range predicate with thresholds aligned lazily, once per scale
+		 */
+		class ScaledRange final
+		{
+		public:
+			/**
+			 * @brief Construct a range predicate
+			 * @param lower Lower side
+			 * @param upper Upper side
+			 * @param inverted true to select the values outside the range
+			 */
+			ScaledRange( const RangeBound& lower, const RangeBound& upper, bool inverted ) noexcept
+				: m_lower{ lower },
+				  m_upper{ upper },
+				  m_inverted{ inverted }
+			{
+			}
+
+			/**
+			 * @brief Thresholds for one scale
+			 * @param scale Scale (0-28)
+			 * @return Aligned thresholds, computed on first request
+			 */
+			const ScaleThresholds& at( std::uint8_t scale ) noexcept
+			{
+				if ( ( m_alignedScales & ( 1U << scale ) ) == 0 )
+				{
+					m_thresholds[scale] = { alignBound( m_lower, scale, true ), alignBound( m_upper, scale, false ) };
+					m_alignedScales |= 1U << scale;
+				}
+
+				return m_thresholds[scale];
+			}
+
+			/**
+			 * @brief Check whether the predicate selects values outside the range
+			 * @return true if inverted
+			 */
+			bool inverted() const noexcept
+			{
+				return m_inverted;
+			}
+
+		private:
+			RangeBound m_lower;
+			RangeBound m_upper;
+			bool m_inverted;
+			std::uint32_t m_alignedScales{ 0 };
+			std::array<ScaleThresholds, constants::DECIMAL_MAXIMUM_PLACES + 1U> m_thresholds{};
+		};
+
+		/**
+		 * @brief Build the range predicate of a comparison
+		 * @param comparison Relation to test
+		 * @param bound Right-hand side
+		 * @return Equivalent range predicate
+		 */
+		static ScaledRange comparisonRange( DecimalFilter::Comparison comparison, const Decimal& bound ) noexcept
+		{
+			const RangeBound none{};
+			const RangeBound atLeast{ bound, BoundKind::Ceiling };
+			const RangeBound above{ bound, BoundKind::FloorPlusOne };
+
+			switch ( comparison )
+			{
+				case DecimalFilter::Comparison::Less:
+					return ScaledRange{ none, atLeast, false };
+				case DecimalFilter::Comparison::LessOrEqual:
+					return ScaledRange{ none, above, false };
+				case DecimalFilter::Comparison::Greater:
+					return ScaledRange{ above, none, false };
+				case DecimalFilter::Comparison::GreaterOrEqual:
+					return ScaledRange{ atLeast, none, false };
+				case DecimalFilter::Comparison::Equal:
+					return ScaledRange{ atLeast, above, false };
+				case DecimalFilter::Comparison::NotEqual:
+				default:
+					return ScaledRange{ atLeast, above, true };
+			}
+		}
+
+		//=====================================================================
+		// Scalar kernels
+		//=====================================================================
+
+		/**
+		 * @brief Column storage arrays
+		 */
+		struct ColumnWords
+		{
+			const std::uint64_t* lo64;
+			const std::uint32_t* hi32;
+			const std::uint32_t* scaleSign;
+		};
+
+		/**
+		 * @brief Test values one at a time, reloading the thresholds only when the scale changes
+		 * @param begin First index
+		 * @param end One past the last index (at most begin + 64)
+		 * @param range Predicate
+		 * @param words Callable returning the (lo64, hi32, flags) words of a value by index
+		 * @return Bit i - begin set when value i is selected
+		 */
+		template <typename Words>
+		static inline std::uint64_t selectScalar( std::size_t begin, std::size_t end, ScaledRange& range, Words words ) noexcept
+		{
+			std::uint32_t currentScale{ constants::DECIMAL_SCALE_MASK };
+			Int128 low;
+			Int128 high;
+
+			std::uint64_t bits{ 0 };
+			for ( std::size_t i{ begin }; i < end; ++i )
+			{
+				const auto [lo64, hi32, flags]{ words( i ) };
+
+				const std::uint32_t scale{ flags & constants::DECIMAL_SCALE_MASK };
+				if ( scale != currentScale )
+				{
+					const ScaleThresholds& thresholds{ range.at( static_cast<std::uint8_t>( scale >> constants::DECIMAL_SCALE_SHIFT ) ) };
+					low = thresholds.low;
+					high = thresholds.high;
+					currentScale = scale;
+				}
+
+				const Int128 magnitude{ lo64, static_cast<std::uint64_t>( hi32 ) };
+				const Int128 mantissa{ ( flags & constants::DECIMAL_SIGN_MASK ) != 0 ? -magnitude : magnitude };
+				bits |= static_cast<std::uint64_t>( !( mantissa < low ) && mantissa < high ) << ( i - begin );
+			}
+
+			// Only bits of tested values are flipped
+			const std::uint64_t tested{ end - begin == VALIDITY_WORD_BITS ? ~0ULL : ( 1ULL << ( end - begin ) ) - 1 };
+			return range.inverted() ? bits ^ tested : bits;
+		}
+
+		/**
+		 * @brief Test a run of at most 64 Decimal values
+		 * @param values Values
+		 * @param begin First index
+		 * @param end One past the last index
+		 * @param range Predicate
+		 * @return Bit i - begin set when value i is selected
+		 */
+		static std::uint64_t selectDecimals( std::span<const Decimal> values, std::size_t begin, std::size_t end, ScaledRange& range ) noexcept
+		{
+			return selectScalar( begin, end, range, [values]( std::size_t i ) noexcept {
+				const auto& mantissa{ values[i].mantissa() };
+				return std::tuple{ static_cast<std::uint64_t>( mantissa[0] ) | ( static_cast<std::uint64_t>( mantissa[1] ) << constants::BITS_PER_UINT32 ),
+					mantissa[2], values[i].flags() };
+			} );
+		}
+
+		/**
+		 * @brief Test a run of at most 64 column rows one at a time
+		 * @param column Column storage
+		 * @param begin First row
+		 * @param end One past the last row
+		 * @param range Predicate
+		 * @return Bit i - begin set when row i is selected
+		 */
+		static std::uint64_t selectColumnScalar( const ColumnWords& column, std::size_t begin, std::size_t end, ScaledRange& range ) noexcept
+		{
+			return selectScalar( begin, end, range, [&column]( std::size_t i ) noexcept {
+				return std::tuple{ column.lo64[i], column.hi32[i], column.scaleSign[i] };
+			} );
+		}
+
+#if NFX_DATATYPES_DECIMAL_FILTER_X86
+		//=====================================================================
+		// AVX2 column kernel (four rows per 256-bit vector)
+		//=====================================================================
+
+		/**
+		 * @brief Unsigned 64-bit greater-than (AVX2 only has the signed compare)
+		 * @return All ones in lanes where left > right
+		 */
+		NFX_DATATYPES_TARGET_AVX2 static inline __m256i greaterThanUnsignedAvx2( __m256i left, __m256i right ) noexcept
+		{
+			const __m256i signBit{ _mm256_set1_epi64x( static_cast<long long>( 1ULL << ( constants::BITS_PER_UINT64 - 1 ) ) ) };
+			return _mm256_cmpgt_epi64( _mm256_xor_si256( left, signBit ), _mm256_xor_si256( right, signBit ) );
+		}
+
+		/**
+		 * @brief Signed 128-bit less-than of values split into high and low lanes
+		 * @return All ones in lanes where (high, low) < (thresholdHigh, thresholdLow)
+		 */
+		NFX_DATATYPES_TARGET_AVX2 static inline __m256i lessThanAvx2( __m256i high, __m256i low, __m256i thresholdHigh, __m256i thresholdLow ) noexcept
+		{
+			return _mm256_or_si256( _mm256_cmpgt_epi64( thresholdHigh, high ),
+				_mm256_and_si256( _mm256_cmpeq_epi64( high, thresholdHigh ), greaterThanUnsignedAvx2( thresholdLow, low ) ) );
+		}
+
+		NFX_DATATYPES_TARGET_AVX2 static std::uint64_t selectColumnAvx2( const ColumnWords& column, std::size_t begin, std::size_t end, ScaledRange& range ) noexcept
+		{
+			const __m256i zero{ _mm256_setzero_si256() };
+			const __m256i scaleMask{ _mm256_set1_epi64x( static_cast<long long>( constants::DECIMAL_SCALE_MASK ) ) };
+			const __m256i signMask{ _mm256_set1_epi64x( static_cast<long long>( constants::DECIMAL_SIGN_MASK ) ) };
+			const std::uint64_t invert{ range.inverted() ? ( 1ULL << constants::DECIMAL_FILTER_AVX2_VALUES ) - 1 : 0ULL };
+
+			std::uint32_t currentScale{ constants::DECIMAL_SCALE_MASK };
+			__m256i runScale{ zero };
+			__m256i lowHigh{ zero };
+			__m256i lowLow{ zero };
+			__m256i highHigh{ zero };
+			__m256i highLow{ zero };
+
+			std::uint64_t bits{ 0 };
+			std::size_t i{ begin };
+			for ( ; i + constants::DECIMAL_FILTER_AVX2_VALUES <= end; i += constants::DECIMAL_FILTER_AVX2_VALUES )
+			{
+				const __m256i flags{ _mm256_cvtepu32_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i*>( column.scaleSign + i ) ) ) };
+
+				// Reload the thresholds when a run of another scale starts
+				const std::uint32_t scale{ column.scaleSign[i] & constants::DECIMAL_SCALE_MASK };
+				if ( scale != currentScale )
+				{
+					const ScaleThresholds& thresholds{ range.at( static_cast<std::uint8_t>( scale >> constants::DECIMAL_SCALE_SHIFT ) ) };
+					runScale = _mm256_set1_epi64x( static_cast<long long>( scale ) );
+					lowHigh = _mm256_set1_epi64x( static_cast<long long>( thresholds.low.toHigh() ) );
+					lowLow = _mm256_set1_epi64x( static_cast<long long>( thresholds.low.toLow() ) );
+					highHigh = _mm256_set1_epi64x( static_cast<long long>( thresholds.high.toHigh() ) );
+					highLow = _mm256_set1_epi64x( static_cast<long long>( thresholds.high.toLow() ) );
+					currentScale = scale;
+				}
+
+				// Groups mixing scales are tested row by row
+				if ( _mm256_movemask_pd( _mm256_castsi256_pd( _mm256_cmpeq_epi64( _mm256_and_si256( flags, scaleMask ), runScale ) ) ) != 0xF )
+				{
+					bits |= selectColumnScalar( column, i, i + constants::DECIMAL_FILTER_AVX2_VALUES, range ) << ( i - begin );
+					continue;
+				}
+
+				// Two's complement of sign and magnitude: (high, low) = negative ? -(hi32, lo64) : (hi32, lo64)
+				const __m256i negative{ _mm256_cmpeq_epi64( _mm256_and_si256( flags, signMask ), signMask ) };
+				const __m256i lo64{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( column.lo64 + i ) ) };
+				const __m256i hi32{ _mm256_cvtepu32_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i*>( column.hi32 + i ) ) ) };
+				const __m256i borrow{ _mm256_andnot_si256( _mm256_cmpeq_epi64( lo64, zero ), negative ) };
+				const __m256i low{ _mm256_sub_epi64( _mm256_xor_si256( lo64, negative ), negative ) };
+				const __m256i high{ _mm256_add_epi64( _mm256_sub_epi64( _mm256_xor_si256( hi32, negative ), negative ), borrow ) };
+
+				const __m256i selected{ _mm256_andnot_si256( lessThanAvx2( high, low, lowHigh, lowLow ), lessThanAvx2( high, low, highHigh, highLow ) ) };
+				bits |= ( static_cast<std::uint64_t>( _mm256_movemask_pd( _mm256_castsi256_pd( selected ) ) ) ^ invert ) << ( i - begin );
+			}
+
+			return bits | ( selectColumnScalar( column, i, end, range ) << ( i - begin ) );
+		}
+
+		//=====================================================================
+		// AVX-512 column kernel (eight rows per 512-bit vector)
+		//=====================================================================
+
+		/**
+		 * @brief Signed 128-bit less-than of values split into high and low lanes
+		 * @return Lanes where (high, low) < (thresholdHigh, thresholdLow)
+		 */
+		NFX_DATATYPES_TARGET_AVX512 static inline __mmask8 lessThanAvx512( __m512i high, __m512i low, __m512i thresholdHigh, __m512i thresholdLow ) noexcept
+		{
+			return static_cast<__mmask8>( _mm512_cmplt_epi64_mask( high, thresholdHigh ) |
+										  ( _mm512_cmpeq_epi64_mask( high, thresholdHigh ) & _mm512_cmplt_epu64_mask( low, thresholdLow ) ) );
+		}
+
+		NFX_DATATYPES_TARGET_AVX512 static std::uint64_t selectColumnAvx512( const ColumnWords& column, std::size_t begin, std::size_t end, ScaledRange& range ) noexcept
+		{
+			const __m512i zero{ _mm512_setzero_si512() };
+			const __m512i one{ _mm512_set1_epi64( 1 ) };
+			const __m512i scaleMask{ _mm512_set1_epi64( static_cast<long long>( constants::DECIMAL_SCALE_MASK ) ) };
+			const __m512i signMask{ _mm512_set1_epi64( static_cast<long long>( constants::DECIMAL_SIGN_MASK ) ) };
+			const std::uint64_t invert{ range.inverted() ? ( 1ULL << constants::DECIMAL_FILTER_AVX512_VALUES ) - 1 : 0ULL };
+
+			std::uint32_t currentScale{ constants::DECIMAL_SCALE_MASK };
+			__m512i runScale{ zero };
+			__m512i lowHigh{ zero };
+			__m512i lowLow{ zero };
+			__m512i highHigh{ zero };
+			__m512i highLow{ zero };
+
+			std::uint64_t bits{ 0 };
+			std::size_t i{ begin };
+			for ( ; i + constants::DECIMAL_FILTER_AVX512_VALUES <= end; i += constants::DECIMAL_FILTER_AVX512_VALUES )
+			{
+				const __m512i flags{ _mm512_cvtepu32_epi64( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( column.scaleSign + i ) ) ) };
+
+				const std::uint32_t scale{ column.scaleSign[i] & constants::DECIMAL_SCALE_MASK };
+				if ( scale != currentScale )
+				{
+					const ScaleThresholds& thresholds{ range.at( static_cast<std::uint8_t>( scale >> constants::DECIMAL_SCALE_SHIFT ) ) };
+					runScale = _mm512_set1_epi64( static_cast<long long>( scale ) );
+					lowHigh = _mm512_set1_epi64( static_cast<long long>( thresholds.low.toHigh() ) );
+					lowLow = _mm512_set1_epi64( static_cast<long long>( thresholds.low.toLow() ) );
+					highHigh = _mm512_set1_epi64( static_cast<long long>( thresholds.high.toHigh() ) );
+					highLow = _mm512_set1_epi64( static_cast<long long>( thresholds.high.toLow() ) );
+					currentScale = scale;
+				}
+
+				if ( _mm512_cmpeq_epi64_mask( _mm512_and_si512( flags, scaleMask ), runScale ) != 0xFF )
+				{
+					bits |= selectColumnScalar( column, i, i + constants::DECIMAL_FILTER_AVX512_VALUES, range ) << ( i - begin );
+					continue;
+				}
+
+				const __mmask8 negative{ _mm512_test_epi64_mask( flags, signMask ) };
+				const __m512i lo64{ _mm512_loadu_si512( column.lo64 + i ) };
+				const __m512i hi32{ _mm512_cvtepu32_epi64( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( column.hi32 + i ) ) ) };
+				const __mmask8 borrow{ static_cast<__mmask8>( negative & _mm512_test_epi64_mask( lo64, lo64 ) ) };
+				const __m512i low{ _mm512_mask_sub_epi64( lo64, negative, zero, lo64 ) };
+				const __m512i negatedHigh{ _mm512_mask_sub_epi64( hi32, negative, zero, hi32 ) };
+				const __m512i high{ _mm512_mask_sub_epi64( negatedHigh, borrow, negatedHigh, one ) };
+
+				const unsigned int selected{ static_cast<unsigned int>( lessThanAvx512( high, low, highHigh, highLow ) ) &
+											 ~static_cast<unsigned int>( lessThanAvx512( high, low, lowHigh, lowLow ) ) };
+				bits |= ( ( static_cast<std::uint64_t>( selected ) & 0xFFU ) ^ invert ) << ( i - begin );
+			}
+
+			return bits | ( selectColumnScalar( column, i, end, range ) << ( i - begin ) );
+		}
+#endif
+
+		//=====================================================================
+		// Kernel selection
+		//=====================================================================
+
+		/** @brief Column kernel testing a run of at most 64 rows */
+		using ColumnKernel = std::uint64_t ( * )( const ColumnWords&, std::size_t, std::size_t, ScaledRange& ) noexcept;
+
+		/**
+		 * @brief Column kernels indexed by CpuDispatch::InstructionSet
+		 */
+#if NFX_DATATYPES_DECIMAL_FILTER_X86
+		static constexpr std::array<ColumnKernel, 3> COLUMN_KERNELS{ selectColumnScalar, selectColumnAvx2, selectColumnAvx512 };
+#else
+		static constexpr std::array<ColumnKernel, 3> COLUMN_KERNELS{ selectColumnScalar, selectColumnScalar, selectColumnScalar };
+#endif
+
+		/**
+		 * @brief Column kernel of the active instruction set
+		 * @return Column kernel
+		 */
+		static ColumnKernel columnKernel() noexcept
+		{
+			return COLUMN_KERNELS[static_cast<std::size_t>( CpuDispatch::active() )];
+		}
+
+		//=====================================================================
+		// Predicate evaluation
+		//=====================================================================
+
+		/**
+		 * @brief Check that a selection bitmask covers a number of rows
+		 * @param rows Number of rows
+		 * @param selection Output bitmask
+		 * @throws std::invalid_argument if the bitmask is too small
+		 */
+		static void checkSelection( std::size_t rows, std::span<std::uint64_t> selection )
+		{
+			if ( selection.size() < validityWordCount( rows ) )
+			{
+				throw std::invalid_argument{ "Destination span is too small" };
+			}
+		}
+
+		static void filterDecimals( std::span<const Decimal> values, ScaledRange range, std::span<std::uint64_t> selection )
+		{
+			checkSelection( values.size(), selection );
+
+			for ( std::size_t begin{ 0 }; begin < values.size(); begin += VALIDITY_WORD_BITS )
+			{
+				selection[begin / VALIDITY_WORD_BITS] = selectDecimals( values, begin, std::min( values.size(), begin + VALIDITY_WORD_BITS ), range );
+			}
+		}
+
+		static void filterColumn( const DecimalColumn& column, ScaledRange range, std::span<std::uint64_t> selection )
+		{
+			checkSelection( column.size(), selection );
+
+			const ColumnWords words{ column.lo64().data(), column.hi32().data(), column.scaleSign().data() };
+			const std::span<const std::uint64_t> validity{ column.validity() };
+			const ColumnKernel kernel{ columnKernel() };
+
+			for ( std::size_t begin{ 0 }; begin < column.size(); begin += VALIDITY_WORD_BITS )
+			{
+				const std::size_t word{ begin / VALIDITY_WORD_BITS };
+				const std::uint64_t bits{ kernel( words, begin, std::min( column.size(), begin + VALIDITY_WORD_BITS ), range ) };
+				selection[word] = validity.empty() ? bits : bits & validity[word];
+			}
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// DecimalFilter class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Span predicates
+	//----------------------------------------------
+
+	void DecimalFilter::compare( std::span<const Decimal> values, Comparison comparison, const Decimal& bound, std::span<std::uint64_t> selection )
+	{
+		internal::filterDecimals( values, internal::comparisonRange( comparison, bound ), selection );
+	}
+
+	void DecimalFilter::between( std::span<const Decimal> values, const Decimal& lower, const Decimal& upper, std::span<std::uint64_t> selection )
+	{
+		internal::filterDecimals( values,
+			internal::ScaledRange{ { lower, internal::BoundKind::Ceiling }, { upper, internal::BoundKind::FloorPlusOne }, false }, selection );
+	}
+
+	//----------------------------------------------
+	// Column predicates
+	//----------------------------------------------
+
+	void DecimalFilter::compare( const DecimalColumn& column, Comparison comparison, const Decimal& bound, std::span<std::uint64_t> selection )
+	{
+		internal::filterColumn( column, internal::comparisonRange( comparison, bound ), selection );
+	}
+
+	void DecimalFilter::between( const DecimalColumn& column, const Decimal& lower, const Decimal& upper, std::span<std::uint64_t> selection )
+	{
+		internal::filterColumn( column,
+			internal::ScaledRange{ { lower, internal::BoundKind::Ceiling }, { upper, internal::BoundKind::FloorPlusOne }, false }, selection );
+	}
+
+	//----------------------------------------------
+	// Selection conversion
+	//----------------------------------------------
+
+	std::size_t DecimalFilter::toIndices( std::span<const std::uint64_t> selection, std::size_t count, std::span<std::size_t> indices )
+	{
+		const std::size_t words{ internal::validityWordCount( count ) };
+		if ( selection.size() < words )
+		{
+			throw std::invalid_argument{ "Selection bitmask is too small" };
+		}
+
+		// Bits beyond count in the last word are ignored
+		const auto wordBits{ [&]( std::size_t word ) {
+			const std::size_t rows{ std::min( count - word * internal::VALIDITY_WORD_BITS, internal::VALIDITY_WORD_BITS ) };
+			return rows == internal::VALIDITY_WORD_BITS ? selection[word] : selection[word] & ( ( 1ULL << rows ) - 1 );
+		} };
+
+		std::size_t selected{ 0 };
+		for ( std::size_t word{ 0 }; word < words; ++word )
+		{
+			selected += static_cast<std::size_t>( std::popcount( wordBits( word ) ) );
+		}
+		if ( indices.size() < selected )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		std::size_t written{ 0 };
+		for ( std::size_t word{ 0 }; word < words; ++word )
+		{
+			for ( std::uint64_t bits{ wordBits( word ) }; bits != 0; bits &= bits - 1 )
+			{
+				indices[written++] = word * internal::VALIDITY_WORD_BITS + static_cast<std::size_t>( std::countr_zero( bits ) );
+			}
+		}
+
+		return written;
+	}
+} // namespace nfx::datatypes
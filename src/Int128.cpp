@@ -38,7 +38,7 @@
 #include "nfx/datatypes/Int128.h"
 
 #include "nfx/datatypes/Decimal.h"
-#include "Constants.h"
+#include "nfx/detail/datatypes/Constants.h"
 
 namespace nfx::datatypes
 {
@@ -50,22 +50,6 @@ namespace nfx::datatypes
 	// Construction
 	//----------------------------------------------
 
-#if NFX_DATATYPES_HAS_NATIVE_INT128
-
-	Int128::Int128( std::uint64_t low, std::uint64_t high ) noexcept
-		: m_value{ static_cast<NFX_DATATYPES_NATIVE_INT128>( high ) << constants::BITS_PER_UINT64 | low }
-	{
-	}
-
-#else
-
-	Int128::Int128( std::uint64_t low, std::uint64_t high ) noexcept
-		: m_layout{ low, high }
-	{
-	}
-
-#endif
-
 	Int128::Int128( float val )
 	{
 		// Convert float to Int128, truncating fractional part (like static_cast<int>(float))
@@ -269,321 +253,6 @@ namespace nfx::datatypes
 		}
 	}
 
-	//----------------------------------------------
-	// Arithmetic operations
-	//----------------------------------------------
-
-#if NFX_DATATYPES_HAS_NATIVE_INT128
-
-	Int128 Int128::operator+( const Int128& other ) const noexcept
-	{
-		return Int128{ m_value + other.m_value };
-	}
-
-	Int128 Int128::operator-( const Int128& other ) const noexcept
-	{
-		return Int128{ m_value - other.m_value };
-	}
-
-	Int128 Int128::operator*( const Int128& other ) const noexcept
-	{
-		return Int128{ m_value * other.m_value };
-	}
-
-	Int128 Int128::operator/( const Int128& other ) const
-	{
-		if ( other.m_value == 0 )
-		{
-			throw std::overflow_error{ "Division by zero" };
-		}
-
-		return Int128{ m_value / other.m_value };
-	}
-
-#else
-	Int128 Int128::operator+( const Int128& other ) const noexcept
-	{
-		// 128-bit addition with carry propagation
-		std::uint64_t result_low{ m_layout.lower64bits + other.m_layout.lower64bits };
-		std::uint64_t carry{ ( result_low < m_layout.lower64bits ) ? constants::BIT_MASK_ONE : constants::BIT_MASK_ZERO };
-		std::uint64_t result_high{ m_layout.upper64bits + other.m_layout.upper64bits + carry };
-		return Int128{ result_low, result_high };
-	}
-
-	Int128 Int128::operator-( const Int128& other ) const noexcept
-	{
-		// 128-bit subtraction with borrow propagation
-		std::uint64_t result_low{ m_layout.lower64bits - other.m_layout.lower64bits };
-		std::uint64_t borrow{ ( m_layout.lower64bits < other.m_layout.lower64bits ) ? constants::BIT_MASK_ONE : constants::BIT_MASK_ZERO };
-		std::uint64_t result_high{ m_layout.upper64bits - other.m_layout.upper64bits - borrow };
-		return Int128{ result_low, result_high };
-	}
-
-	Int128 Int128::operator*( const Int128& other ) const noexcept
-	{
-		// 128-bit multiplication using Karatsuba-style algorithm (https://en.wikipedia.org/wiki/Karatsuba_algorithm)
-		// Performance: Breaks 64x64 multiplication into 32x32 operations
-		// to leverage hardware multipliers efficiently on all platforms
-		std::uint64_t a_low{ m_layout.lower64bits & constants::UINT32_MAX_VALUE };
-		std::uint64_t a_high{ m_layout.lower64bits >> constants::BITS_PER_UINT32 };
-		std::uint64_t b_low{ other.m_layout.lower64bits & constants::UINT32_MAX_VALUE };
-		std::uint64_t b_high{ other.m_layout.lower64bits >> constants::BITS_PER_UINT32 }; // Four 32x32->64 multiplications
-		std::uint64_t p0{ a_low * b_low };
-		std::uint64_t p1{ a_low * b_high };
-		std::uint64_t p2{ a_high * b_low };
-		std::uint64_t p3{ a_high * b_high };
-
-		// Carry computation for intermediate sum
-		std::uint64_t carry{
-			( ( p0 >> constants::BITS_PER_UINT32 ) +
-				( p1 & constants::UINT32_MAX_VALUE ) +
-				( p2 & constants::UINT32_MAX_VALUE ) ) >>
-			constants::BITS_PER_UINT32 }; // Final result assembly
-
-		std::uint64_t result_low{
-			p0 +
-			( p1 << constants::BITS_PER_UINT32 ) +
-			( p2 << constants::BITS_PER_UINT32 ) };
-
-		std::uint64_t result_high{
-			p3 +
-			( p1 >> constants::BITS_PER_UINT32 ) +
-			( p2 >> constants::BITS_PER_UINT32 ) +
-			carry +
-			m_layout.upper64bits * other.m_layout.lower64bits +
-			m_layout.lower64bits * other.m_layout.upper64bits };
-
-		return Int128{ result_low, result_high };
-	}
-
-	Int128 Int128::operator/( const Int128& other ) const
-	{
-		if ( other.isZero() )
-		{
-			throw std::overflow_error{ "Division by zero" };
-		}
-
-		// Performance optimization: Fast path for 64-bit values
-		// Avoids expensive 128-bit division when possible
-		if ( m_layout.upper64bits == 0 && other.m_layout.upper64bits == 0 )
-		{
-			// Both fit in 64-bit - use native division
-			return Int128{ m_layout.lower64bits / other.m_layout.lower64bits, 0 };
-		}
-
-		// Optimized path: dividend is 128-bit but divisor fits in 64-bit
-		// Use precise 128/64 division algorithm
-		if ( other.m_layout.upper64bits == 0 )
-		{
-			std::uint64_t divisor{ other.m_layout.lower64bits };
-
-			// Divide high part first
-			std::uint64_t high_quotient{ m_layout.upper64bits / divisor };
-			std::uint64_t high_remainder{ m_layout.upper64bits % divisor };
-
-			// Now divide (high_remainder << 64 + m_layout.lower64bits) by divisor
-			// This is equivalent to dividing a 128-bit number by a 64-bit number
-			if ( high_remainder == 0 )
-			{
-				// Simple case: high part divides evenly
-				std::uint64_t low_quotient{ m_layout.lower64bits / divisor };
-				return Int128{ low_quotient, high_quotient };
-			}
-			else
-			{
-				// Complex case: use long division for the remainder
-				// We need to compute (high_remainder * 2^64 + m_layout.lower64bits) / divisor
-
-				// Split the lower 64 bits into two 32-bit parts for easier handling
-				std::uint64_t low_high{ m_layout.lower64bits >> constants::BITS_PER_UINT32 };
-				std::uint64_t low_low{ m_layout.lower64bits & constants::UINT32_MAX_VALUE }; // Divide (high_remainder << 32 + low_high) by divisor
-				std::uint64_t temp_dividend{ ( high_remainder << constants::BITS_PER_UINT32 ) + low_high };
-				std::uint64_t temp_quotient{ temp_dividend / divisor };
-				std::uint64_t temp_remainder{ temp_dividend % divisor };
-
-				// Divide (temp_remainder << 32 + low_low) by divisor
-				std::uint64_t final_dividend{ ( temp_remainder << constants::BITS_PER_UINT32 ) + low_low };
-				std::uint64_t final_quotient{ final_dividend / divisor };
-
-				// Combine the quotients */
-				std::uint64_t low_quotient{ ( temp_quotient << constants::BITS_PER_UINT32 ) + final_quotient };
-				return Int128{ low_quotient, high_quotient };
-			}
-		}
-
-		// General case: 128-bit / 128-bit division using binary long division
-		// This handles all cases where both operands require the full 128-bit range
-
-		// Handle sign for signed division
-		bool result_negative{ false };
-		Int128 abs_dividend{ *this };
-		Int128 abs_divisor{ other };
-
-		if ( abs_dividend.isNegative() )
-		{
-			result_negative = !result_negative;
-			abs_dividend = -abs_dividend;
-		}
-
-		if ( abs_divisor.isNegative() )
-		{
-			result_negative = !result_negative;
-			abs_divisor = -abs_divisor;
-		}
-
-		// Early exit for simple cases
-		if ( abs_dividend < abs_divisor )
-		{
-			return Int128{ 0, 0 };
-		}
-
-		if ( abs_dividend == abs_divisor )
-		{
-			return result_negative ? Int128{ 0, 0 } - Int128{ 1, 0 } : Int128{ 1, 0 };
-		}
-
-		// Binary long division algorithm
-		Int128 quotient{ 0, 0 };
-		Int128 remainder{ 0, 0 };
-
-		// Process bits from most significant to least significant
-		for ( int i{ constants::INT_128_MAX_BIT_INDEX }; i >= 0; --i )
-		{
-			// Shift remainder left by 1
-			remainder = remainder + remainder; // equivalent to << 1
-
-			// Set the least significant bit of remainder to the i-th bit of dividend
-			if ( ( i >= constants::BITS_PER_UINT64 &&
-					 ( ( abs_dividend.m_layout.upper64bits >> ( i - constants::BITS_PER_UINT64 ) ) & 1 ) ) ||
-				 ( i < constants::BITS_PER_UINT64 &&
-					 ( ( abs_dividend.m_layout.lower64bits >> i ) & 1 ) ) )
-			{
-				remainder = remainder + Int128{ 1, 0 };
-			}
-
-			// If remainder >= divisor, subtract divisor and set quotient bit
-			if ( !( remainder < abs_divisor ) )
-			{
-				remainder = remainder - abs_divisor;
-
-				// Set the i-th bit of quotient
-				if ( i >= constants::BITS_PER_UINT64 )
-				{
-					quotient.m_layout.upper64bits |= ( constants::BIT_MASK_ONE << ( i - constants::BITS_PER_UINT64 ) );
-				}
-				else
-				{
-					quotient.m_layout.lower64bits |= ( constants::BIT_MASK_ONE << i );
-				}
-			}
-		}
-		return result_negative ? Int128{ 0, 0 } - quotient : quotient;
-	}
-#endif
-
-	//----------------------------------------------
-	// String parsing and conversion
-	//----------------------------------------------
-
-	Int128 Int128::parse( std::string_view str )
-	{
-		Int128 result;
-		if ( !tryParse( str, result ) )
-		{
-			throw std::invalid_argument{ "Invalid Int128 string format" };
-		}
-
-		return result;
-	}
-
-	bool Int128::tryParse( std::string_view str, Int128& result ) noexcept
-	{
-		try
-		{
-			if ( str.empty() )
-			{
-				return false;
-			}
-
-			// Handle sign
-			bool isNegative = false;
-			size_t pos = 0;
-
-			if ( str[0] == '-' )
-			{
-				isNegative = true;
-				pos = 1;
-			}
-			else if ( str[0] == '+' )
-			{
-				pos = 1;
-			}
-
-			// Check if we have digits after sign
-			if ( pos >= str.length() )
-			{
-				return false;
-			}
-
-			// Parse digits and build the number
-			result = Int128{ 0 };
-
-			// Quick overflow check: if string is too long, it's definitely overflow
-			size_t digitCount = str.length() - pos;
-			if ( digitCount > constants::INT_128_MAX_DIGIT_COUNT )
-			{
-				return false;
-			}
-
-			// For exactly 39 digits, we need to check against max values
-			if ( digitCount == constants::INT_128_MAX_DIGIT_COUNT )
-			{
-				std::string_view digits = str.substr( pos );
-
-				if ( !isNegative )
-				{
-					// Check against max positive
-					if ( digits > constants::INT_128_MAX_POSITIVE_STRING )
-					{
-						return false;
-					}
-				}
-				else
-				{
-					// Check against max negative (absolute value)
-					if ( digits > constants::INT_128_MAX_NEGATIVE_STRING )
-					{
-						return false;
-					}
-				}
-			}
-
-			for ( size_t i = pos; i < str.length(); ++i )
-			{
-				char c{ str[i] };
-				if ( c < '0' || c > '9' )
-				{
-					return false; // Invalid character
-				}
-
-				int digit = c - '0';
-				result = result * Int128{ constants::INT_128_BASE } + Int128{ digit };
-			}
-
-			// Apply sign
-			if ( isNegative )
-			{
-				result = -result;
-			}
-
-			return true;
-		}
-		catch ( ... )
-		{
-			return false;
-		}
-	}
-
 	//----------------------------------------------
 	// Type conversion
 	//----------------------------------------------
@@ -627,21 +296,6 @@ namespace nfx::datatypes
 		return result;
 	}
 
-	std::array<std::int32_t, 4> Int128::toBits() const noexcept
-	{
-		std::array<std::int32_t, 4> bits{};
-
-		// Extract from low/high 64-bit words (works on both platforms via toLow/toHigh)
-		std::uint64_t low = toLow();
-		std::uint64_t high = toHigh();
-
-		bits[0] = static_cast<std::int32_t>( low );
-		bits[1] = static_cast<std::int32_t>( low >> constants::BITS_PER_UINT32 );
-		bits[2] = static_cast<std::int32_t>( high );
-		bits[3] = static_cast<std::int32_t>( high >> constants::BITS_PER_UINT32 );
-		return bits;
-	}
-
 	//----------------------------------------------
 	// Comparison with built-in floating point types
 	//----------------------------------------------
@@ -758,38 +412,6 @@ namespace nfx::datatypes
 	}
 #endif
 
-	//----------------------------------------------
-	// Access operations
-	//----------------------------------------------
-
-#if NFX_DATATYPES_HAS_NATIVE_INT128
-
-	std::uint64_t Int128::toLow() const noexcept
-	{
-		return static_cast<std::uint64_t>( m_value );
-	}
-
-	std::uint64_t Int128::toHigh() const noexcept
-	{
-		return static_cast<std::uint64_t>( m_value >> constants::BITS_PER_UINT64 );
-	}
-
-	NFX_DATATYPES_NATIVE_INT128 Int128::toNative() const noexcept
-	{
-		return m_value;
-	}
-#else
-	std::uint64_t Int128::toLow() const noexcept
-	{
-		return m_layout.lower64bits;
-	}
-
-	std::uint64_t Int128::toHigh() const noexcept
-	{
-		return m_layout.upper64bits;
-	}
-#endif
-
 	//=====================================================================
 	// Stream operators
 	//=====================================================================
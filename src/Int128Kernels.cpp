@@ -0,0 +1,580 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Int128Kernels.cpp
+ * @brief Implementation of the scalar, AVX2 and AVX-512 Int128 span kernels
+ */
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#include "nfx/datatypes/CpuDispatch.h"
+#include "nfx/datatypes/DecimalColumn.h"
+#include "nfx/datatypes/Int128Kernels.h"
+
+#include "nfx/detail/datatypes/Constants.h"
+
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+#	define NFX_DATATYPES_INT128_KERNELS_X86 1
+#	define NFX_DATATYPES_TARGET_AVX2 __attribute__( ( target( "avx2" ) ) )
+#	define NFX_DATATYPES_TARGET_AVX512 __attribute__( ( target( "avx512f" ) ) )
+#	include <immintrin.h>
+#else
+#	define NFX_DATATYPES_INT128_KERNELS_X86 0
+#endif
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		// The vector kernels load each value as its low word followed by its high word
+		static_assert( sizeof( Int128 ) == 2 * sizeof( std::uint64_t ), "Int128 must be two 64-bit words" );
+
+		//=====================================================================
+		// Exact 192-bit sum
+		//=====================================================================
+
+		/**
+		 * @brief Two's complement 192-bit total, least significant word first
+		 */
+		using WideSum = std::array<std::uint64_t, 3>;
+
+		/**
+		 * @brief Add an unsigned value at a word position, propagating the carry
+		 * @param total Total to update
+		 * @param word Index of the word receiving the value
+		 * @param value Value to add
+		 */
+		static void addAt( WideSum& total, std::size_t word, std::uint64_t value ) noexcept
+		{
+			for ( ; word < total.size() && value != 0; ++word )
+			{
+				total[word] += value;
+				value = total[word] < value ? 1U : 0U;
+			}
+		}
+
+		/**
+		 * @brief Add an unsigned value shifted left by a multiple of 32 bits
+		 * @param total Total to update
+		 * @param value Value to add
+		 * @param shift Shift in bits (0, 32, 64 or 96)
+		 */
+		static void addShifted( WideSum& total, std::uint64_t value, int shift ) noexcept
+		{
+			const std::size_t word{ static_cast<std::size_t>( shift / constants::BITS_PER_UINT64 ) };
+			const int bits{ shift % constants::BITS_PER_UINT64 };
+
+			addAt( total, word, value << bits );
+			if ( bits != 0 )
+			{
+				addAt( total, word + 1, value >> ( constants::BITS_PER_UINT64 - bits ) );
+			}
+		}
+
+		/**
+		 * @brief Add Int128 values to a total one at a time
+		 * @param values First value
+		 * @param count Number of values
+		 * @param total Total to update
+		 */
+		static void sumScalar( const Int128* values, std::size_t count, WideSum& total ) noexcept
+		{
+			std::uint64_t low{ total[0] };
+			std::uint64_t middle{ total[1] };
+			std::uint64_t high{ total[2] };
+
+			for ( std::size_t i{ 0 }; i < count; ++i )
+			{
+				const std::uint64_t valueLow{ values[i].toLow() };
+				const std::uint64_t valueHigh{ values[i].toHigh() };
+
+				low += valueLow;
+				const std::uint64_t lowCarry{ low < valueLow ? 1U : 0U };
+				middle += lowCarry;
+				const std::uint64_t carryOverflow{ middle < lowCarry ? 1U : 0U };
+				middle += valueHigh;
+				const std::uint64_t middleCarry{ middle < valueHigh ? 1U : 0U };
+
+				// A negative high word sign-extends to all ones in the top word
+				high += carryOverflow + middleCarry - ( valueHigh >> ( constants::BITS_PER_UINT64 - 1 ) );
+			}
+
+			total = { low, middle, high };
+		}
+
+		/**
+		 * @brief Narrow a 192-bit total to Int128
+		 * @param total Exact total
+		 * @param status Raises Overflow if the total does not fit
+		 * @return Total, or the nearest Int128 limit on overflow
+		 */
+		static Int128 narrowSum( const WideSum& total, ArithmeticStatus& status ) noexcept
+		{
+			const std::uint64_t signExtension{ ( total[1] >> ( constants::BITS_PER_UINT64 - 1 ) ) != 0 ? ~0ULL : 0ULL };
+			if ( total[2] != signExtension )
+			{
+				status |= ArithmeticStatus::Overflow;
+				return saturatedInt128( ( total[2] >> ( constants::BITS_PER_UINT64 - 1 ) ) != 0 );
+			}
+
+			return Int128{ total[0], total[1] };
+		}
+
+		//=====================================================================
+		// Scalar kernels
+		//=====================================================================
+
+		static void addScalar( const Int128* left, const Int128* right, Int128* result, std::size_t count ) noexcept
+		{
+			for ( std::size_t i{ 0 }; i < count; ++i )
+			{
+				result[i] = left[i] + right[i];
+			}
+		}
+
+		static void subtractScalar( const Int128* left, const Int128* right, Int128* result, std::size_t count ) noexcept
+		{
+			for ( std::size_t i{ 0 }; i < count; ++i )
+			{
+				result[i] = left[i] - right[i];
+			}
+		}
+
+		static void negateScalar( const Int128* values, Int128* result, std::size_t count ) noexcept
+		{
+			for ( std::size_t i{ 0 }; i < count; ++i )
+			{
+				result[i] = -values[i];
+			}
+		}
+
+		/**
+		 * @brief Compare a run of at most 64 values
+		 * @param left First operands
+		 * @param right Second operands
+		 * @param begin First index
+		 * @param end One past the last index
+		 * @return Bit i - begin set when left[i] < right[i]
+		 */
+		static std::uint64_t lessThanBits( const Int128* left, const Int128* right, std::size_t begin, std::size_t end ) noexcept
+		{
+			std::uint64_t bits{ 0 };
+			for ( std::size_t i{ begin }; i < end; ++i )
+			{
+				bits |= static_cast<std::uint64_t>( left[i] < right[i] ) << ( i - begin );
+			}
+
+			return bits;
+		}
+
+		static void lessThanScalar( const Int128* left, const Int128* right, std::size_t count, std::uint64_t* mask ) noexcept
+		{
+			for ( std::size_t begin{ 0 }; begin < count; begin += VALIDITY_WORD_BITS )
+			{
+				mask[begin / VALIDITY_WORD_BITS] = lessThanBits( left, right, begin, std::min( count, begin + VALIDITY_WORD_BITS ) );
+			}
+		}
+
+#if NFX_DATATYPES_INT128_KERNELS_X86
+		//=====================================================================
+		// AVX2 kernels (two values per 256-bit vector)
+		//=====================================================================
+
+		/**
+		 * @brief Unsigned 64-bit greater-than (AVX2 only has the signed compare)
+		 * @return All ones in lanes where left > right
+		 */
+		NFX_DATATYPES_TARGET_AVX2 static inline __m256i greaterThanUnsignedAvx2( __m256i left, __m256i right ) noexcept
+		{
+			const __m256i signBit{ _mm256_set1_epi64x( static_cast<long long>( 1ULL << ( constants::BITS_PER_UINT64 - 1 ) ) ) };
+			return _mm256_cmpgt_epi64( _mm256_xor_si256( left, signBit ), _mm256_xor_si256( right, signBit ) );
+		}
+
+		NFX_DATATYPES_TARGET_AVX2 static void addAvx2( const Int128* left, const Int128* right, Int128* result, std::size_t count ) noexcept
+		{
+			std::size_t i{ 0 };
+			for ( ; i + constants::INT128_KERNEL_AVX2_VALUES <= count; i += constants::INT128_KERNEL_AVX2_VALUES )
+			{
+				const __m256i a{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( left + i ) ) };
+				const __m256i b{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( right + i ) ) };
+				const __m256i sum{ _mm256_add_epi64( a, b ) };
+
+				// A low lane that wrapped is all ones; moving it up one lane subtracts -1 from the high word
+				const __m256i carry{ _mm256_slli_si256( greaterThanUnsignedAvx2( a, sum ), 8 ) };
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( result + i ), _mm256_sub_epi64( sum, carry ) );
+			}
+
+			addScalar( left + i, right + i, result + i, count - i );
+		}
+
+		NFX_DATATYPES_TARGET_AVX2 static void subtractAvx2( const Int128* left, const Int128* right, Int128* result, std::size_t count ) noexcept
+		{
+			std::size_t i{ 0 };
+			for ( ; i + constants::INT128_KERNEL_AVX2_VALUES <= count; i += constants::INT128_KERNEL_AVX2_VALUES )
+			{
+				const __m256i a{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( left + i ) ) };
+				const __m256i b{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( right + i ) ) };
+				const __m256i borrow{ _mm256_slli_si256( greaterThanUnsignedAvx2( b, a ), 8 ) };
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( result + i ), _mm256_add_epi64( _mm256_sub_epi64( a, b ), borrow ) );
+			}
+
+			subtractScalar( left + i, right + i, result + i, count - i );
+		}
+
+		NFX_DATATYPES_TARGET_AVX2 static void negateAvx2( const Int128* values, Int128* result, std::size_t count ) noexcept
+		{
+			const __m256i zero{ _mm256_setzero_si256() };
+
+			std::size_t i{ 0 };
+			for ( ; i + constants::INT128_KERNEL_AVX2_VALUES <= count; i += constants::INT128_KERNEL_AVX2_VALUES )
+			{
+				const __m256i value{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( values + i ) ) };
+
+				// 0 - low borrows whenever low is non-zero
+				const __m256i borrow{ _mm256_slli_si256( _mm256_xor_si256( _mm256_cmpeq_epi64( value, zero ), _mm256_set1_epi64x( -1 ) ), 8 ) };
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( result + i ), _mm256_add_epi64( _mm256_sub_epi64( zero, value ), borrow ) );
+			}
+
+			negateScalar( values + i, result + i, count - i );
+		}
+
+		NFX_DATATYPES_TARGET_AVX2 static void lessThanAvx2( const Int128* left, const Int128* right, std::size_t count, std::uint64_t* mask ) noexcept
+		{
+			for ( std::size_t begin{ 0 }; begin < count; begin += VALIDITY_WORD_BITS )
+			{
+				const std::size_t end{ std::min( count, begin + VALIDITY_WORD_BITS ) };
+				std::uint64_t bits{ 0 };
+
+				std::size_t i{ begin };
+				for ( ; i + constants::INT128_KERNEL_AVX2_VALUES <= end; i += constants::INT128_KERNEL_AVX2_VALUES )
+				{
+					const __m256i a{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( left + i ) ) };
+					const __m256i b{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( right + i ) ) };
+
+					// Decided by the signed high lanes, or by the unsigned low lanes when the high lanes are equal
+					const __m256i lowLess{ _mm256_slli_si256( greaterThanUnsignedAvx2( b, a ), 8 ) };
+					const __m256i less{ _mm256_or_si256( _mm256_cmpgt_epi64( b, a ), _mm256_and_si256( _mm256_cmpeq_epi64( a, b ), lowLess ) ) };
+
+					// The high lanes (1 and 3) carry the result of each value
+					const auto lanes{ static_cast<std::uint64_t>( _mm256_movemask_pd( _mm256_castsi256_pd( less ) ) ) };
+					bits |= ( ( ( lanes >> 1 ) & 1U ) | ( ( lanes >> 2 ) & 2U ) ) << ( i - begin );
+				}
+
+				mask[begin / VALIDITY_WORD_BITS] = bits | ( lessThanBits( left, right, i, end ) << ( i - begin ) );
+			}
+		}
+
+		NFX_DATATYPES_TARGET_AVX2 static void sumAvx2( const Int128* values, std::size_t count, WideSum& total ) noexcept
+		{
+			const __m256i lowHalf{ _mm256_set1_epi64x( static_cast<long long>( constants::UINT32_MAX_VALUE ) ) };
+
+			std::size_t i{ 0 };
+			while ( count - i >= constants::INT128_KERNEL_AVX2_VALUES )
+			{
+				const std::size_t blockEnd{ i + std::min( ( count - i ) & ~( constants::INT128_KERNEL_AVX2_VALUES - 1 ), constants::INT128_KERNEL_SUM_BLOCK_VALUES ) };
+				__m256i lowHalves{ _mm256_setzero_si256() };
+				__m256i highHalves{ _mm256_setzero_si256() };
+				__m256i signs{ _mm256_setzero_si256() };
+
+				for ( ; i < blockEnd; i += constants::INT128_KERNEL_AVX2_VALUES )
+				{
+					const __m256i value{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( values + i ) ) };
+					lowHalves = _mm256_add_epi64( lowHalves, _mm256_and_si256( value, lowHalf ) );
+					highHalves = _mm256_add_epi64( highHalves, _mm256_srli_epi64( value, constants::BITS_PER_UINT32 ) );
+					signs = _mm256_add_epi64( signs, _mm256_srli_epi64( value, constants::BITS_PER_UINT64 - 1 ) );
+				}
+
+				alignas( 32 ) std::array<std::uint64_t, 4> lowLanes;
+				alignas( 32 ) std::array<std::uint64_t, 4> highLanes;
+				alignas( 32 ) std::array<std::uint64_t, 4> signLanes;
+				_mm256_store_si256( reinterpret_cast<__m256i*>( lowLanes.data() ), lowHalves );
+				_mm256_store_si256( reinterpret_cast<__m256i*>( highLanes.data() ), highHalves );
+				_mm256_store_si256( reinterpret_cast<__m256i*>( signLanes.data() ), signs );
+
+				// Even lanes hold low words (bits 0-63), odd lanes high words (bits 64-127)
+				for ( std::size_t lane{ 0 }; lane < lowLanes.size(); ++lane )
+				{
+					const int shift{ lane % 2 == 0 ? 0 : constants::BITS_PER_UINT64 };
+					addShifted( total, lowLanes[lane], shift );
+					addShifted( total, highLanes[lane], shift + constants::BITS_PER_UINT32 );
+				}
+				total[2] -= signLanes[1] + signLanes[3];
+			}
+
+			sumScalar( values + i, count - i, total );
+		}
+
+		//=====================================================================
+		// AVX-512 kernels (four values per 512-bit vector)
+		//=====================================================================
+
+		/** @brief Mask of the high (odd) lanes of a 512-bit vector of Int128 values */
+		inline constexpr unsigned int AVX512_HIGH_LANES{ 0xAAU };
+
+		/**
+		 * @brief Move each low-lane flag to the high lane of the same value
+		 * @param lanes Per-lane flags
+		 * @return Flags on the high lanes only
+		 */
+		static inline __mmask8 toHighLanes( __mmask8 lanes ) noexcept
+		{
+			return static_cast<__mmask8>( ( static_cast<unsigned int>( lanes ) << 1 ) & AVX512_HIGH_LANES );
+		}
+
+		NFX_DATATYPES_TARGET_AVX512 static void addAvx512( const Int128* left, const Int128* right, Int128* result, std::size_t count ) noexcept
+		{
+			const __m512i one{ _mm512_set1_epi64( 1 ) };
+
+			std::size_t i{ 0 };
+			for ( ; i + constants::INT128_KERNEL_AVX512_VALUES <= count; i += constants::INT128_KERNEL_AVX512_VALUES )
+			{
+				const __m512i a{ _mm512_loadu_si512( left + i ) };
+				const __m512i b{ _mm512_loadu_si512( right + i ) };
+				const __m512i sum{ _mm512_add_epi64( a, b ) };
+				const __mmask8 carry{ toHighLanes( _mm512_cmplt_epu64_mask( sum, a ) ) };
+				_mm512_storeu_si512( result + i, _mm512_mask_add_epi64( sum, carry, sum, one ) );
+			}
+
+			addScalar( left + i, right + i, result + i, count - i );
+		}
+
+		NFX_DATATYPES_TARGET_AVX512 static void subtractAvx512( const Int128* left, const Int128* right, Int128* result, std::size_t count ) noexcept
+		{
+			const __m512i one{ _mm512_set1_epi64( 1 ) };
+
+			std::size_t i{ 0 };
+			for ( ; i + constants::INT128_KERNEL_AVX512_VALUES <= count; i += constants::INT128_KERNEL_AVX512_VALUES )
+			{
+				const __m512i a{ _mm512_loadu_si512( left + i ) };
+				const __m512i b{ _mm512_loadu_si512( right + i ) };
+				const __m512i difference{ _mm512_sub_epi64( a, b ) };
+				const __mmask8 borrow{ toHighLanes( _mm512_cmplt_epu64_mask( a, b ) ) };
+				_mm512_storeu_si512( result + i, _mm512_mask_sub_epi64( difference, borrow, difference, one ) );
+			}
+
+			subtractScalar( left + i, right + i, result + i, count - i );
+		}
+
+		NFX_DATATYPES_TARGET_AVX512 static void negateAvx512( const Int128* values, Int128* result, std::size_t count ) noexcept
+		{
+			const __m512i zero{ _mm512_setzero_si512() };
+			const __m512i one{ _mm512_set1_epi64( 1 ) };
+
+			std::size_t i{ 0 };
+			for ( ; i + constants::INT128_KERNEL_AVX512_VALUES <= count; i += constants::INT128_KERNEL_AVX512_VALUES )
+			{
+				const __m512i value{ _mm512_loadu_si512( values + i ) };
+				const __m512i negated{ _mm512_sub_epi64( zero, value ) };
+				const __mmask8 borrow{ toHighLanes( _mm512_test_epi64_mask( value, value ) ) };
+				_mm512_storeu_si512( result + i, _mm512_mask_sub_epi64( negated, borrow, negated, one ) );
+			}
+
+			negateScalar( values + i, result + i, count - i );
+		}
+
+		NFX_DATATYPES_TARGET_AVX512 static void lessThanAvx512( const Int128* left, const Int128* right, std::size_t count, std::uint64_t* mask ) noexcept
+		{
+			for ( std::size_t begin{ 0 }; begin < count; begin += VALIDITY_WORD_BITS )
+			{
+				const std::size_t end{ std::min( count, begin + VALIDITY_WORD_BITS ) };
+				std::uint64_t bits{ 0 };
+
+				std::size_t i{ begin };
+				for ( ; i + constants::INT128_KERNEL_AVX512_VALUES <= end; i += constants::INT128_KERNEL_AVX512_VALUES )
+				{
+					const __m512i a{ _mm512_loadu_si512( left + i ) };
+					const __m512i b{ _mm512_loadu_si512( right + i ) };
+					const unsigned int less{ ( static_cast<unsigned int>( _mm512_cmplt_epi64_mask( a, b ) ) |
+												 ( static_cast<unsigned int>( _mm512_cmpeq_epi64_mask( a, b ) ) &
+													 toHighLanes( _mm512_cmplt_epu64_mask( a, b ) ) ) ) &
+											 AVX512_HIGH_LANES };
+
+					// Compact the four odd bits into bits 0-3
+					unsigned int packed{ less >> 1 };
+					packed = ( packed | ( packed >> 1 ) ) & 0x33U;
+					packed = ( packed | ( packed >> 2 ) ) & 0x0FU;
+					bits |= static_cast<std::uint64_t>( packed ) << ( i - begin );
+				}
+
+				mask[begin / VALIDITY_WORD_BITS] = bits | ( lessThanBits( left, right, i, end ) << ( i - begin ) );
+			}
+		}
+
+		NFX_DATATYPES_TARGET_AVX512 static void sumAvx512( const Int128* values, std::size_t count, WideSum& total ) noexcept
+		{
+			const __m512i lowHalf{ _mm512_set1_epi64( static_cast<long long>( constants::UINT32_MAX_VALUE ) ) };
+
+			std::size_t i{ 0 };
+			while ( count - i >= constants::INT128_KERNEL_AVX512_VALUES )
+			{
+				const std::size_t blockEnd{ i + std::min( ( count - i ) & ~( constants::INT128_KERNEL_AVX512_VALUES - 1 ), constants::INT128_KERNEL_SUM_BLOCK_VALUES ) };
+				__m512i lowHalves{ _mm512_setzero_si512() };
+				__m512i highHalves{ _mm512_setzero_si512() };
+				__m512i signs{ _mm512_setzero_si512() };
+
+				for ( ; i < blockEnd; i += constants::INT128_KERNEL_AVX512_VALUES )
+				{
+					const __m512i value{ _mm512_loadu_si512( values + i ) };
+					lowHalves = _mm512_add_epi64( lowHalves, _mm512_and_si512( value, lowHalf ) );
+					highHalves = _mm512_add_epi64( highHalves, _mm512_srli_epi64( value, constants::BITS_PER_UINT32 ) );
+					signs = _mm512_add_epi64( signs, _mm512_srli_epi64( value, constants::BITS_PER_UINT64 - 1 ) );
+				}
+
+				alignas( 64 ) std::array<std::uint64_t, 8> lowLanes;
+				alignas( 64 ) std::array<std::uint64_t, 8> highLanes;
+				_mm512_store_si512( lowLanes.data(), lowHalves );
+				_mm512_store_si512( highLanes.data(), highHalves );
+
+				for ( std::size_t lane{ 0 }; lane < lowLanes.size(); ++lane )
+				{
+					const int shift{ lane % 2 == 0 ? 0 : constants::BITS_PER_UINT64 };
+					addShifted( total, lowLanes[lane], shift );
+					addShifted( total, highLanes[lane], shift + constants::BITS_PER_UINT32 );
+				}
+				total[2] -= static_cast<std::uint64_t>( _mm512_mask_reduce_add_epi64( static_cast<__mmask8>( AVX512_HIGH_LANES ), signs ) );
+			}
+
+			sumScalar( values + i, count - i, total );
+		}
+#endif
+
+		//=====================================================================
+		// Kernel selection
+		//=====================================================================
+
+		/**
+		 * @brief Kernel entry points of one instruction set
+		 */
+		struct Int128KernelTable
+		{
+			void ( *add )( const Int128*, const Int128*, Int128*, std::size_t ) noexcept;
+			void ( *subtract )( const Int128*, const Int128*, Int128*, std::size_t ) noexcept;
+			void ( *negate )( const Int128*, Int128*, std::size_t ) noexcept;
+			void ( *lessThan )( const Int128*, const Int128*, std::size_t, std::uint64_t* ) noexcept;
+			void ( *sum )( const Int128*, std::size_t, WideSum& ) noexcept;
+		};
+
+		/**
+		 * @brief Kernel tables indexed by CpuDispatch::InstructionSet
+		 */
+		static constexpr std::array<Int128KernelTable, 3> INT128_KERNELS{ {
+			{ addScalar, subtractScalar, negateScalar, lessThanScalar, sumScalar },
+#if NFX_DATATYPES_INT128_KERNELS_X86
+			{ addAvx2, subtractAvx2, negateAvx2, lessThanAvx2, sumAvx2 },
+			{ addAvx512, subtractAvx512, negateAvx512, lessThanAvx512, sumAvx512 },
+#else
+			{ addScalar, subtractScalar, negateScalar, lessThanScalar, sumScalar },
+			{ addScalar, subtractScalar, negateScalar, lessThanScalar, sumScalar },
+#endif
+		} };
+
+		/**
+		 * @brief Kernels of the active instruction set
+		 * @return Kernel table
+		 */
+		static const Int128KernelTable& int128Kernels() noexcept
+		{
+			return INT128_KERNELS[static_cast<std::size_t>( CpuDispatch::active() )];
+		}
+
+		//=====================================================================
+		// Argument validation
+		//=====================================================================
+
+		/**
+		 * @brief Check the spans of a binary element-wise kernel
+		 * @param leftSize Size of the first operand span
+		 * @param rightSize Size of the second operand span
+		 * @param resultSize Size of the output span
+		 * @throws std::invalid_argument if the operand sizes differ or the output is too small
+		 */
+		static void checkBinarySpans( std::size_t leftSize, std::size_t rightSize, std::size_t resultSize )
+		{
+			if ( leftSize != rightSize )
+			{
+				throw std::invalid_argument{ "Operand spans differ in size" };
+			}
+			if ( resultSize < leftSize )
+			{
+				throw std::invalid_argument{ "Destination span is too small" };
+			}
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// Int128Kernels class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Element-wise arithmetic
+	//----------------------------------------------
+
+	void Int128Kernels::add( std::span<const Int128> left, std::span<const Int128> right, std::span<Int128> result )
+	{
+		internal::checkBinarySpans( left.size(), right.size(), result.size() );
+		internal::int128Kernels().add( left.data(), right.data(), result.data(), left.size() );
+	}
+
+	void Int128Kernels::subtract( std::span<const Int128> left, std::span<const Int128> right, std::span<Int128> result )
+	{
+		internal::checkBinarySpans( left.size(), right.size(), result.size() );
+		internal::int128Kernels().subtract( left.data(), right.data(), result.data(), left.size() );
+	}
+
+	void Int128Kernels::negate( std::span<const Int128> values, std::span<Int128> result )
+	{
+		internal::checkBinarySpans( values.size(), values.size(), result.size() );
+		internal::int128Kernels().negate( values.data(), result.data(), values.size() );
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	void Int128Kernels::lessThan( std::span<const Int128> left, std::span<const Int128> right, std::span<std::uint64_t> mask )
+	{
+		internal::checkBinarySpans( left.size(), right.size(), left.size() );
+		if ( mask.size() < internal::validityWordCount( left.size() ) )
+		{
+			throw std::invalid_argument{ "Destination span is too small" };
+		}
+
+		internal::int128Kernels().lessThan( left.data(), right.data(), left.size(), mask.data() );
+	}
+
+	//----------------------------------------------
+	// Reduction
+	//----------------------------------------------
+
+	Int128 Int128Kernels::sum( std::span<const Int128> values, ArithmeticStatus& status ) noexcept
+	{
+		internal::WideSum total{};
+		internal::int128Kernels().sum( values.data(), values.size(), total );
+
+		return internal::narrowSum( total, status );
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,321 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ParallelReduce.cpp
+ * @brief Implementation of the chunked multi-threaded Decimal and Int128 reductions
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "nfx/datatypes/ParallelReduce.h"
+#include "nfx/datatypes/DecimalAccumulator.h"
+#include "nfx/datatypes/Int128Kernels.h"
+
+#include "nfx/detail/datatypes/Constants.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Chunk scheduling
+		//=====================================================================
+
+		/**
+		 * @brief Get the number of chunks a span is split into
+		 * @param size Number of values
+		 * @param threadCount Requested thread count (0 = default)
+		 * @return Between 1 and the thread count, so that every chunk holds PARALLEL_MIN_CHUNK_VALUES values
+		 */
+		static std::size_t chunkCount( std::size_t size, std::size_t threadCount ) noexcept
+		{
+			const std::size_t threads{ threadCount == 0 ? ParallelReduce::defaultThreadCount() : threadCount };
+
+			return std::max<std::size_t>( 1, std::min( threads, size / constants::PARALLEL_MIN_CHUNK_VALUES ) );
+		}
+
+		/**
+		 * @brief Reduce contiguous chunks of [0, size) concurrently
+		 * @param size Number of values
+		 * @param threadCount Requested thread count (0 = default)
+		 * @param reduce Callable (first, last) -> Result reducing one chunk
+		 * @return Chunk results, in chunk order
+		 * @details Chunk 0 runs on the calling thread. Threads are joined before returning,
+		 *          also when starting one of them throws.
+		 */
+		template <typename Result, typename Reduce>
+		static std::vector<Result> reduceChunks( std::size_t size, std::size_t threadCount, const Reduce& reduce )
+		{
+			const std::size_t count{ chunkCount( size, threadCount ) };
+			std::vector<Result> results( count );
+
+			{
+				std::vector<std::jthread> workers;
+				workers.reserve( count - 1 );
+				for ( std::size_t chunk{ 1 }; chunk < count; ++chunk )
+				{
+					workers.emplace_back( [&results, &reduce, size, count, chunk]() {
+						results[chunk] = reduce( size * chunk / count, size * ( chunk + 1 ) / count );
+					} );
+				}
+
+				results[0] = reduce( 0, size / count );
+			}
+
+			return results;
+		}
+
+		//=====================================================================
+		// Int128 totals
+		//=====================================================================
+
+		/**
+		 * @brief Sign-extend an Int128 to a 256-bit two's complement value
+		 * @param value Value to extend
+		 * @return value modulo 2^256
+		 */
+		static constexpr UInt256 signExtend( const Int128& value ) noexcept
+		{
+			const std::uint64_t extension{ value.isNegative() ? ~std::uint64_t{ 0 } : 0 };
+
+			return UInt256::fromWords( value.toLow(), value.toHigh(), extension, extension );
+		}
+
+		/**
+		 * @brief Sum a chunk of Int128 values exactly
+		 * @param values Chunk to sum
+		 * @return Exact total modulo 2^256 (exact for any span that fits in memory)
+		 */
+		static UInt256 exactTotal( std::span<const Int128> values ) noexcept
+		{
+			ArithmeticStatus status{ ArithmeticStatus::None };
+			const Int128 total{ Int128Kernels::sum( values, status ) };
+			if ( !hasStatus( status, ArithmeticStatus::Overflow ) )
+			{
+				return signExtend( total );
+			}
+
+			// The chunk total itself does not fit: redo it in 256 bits
+			UInt256 wide;
+			for ( const Int128& value : values )
+			{
+				wide = wide + signExtend( value );
+			}
+
+			return wide;
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// ParallelReduce class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Sum
+	//----------------------------------------------
+
+	Decimal ParallelReduce::parallelSum( std::span<const Decimal> values, std::size_t threadCount )
+	{
+		ArithmeticStatus status{ ArithmeticStatus::None };
+		const Decimal result{ parallelSum( values, status, threadCount ) };
+		if ( hasStatus( status, ArithmeticStatus::Overflow ) )
+		{
+			throw std::overflow_error{ "Decimal sum overflow" };
+		}
+
+		return result;
+	}
+
+	Decimal ParallelReduce::parallelSum( std::span<const Decimal> values, ArithmeticStatus& status, std::size_t threadCount )
+	{
+		const auto partials{ internal::reduceChunks<DecimalAccumulator>( values.size(), threadCount,
+			[values]( std::size_t first, std::size_t last ) {
+				DecimalAccumulator accumulator;
+				accumulator.add( values.subspan( first, last - first ) );
+
+				return accumulator;
+			} ) };
+
+		DecimalAccumulator total;
+		for ( const DecimalAccumulator& partial : partials )
+		{
+			total.merge( partial );
+		}
+
+		return total.result( status );
+	}
+
+	Int128 ParallelReduce::parallelSum( std::span<const Int128> values, ArithmeticStatus& status, std::size_t threadCount )
+	{
+		const auto partials{ internal::reduceChunks<internal::UInt256>( values.size(), threadCount,
+			[values]( std::size_t first, std::size_t last ) {
+				return internal::exactTotal( values.subspan( first, last - first ) );
+			} ) };
+
+		internal::UInt256 total;
+		for ( const internal::UInt256& partial : partials )
+		{
+			total = total + partial;
+		}
+
+		// Fits when words 1-3 are the sign extension of bit 127
+		const bool negative{ ( total.word( 3 ) >> ( constants::BITS_PER_UINT64 - 1 ) ) != 0 };
+		const std::uint64_t extension{ negative ? ~std::uint64_t{ 0 } : 0 };
+		if ( total.word( 2 ) != extension || total.word( 3 ) != extension ||
+			 ( ( total.word( 1 ) >> ( constants::BITS_PER_UINT64 - 1 ) ) != 0 ) != negative )
+		{
+			status |= ArithmeticStatus::Overflow;
+
+			return internal::saturatedInt128( negative );
+		}
+
+		return Int128{ total.word( 0 ), total.word( 1 ) };
+	}
+
+	//----------------------------------------------
+	// Minimum and maximum
+	//----------------------------------------------
+
+	std::pair<Decimal, Decimal> ParallelReduce::parallelMinMax( std::span<const Decimal> values, std::size_t threadCount )
+	{
+		if ( values.empty() )
+		{
+			throw std::invalid_argument{ "Cannot find the minimum and maximum of an empty span" };
+		}
+
+		// Strict comparisons keep the first of equal values, within and across chunks
+		const auto partials{ internal::reduceChunks<std::pair<Decimal, Decimal>>( values.size(), threadCount,
+			[values]( std::size_t first, std::size_t last ) {
+				std::pair<Decimal, Decimal> extremes{ values[first], values[first] };
+				for ( std::size_t i{ first + 1 }; i < last; ++i )
+				{
+					if ( values[i] < extremes.first )
+					{
+						extremes.first = values[i];
+					}
+					if ( extremes.second < values[i] )
+					{
+						extremes.second = values[i];
+					}
+				}
+
+				return extremes;
+			} ) };
+
+		std::pair<Decimal, Decimal> result{ partials.front() };
+		for ( std::size_t chunk{ 1 }; chunk < partials.size(); ++chunk )
+		{
+			if ( partials[chunk].first < result.first )
+			{
+				result.first = partials[chunk].first;
+			}
+			if ( result.second < partials[chunk].second )
+			{
+				result.second = partials[chunk].second;
+			}
+		}
+
+		return result;
+	}
+
+	std::pair<Int128, Int128> ParallelReduce::parallelMinMax( std::span<const Int128> values, std::size_t threadCount )
+	{
+		if ( values.empty() )
+		{
+			throw std::invalid_argument{ "Cannot find the minimum and maximum of an empty span" };
+		}
+
+		const auto partials{ internal::reduceChunks<std::pair<Int128, Int128>>( values.size(), threadCount,
+			[values]( std::size_t first, std::size_t last ) {
+				const auto [low, high]{ std::minmax_element( values.begin() + static_cast<std::ptrdiff_t>( first ),
+					values.begin() + static_cast<std::ptrdiff_t>( last ) ) };
+
+				return std::pair<Int128, Int128>{ *low, *high };
+			} ) };
+
+		std::pair<Int128, Int128> result{ partials.front() };
+		for ( const auto& [low, high] : partials )
+		{
+			result.first = std::min( result.first, low );
+			result.second = std::max( result.second, high );
+		}
+
+		return result;
+	}
+
+	//----------------------------------------------
+	// Dot product
+	//----------------------------------------------
+
+	Decimal ParallelReduce::parallelDot( std::span<const Decimal> values, std::span<const Decimal> weights, std::size_t threadCount )
+	{
+		ArithmeticStatus status{ ArithmeticStatus::None };
+		const Decimal result{ parallelDot( values, weights, status, threadCount ) };
+		if ( hasStatus( status, ArithmeticStatus::Overflow ) )
+		{
+			throw std::overflow_error{ "Decimal sum overflow" };
+		}
+
+		return result;
+	}
+
+	Decimal ParallelReduce::parallelDot( std::span<const Decimal> values, std::span<const Decimal> weights, ArithmeticStatus& status,
+		std::size_t threadCount )
+	{
+		if ( values.size() != weights.size() )
+		{
+			throw std::invalid_argument{ "Operand spans differ in size" };
+		}
+
+		const auto partials{ internal::reduceChunks<DecimalAccumulator>( values.size(), threadCount,
+			[values, weights]( std::size_t first, std::size_t last ) {
+				DecimalAccumulator accumulator;
+				accumulator.addWeighted( values.subspan( first, last - first ), weights.subspan( first, last - first ) );
+
+				return accumulator;
+			} ) };
+
+		DecimalAccumulator total;
+		for ( const DecimalAccumulator& partial : partials )
+		{
+			total.merge( partial );
+		}
+
+		return total.result( status );
+	}
+
+	//----------------------------------------------
+	// Configuration
+	//----------------------------------------------
+
+	std::size_t ParallelReduce::defaultThreadCount() noexcept
+	{
+		return std::max<std::size_t>( 1, std::thread::hardware_concurrency() );
+	}
+} // namespace nfx::datatypes
@@ -0,0 +1,563 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file RadixSort.cpp
+ * @brief Implementation of the LSD radix sorts over order-preserving Decimal and Int128 keys
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "nfx/datatypes/ParallelReduce.h"
+#include "nfx/datatypes/RadixSort.h"
+
+#include "nfx/detail/datatypes/Constants.h"
+#include "nfx/detail/datatypes/UInt256.h"
+
+namespace nfx::datatypes
+{
+	namespace internal
+	{
+		//=====================================================================
+		// Sort records
+		//=====================================================================
+
+		/** @brief Payload of records whose key alone restores the value */
+		struct NoPayload
+		{
+		};
+
+		/**
+		 * @brief Unsigned sort key, least significant word first, with its payload
+		 */
+		template <std::size_t KeyWords, typename Payload>
+		struct SortRecord
+		{
+			std::array<std::uint64_t, KeyWords> key;
+			[[no_unique_address]] Payload payload;
+		};
+
+		/** @brief Occurrences of each digit value in one key byte */
+		using Histogram = std::array<std::size_t, constants::RADIX_SORT_BUCKETS>;
+
+		/**
+		 * @brief Get one radix digit of a record key
+		 * @param record Record
+		 * @param digit Digit index (0 = least significant)
+		 * @return Digit value
+		 */
+		template <std::size_t KeyWords, typename Payload>
+		static inline std::size_t keyDigit( const SortRecord<KeyWords, Payload>& record, std::size_t digit ) noexcept
+		{
+			const std::size_t bit{ digit * constants::RADIX_SORT_DIGIT_BITS };
+			const std::size_t word{ bit / constants::BITS_PER_UINT64 };
+			const std::size_t shift{ bit % constants::BITS_PER_UINT64 };
+
+			std::uint64_t bits{ record.key[word] >> shift };
+			if ( shift + constants::RADIX_SORT_DIGIT_BITS > constants::BITS_PER_UINT64 && word + 1 < KeyWords )
+			{
+				bits |= record.key[word + 1] << ( constants::BITS_PER_UINT64 - shift );
+			}
+
+			return static_cast<std::size_t>( bits & ( constants::RADIX_SORT_BUCKETS - 1 ) );
+		}
+
+		//=====================================================================
+		// Chunk scheduling
+		//=====================================================================
+
+		/**
+		 * @brief Get the number of chunks a sort is split into
+		 * @param size Number of values
+		 * @param threadCount Requested thread count (0 = default)
+		 * @return Between 1 and the thread count, so that every chunk holds PARALLEL_MIN_CHUNK_VALUES values
+		 */
+		static std::size_t sortChunkCount( std::size_t size, std::size_t threadCount ) noexcept
+		{
+			const std::size_t threads{ threadCount == 0 ? ParallelReduce::defaultThreadCount() : threadCount };
+
+			return std::max<std::size_t>( 1, std::min( threads, size / constants::PARALLEL_MIN_CHUNK_VALUES ) );
+		}
+
+		/**
+		 * @brief Run a task for every chunk, chunk 0 on the calling thread
+		 * @param chunks Number of chunks
+		 * @param task Callable (chunk) run once per chunk
+		 */
+		template <typename Task>
+		static void forEachChunk( std::size_t chunks, const Task& task )
+		{
+			std::vector<std::jthread> workers;
+			workers.reserve( chunks - 1 );
+			for ( std::size_t chunk{ 1 }; chunk < chunks; ++chunk )
+			{
+				workers.emplace_back( [&task, chunk]() { task( chunk ); } );
+			}
+
+			task( 0 );
+		}
+
+		//=====================================================================
+		// Key arithmetic
+		//=====================================================================
+
+		/**
+		 * @brief Compare two keys
+		 * @param left First key
+		 * @param right Second key
+		 * @return true if left < right
+		 */
+		template <std::size_t KeyWords>
+		static inline bool keyLess( const std::array<std::uint64_t, KeyWords>& left, const std::array<std::uint64_t, KeyWords>& right ) noexcept
+		{
+			for ( std::size_t word{ KeyWords }; word-- > 0; )
+			{
+				if ( left[word] != right[word] )
+				{
+					return left[word] < right[word];
+				}
+			}
+
+			return false;
+		}
+
+		/**
+		 * @brief Subtract two keys
+		 * @param left Key to subtract from (at least right)
+		 * @param right Key to subtract
+		 * @return left - right
+		 */
+		template <std::size_t KeyWords>
+		static inline std::array<std::uint64_t, KeyWords> keyDifference( const std::array<std::uint64_t, KeyWords>& left,
+			const std::array<std::uint64_t, KeyWords>& right ) noexcept
+		{
+			std::array<std::uint64_t, KeyWords> difference;
+			std::uint64_t borrow{ 0 };
+			for ( std::size_t word{ 0 }; word < KeyWords; ++word )
+			{
+				const std::uint64_t partial{ left[word] - right[word] };
+				const std::uint64_t nextBorrow{ ( left[word] < right[word] ? 1U : 0U ) + ( partial < borrow ? 1U : 0U ) };
+				difference[word] = partial - borrow;
+				borrow = nextBorrow;
+			}
+
+			return difference;
+		}
+
+		/**
+		 * @brief Get the number of significant radix digits of a key
+		 * @param key Key
+		 * @return Index of the highest non-zero digit plus one (0 for a zero key)
+		 */
+		template <std::size_t KeyWords>
+		static inline std::size_t keyDigits( const std::array<std::uint64_t, KeyWords>& key ) noexcept
+		{
+			for ( std::size_t word{ KeyWords }; word-- > 0; )
+			{
+				if ( key[word] != 0 )
+				{
+					const auto bits{ static_cast<std::size_t>( std::bit_width( key[word] ) ) + word * constants::BITS_PER_UINT64 };
+					return ( bits + constants::RADIX_SORT_DIGIT_BITS - 1 ) / constants::RADIX_SORT_DIGIT_BITS;
+				}
+			}
+
+			return 0;
+		}
+
+		//=====================================================================
+		// LSD radix sort
+		//=====================================================================
+
+		/**
+		 * @brief Sort records by key, stably
+		 * @param records Records to sort; holds the sorted records on return, with their keys
+		 *        reduced by the returned base
+		 * @param chunks Number of chunks sorted concurrently
+		 * @return Smallest key of the input
+		 * @details Keys are rebased on the smallest key first, so that only the digits spanned by
+		 *          the key range are counted and sorted (e.g. small signed values differ in every
+		 *          byte of their sign-flipped keys, but their range is narrow). Short inputs are
+		 *          sorted by comparing keys.
+		 */
+		template <std::size_t KeyWords, typename Payload>
+		static std::array<std::uint64_t, KeyWords> sortRecords( std::vector<SortRecord<KeyWords, Payload>>& records, std::size_t chunks )
+		{
+			using Key = std::array<std::uint64_t, KeyWords>;
+			constexpr std::size_t keyDigitCount{ ( KeyWords * constants::BITS_PER_UINT64 + constants::RADIX_SORT_DIGIT_BITS - 1 ) /
+												 constants::RADIX_SORT_DIGIT_BITS };
+			const std::size_t size{ records.size() };
+			if ( size < constants::RADIX_SORT_MIN_VALUES )
+			{
+				std::stable_sort( records.begin(), records.end(),
+					[]( const auto& left, const auto& right ) noexcept { return keyLess( left.key, right.key ); } );
+
+				return Key{};
+			}
+
+			const auto first{ [size, chunks]( std::size_t chunk ) { return size * chunk / chunks; } };
+
+			std::vector<std::pair<Key, Key>> bounds( chunks );
+			forEachChunk( chunks, [&]( std::size_t chunk ) {
+				Key low{ records[first( chunk )].key };
+				Key high{ low };
+				for ( std::size_t i{ first( chunk ) + 1 }; i < first( chunk + 1 ); ++i )
+				{
+					low = keyLess( records[i].key, low ) ? records[i].key : low;
+					high = keyLess( high, records[i].key ) ? records[i].key : high;
+				}
+				bounds[chunk] = { low, high };
+			} );
+
+			Key base{ bounds.front().first };
+			Key top{ bounds.front().second };
+			for ( const auto& [low, high] : bounds )
+			{
+				base = keyLess( low, base ) ? low : base;
+				top = keyLess( top, high ) ? high : top;
+			}
+			const std::size_t activeDigits{ keyDigits( keyDifference( top, base ) ) };
+
+			// Rebase and count every active digit at once; chunk composition is unchanged until the first scatter
+			std::vector<std::array<Histogram, keyDigitCount>> histograms( chunks );
+			forEachChunk( chunks, [&]( std::size_t chunk ) {
+				auto& counts{ histograms[chunk] };
+				std::for_each_n( counts.begin(), activeDigits, []( Histogram& histogram ) { histogram.fill( 0 ); } );
+				for ( std::size_t i{ first( chunk ) }; i < first( chunk + 1 ); ++i )
+				{
+					records[i].key = keyDifference( records[i].key, base );
+					for ( std::size_t digit{ 0 }; digit < activeDigits; ++digit )
+					{
+						++counts[digit][keyDigit( records[i], digit )];
+					}
+				}
+			} );
+
+			// Scatter passes alternate between records and an uninitialized buffer
+			const auto buffer{ std::make_unique_for_overwrite<SortRecord<KeyWords, Payload>[]>( activeDigits == 0 ? 0 : size ) };
+			SortRecord<KeyWords, Payload>* source{ records.data() };
+			SortRecord<KeyWords, Payload>* target{ buffer.get() };
+			std::vector<Histogram> offsets( chunks );
+			bool scattered{ false };
+
+			for ( std::size_t digit{ 0 }; digit < activeDigits; ++digit )
+			{
+				// Totals do not depend on the record order; a digit shared by all keys needs no pass
+				Histogram totals{};
+				for ( const auto& counts : histograms )
+				{
+					for ( std::size_t bucket{ 0 }; bucket < constants::RADIX_SORT_BUCKETS; ++bucket )
+					{
+						totals[bucket] += counts[digit][bucket];
+					}
+				}
+				if ( std::find( totals.begin(), totals.end(), size ) != totals.end() )
+				{
+					continue;
+				}
+
+				if ( scattered && chunks > 1 )
+				{
+					forEachChunk( chunks, [&]( std::size_t chunk ) {
+						Histogram& counts{ histograms[chunk][digit] };
+						counts.fill( 0 );
+						for ( std::size_t i{ first( chunk ) }; i < first( chunk + 1 ); ++i )
+						{
+							++counts[keyDigit( source[i], digit )];
+						}
+					} );
+				}
+
+				// Bucket-major, chunk-minor offsets keep the sort stable across chunks
+				std::size_t offset{ 0 };
+				for ( std::size_t bucket{ 0 }; bucket < constants::RADIX_SORT_BUCKETS; ++bucket )
+				{
+					for ( std::size_t chunk{ 0 }; chunk < chunks; ++chunk )
+					{
+						offsets[chunk][bucket] = offset;
+						offset += histograms[chunk][digit][bucket];
+					}
+				}
+
+				forEachChunk( chunks, [&]( std::size_t chunk ) {
+					Histogram& next{ offsets[chunk] };
+					for ( std::size_t i{ first( chunk ) }; i < first( chunk + 1 ); ++i )
+					{
+						target[next[keyDigit( source[i], digit )]++] = source[i];
+					}
+				} );
+
+				std::swap( source, target );
+				scattered = true;
+			}
+
+			if ( source != records.data() )
+			{
+				forEachChunk( chunks, [&]( std::size_t chunk ) {
+					std::copy( source + first( chunk ), source + first( chunk + 1 ), records.begin() + static_cast<std::ptrdiff_t>( first( chunk ) ) );
+				} );
+			}
+
+			return base;
+		}
+
+		//=====================================================================
+		// Key transforms
+		//=====================================================================
+
+		/** @brief Top bit of a key word, flipped so that negative keys sort first */
+		inline constexpr std::uint64_t KEY_SIGN_BIT{ std::uint64_t{ 1 } << ( constants::BITS_PER_UINT64 - 1 ) };
+
+		/**
+		 * @brief Map an Int128 to an unsigned key of the same order
+		 * @param value Value to map
+		 * @return Key words, least significant first
+		 */
+		static inline std::array<std::uint64_t, 2> int128Key( const Int128& value ) noexcept
+		{
+			return { value.toLow(), value.toHigh() ^ KEY_SIGN_BIT };
+		}
+
+		/**
+		 * @brief Map a Decimal to an unsigned key of the same order
+		 * @param value Value to map
+		 * @param scale Common scale of all keys (at least value.scale())
+		 * @param key Output key words, least significant first
+		 * @return false if the aligned mantissa does not fit the key
+		 */
+		template <std::size_t KeyWords>
+		static inline bool decimalKey( const Decimal& value, std::uint8_t scale, std::array<std::uint64_t, KeyWords>& key ) noexcept
+		{
+			UInt256 aligned{ mantissaAsUInt256( value ) };
+			if ( value.scale() != scale )
+			{
+				aligned = multiplyByPowerOf10Wide( aligned, static_cast<std::uint8_t>( scale - value.scale() ) );
+			}
+			if ( !aligned.fitsIn( KeyWords * constants::BITS_PER_UINT64 - 1 ) )
+			{
+				return false;
+			}
+
+			// Two's complement over the key width, then the sign bit flipped
+			if ( value.isNegative() )
+			{
+				aligned = UInt256{} - aligned;
+			}
+			for ( std::size_t word{ 0 }; word < KeyWords; ++word )
+			{
+				key[word] = aligned.word( word );
+			}
+			key[KeyWords - 1] ^= KEY_SIGN_BIT;
+
+			return true;
+		}
+
+		/**
+		 * @brief Build keyed records of Decimal values
+		 * @param values Values to key
+		 * @param chunks Number of chunks keyed concurrently
+		 * @param payload Callable (index) -> Payload of the record of values[index]
+		 * @param records Output records (resized to values.size())
+		 * @return false if an aligned mantissa does not fit the key width
+		 */
+		template <std::size_t KeyWords, typename Payload, typename MakePayload>
+		static bool decimalRecords( std::span<const Decimal> values, std::uint8_t scale, std::size_t chunks, const MakePayload& payload,
+			std::vector<SortRecord<KeyWords, Payload>>& records )
+		{
+			records.resize( values.size() );
+			std::vector<char> fits( chunks, 1 );
+			forEachChunk( chunks, [&]( std::size_t chunk ) {
+				for ( std::size_t i{ values.size() * chunk / chunks }; i < values.size() * ( chunk + 1 ) / chunks; ++i )
+				{
+					if ( !decimalKey( values[i], scale, records[i].key ) )
+					{
+						fits[chunk] = 0;
+						return;
+					}
+					records[i].payload = payload( i );
+				}
+			} );
+
+			return std::find( fits.begin(), fits.end(), 0 ) == fits.end();
+		}
+
+		/**
+		 * @brief Sort Decimal values by numeric order and emit the sorted records
+		 * @param values Values to sort (unchanged)
+		 * @param threadCount Maximum number of threads
+		 * @param payload Callable (index) -> Payload stored with values[index]
+		 * @param emit Callable (position, payload) receiving the sorted payloads
+		 */
+		template <typename Payload, typename MakePayload, typename Emit>
+		static void sortDecimals( std::span<const Decimal> values, std::size_t threadCount, const MakePayload& payload, const Emit& emit )
+		{
+			const std::size_t chunks{ sortChunkCount( values.size(), threadCount ) };
+			const std::uint8_t scale{ std::max_element( values.begin(), values.end(),
+				[]( const Decimal& left, const Decimal& right ) noexcept { return left.scale() < right.scale(); } )->scale() };
+
+			const auto output{ [&]( const auto& records ) {
+				forEachChunk( chunks, [&]( std::size_t chunk ) {
+					for ( std::size_t i{ records.size() * chunk / chunks }; i < records.size() * ( chunk + 1 ) / chunks; ++i )
+					{
+						emit( i, records[i].payload );
+					}
+				} );
+			} };
+
+			constexpr std::size_t narrowWords{ constants::RADIX_SORT_NARROW_KEY_BITS / constants::BITS_PER_UINT64 };
+			{
+				std::vector<SortRecord<narrowWords, Payload>> records;
+				if ( decimalRecords( values, scale, chunks, payload, records ) )
+				{
+					sortRecords( records, chunks );
+					output( records );
+
+					return;
+				}
+			}
+
+			constexpr std::size_t wideWords{ constants::RADIX_SORT_WIDE_KEY_BITS / constants::BITS_PER_UINT64 };
+			std::vector<SortRecord<wideWords, Payload>> records;
+			decimalRecords( values, scale, chunks, payload, records );
+			sortRecords( records, chunks );
+			output( records );
+		}
+
+		/**
+		 * @brief Check that an argsort output can hold every index
+		 * @param size Number of values
+		 * @param indices Output span
+		 * @throws std::invalid_argument if indices is too small
+		 */
+		static void checkIndices( std::size_t size, std::span<std::size_t> indices )
+		{
+			if ( indices.size() < size )
+			{
+				throw std::invalid_argument{ "Destination span is too small" };
+			}
+		}
+	} // namespace internal
+
+	//=====================================================================
+	// RadixSort class
+	//=====================================================================
+
+	//----------------------------------------------
+	// In-place sort
+	//----------------------------------------------
+
+	void RadixSort::radixSort( std::span<Decimal> values, std::size_t threadCount )
+	{
+		if ( values.size() < 2 )
+		{
+			return;
+		}
+
+		internal::sortDecimals<Decimal>(
+			values, threadCount, [values]( std::size_t i ) noexcept { return values[i]; },
+			[values]( std::size_t position, const Decimal& value ) noexcept { values[position] = value; } );
+	}
+
+	void RadixSort::radixSort( std::span<Int128> values, std::size_t threadCount )
+	{
+		if ( values.size() < 2 )
+		{
+			return;
+		}
+
+		const std::size_t chunks{ internal::sortChunkCount( values.size(), threadCount ) };
+		std::vector<internal::SortRecord<2, internal::NoPayload>> records( values.size() );
+		internal::forEachChunk( chunks, [&]( std::size_t chunk ) {
+			for ( std::size_t i{ values.size() * chunk / chunks }; i < values.size() * ( chunk + 1 ) / chunks; ++i )
+			{
+				records[i].key = internal::int128Key( values[i] );
+			}
+		} );
+
+		// Keys come back relative to the smallest one
+		const auto base{ internal::sortRecords( records, chunks ) };
+		const Int128 offset{ base[0], base[1] };
+
+		internal::forEachChunk( chunks, [&]( std::size_t chunk ) {
+			for ( std::size_t i{ values.size() * chunk / chunks }; i < values.size() * ( chunk + 1 ) / chunks; ++i )
+			{
+				const Int128 key{ offset + Int128{ records[i].key[0], records[i].key[1] } };
+				values[i] = Int128{ key.toLow(), key.toHigh() ^ internal::KEY_SIGN_BIT };
+			}
+		} );
+	}
+
+	//----------------------------------------------
+	// Argsort
+	//----------------------------------------------
+
+	void RadixSort::argsort( std::span<const Decimal> values, std::span<std::size_t> indices, std::size_t threadCount )
+	{
+		internal::checkIndices( values.size(), indices );
+		if ( values.size() < 2 )
+		{
+			std::fill_n( indices.begin(), values.size(), 0 );
+
+			return;
+		}
+
+		internal::sortDecimals<std::size_t>(
+			values, threadCount, []( std::size_t i ) noexcept { return i; },
+			[indices]( std::size_t position, std::size_t index ) noexcept { indices[position] = index; } );
+	}
+
+	void RadixSort::argsort( std::span<const Int128> values, std::span<std::size_t> indices, std::size_t threadCount )
+	{
+		internal::checkIndices( values.size(), indices );
+		if ( values.size() < 2 )
+		{
+			std::fill_n( indices.begin(), values.size(), 0 );
+
+			return;
+		}
+
+		const std::size_t chunks{ internal::sortChunkCount( values.size(), threadCount ) };
+		std::vector<internal::SortRecord<2, std::size_t>> records( values.size() );
+		internal::forEachChunk( chunks, [&]( std::size_t chunk ) {
+			for ( std::size_t i{ values.size() * chunk / chunks }; i < values.size() * ( chunk + 1 ) / chunks; ++i )
+			{
+				records[i] = { internal::int128Key( values[i] ), i };
+			}
+		} );
+
+		internal::sortRecords( records, chunks );
+
+		internal::forEachChunk( chunks, [&]( std::size_t chunk ) {
+			for ( std::size_t i{ values.size() * chunk / chunks }; i < values.size() * ( chunk + 1 ) / chunks; ++i )
+			{
+				indices[i] = records[i].payload;
+			}
+		} );
+	}
+} // namespace nfx::datatypes
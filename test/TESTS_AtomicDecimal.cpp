@@ -0,0 +1,139 @@
+/**
+ * @file TESTS_AtomicDecimal.cpp
+ * @brief Tests for the lock-free atomic Decimal
+ * @details Validates bitwise compare-exchange, fetchAdd overflow handling in both the
+ *          throwing and status API, and exact totals under multithreaded contention
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/AtomicDecimal.h>
+
+namespace nfx::datatypes::test
+{
+	//=====================================================================
+	// AtomicDecimal type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Atomic operations
+	//----------------------------------------------
+
+	TEST( AtomicDecimalOperations, LoadStoreExchange )
+	{
+		static_assert( alignof( datatypes::AtomicDecimal ) == 16 && sizeof( datatypes::AtomicDecimal ) == 16 );
+
+		datatypes::AtomicDecimal value;
+		EXPECT_TRUE( value.load().isZero() );
+
+		const datatypes::Decimal price{ "-12345678901234567890.123456789" };
+		value.store( price );
+		EXPECT_EQ( value.load().toBits(), price.toBits() );
+
+		EXPECT_EQ( value.exchange( datatypes::Decimal{ "0.5" } ).toBits(), price.toBits() );
+		EXPECT_EQ( value.load(), datatypes::Decimal{ "0.5" } );
+		EXPECT_EQ( value.isLockFree(), ( datatypes::AtomicDecimal{ price } ).isLockFree() );
+	}
+
+	TEST( AtomicDecimalOperations, CompareExchangeIsBitwise )
+	{
+		const datatypes::Decimal oneAndHalf{ "1.5" };
+		datatypes::AtomicDecimal value{ oneAndHalf };
+
+		// Numerically equal, different scale
+		datatypes::Decimal expected{ oneAndHalf.rescale( 2 ) };
+		EXPECT_FALSE( value.compareExchange( expected, datatypes::Decimal{ 2 } ) );
+		EXPECT_EQ( expected.toBits(), oneAndHalf.toBits() );
+
+		EXPECT_TRUE( value.compareExchange( expected, datatypes::Decimal{ 2 } ) );
+		EXPECT_EQ( value.load(), datatypes::Decimal{ 2 } );
+	}
+
+	TEST( AtomicDecimalOperations, FetchAdd )
+	{
+		datatypes::AtomicDecimal value{ datatypes::Decimal{ "100.25" } };
+		EXPECT_EQ( value.fetchAdd( datatypes::Decimal{ "-0.005" } ), datatypes::Decimal{ "100.25" } );
+		EXPECT_EQ( value.load(), datatypes::Decimal{ "100.245" } );
+
+		// The stored result is normalized like Decimal::add, so it compares equal bitwise
+		datatypes::AtomicDecimal half{ datatypes::Decimal{ "1.5" } };
+		(void)half.fetchAdd( datatypes::Decimal{ "0.5" } );
+		EXPECT_EQ( half.load().toBits(), datatypes::Decimal{ 2 }.toBits() );
+		datatypes::Decimal two{ 2 };
+		EXPECT_TRUE( half.compareExchange( two, datatypes::Decimal{} ) );
+
+		// Fast path (scale gap up to 9) and Decimal::add agree bit for bit, including zero crossings
+		const datatypes::Decimal one{ datatypes::Decimal{ 1 }.rescale( 2 ) };
+		datatypes::AtomicDecimal position{ one };
+		(void)position.fetchAdd( datatypes::Decimal{ -3 }.rescale( 2 ) );
+		EXPECT_EQ( position.load().toBits(), datatypes::Decimal{ -2 }.toBits() );
+		(void)position.fetchAdd( datatypes::Decimal{ 2 }.rescale( 2 ) );
+		EXPECT_EQ( position.load().toBits(), datatypes::Decimal{}.toBits() );
+		EXPECT_FALSE( position.load().isNegative() );
+
+		for ( const char* left : { "1.25", "-1.25", "0.000000001", "79228162514264337593543950.335", "0", "1.50" } )
+		{
+			for ( const char* right : { "0.75", "-1.2500", "3", "0.0000000000001", "-0.00000000000000000001", "0.00" } )
+			{
+				const datatypes::Decimal leftValue{ datatypes::Decimal{ left } };
+				const datatypes::Decimal rightValue{ datatypes::Decimal{ right } };
+				ArithmeticStatus expectedStatus{ ArithmeticStatus::None };
+				const datatypes::Decimal expected{ datatypes::Decimal::add( leftValue, rightValue, expectedStatus ) };
+
+				datatypes::AtomicDecimal sum{ leftValue };
+				ArithmeticStatus status{ ArithmeticStatus::None };
+				(void)sum.fetchAdd( rightValue, status );
+				EXPECT_EQ( sum.load().toBits(), expected.toBits() ) << left << " + " << right;
+				EXPECT_EQ( status, expectedStatus ) << left << " + " << right;
+			}
+		}
+
+		// Overflow leaves the value unchanged
+		datatypes::AtomicDecimal maximum{ datatypes::Decimal::maxValue() };
+		EXPECT_THROW( (void)maximum.fetchAdd( datatypes::Decimal{ 1 } ), std::overflow_error );
+		EXPECT_EQ( maximum.load(), datatypes::Decimal::maxValue() );
+
+		ArithmeticStatus status{ ArithmeticStatus::None };
+		EXPECT_EQ( maximum.fetchAdd( datatypes::Decimal{ 1 }, status ), datatypes::Decimal::maxValue() );
+		EXPECT_TRUE( hasStatus( status, ArithmeticStatus::Overflow ) );
+		EXPECT_EQ( maximum.load(), datatypes::Decimal::maxValue() );
+
+		status = ArithmeticStatus::None;
+		(void)maximum.fetchAdd( datatypes::Decimal{ -1 }, status );
+		EXPECT_EQ( status, ArithmeticStatus::None );
+	}
+
+	//----------------------------------------------
+	// Contention
+	//----------------------------------------------
+
+	TEST( AtomicDecimalContention, ExactTotal )
+	{
+		constexpr int threadCount{ 4 };
+		constexpr int addsPerThread{ 20000 };
+
+		datatypes::AtomicDecimal notional;
+		std::vector<std::thread> threads;
+		for ( int t{ 0 }; t < threadCount; ++t )
+		{
+			threads.emplace_back( [&notional, t]() {
+				// Mixed scales exercise the rescaling path
+				const datatypes::Decimal delta{ t % 2 == 0 ? datatypes::Decimal{ "0.01" } : datatypes::Decimal{ "1234567.8" } };
+				for ( int i{ 0 }; i < addsPerThread; ++i )
+				{
+					(void)notional.fetchAdd( delta );
+				}
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		// 2 * 20000 * 0.01 + 2 * 20000 * 1234567.8
+		EXPECT_EQ( notional.load(), datatypes::Decimal{ "49382712400" } );
+	}
+} // namespace nfx::datatypes::test
@@ -0,0 +1,105 @@
+/**
+ * @file TESTS_AtomicInt128.cpp
+ * @brief Tests for the lock-free atomic Int128
+ * @details Validates load, store, exchange and compare-exchange semantics, wrapping
+ *          fetchAdd, and exact totals under multithreaded contention
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/AtomicInt128.h>
+
+namespace nfx::datatypes::test
+{
+	//=====================================================================
+	// AtomicInt128 type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Atomic operations
+	//----------------------------------------------
+
+	TEST( AtomicInt128Operations, LoadStoreExchange )
+	{
+		static_assert( alignof( datatypes::AtomicInt128 ) == 16 && sizeof( datatypes::AtomicInt128 ) == 16 );
+
+		datatypes::AtomicInt128 value;
+		EXPECT_EQ( value.load(), datatypes::Int128{ 0 } );
+
+		const datatypes::Int128 large{ 0x0123456789ABCDEFULL, 0xFEDCBA9876543210ULL };
+		value.store( large );
+		EXPECT_EQ( value.load(), large );
+
+		EXPECT_EQ( value.exchange( datatypes::Int128{ -5 } ), large );
+		EXPECT_EQ( value.load(), datatypes::Int128{ -5 } );
+
+		const datatypes::AtomicInt128 initial{ large };
+		EXPECT_EQ( initial.load(), large );
+		EXPECT_TRUE( initial.isLockFree() || !datatypes::AtomicInt128::isAlwaysLockFree );
+	}
+
+	TEST( AtomicInt128Operations, CompareExchange )
+	{
+		datatypes::AtomicInt128 value{ datatypes::Int128{ 10 } };
+
+		// Only the high word differs: the whole 16 bytes must match
+		datatypes::Int128 expected{ 10ULL, 1ULL };
+		EXPECT_FALSE( value.compareExchange( expected, datatypes::Int128{ 20 } ) );
+		EXPECT_EQ( expected, datatypes::Int128{ 10 } );
+		EXPECT_EQ( value.load(), datatypes::Int128{ 10 } );
+
+		EXPECT_TRUE( value.compareExchange( expected, datatypes::Int128{ 20 } ) );
+		EXPECT_EQ( value.load(), datatypes::Int128{ 20 } );
+	}
+
+	TEST( AtomicInt128Operations, FetchAdd )
+	{
+		datatypes::AtomicInt128 value{ datatypes::Int128{ ~0ULL, 0ULL } };
+
+		// Carry into the high word
+		EXPECT_EQ( value.fetchAdd( datatypes::Int128{ 1 } ), ( datatypes::Int128{ ~0ULL, 0ULL } ) );
+		EXPECT_EQ( value.load(), ( datatypes::Int128{ 0ULL, 1ULL } ) );
+
+		EXPECT_EQ( value.fetchAdd( datatypes::Int128{ -2 } ), ( datatypes::Int128{ 0ULL, 1ULL } ) );
+		EXPECT_EQ( value.load(), ( datatypes::Int128{ ~0ULL - 1, 0ULL } ) );
+
+		// Wraps modulo 2^128
+		datatypes::AtomicInt128 maximum{ datatypes::Int128{ ~0ULL, 0x7FFFFFFFFFFFFFFFULL } };
+		(void)maximum.fetchAdd( datatypes::Int128{ 1 } );
+		EXPECT_EQ( maximum.load(), ( datatypes::Int128{ 0ULL, 0x8000000000000000ULL } ) );
+	}
+
+	//----------------------------------------------
+	// Contention
+	//----------------------------------------------
+
+	TEST( AtomicInt128Contention, ExactTotal )
+	{
+		constexpr int threadCount{ 4 };
+		constexpr int addsPerThread{ 20000 };
+
+		// Each add touches both words so torn updates would show up in the total
+		const datatypes::Int128 delta{ 0x8000000000000001ULL, 1ULL };
+
+		datatypes::AtomicInt128 total;
+		std::vector<std::thread> threads;
+		for ( int t{ 0 }; t < threadCount; ++t )
+		{
+			threads.emplace_back( [&total, &delta]() {
+				for ( int i{ 0 }; i < addsPerThread; ++i )
+				{
+					(void)total.fetchAdd( delta );
+				}
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		EXPECT_EQ( total.load(), delta * datatypes::Int128{ threadCount * addsPerThread } );
+	}
+} // namespace nfx::datatypes::test
@@ -0,0 +1,177 @@
+/**
+ * @file TESTS_BatchFormatter.cpp
+ * @brief Tests for batch Decimal and Int128 formatting
+ * @details Validates that default output matches toString() exactly, fixed-scale rounding and
+ *          padding, delimiters and offsets, buffer size handling and a BatchParser round trip
+ */
+
+#include <array>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/BatchFormatter.h>
+#include <nfx/datatypes/BatchParser.h>
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/Int128.h>
+
+namespace nfx::datatypes::test
+{
+	namespace
+	{
+		/** @brief Format values and return the written text */
+		std::string formatDecimals( const std::vector<datatypes::Decimal>& values, const datatypes::BatchFormatOptions& options )
+		{
+			std::string text( datatypes::BatchFormatter::maxDecimalOutputSize( values.size(), options ), '\0' );
+			text.resize( datatypes::BatchFormatter::formatDecimals( values, text, {}, options ) );
+
+			return text;
+		}
+	} // namespace
+
+	//=====================================================================
+	// BatchFormatter tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Decimal
+	//----------------------------------------------
+
+	TEST( BatchFormatterDecimal, MatchesToString )
+	{
+		std::vector<datatypes::Decimal> values{ datatypes::Decimal{}, datatypes::Decimal{ "-0.5" }.round( 0, datatypes::Decimal::RoundingMode::ToZero ),
+			datatypes::Decimal{ 7 }, datatypes::Decimal{ "-101.25" }, datatypes::Decimal{ "0.0003" }, datatypes::Decimal{ "1.5" }.rescale( 10 ),
+			datatypes::Decimal::maxValue(), datatypes::Decimal::minValue(), datatypes::Decimal{ "0.0000000000000000000000000001" },
+			datatypes::Decimal{ "-1234567890123456789.012345678" }, datatypes::Decimal{ "18446744073709551616" } };
+
+		std::mt19937_64 generator{ 7 };
+		for ( int i{ 0 }; i < 500; ++i )
+		{
+			datatypes::Decimal value;
+			value.mantissa() = { static_cast<std::uint32_t>( generator() ), static_cast<std::uint32_t>( generator() ),
+				static_cast<std::uint32_t>( generator() >> ( generator() % 33 ) ) };
+			value.flags() = ( static_cast<std::uint32_t>( generator() % 29 ) << 16 ) | ( generator() % 2 ? 0x80000000U : 0U );
+			values.push_back( value );
+		}
+
+		std::vector<std::size_t> offsets( values.size() + 1 );
+		std::string text( datatypes::BatchFormatter::maxDecimalOutputSize( values.size() ), '\0' );
+		const std::size_t length{ datatypes::BatchFormatter::formatDecimals( values, text, offsets ) };
+		EXPECT_EQ( offsets.front(), 0U );
+		EXPECT_EQ( offsets.back(), length );
+
+		for ( std::size_t i{ 0 }; i < values.size(); ++i )
+		{
+			EXPECT_EQ( std::string_view( text ).substr( offsets[i], offsets[i + 1] - offsets[i] ), values[i].toString() ) << i;
+		}
+	}
+
+	TEST( BatchFormatterDecimal, FixedScale )
+	{
+		datatypes::BatchFormatOptions options;
+		options.delimiter = ',';
+		options.fixedScale = 2;
+
+		const std::vector<datatypes::Decimal> values{ datatypes::Decimal{ "1.005" }, datatypes::Decimal{ "-2.5" }, datatypes::Decimal{ 3 },
+			datatypes::Decimal{}, datatypes::Decimal{ "-0.001" }, datatypes::Decimal{ "0.07" }, datatypes::Decimal{ "12.3456" } };
+		EXPECT_EQ( formatDecimals( values, options ), "1.00,-2.50,3.00,0.00,0.00,0.07,12.35" );
+
+		options.rounding = datatypes::Decimal::RoundingMode::ToPositiveInfinity;
+		EXPECT_EQ( formatDecimals( values, options ), "1.01,-2.50,3.00,0.00,0.00,0.07,12.35" );
+
+		options.fixedScale = 0;
+		options.rounding = datatypes::Decimal::RoundingMode::ToNearestTiesAway;
+		EXPECT_EQ( formatDecimals( values, options ), "1,-3,3,0,0,0,12" );
+
+		// The widest text a fixed scale can produce
+		options.fixedScale = 28;
+		const std::vector<datatypes::Decimal> widest{ -datatypes::Decimal::maxValue() };
+		const std::string text{ formatDecimals( widest, options ) };
+		EXPECT_EQ( text, "-79228162514264337593543950335.0000000000000000000000000000" );
+		EXPECT_LE( text.size(), datatypes::BatchFormatter::maxDecimalOutputSize( 1, options ) );
+
+		options.fixedScale = 29;
+		std::array<char, 128> buffer{};
+		EXPECT_THROW( (void)datatypes::BatchFormatter::formatDecimals( widest, buffer, {}, options ), std::invalid_argument );
+	}
+
+	TEST( BatchFormatterDecimal, DelimitersAndBufferSize )
+	{
+		const std::vector<datatypes::Decimal> values{ datatypes::Decimal{ "1.5" }, datatypes::Decimal{ -22 }, datatypes::Decimal{ "0.25" } };
+
+		datatypes::BatchFormatOptions options;
+		options.delimiter = '\n';
+		EXPECT_EQ( formatDecimals( values, options ), "1.5\n-22\n0.25" );
+
+		options.trailingDelimiter = true;
+		EXPECT_EQ( formatDecimals( values, options ), "1.5\n-22\n0.25\n" );
+
+		// Exactly large enough succeeds, one byte less fails
+		std::array<char, 13> exact{};
+		EXPECT_EQ( datatypes::BatchFormatter::formatDecimals( values, exact, {}, options ), 13U );
+		std::array<char, 12> shortBuffer{};
+		EXPECT_THROW( (void)datatypes::BatchFormatter::formatDecimals( values, shortBuffer, {}, options ), std::invalid_argument );
+		std::array<char, 10> shorter{};
+		EXPECT_THROW( (void)datatypes::BatchFormatter::formatDecimals( values, shorter, {}, options ), std::invalid_argument );
+
+		std::array<std::size_t, 3> fewOffsets{};
+		std::array<char, 64> buffer{};
+		EXPECT_THROW( (void)datatypes::BatchFormatter::formatDecimals( values, buffer, fewOffsets, options ), std::invalid_argument );
+
+		EXPECT_EQ( datatypes::BatchFormatter::formatDecimals( std::span<const datatypes::Decimal>{}, buffer ), 0U );
+	}
+
+	TEST( BatchFormatterDecimal, ParserRoundTrip )
+	{
+		std::vector<datatypes::Decimal> values;
+		for ( int i{ 0 }; i < 300; ++i )
+		{
+			values.push_back( datatypes::Decimal{ i * 7919 - 1000000 } / datatypes::Decimal{ 1000 } );
+		}
+
+		std::vector<std::size_t> offsets( values.size() + 1 );
+		std::string text( datatypes::BatchFormatter::maxDecimalOutputSize( values.size() ), '\0' );
+		text.resize( datatypes::BatchFormatter::formatDecimals( values, text, offsets ) );
+
+		std::vector<datatypes::Decimal> parsed( values.size() );
+		std::vector<std::uint64_t> errors( ( values.size() + 63 ) / 64 );
+		EXPECT_EQ( datatypes::BatchParser::parseDecimals( text, offsets, parsed, errors ), values.size() );
+		for ( std::size_t i{ 0 }; i < values.size(); ++i )
+		{
+			EXPECT_EQ( parsed[i].toBits(), values[i].toBits() ) << i;
+		}
+	}
+
+	//----------------------------------------------
+	// Int128
+	//----------------------------------------------
+
+	TEST( BatchFormatterInt128, MatchesToString )
+	{
+		const datatypes::Int128 maxValue{ 0xFFFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL };
+		const datatypes::Int128 minValue{ 0ULL, 0x8000000000000000ULL };
+		std::vector<datatypes::Int128> values{ datatypes::Int128{}, datatypes::Int128{ -1 }, datatypes::Int128{ 10 }, maxValue, minValue,
+			datatypes::Int128{ 0ULL, 1ULL }, datatypes::Int128{ "-10000000000000000000" } };
+
+		std::mt19937_64 generator{ 11 };
+		for ( int i{ 0 }; i < 500; ++i )
+		{
+			values.push_back( datatypes::Int128{ generator(), generator() >> ( generator() % 64 ) } );
+		}
+
+		datatypes::BatchFormatOptions options;
+		options.delimiter = ' ';
+		std::vector<std::size_t> offsets( values.size() + 1 );
+		std::string text( datatypes::BatchFormatter::maxInt128OutputSize( values.size(), options ), '\0' );
+		(void)datatypes::BatchFormatter::formatInt128s( values, text, offsets, options );
+
+		for ( std::size_t i{ 0 }; i < values.size(); ++i )
+		{
+			const std::size_t end{ i + 1 < values.size() ? offsets[i + 1] - 1 : offsets[i + 1] };
+			EXPECT_EQ( std::string_view( text ).substr( offsets[i], end - offsets[i] ), values[i].toString() ) << i;
+		}
+	}
+} // namespace nfx::datatypes::test
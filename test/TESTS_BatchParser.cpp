@@ -0,0 +1,222 @@
+/**
+ * @file TESTS_BatchParser.cpp
+ * @brief Tests for batch Decimal and Int128 parsing
+ * @details Validates that every field matches the scalar tryParse result bit for bit, the
+ *          offsets and delimiter field layouts, the error bitmap and the DecimalColumn overloads
+ */
+
+#include <array>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/BatchParser.h>
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalColumn.h>
+#include <nfx/datatypes/Int128.h>
+
+namespace nfx::datatypes::test
+{
+	namespace
+	{
+		/** @brief Concatenate fields and record Arrow-style offsets (n + 1 boundaries) */
+		std::string joinFields( const std::vector<std::string>& fields, std::vector<std::size_t>& offsets )
+		{
+			std::string buffer;
+			offsets.assign( 1, 0 );
+			for ( const std::string& field : fields )
+			{
+				buffer += field;
+				offsets.push_back( buffer.size() );
+			}
+
+			return buffer;
+		}
+
+		const std::vector<std::string> decimalSamples{ "0", "-0", "+7", "1.", ".5", "-.250", "0.000", "101.25", "-0.0003",
+			"123456789012345678", "1234567890123456789.012345678", "79228162514264337593543950335",
+			"-79228162514264337593543950335", "0.0000000000000000000000000001", "12345678901234567890123456789.5",
+			"99999999999999999999999999999999", "1.2.3", "", "-", "+", ".", "1e5", " 1", "12a4", "00000000000000000000000000000000001.5",
+			"4294967296.4294967296", "18446744073709551616" };
+
+		const std::vector<std::string> int128Samples{ "0", "-0", "+42", "-9223372036854775808", "18446744073709551616",
+			"12345678901234567890123456789012", "-99999999999999999999999999999999", "170141183460469231731687303715884105727",
+			"-170141183460469231731687303715884105728", "170141183460469231731687303715884105728", "", "-", "1.5", "12x",
+			"000000000000000000000000000000000000000001" };
+	} // namespace
+
+	//=====================================================================
+	// BatchParser tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Decimal
+	//----------------------------------------------
+
+	TEST( BatchParserDecimal, MatchesTryParse )
+	{
+		std::vector<std::size_t> offsets;
+		const std::string buffer{ joinFields( decimalSamples, offsets ) };
+
+		std::vector<datatypes::Decimal> values( decimalSamples.size(), datatypes::Decimal{ 99 } );
+		std::vector<std::uint64_t> errors( 1, ~0ULL );
+		EXPECT_EQ( datatypes::BatchParser::parseDecimals( buffer, offsets, values, errors ), decimalSamples.size() );
+
+		for ( std::size_t i{ 0 }; i < decimalSamples.size(); ++i )
+		{
+			datatypes::Decimal expected;
+			const bool ok{ datatypes::Decimal::tryParse( decimalSamples[i], expected ) };
+			EXPECT_EQ( ( ( errors[0] >> i ) & 1U ) == 0, ok ) << decimalSamples[i];
+			EXPECT_EQ( values[i].toBits(), ok ? expected.toBits() : datatypes::Decimal{}.toBits() ) << decimalSamples[i];
+		}
+		EXPECT_EQ( errors[0] >> decimalSamples.size(), 0ULL );
+	}
+
+	TEST( BatchParserDecimal, RandomFieldsMatchTryParse )
+	{
+		std::mt19937_64 generator{ 20240611 };
+		std::uniform_int_distribution<int> digitCount{ 0, 20 };
+		std::uniform_int_distribution<int> digit{ 0, 9 };
+		std::uniform_int_distribution<int> choice{ 0, 15 };
+
+		const auto digits{ [&]( std::string& field ) {
+			const int count{ digitCount( generator ) };
+			for ( int i{ 0 }; i < count; ++i )
+			{
+				// Bias towards zeros to exercise leading/trailing zero handling
+				field.push_back( choice( generator ) < 4 ? '0' : static_cast<char>( '0' + digit( generator ) ) );
+			}
+		} };
+
+		std::vector<std::string> fields;
+		for ( int n{ 0 }; n < 5000; ++n )
+		{
+			// [sign] digits [. digits], with occasional junk inserted
+			std::string field;
+			const int sign{ choice( generator ) };
+			field += sign < 3 ? "-" : ( sign < 4 ? "+" : "" );
+			digits( field );
+			if ( choice( generator ) < 10 )
+			{
+				field.push_back( '.' );
+				digits( field );
+			}
+			if ( choice( generator ) == 0 && !field.empty() )
+			{
+				field.insert( field.begin() + static_cast<std::ptrdiff_t>( std::uniform_int_distribution<std::size_t>{ 0, field.size() - 1 }( generator ) ),
+					".x-"[choice( generator ) % 3] );
+			}
+			fields.push_back( field );
+		}
+
+		std::vector<std::size_t> offsets;
+		const std::string buffer{ joinFields( fields, offsets ) };
+		std::vector<datatypes::Decimal> values( fields.size() );
+		std::vector<std::uint64_t> errors( ( fields.size() + 63 ) / 64 );
+		(void)datatypes::BatchParser::parseDecimals( buffer, offsets, values, errors );
+
+		for ( std::size_t i{ 0 }; i < fields.size(); ++i )
+		{
+			datatypes::Decimal expected;
+			const bool ok{ datatypes::Decimal::tryParse( fields[i], expected ) };
+			ASSERT_EQ( ( ( errors[i / 64] >> ( i % 64 ) ) & 1U ) == 0, ok ) << fields[i];
+			if ( ok )
+			{
+				ASSERT_EQ( values[i].toBits(), expected.toBits() ) << fields[i];
+			}
+		}
+	}
+
+	TEST( BatchParserDecimal, Delimited )
+	{
+		const std::string text{ "1.50\n-2\nabc\n\n0.001\n" };
+		std::array<datatypes::Decimal, 5> values{};
+		std::array<std::uint64_t, 1> errors{};
+
+		// The trailing delimiter does not open a sixth field
+		EXPECT_EQ( datatypes::BatchParser::parseDecimals( text, '\n', values, errors ), 5U );
+		EXPECT_EQ( values[0], datatypes::Decimal{ "1.5" } );
+		EXPECT_EQ( values[0].scale(), 1U );
+		EXPECT_EQ( values[1], datatypes::Decimal{ -2 } );
+		EXPECT_TRUE( values[2].isZero() );
+		EXPECT_EQ( values[4], datatypes::Decimal{ "0.001" } );
+		EXPECT_EQ( errors[0], 0xCULL );
+
+		EXPECT_EQ( datatypes::BatchParser::parseDecimals( std::string_view{}, '\n', values, errors ), 0U );
+
+		std::array<datatypes::Decimal, 4> small{};
+		EXPECT_THROW( (void)datatypes::BatchParser::parseDecimals( text, '\n', small, errors ), std::invalid_argument );
+	}
+
+	TEST( BatchParserDecimal, OffsetValidation )
+	{
+		const std::string text{ "12" };
+		std::array<datatypes::Decimal, 2> values{};
+		std::array<std::uint64_t, 1> errors{};
+
+		const std::array<std::size_t, 3> backwards{ 0, 2, 1 };
+		EXPECT_THROW( (void)datatypes::BatchParser::parseDecimals( text, backwards, values, errors ), std::invalid_argument );
+
+		const std::array<std::size_t, 2> pastEnd{ 0, 3 };
+		EXPECT_THROW( (void)datatypes::BatchParser::parseDecimals( text, pastEnd, values, errors ), std::invalid_argument );
+
+		const std::array<std::size_t, 4> tooMany{ 0, 1, 1, 2 };
+		EXPECT_THROW( (void)datatypes::BatchParser::parseDecimals( text, tooMany, values, errors ), std::invalid_argument );
+
+		std::span<std::uint64_t> noErrors{};
+		const std::array<std::size_t, 2> one{ 0, 2 };
+		EXPECT_THROW( (void)datatypes::BatchParser::parseDecimals( text, one, values, noErrors ), std::invalid_argument );
+		EXPECT_EQ( datatypes::BatchParser::parseDecimals( text, std::span<const std::size_t>{}, values, noErrors ), 0U );
+	}
+
+	TEST( BatchParserDecimal, Column )
+	{
+		datatypes::DecimalColumn column;
+		column.append( datatypes::Decimal{ 1 } );
+
+		EXPECT_EQ( datatypes::BatchParser::parseDecimals( "2.5,x,-3", ',', column ), 3U );
+		ASSERT_EQ( column.size(), 4U );
+		EXPECT_EQ( column[1], datatypes::Decimal{ "2.5" } );
+		EXPECT_FALSE( column.isValid( 2 ) );
+		EXPECT_EQ( column[3], datatypes::Decimal{ -3 } );
+
+		const std::array<std::size_t, 3> offsets{ 0, 3, 4 };
+		EXPECT_EQ( datatypes::BatchParser::parseDecimals( "0.1?", offsets, column ), 2U );
+		EXPECT_EQ( column[4], datatypes::Decimal{ "0.1" } );
+		EXPECT_EQ( column.nullCount(), 2U );
+	}
+
+	//----------------------------------------------
+	// Int128
+	//----------------------------------------------
+
+	TEST( BatchParserInt128, MatchesTryParse )
+	{
+		std::vector<std::size_t> offsets;
+		const std::string buffer{ joinFields( int128Samples, offsets ) };
+
+		std::vector<datatypes::Int128> values( int128Samples.size() );
+		std::vector<std::uint64_t> errors( 1 );
+		EXPECT_EQ( datatypes::BatchParser::parseInt128s( buffer, offsets, values, errors ), int128Samples.size() );
+
+		for ( std::size_t i{ 0 }; i < int128Samples.size(); ++i )
+		{
+			datatypes::Int128 expected;
+			const bool ok{ datatypes::Int128::tryParse( int128Samples[i], expected ) };
+			EXPECT_EQ( ( ( errors[0] >> i ) & 1U ) == 0, ok ) << int128Samples[i];
+			EXPECT_EQ( values[i], ok ? expected : datatypes::Int128{} ) << int128Samples[i];
+		}
+	}
+
+	TEST( BatchParserInt128, Delimited )
+	{
+		std::array<datatypes::Int128, 3> values{};
+		std::array<std::uint64_t, 1> errors{};
+		EXPECT_EQ( datatypes::BatchParser::parseInt128s( "-12345678901234567890123,7,", ',', values, errors ), 2U );
+		EXPECT_EQ( values[0], datatypes::Int128{ "-12345678901234567890123" } );
+		EXPECT_EQ( values[1], datatypes::Int128{ 7 } );
+		EXPECT_EQ( errors[0], 0ULL );
+	}
+} // namespace nfx::datatypes::test
@@ -0,0 +1,230 @@
+/**
+ * @file TESTS_ColumnFile.cpp
+ * @brief Tests for the column file writer and memory-mapped reader
+ * @details Validates round trips of every column type, scale policy and Decimal64 packing
+ *          checks, the XXH64 checksum against reference digests, and rejection of
+ *          damaged, truncated and missing files
+ */
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/ColumnFile.h>
+
+namespace nfx::datatypes::test
+{
+	namespace
+	{
+		/** @brief Scratch file removed at the end of a test */
+		class TemporaryFile
+		{
+		public:
+			explicit TemporaryFile( const char* name )
+				: m_path{ std::filesystem::temp_directory_path() / name }
+			{
+				std::filesystem::remove( m_path );
+			}
+
+			~TemporaryFile()
+			{
+				std::error_code error;
+				std::filesystem::remove( m_path, error );
+			}
+
+			const std::filesystem::path& path() const noexcept
+			{
+				return m_path;
+			}
+
+		private:
+			std::filesystem::path m_path;
+		};
+
+		/** @brief Overwrite one byte of a file */
+		void patchByte( const std::filesystem::path& path, std::streamoff offset, char value )
+		{
+			std::fstream file{ path, std::ios::binary | std::ios::in | std::ios::out };
+			file.seekp( offset );
+			file.put( value );
+		}
+	} // namespace
+
+	//=====================================================================
+	// ColumnFile type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Round trips
+	//----------------------------------------------
+
+	TEST( ColumnFileRoundTrip, Decimal )
+	{
+		const TemporaryFile file{ "nfx_column_decimal.col" };
+		const std::vector<datatypes::Decimal> first{ datatypes::Decimal{ "101.25" }, datatypes::Decimal{ "-0.0003" } };
+		const std::vector<datatypes::Decimal> second{ datatypes::Decimal{ "1.5" }.rescale( 6 ), datatypes::Decimal::maxValue(), datatypes::Decimal{} };
+
+		datatypes::ColumnFileWriter writer{ file.path(), datatypes::ColumnType::Decimal };
+		writer.append( first );
+		writer.append( second );
+		EXPECT_EQ( writer.size(), 5U );
+		writer.finish();
+		EXPECT_THROW( writer.append( first ), std::logic_error );
+
+		const datatypes::ColumnFileReader reader{ file.path() };
+		EXPECT_EQ( reader.type(), datatypes::ColumnType::Decimal );
+		EXPECT_EQ( reader.scalePolicy(), datatypes::ColumnScalePolicy::Preserve );
+		ASSERT_EQ( reader.size(), 5U );
+		EXPECT_EQ( std::filesystem::file_size( file.path() ), 64U + 5U * 16U );
+
+		const std::span<const datatypes::Decimal> values{ reader.decimals() };
+		EXPECT_EQ( reinterpret_cast<std::uintptr_t>( values.data() ) % 64, 0U );
+		EXPECT_EQ( values[0].toBits(), first[0].toBits() );
+		EXPECT_EQ( values[2].toBits(), second[0].toBits() );
+		EXPECT_EQ( values[3], datatypes::Decimal::maxValue() );
+
+		EXPECT_TRUE( reader.verifyChecksum() );
+		EXPECT_EQ( reader.findInvalid(), reader.size() );
+		EXPECT_THROW( (void)reader.int128s(), std::invalid_argument );
+		EXPECT_THROW( (void)reader.decimal64s(), std::invalid_argument );
+	}
+
+	TEST( ColumnFileRoundTrip, Decimal64 )
+	{
+		const TemporaryFile file{ "nfx_column_decimal64.col" };
+		const std::vector<datatypes::Decimal> closes{ datatypes::Decimal{ "101.2500" }.rescale( 4 ), datatypes::Decimal{ "-7" }.rescale( 4 ) };
+
+		{
+			datatypes::ColumnFileWriter writer{ file.path(), datatypes::ColumnType::Decimal64, datatypes::ColumnScalePolicy::Fixed, 4 };
+			writer.append( closes );
+
+			// Rejected batches leave the column untouched
+			const std::vector<datatypes::Decimal> wrongScale{ datatypes::Decimal{ "1.5" } };
+			EXPECT_THROW( writer.append( wrongScale ), std::invalid_argument );
+			const std::vector<datatypes::Decimal> tooLarge{ datatypes::Decimal{ "100000000000000" }.rescale( 4 ) };
+			EXPECT_THROW( writer.append( tooLarge ), std::overflow_error );
+			const std::vector<datatypes::Int128> integers{ datatypes::Int128{ 1 } };
+			EXPECT_THROW( writer.append( integers ), std::invalid_argument );
+			EXPECT_EQ( writer.size(), 2U );
+			writer.finish();
+		}
+
+		const datatypes::ColumnFileReader reader{ file.path() };
+		EXPECT_EQ( reader.type(), datatypes::ColumnType::Decimal64 );
+		EXPECT_EQ( reader.scalePolicy(), datatypes::ColumnScalePolicy::Fixed );
+		EXPECT_EQ( reader.scale(), 4U );
+		EXPECT_EQ( std::filesystem::file_size( file.path() ), 64U + 2U * 8U );
+
+		std::vector<datatypes::Decimal> restored( reader.size() );
+		reader.toDecimals( restored );
+		EXPECT_EQ( restored[0].toBits(), closes[0].toBits() );
+		EXPECT_EQ( restored[1].toBits(), closes[1].toBits() );
+		EXPECT_EQ( reader.decimal64s()[1].scale(), 4U );
+		EXPECT_EQ( reader.findInvalid(), reader.size() );
+
+		std::vector<datatypes::Decimal> small( 1 );
+		EXPECT_THROW( reader.toDecimals( small ), std::invalid_argument );
+	}
+
+	TEST( ColumnFileRoundTrip, Int128AndChecksum )
+	{
+		const TemporaryFile file{ "nfx_column_int128.col" };
+
+		// Payload bytes 0, 1, ..., 255 three times: XXH64 0x8E03C838C596036F
+		std::array<std::byte, 768> bytes;
+		for ( std::size_t i{ 0 }; i < bytes.size(); ++i )
+		{
+			bytes[i] = static_cast<std::byte>( i );
+		}
+		std::vector<datatypes::Int128> values( bytes.size() / 16 );
+		std::memcpy( values.data(), bytes.data(), bytes.size() );
+
+		{
+			// Uneven batches exercise the streaming checksum
+			datatypes::ColumnFileWriter writer{ file.path(), datatypes::ColumnType::Int128 };
+			writer.append( std::span<const datatypes::Int128>{ values }.first( 5 ) );
+			writer.append( std::span<const datatypes::Int128>{ values }.subspan( 5 ) );
+			writer.finish();
+		}
+
+		const datatypes::ColumnFileReader reader{ file.path() };
+		EXPECT_EQ( reader.type(), datatypes::ColumnType::Int128 );
+		ASSERT_EQ( reader.size(), values.size() );
+		EXPECT_EQ( reader.int128s()[47], values[47] );
+		EXPECT_EQ( reader.checksum(), 0x8E03C838C596036FULL );
+		EXPECT_TRUE( reader.verifyChecksum() );
+
+		std::vector<datatypes::Decimal> decimals( reader.size() );
+		EXPECT_THROW( reader.toDecimals( decimals ), std::invalid_argument );
+		EXPECT_THROW( ( datatypes::ColumnFileWriter{ file.path(), datatypes::ColumnType::Int128, datatypes::ColumnScalePolicy::Fixed, 2 } ),
+			std::invalid_argument );
+	}
+
+	TEST( ColumnFileRoundTrip, EmptyAndMoved )
+	{
+		const TemporaryFile file{ "nfx_column_empty.col" };
+		{
+			datatypes::ColumnFileWriter writer{ file.path(), datatypes::ColumnType::Decimal };
+			writer.finish();
+		}
+
+		datatypes::ColumnFileReader reader{ file.path() };
+		EXPECT_EQ( reader.size(), 0U );
+		EXPECT_TRUE( reader.decimals().empty() );
+		EXPECT_EQ( reader.checksum(), 0xEF46DB3751D8E999ULL );
+
+		const datatypes::ColumnFileReader moved{ std::move( reader ) };
+		EXPECT_TRUE( moved.verifyChecksum() );
+		EXPECT_EQ( moved.type(), datatypes::ColumnType::Decimal );
+	}
+
+	TEST( ColumnFileRoundTrip, UnfinishedWriterRemovesFile )
+	{
+		const TemporaryFile file{ "nfx_column_unfinished.col" };
+		{
+			datatypes::ColumnFileWriter writer{ file.path(), datatypes::ColumnType::Decimal };
+			writer.append( std::vector<datatypes::Decimal>{ datatypes::Decimal{ "1.25" } } );
+		}
+
+		EXPECT_FALSE( std::filesystem::exists( file.path() ) );
+		EXPECT_THROW( datatypes::ColumnFileReader{ file.path() }, std::system_error );
+	}
+
+	//----------------------------------------------
+	// Damaged files
+	//----------------------------------------------
+
+	TEST( ColumnFileValidation, DamagedFiles )
+	{
+		const TemporaryFile file{ "nfx_column_damaged.col" };
+		const std::vector<datatypes::Decimal> values{ datatypes::Decimal{ "1.25" }, datatypes::Decimal{ "2.5" } };
+		{
+			datatypes::ColumnFileWriter writer{ file.path(), datatypes::ColumnType::Decimal };
+			writer.append( values );
+			writer.finish();
+		}
+
+		// Payload damage is found on demand: flags word of the second value
+		patchByte( file.path(), 64 + 16 + 1, 0x01 );
+		{
+			const datatypes::ColumnFileReader reader{ file.path() };
+			EXPECT_FALSE( reader.verifyChecksum() );
+			EXPECT_EQ( reader.findInvalid(), 1U );
+		}
+
+		// Header damage is found on open
+		patchByte( file.path(), 24, 0x03 );
+		EXPECT_THROW( datatypes::ColumnFileReader{ file.path() }, std::invalid_argument );
+
+		std::filesystem::resize_file( file.path(), 40 );
+		EXPECT_THROW( datatypes::ColumnFileReader{ file.path() }, std::invalid_argument );
+
+		std::filesystem::remove( file.path() );
+		EXPECT_THROW( datatypes::ColumnFileReader{ file.path() }, std::system_error );
+	}
+} // namespace nfx::datatypes::test
@@ -0,0 +1,141 @@
+/**
+ * @file TESTS_ConcurrentDecimalAdder.cpp
+ * @brief Tests for the sharded concurrent Decimal adder
+ * @details Validates shard sizing, exact sums across scales and products, reset semantics,
+ *          and exact totals when many threads add while another takes and resets the sum
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/ConcurrentDecimalAdder.h>
+
+namespace nfx::datatypes::test
+{
+	//=====================================================================
+	// ConcurrentDecimalAdder type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Accumulation
+	//----------------------------------------------
+
+	TEST( ConcurrentDecimalAdderAccumulation, ShardsAndSum )
+	{
+		static_assert( alignof( internal::AdderShard ) == constants::CONCURRENT_ADDER_SHARD_ALIGNMENT );
+
+		EXPECT_EQ( datatypes::ConcurrentDecimalAdder{ 0 }.shardCount(), 1U );
+		EXPECT_EQ( datatypes::ConcurrentDecimalAdder{ 5 }.shardCount(), 8U );
+		const datatypes::ConcurrentDecimalAdder defaulted;
+		EXPECT_GE( defaulted.shardCount(), 1U );
+		EXPECT_LE( defaulted.shardCount(), constants::CONCURRENT_ADDER_MAX_DEFAULT_SHARDS );
+		EXPECT_TRUE( defaulted.sum().isZero() );
+
+		datatypes::ConcurrentDecimalAdder adder{ 4 };
+		adder.add( datatypes::Decimal{ "0.1" } );
+		adder.add( datatypes::Decimal{ "0.2" } );
+		adder.add( datatypes::Decimal{ "-1000000000000000000000000000" } );
+		adder.addWeighted( datatypes::Decimal{ "101.25" }, datatypes::Decimal{ "0.003" } );
+		adder.add( datatypes::Decimal{ "1000000000000000000000000000" } );
+
+		// Exact although the intermediate total has no room for the fraction in a Decimal
+		EXPECT_EQ( adder.sum(), datatypes::Decimal{ "0.60375" } );
+		EXPECT_EQ( adder.count(), 5U );
+
+		DecimalAccumulator merged{ adder.snapshot() };
+		merged.add( datatypes::Decimal{ "0.39625" } );
+		EXPECT_EQ( merged.result(), datatypes::Decimal{ 1 } );
+
+		adder.reset();
+		EXPECT_TRUE( adder.sum().isZero() );
+		EXPECT_EQ( adder.count(), 0U );
+	}
+
+	TEST( ConcurrentDecimalAdderAccumulation, Overflow )
+	{
+		datatypes::ConcurrentDecimalAdder adder{ 2 };
+		adder.add( datatypes::Decimal::maxValue() );
+		adder.add( datatypes::Decimal::maxValue() );
+
+		EXPECT_THROW( (void)adder.sum(), std::overflow_error );
+
+		ArithmeticStatus status{ ArithmeticStatus::None };
+		EXPECT_EQ( adder.sum( status ), datatypes::Decimal::maxValue() );
+		EXPECT_TRUE( hasStatus( status, ArithmeticStatus::Overflow ) );
+
+		// The shards are emptied even though the sum did not fit
+		EXPECT_THROW( (void)adder.sumThenReset(), std::overflow_error );
+		EXPECT_TRUE( adder.sum().isZero() );
+	}
+
+	//----------------------------------------------
+	// Contention
+	//----------------------------------------------
+
+	TEST( ConcurrentDecimalAdderContention, ExactTotal )
+	{
+		constexpr int threadCount{ 8 };
+		constexpr int addsPerThread{ 20000 };
+
+		// Fewer shards than threads forces collisions
+		datatypes::ConcurrentDecimalAdder fees{ 2 };
+		std::vector<std::thread> threads;
+		for ( int t{ 0 }; t < threadCount; ++t )
+		{
+			threads.emplace_back( [&fees, t]() {
+				const datatypes::Decimal fee{ t % 2 == 0 ? datatypes::Decimal{ "0.0001" } : datatypes::Decimal{ "12.5" } };
+				for ( int i{ 0 }; i < addsPerThread; ++i )
+				{
+					fees.add( fee );
+				}
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		// 4 * 20000 * 0.0001 + 4 * 20000 * 12.5
+		EXPECT_EQ( fees.sum(), datatypes::Decimal{ "1000008" } );
+		EXPECT_EQ( fees.count(), static_cast<std::uint64_t>( threadCount * addsPerThread ) );
+	}
+
+	TEST( ConcurrentDecimalAdderContention, SumThenResetLosesNothing )
+	{
+		constexpr int threadCount{ 4 };
+		constexpr int addsPerThread{ 20000 };
+
+		datatypes::ConcurrentDecimalAdder volume;
+		std::atomic<int> running{ threadCount };
+		std::vector<std::thread> threads;
+		for ( int t{ 0 }; t < threadCount; ++t )
+		{
+			threads.emplace_back( [&volume, &running]() {
+				for ( int i{ 0 }; i < addsPerThread; ++i )
+				{
+					volume.addWeighted( datatypes::Decimal{ "99.5" }, datatypes::Decimal{ 2 } );
+				}
+				running.fetch_sub( 1 );
+			} );
+		}
+
+		// Drain interval totals while the writers run
+		DecimalAccumulator reported;
+		while ( running.load() > 0 )
+		{
+			reported.merge( volume.snapshotThenReset() );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+		reported.merge( volume.snapshotThenReset() );
+
+		EXPECT_EQ( reported.result(), datatypes::Decimal{ "15920000" } );
+		EXPECT_EQ( reported.count(), static_cast<std::uint64_t>( threadCount * addsPerThread ) );
+		EXPECT_TRUE( volume.sum().isZero() );
+	}
+} // namespace nfx::datatypes::test
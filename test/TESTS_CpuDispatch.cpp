@@ -0,0 +1,134 @@
+/**
+ * @file TESTS_CpuDispatch.cpp
+ * @brief Tests for runtime instruction set selection
+ * @details Validates detection and override of the active instruction set, and that the
+ *          Int128 and DecimalFilter kernels return identical results under every instruction
+ *          set the running CPU supports
+ */
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/ArithmeticStatus.h>
+#include <nfx/datatypes/CpuDispatch.h>
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalColumn.h>
+#include <nfx/datatypes/DecimalFilter.h>
+#include <nfx/datatypes/Int128.h>
+#include <nfx/datatypes/Int128Kernels.h>
+
+namespace nfx::datatypes::test
+{
+	using InstructionSet = datatypes::CpuDispatch::InstructionSet;
+
+	namespace
+	{
+		/** @brief Every instruction set, narrowest first */
+		constexpr InstructionSet INSTRUCTION_SETS[]{ InstructionSet::Baseline, InstructionSet::Avx2, InstructionSet::Avx512 };
+
+		/** @brief Results of every dispatched kernel on fixed data */
+		struct KernelResults
+		{
+			std::vector<datatypes::Int128> sums;
+			std::vector<std::uint64_t> lessThan;
+			datatypes::Int128 total;
+			std::vector<std::uint64_t> selection;
+		};
+
+		/** @brief Run every dispatched kernel under the active instruction set */
+		KernelResults runKernels()
+		{
+			std::mt19937_64 engine{ 41 };
+			std::vector<datatypes::Int128> left( 1000 );
+			std::vector<datatypes::Int128> right( left.size() );
+			datatypes::DecimalColumn column;
+			for ( std::size_t i{ 0 }; i < left.size(); ++i )
+			{
+				left[i] = datatypes::Int128{ engine(), engine() };
+				right[i] = datatypes::Int128{ engine(), engine() };
+				if ( i % 17 == 0 )
+				{
+					column.appendNull();
+				}
+				else
+				{
+					// Runs sharing a scale take the vector path, scale changes the scalar one
+					const datatypes::Decimal value{ static_cast<std::int64_t>( engine() % 2000000 ) - 1000000 };
+					column.append( ( value / datatypes::Decimal{ 1000 } ).rescale( static_cast<std::int32_t>( 3 + i / 100 % 3 ) ) );
+				}
+			}
+
+			KernelResults results;
+			results.sums.resize( left.size() );
+			datatypes::Int128Kernels::add( left, right, results.sums );
+			results.lessThan.resize( ( left.size() + 63 ) / 64 );
+			datatypes::Int128Kernels::lessThan( left, right, results.lessThan );
+
+			datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+			results.total = datatypes::Int128Kernels::sum( left, status );
+
+			results.selection.resize( ( column.size() + 63 ) / 64 );
+			datatypes::DecimalFilter::between( column, datatypes::Decimal{ "-250.5" }, datatypes::Decimal{ "400" }, results.selection );
+
+			return results;
+		}
+	} // namespace
+
+	//=====================================================================
+	// CpuDispatch tests
+	//=====================================================================
+
+	TEST( CpuDispatch, Detection )
+	{
+		EXPECT_EQ( datatypes::CpuDispatch::active(), datatypes::CpuDispatch::detected() );
+		EXPECT_TRUE( datatypes::CpuDispatch::isSupported( InstructionSet::Baseline ) );
+		EXPECT_TRUE( datatypes::CpuDispatch::isSupported( datatypes::CpuDispatch::detected() ) );
+	}
+
+	TEST( CpuDispatch, Override )
+	{
+		for ( const InstructionSet instructionSet : INSTRUCTION_SETS )
+		{
+			if ( datatypes::CpuDispatch::isSupported( instructionSet ) )
+			{
+				datatypes::CpuDispatch::setActive( instructionSet );
+				EXPECT_EQ( datatypes::CpuDispatch::active(), instructionSet );
+			}
+			else
+			{
+				// Unsupported sets are rejected and leave the selection unchanged
+				const InstructionSet previous{ datatypes::CpuDispatch::active() };
+				EXPECT_THROW( datatypes::CpuDispatch::setActive( instructionSet ), std::invalid_argument );
+				EXPECT_EQ( datatypes::CpuDispatch::active(), previous );
+			}
+		}
+
+		datatypes::CpuDispatch::reset();
+		EXPECT_EQ( datatypes::CpuDispatch::active(), datatypes::CpuDispatch::detected() );
+	}
+
+	TEST( CpuDispatch, IdenticalResults )
+	{
+		datatypes::CpuDispatch::setActive( InstructionSet::Baseline );
+		const KernelResults expected{ runKernels() };
+
+		for ( const InstructionSet instructionSet : INSTRUCTION_SETS )
+		{
+			if ( !datatypes::CpuDispatch::isSupported( instructionSet ) )
+			{
+				continue;
+			}
+
+			datatypes::CpuDispatch::setActive( instructionSet );
+			const KernelResults results{ runKernels() };
+			EXPECT_EQ( results.sums, expected.sums );
+			EXPECT_EQ( results.lessThan, expected.lessThan );
+			EXPECT_EQ( results.total, expected.total );
+			EXPECT_EQ( results.selection, expected.selection );
+		}
+
+		datatypes::CpuDispatch::reset();
+	}
+} // namespace nfx::datatypes::test
@@ -4,14 +4,18 @@
  * @details Validates Decimal compatibility and cross-platform behavior
  */
 
+#include <array>
 #include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 #include <gtest/gtest.h>
 
 #include <nfx/datatypes/Decimal.h>
 #include <nfx/datatypes/Int128.h>
 
-#include "Constants.h"
+#include <nfx/detail/datatypes/Constants.h>
 
 namespace nfx::datatypes::test
 {
@@ -375,6 +379,46 @@ namespace nfx::datatypes::test
 		EXPECT_EQ( static_cast<std::uint32_t>( smallBits[3] ) & constants::DECIMAL_SIGN_MASK, 0u );
 	}
 
+	TEST( DecimalConversion, FromBits )
+	{
+		for ( const char* text : { "0", "123.45", "-0.001", "79228162514264337593543950335", "-7.9228162514264337593543950335" } )
+		{
+			const datatypes::Decimal value{ text };
+			EXPECT_EQ( datatypes::Decimal::fromBits( value.toBits() ).toBits(), value.toBits() ) << text;
+		}
+
+		// Unnormalized scale is kept
+		const datatypes::Decimal padded{ datatypes::Decimal{ "1.5" }.rescale( 6 ) };
+		EXPECT_EQ( datatypes::Decimal::fromBits( padded.toBits() ).scale(), 6U );
+
+		// Reserved bits or a scale above 28 are rejected
+		datatypes::Decimal result{ 7 };
+		EXPECT_THROW( (void)datatypes::Decimal::fromBits( { 1, 0, 0, 0x00000001 } ), std::invalid_argument );
+		EXPECT_THROW( (void)datatypes::Decimal::fromBits( { 1, 0, 0, 0x01000000 } ), std::invalid_argument );
+		EXPECT_THROW( (void)datatypes::Decimal::fromBits( { 1, 0, 0, 29 << 16 } ), std::invalid_argument );
+		EXPECT_FALSE( datatypes::Decimal::tryFromBits( { 1, 0, 0, 0x40000000 }, result ) );
+		EXPECT_EQ( result, datatypes::Decimal{ 7 } );
+		EXPECT_TRUE( datatypes::Decimal::tryFromBits( { 1, 0, 0, static_cast<std::int32_t>( 0x801C0000U ) }, result ) );
+		EXPECT_EQ( result, datatypes::Decimal{ "-0.0000000000000000000000000001" } );
+
+		static_assert( datatypes::Decimal::fromBits( { 12345, 0, 0, 2 << 16 } ) == datatypes::Decimal{ "123.45" } );
+	}
+
+	TEST( DecimalConversion, FromParts )
+	{
+		const datatypes::Decimal max{ datatypes::Decimal::fromParts( 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU, 0, false ) };
+		EXPECT_EQ( max, datatypes::Decimal::maxValue() );
+
+		const datatypes::Decimal price{ datatypes::Decimal::fromParts( 750, 0, 0, 2, true ) };
+		EXPECT_EQ( price.toBits(), datatypes::Decimal{ "-7.5" }.rescale( 2 ).toBits() );
+
+		// A zero mantissa never carries the sign
+		EXPECT_FALSE( datatypes::Decimal::fromParts( 0, 0, 0, 3, true ).isNegative() );
+		EXPECT_THROW( (void)datatypes::Decimal::fromParts( 1, 0, 0, 29, false ), std::invalid_argument );
+
+		static_assert( datatypes::Decimal::fromParts( 0, 1, 0, 0, false ) == datatypes::Decimal{ std::uint64_t{ 1 } << 32 } );
+	}
+
 	//----------------------------------------------
 	// Arithmetic
 	//----------------------------------------------
@@ -397,6 +441,12 @@ namespace nfx::datatypes::test
 		EXPECT_FALSE( result.isZero() );
 		EXPECT_FALSE( result.isNegative() );
 
+		// Negative left operand with larger positive right operand
+		result = d4 + d3;
+		EXPECT_FALSE( result.isNegative() );
+		EXPECT_EQ( result.toString(), "50" );
+		EXPECT_EQ( ( datatypes::Decimal{ "-2.25" } + datatypes::Decimal{ "99999999.99" } ).toString(), "99999997.74" );
+
 		// Test adding zero
 		result = d1 + datatypes::Decimal{ 0 };
 		EXPECT_EQ( result.toString(), d1.toString() );
@@ -1798,6 +1848,172 @@ namespace nfx::datatypes::test
 		EXPECT_EQ( Decimal( "0.001" ).round( 3, Decimal::RoundingMode::ToNearest ).toString(), "0.001" );
 	}
 
+	//----------------------------------------------
+	// Rescale
+	//----------------------------------------------
+
+	TEST( DecimalRescale, RaiseScale )
+	{
+		using datatypes::Decimal;
+
+		// Raising the scale appends trailing zeros
+		Decimal raised{ Decimal( "1.5" ).rescale( 2 ) };
+		EXPECT_EQ( raised.scale(), 2 );
+		EXPECT_EQ( raised.toString(), "1.50" );
+		EXPECT_EQ( raised, Decimal( "1.5" ) );
+
+		EXPECT_EQ( Decimal( "42" ).rescale( 4 ).toString(), "42.0000" );
+		EXPECT_EQ( Decimal( "-42" ).rescale( 8 ).toString(), "-42.00000000" );
+		EXPECT_EQ( Decimal( "0.00000001" ).rescale( 8 ).toString(), "0.00000001" );
+
+		// Scale above the maximum is clamped
+		EXPECT_EQ( Decimal( "1" ).rescale( 40 ).scale(), 28 );
+
+		// Raising the scale past the 96-bit mantissa is reported, never stopped short
+		Decimal max{ Decimal::maxValue() };
+		EXPECT_THROW( (void)max.rescale( 2 ), std::overflow_error );
+
+		Decimal large{ "7922816251426433759354395033" };
+		Decimal result{ 7 };
+		EXPECT_FALSE( large.tryRescale( 5, result ) );
+		EXPECT_FALSE( large.tryRescale( 2, result ) );
+		EXPECT_EQ( result, Decimal{ 7 } );
+
+		EXPECT_TRUE( large.tryRescale( 1, result ) );
+		EXPECT_EQ( result.toString(), "7922816251426433759354395033.0" );
+	}
+
+	TEST( DecimalRescale, LowerScale )
+	{
+		using datatypes::Decimal;
+
+		EXPECT_EQ( Decimal( "1.005" ).rescale( 2 ).toString(), "1.00" );
+		EXPECT_EQ( Decimal( "1.015" ).rescale( 2 ).toString(), "1.02" );
+		EXPECT_EQ( Decimal( "1.005" ).rescale( 2, Decimal::RoundingMode::ToNearestTiesAway ).toString(), "1.01" );
+		EXPECT_EQ( Decimal( "-2.5" ).rescale( 0, Decimal::RoundingMode::ToNearestTiesAway ).toString(), "-3" );
+		EXPECT_EQ( Decimal( "-2.5" ).rescale( 0, Decimal::RoundingMode::ToZero ).toString(), "-2" );
+		EXPECT_EQ( Decimal( "-2.1" ).rescale( 0, Decimal::RoundingMode::ToNegativeInfinity ).toString(), "-3" );
+		EXPECT_EQ( Decimal( "-2.1" ).rescale( 0, Decimal::RoundingMode::ToPositiveInfinity ).toString(), "-2" );
+		EXPECT_EQ( Decimal( "2.1" ).rescale( 0, Decimal::RoundingMode::ToPositiveInfinity ).toString(), "3" );
+
+		// Rounding keeps trailing zeros at the requested scale
+		Decimal rounded{ Decimal( "9.9996" ).rescale( 3 ) };
+		EXPECT_EQ( rounded.scale(), 3 );
+		EXPECT_EQ( rounded.toString(), "10.000" );
+
+		// Negative target scale is treated as 0
+		EXPECT_EQ( Decimal( "123.456" ).rescale( -3 ).toString(), "123" );
+	}
+
+	TEST( DecimalRescale, UniformScaleColumn )
+	{
+		using datatypes::Decimal;
+
+		Decimal values[]{ Decimal( "100" ), Decimal( "99.5" ), Decimal( "100.25" ), Decimal( "0.125" ) };
+
+		for ( auto& value : values )
+		{
+			value = value.rescale( 2 );
+			EXPECT_EQ( value.scale(), 2 );
+		}
+
+		EXPECT_EQ( values[0].toString(), "100.00" );
+		EXPECT_EQ( values[1].toString(), "99.50" );
+		EXPECT_EQ( values[2].toString(), "100.25" );
+		EXPECT_EQ( values[3].toString(), "0.12" );
+		EXPECT_TRUE( values[1] < values[0] );
+		EXPECT_TRUE( values[2] > values[0] );
+	}
+
+	TEST( DecimalRescale, MovePoint )
+	{
+		using datatypes::Decimal;
+
+		// Representable moves only adjust the scale
+		Decimal left{ Decimal( "12345" ).movePointLeft( 2 ) };
+		EXPECT_EQ( left.toString(), "123.45" );
+		EXPECT_EQ( left.mantissa(), Decimal( "12345" ).mantissa() );
+
+		Decimal right{ Decimal( "123.45" ).movePointRight( 2 ) };
+		EXPECT_EQ( right.toString(), "12345" );
+		EXPECT_EQ( right.mantissa(), Decimal( "123.45" ).mantissa() );
+
+		EXPECT_EQ( Decimal( "-1.5" ).movePointLeft( 3 ).toString(), "-0.0015" );
+		EXPECT_EQ( Decimal( "1.5" ).movePointRight( 3 ).toString(), "1500" );
+		EXPECT_EQ( Decimal( "1.5" ).movePointRight( -1 ).toString(), "0.15" );
+		EXPECT_EQ( Decimal( "1.5" ).movePointLeft( -1 ).toString(), "15" );
+		EXPECT_EQ( Decimal( "1.5" ).movePointLeft( 0 ).toString(), "1.5" );
+
+		// Digits beyond the maximum scale are rounded away
+		EXPECT_EQ( Decimal( "0.0000000000000000000000000015" ).movePointLeft( 1 ).toString(), "0.0000000000000000000000000002" );
+		EXPECT_EQ( Decimal( "0.0000000000000000000000000025" ).movePointLeft( 1 ).toString(), "0.0000000000000000000000000002" );
+		EXPECT_TRUE( Decimal( "123" ).movePointLeft( 100 ).isZero() );
+
+		// Out of range results are clamped
+		EXPECT_EQ( Decimal( "1" ).movePointRight( 29 ), Decimal::maxValue() );
+		EXPECT_EQ( Decimal( "-1" ).movePointRight( 100 ), -Decimal::maxValue() );
+		EXPECT_TRUE( Decimal( "0" ).movePointRight( 100 ).isZero() );
+
+		// Extreme shifts saturate instead of overflowing the place count
+		constexpr std::int32_t minPlaces{ std::numeric_limits<std::int32_t>::min() };
+		constexpr std::int32_t maxPlaces{ std::numeric_limits<std::int32_t>::max() };
+		EXPECT_EQ( Decimal( "1.5" ).movePointLeft( minPlaces ), Decimal::maxValue() );
+		EXPECT_EQ( Decimal( "-1.5" ).movePointRight( maxPlaces ), -Decimal::maxValue() );
+		EXPECT_TRUE( Decimal::maxValue().movePointRight( minPlaces ).isZero() );
+		EXPECT_TRUE( Decimal( "0.0000000000000000000000000001" ).movePointLeft( maxPlaces ).isZero() );
+		EXPECT_EQ( Decimal::maxValue().movePointLeft( 57 ).toString(), "0.0000000000000000000000000001" );
+	}
+
+	//----------------------------------------------
+	// Compile-time evaluation
+	//----------------------------------------------
+
+	TEST( DecimalConstexpr, CoreOperations )
+	{
+		using datatypes::Decimal;
+
+		constexpr Decimal price{ "123.45" };
+		constexpr Decimal quantity{ std::int64_t{ 3 } };
+		constexpr Decimal notional{ price * quantity };
+		static_assert( notional == Decimal{ "370.35" } );
+		static_assert( price + Decimal{ "0.55" } == Decimal{ std::int32_t{ 124 } } );
+		static_assert( price - price == Decimal::zero() );
+		static_assert( Decimal{ std::int32_t{ 1 } } / Decimal{ std::int32_t{ 4 } } == Decimal{ "0.25" } );
+		static_assert( -price < price );
+		static_assert( price.scale() == 2 );
+		static_assert( Decimal::minValue().scale() == 28 && Decimal::maxValue().scale() == 0 );
+		static_assert( Decimal{ "2.345" }.round( 2 ) == Decimal{ "2.34" } );
+		static_assert( Decimal{ "1.5" }.rescale( 4 ).scale() == 4 );
+		static_assert( Decimal{ "1.23" }.movePointRight( 2 ) == std::int64_t{ 123 } );
+
+		constexpr bool parsed{ [] {
+			Decimal value;
+			return Decimal::tryParse( "-0.000001", value ) && value.isNegative() && !Decimal::tryParse( "1.2.3", value );
+		}() };
+		static_assert( parsed );
+
+		EXPECT_EQ( notional.toString(), "370.35" );
+	}
+
+	TEST( DecimalConstexpr, Literals )
+	{
+		using datatypes::Decimal;
+		using namespace datatypes::literals;
+
+		constexpr Decimal tickSize{ 0.0001_dec };
+		static_assert( tickSize == Decimal{ "0.0001" } );
+		static_assert( 123.45_dec == Decimal{ "123.45" } );
+		static_assert( 1e-8_dec == Decimal{ "0.00000001" } );
+		static_assert( 1.5E3_dec == Decimal{ std::int64_t{ 1500 } } );
+		static_assert( 2.50e+1_dec == Decimal{ std::int64_t{ 25 } } );
+		static_assert( ( 10e-1_dec ).scale() == 0 );
+		static_assert( -0.5_dec == Decimal{ "-0.5" } );
+		static_assert( 7922816251426433759354395033.5_dec == Decimal{ "7922816251426433759354395033.5" } );
+
+		EXPECT_EQ( ( 1e-8_dec ).toString(), "0.00000001" );
+		EXPECT_EQ( ( 123.45_dec ).toBits(), Decimal{ "123.45" }.toBits() );
+	}
+
 	//----------------------------------------------
 	// String parsing
 	//----------------------------------------------
@@ -2115,4 +2331,134 @@ namespace nfx::datatypes::test
 
 		EXPECT_TRUE( datatypes::Decimal::tryParse( tooLong, result ) );
 	}
+
+	//----------------------------------------------
+	// Non-throwing arithmetic
+	//----------------------------------------------
+
+	TEST( DecimalStatusArithmetic, MatchesOperators )
+	{
+		const std::array<std::pair<const char*, const char*>, 6> pairs{ {
+			{ "1.5", "2" },
+			{ "123.456", "-0.001" },
+			{ "12345678901234.5678", "98765.4321" },
+			{ "-7.25", "0.5" },
+			{ "1", "3" },
+			{ "0.0000000001", "0.0000000000000000001" },
+		} };
+
+		for ( const auto& [leftText, rightText] : pairs )
+		{
+			const datatypes::Decimal left{ leftText };
+			const datatypes::Decimal right{ rightText };
+			datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+
+			EXPECT_EQ( datatypes::Decimal::add( left, right, status ).toBits(), ( left + right ).toBits() ) << leftText << " + " << rightText;
+			EXPECT_EQ( datatypes::Decimal::subtract( left, right, status ).toBits(), ( left - right ).toBits() ) << leftText << " - " << rightText;
+			EXPECT_EQ( datatypes::Decimal::multiply( left, right, status ).toBits(), ( left * right ).toBits() ) << leftText << " * " << rightText;
+			EXPECT_EQ( datatypes::Decimal::divide( left, right, status ).toBits(), ( left / right ).toBits() ) << leftText << " / " << rightText;
+			EXPECT_FALSE( datatypes::hasStatus( status, datatypes::ArithmeticStatus::Overflow | datatypes::ArithmeticStatus::DivisionByZero ) );
+		}
+	}
+
+	TEST( DecimalStatusArithmetic, Flags )
+	{
+		datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+
+		// Exact results raise nothing
+		EXPECT_EQ( datatypes::Decimal::add( datatypes::Decimal{ "1.25" }, datatypes::Decimal{ "2.5" }, status ), datatypes::Decimal{ "3.75" } );
+		EXPECT_EQ( datatypes::Decimal::divide( datatypes::Decimal{ 10 }, datatypes::Decimal{ 4 }, status ), datatypes::Decimal{ "2.5" } );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::None );
+
+		// Truncated digits
+		EXPECT_EQ( datatypes::Decimal::add( datatypes::Decimal::maxValue(), datatypes::Decimal{ "0.1" }, status ), datatypes::Decimal::maxValue() );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::Inexact );
+
+		status = datatypes::ArithmeticStatus::None;
+		EXPECT_EQ( datatypes::Decimal::divide( datatypes::Decimal{ 1 }, datatypes::Decimal{ 3 }, status ), datatypes::Decimal{ "0.333333333333333333" } );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::Inexact );
+
+		// Overflow clamps, including products that exceed 128 bits
+		status = datatypes::ArithmeticStatus::None;
+		EXPECT_EQ( datatypes::Decimal::add( datatypes::Decimal::maxValue(), datatypes::Decimal{ 1 }, status ), datatypes::Decimal::maxValue() );
+		EXPECT_TRUE( datatypes::hasStatus( status, datatypes::ArithmeticStatus::Overflow ) );
+		EXPECT_EQ( datatypes::Decimal::multiply( datatypes::Decimal::maxValue(), datatypes::Decimal{ -2 }, status ), datatypes::Decimal::minValue() );
+		EXPECT_EQ( datatypes::Decimal::multiply( datatypes::Decimal::maxValue(), datatypes::Decimal::maxValue(), status ), datatypes::Decimal::maxValue() );
+		EXPECT_EQ( datatypes::Decimal::multiply( datatypes::Decimal::maxValue(), datatypes::Decimal{ "0.5" }, status ).toString(), "39614081257132168796771975167" );
+
+		// Division by zero yields zero
+		status = datatypes::ArithmeticStatus::None;
+		EXPECT_TRUE( datatypes::Decimal::divide( datatypes::Decimal{ 1 }, datatypes::Decimal{}, status ).isZero() );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::DivisionByZero );
+	}
+
+	TEST( DecimalStatusArithmetic, StickyOverBatch )
+	{
+		const std::array<datatypes::Decimal, 4> prices{ datatypes::Decimal{ "101.25" }, datatypes::Decimal{ "99.5" },
+			datatypes::Decimal::maxValue(), datatypes::Decimal{ "0.01" } };
+		const datatypes::Decimal quantity{ 3 };
+
+		datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+		std::array<datatypes::Decimal, 4> notionals{};
+		for ( std::size_t i{ 0 }; i < prices.size(); ++i )
+		{
+			notionals[i] = datatypes::Decimal::multiply( prices[i], quantity, status );
+		}
+
+		EXPECT_TRUE( datatypes::hasStatus( status, datatypes::ArithmeticStatus::Overflow ) );
+		EXPECT_FALSE( datatypes::hasStatus( status, datatypes::ArithmeticStatus::DivisionByZero ) );
+		EXPECT_EQ( notionals[0], datatypes::Decimal{ "303.75" } );
+		EXPECT_EQ( notionals[3], datatypes::Decimal{ "0.03" } );
+
+		constexpr auto folded{ [] {
+			datatypes::ArithmeticStatus flags{ datatypes::ArithmeticStatus::None };
+			return datatypes::Decimal::divide( datatypes::Decimal{ 1 }, datatypes::Decimal{ 8 }, flags );
+		}() };
+		static_assert( folded == datatypes::Decimal{ "0.125" } );
+	}
+
+	//----------------------------------------------
+	// Hashing
+	//----------------------------------------------
+
+	TEST( DecimalHashing, ConsistentWithEquality )
+	{
+		const datatypes::Decimal price{ "1.5" };
+		EXPECT_EQ( price.hash(), price.rescale( 2 ).hash() );
+		EXPECT_EQ( price.hash(), price.rescale( 28 ).hash() );
+		EXPECT_EQ( datatypes::Decimal{ "-101.25" }.hash(), datatypes::Decimal{ "-101.25" }.rescale( 7 ).hash() );
+		EXPECT_EQ( datatypes::Decimal{ 12000 }.hash(), datatypes::Decimal{ 12000 }.rescale( 3 ).hash() );
+		EXPECT_EQ( datatypes::Decimal{ "-0" }.hash(), datatypes::Decimal{ "0" }.rescale( 5 ).hash() );
+		EXPECT_EQ( std::hash<datatypes::Decimal>{}( price ), static_cast<std::size_t>( price.rescale( 4 ).hash() ) );
+
+		EXPECT_NE( price.hash(), ( -price ).hash() );
+		EXPECT_NE( datatypes::Decimal{ "1.5" }.hash(), datatypes::Decimal{ "15" }.hash() );
+		EXPECT_NE( datatypes::Decimal::maxValue().hash(), datatypes::Decimal::minValue().hash() );
+
+		// Every scale of every value in a price ladder hashes like its normalized form
+		std::unordered_set<std::uint64_t> hashes;
+		for ( std::int64_t tick{ -1000 }; tick < 1000; ++tick )
+		{
+			const datatypes::Decimal level{ datatypes::Decimal{ tick } * datatypes::Decimal{ "0.0001" } };
+			hashes.insert( level.hash() );
+			for ( std::uint8_t scale{ level.scale() }; scale <= constants::DECIMAL_MAXIMUM_PLACES; scale += 5 )
+			{
+				EXPECT_EQ( level.rescale( scale ).hash(), level.hash() ) << level;
+			}
+		}
+		EXPECT_EQ( hashes.size(), 2000U );
+
+		static_assert( datatypes::Decimal{ "2.5" }.rescale( 2 ).hash() == datatypes::Decimal{ "2.5" }.hash() );
+	}
+
+	TEST( DecimalHashing, UnorderedContainers )
+	{
+		std::unordered_map<datatypes::Decimal, int> volumes;
+		volumes[datatypes::Decimal{ "101.25" }] += 10;
+		volumes[datatypes::Decimal{ "101.25" }.rescale( 4 )] += 5;
+		volumes[datatypes::Decimal{ "101.3" }] += 1;
+
+		EXPECT_EQ( volumes.size(), 2U );
+		EXPECT_EQ( volumes.at( datatypes::Decimal{ "101.250000" } ), 15 );
+	}
 } // namespace nfx::datatypes::test
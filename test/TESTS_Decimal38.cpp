@@ -0,0 +1,246 @@
+/**
+ * @file TESTS_Decimal38.cpp
+ * @brief Tests for the 127-bit mantissa Decimal38 type
+ * @details Validates construction, parsing and formatting at full width, arithmetic with
+ *          rounding and overflow, the rounding surface and conversions to and from Decimal
+ */
+
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/Decimal38.h>
+#include <nfx/datatypes/Int128.h>
+
+namespace nfx::datatypes::test
+{
+	using RoundingMode = datatypes::Decimal38::RoundingMode;
+
+	//=====================================================================
+	// Decimal38 type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	TEST( Decimal38Construction, Basic )
+	{
+		static_assert( sizeof( datatypes::Decimal38 ) == 24 );
+
+		EXPECT_TRUE( datatypes::Decimal38{}.isZero() );
+		EXPECT_EQ( datatypes::Decimal38{ -42 }.toString(), "-42" );
+		EXPECT_EQ( datatypes::Decimal38{ std::uint64_t{ 18446744073709551615ULL } }.toString(), "18446744073709551615" );
+		EXPECT_EQ( datatypes::Decimal38{ std::int64_t{ INT64_MIN } }.toString(), "-9223372036854775808" );
+
+		EXPECT_EQ( datatypes::Decimal38::maxValue().toString(), "170141183460469231731687303715884105727" );
+		EXPECT_EQ( datatypes::Decimal38::minValue().toString(), "-170141183460469231731687303715884105727" );
+		const datatypes::Int128 int128Max{ 0xFFFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL };
+		const datatypes::Int128 int128Min{ 0ULL, 0x8000000000000000ULL };
+		EXPECT_EQ( datatypes::Decimal38{ int128Max }, datatypes::Decimal38::maxValue() );
+		EXPECT_EQ( datatypes::Decimal38{ -int128Max }, datatypes::Decimal38::minValue() );
+		EXPECT_THROW( datatypes::Decimal38{ int128Min }, std::overflow_error );
+	}
+
+	TEST( Decimal38Construction, FromDecimal )
+	{
+		for ( const char* text : { "0", "-1", "123.4567", "-12345678901234567890.123456789", "79228162514264337593543950335",
+				  "0.0000000000000000000000000001" } )
+		{
+			const datatypes::Decimal value{ text };
+			const datatypes::Decimal38 wide{ value };
+			EXPECT_EQ( wide.toString(), value.toString() ) << text;
+			EXPECT_EQ( wide.toDecimal().toBits(), value.toBits() ) << text;
+		}
+
+		// Unnormalized scale is kept
+		const datatypes::Decimal38 padded{ datatypes::Decimal{ "1.5" }.rescale( 4 ) };
+		EXPECT_EQ( padded.scale(), 4 );
+		EXPECT_EQ( padded.toString(), "1.5000" );
+	}
+
+	//----------------------------------------------
+	// Parsing and formatting
+	//----------------------------------------------
+
+	TEST( Decimal38Parsing, FullPrecision )
+	{
+		for ( const char* text : { "123456789012345678901234.56789012345", "-0.00000000000000000000000000000000000001",
+				  "17014118346046923173168730371588410572.7", "0.5", "-170141183460469231731687303715884105727" } )
+		{
+			EXPECT_EQ( datatypes::Decimal38{ text }.toString(), text );
+		}
+
+		EXPECT_EQ( datatypes::Decimal38{ "+001.2300" }.toString(), "1.23" );
+		EXPECT_EQ( datatypes::Decimal38{ "-0.000" }.toString(), "0" );
+		EXPECT_EQ( datatypes::Decimal38{ "0.00000000000000000000000000000000000001" }.scale(), 38 );
+	}
+
+	TEST( Decimal38Parsing, Rounding )
+	{
+		// Ties to even at the 38th place, any non-zero digit beyond breaks the tie
+		EXPECT_EQ( datatypes::Decimal38{ "0.123456789012345678901234567890123456785" }.toString(), "0.12345678901234567890123456789012345678" );
+		EXPECT_EQ( datatypes::Decimal38{ "0.123456789012345678901234567890123456785000000000000000000000000000000000000000001" }.toString(),
+			"0.12345678901234567890123456789012345679" );
+
+		// Fewer places once the integer part takes more room
+		EXPECT_EQ( datatypes::Decimal38{ "1701411834604692317316873037158841057.2749" }.toString(), "1701411834604692317316873037158841057.27" );
+		EXPECT_TRUE( datatypes::Decimal38{ "0.0000000000000000000000000000000000000049" }.isZero() );
+	}
+
+	TEST( Decimal38Parsing, Invalid )
+	{
+		datatypes::Decimal38 result{ 7 };
+		for ( const char* text : { "", "-", ".", "1.2.3", "12a", "170141183460469231731687303715884105728",
+				  "1000000000000000000000000000000000000000000000000000000000000000000000000000000000" } )
+		{
+			EXPECT_FALSE( datatypes::Decimal38::tryParse( text, result ) ) << text;
+			EXPECT_TRUE( result.isZero() );
+		}
+
+		EXPECT_THROW( (void)datatypes::Decimal38::parse( "1e5" ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Arithmetic
+	//----------------------------------------------
+
+	TEST( Decimal38Arithmetic, AddSubtract )
+	{
+		EXPECT_EQ( datatypes::Decimal38{ "0.1" } + datatypes::Decimal38{ "0.2" }, datatypes::Decimal38{ "0.3" } );
+		EXPECT_EQ( ( datatypes::Decimal38{ "1.25" } - datatypes::Decimal38{ "3.5" } ).toString(), "-2.25" );
+		EXPECT_EQ( ( datatypes::Decimal38{ "1.25" } - datatypes::Decimal38{ "1.25" } ).toString(), "0" );
+
+		// Exact sums beyond 28 digits
+		EXPECT_EQ( ( datatypes::Decimal38{ "99999999999999999999999999999999999999" } + datatypes::Decimal38{ 1 } ).toString(),
+			"100000000000000000000000000000000000000" );
+
+		// A sum that needs more than 127 bits gives up fractional digits first
+		EXPECT_EQ( ( datatypes::Decimal38{ "17014118346046923173168730371588410572.7" } + datatypes::Decimal38{ "0.05" } ).toString(),
+			"17014118346046923173168730371588410573" );
+
+		EXPECT_THROW( datatypes::Decimal38::maxValue() + datatypes::Decimal38{ 1 }, std::overflow_error );
+		EXPECT_THROW( datatypes::Decimal38::minValue() - datatypes::Decimal38{ 1 }, std::overflow_error );
+	}
+
+	TEST( Decimal38Arithmetic, MultiplyDivide )
+	{
+		EXPECT_EQ( ( datatypes::Decimal38{ "-12345678901234567890.12345678901234567" } * datatypes::Decimal38{ "98765.4321" } ).toString(),
+			"-1219326311248285321124828.53211248285233" );
+		EXPECT_EQ( ( datatypes::Decimal38{ "0.0000000000000000001" } * datatypes::Decimal38{ "0.0000000000000000001" } ).toString(),
+			"0.00000000000000000000000000000000000001" );
+		EXPECT_TRUE( ( datatypes::Decimal38{ "0.00000000000000000000000000000000000001" } * datatypes::Decimal38{ "0.1" } ).isZero() );
+		EXPECT_THROW( datatypes::Decimal38::maxValue() * datatypes::Decimal38{ 2 }, std::overflow_error );
+
+		EXPECT_EQ( ( datatypes::Decimal38{ 1 } / datatypes::Decimal38{ 3 } ).toString(), "0.33333333333333333333333333333333333333" );
+		EXPECT_EQ( ( datatypes::Decimal38{ -2 } / datatypes::Decimal38{ 3 } ).toString(), "-0.66666666666666666666666666666666666667" );
+		EXPECT_EQ( ( datatypes::Decimal38{ 1 } / datatypes::Decimal38{ "0.7" } ).toString(), "1.42857142857142857142857142857142857143" );
+		EXPECT_EQ( ( datatypes::Decimal38{ "100000000000000000000000" } / datatypes::Decimal38{ "300000000000000000000" } ).toString(),
+			"333.33333333333333333333333333333333333" );
+		EXPECT_EQ( ( datatypes::Decimal38{ "7.5" } / datatypes::Decimal38{ "2.5" } ).toString(), "3" );
+
+		EXPECT_THROW( datatypes::Decimal38{ 1 } / datatypes::Decimal38{}, std::overflow_error );
+		EXPECT_THROW( datatypes::Decimal38::maxValue() / datatypes::Decimal38{ "0.5" }, std::overflow_error );
+	}
+
+	TEST( Decimal38Arithmetic, Constexpr )
+	{
+		static_assert( datatypes::Decimal38{ "1.5" } * datatypes::Decimal38{ 2 } == datatypes::Decimal38{ 3 } );
+		static_assert( datatypes::Decimal38{ 1 } / datatypes::Decimal38{ 8 } == datatypes::Decimal38{ "0.125" } );
+		static_assert( datatypes::Decimal38{ "-0.5" } < datatypes::Decimal38{ "0.25" } );
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	TEST( Decimal38Comparison, Ordering )
+	{
+		const datatypes::Decimal38 one{ datatypes::Decimal38{ 1 }.rescale( 20 ) };
+		EXPECT_EQ( one, datatypes::Decimal38::one() );
+		EXPECT_LT( datatypes::Decimal38{ "-1" }, datatypes::Decimal38{ "0.5" } );
+		EXPECT_LT( datatypes::Decimal38{ "-2" }, datatypes::Decimal38{ "-1.99999999999999999999999999999999999" } );
+		EXPECT_GT( datatypes::Decimal38::maxValue(), datatypes::Decimal38{ "170141183460469231731687303715884105.726" } );
+		EXPECT_LE( datatypes::Decimal38{}, -datatypes::Decimal38{} );
+		EXPECT_GE( datatypes::Decimal38{ "0.1" }, datatypes::Decimal38{ "0.10" } );
+		EXPECT_NE( datatypes::Decimal38{ "0.1" }, datatypes::Decimal38{ "-0.1" } );
+	}
+
+	//----------------------------------------------
+	// Rounding
+	//----------------------------------------------
+
+	TEST( Decimal38Rounding, Modes )
+	{
+		const datatypes::Decimal38 value{ "-2.5" };
+		EXPECT_EQ( value.round(), datatypes::Decimal38{ -2 } );
+		EXPECT_EQ( value.round( 0, RoundingMode::ToNearestTiesAway ), datatypes::Decimal38{ -3 } );
+		EXPECT_EQ( value.round( 0, RoundingMode::ToPositiveInfinity ), datatypes::Decimal38{ -2 } );
+		EXPECT_EQ( value.round( 0, RoundingMode::ToNegativeInfinity ), datatypes::Decimal38{ -3 } );
+
+		EXPECT_EQ( datatypes::Decimal38{ "-2.1" }.floor(), datatypes::Decimal38{ -3 } );
+		EXPECT_EQ( datatypes::Decimal38{ "-2.9" }.ceiling(), datatypes::Decimal38{ -2 } );
+		EXPECT_EQ( datatypes::Decimal38{ "2.9" }.truncate(), datatypes::Decimal38{ 2 } );
+		EXPECT_EQ( datatypes::Decimal38{ "0.12345678901234567890123456789012345678" }.round( 30 ).toString(), "0.123456789012345678901234567890" );
+		EXPECT_EQ( datatypes::Decimal38{ "-7.25" }.abs().toString(), "7.25" );
+	}
+
+	TEST( Decimal38Rounding, Rescale )
+	{
+		EXPECT_EQ( datatypes::Decimal38{ "1.5" }.rescale( 2 ).toString(), "1.50" );
+		EXPECT_EQ( datatypes::Decimal38{ "1.005" }.rescale( 2 ).toString(), "1.00" );
+		EXPECT_EQ( datatypes::Decimal38{}.rescale( 3 ).scale(), 3 );
+		EXPECT_EQ( datatypes::Decimal38{ 1 }.rescale( 38 ).scale(), 38 );
+
+		// Raising the scale past the 127-bit mantissa fails instead of stopping short
+		const datatypes::Decimal38 large{ "1000000000000000000000000000000000000" };
+		EXPECT_EQ( large.rescale( 2 ).scale(), 2 );
+		EXPECT_THROW( (void)large.rescale( 5 ), std::overflow_error );
+
+		datatypes::Decimal38 result{ 7 };
+		EXPECT_FALSE( large.tryRescale( 3, result ) );
+		EXPECT_EQ( result, datatypes::Decimal38{ 7 } );
+		EXPECT_TRUE( large.tryRescale( 2, result ) );
+		EXPECT_EQ( result.scale(), 2 );
+		EXPECT_EQ( result, large );
+		EXPECT_TRUE( datatypes::Decimal38{ "-1.25" }.tryRescale( 1, result, RoundingMode::ToNearestTiesAway ) );
+		EXPECT_EQ( result.toString(), "-1.3" );
+	}
+
+	//----------------------------------------------
+	// Conversion
+	//----------------------------------------------
+
+	TEST( Decimal38Conversion, ToDecimal )
+	{
+		const datatypes::Decimal38 value{ "1.23456789012345678901234567890123456789" };
+		EXPECT_EQ( value.toDecimal().toString(), "1.2345678901234567890123456789" );
+		EXPECT_EQ( value.toDecimal( RoundingMode::ToPositiveInfinity ).toString(), "1.2345678901234567890123456790" );
+		EXPECT_EQ( ( -value ).toDecimal( RoundingMode::ToZero ).toString(), "-1.2345678901234567890123456789" );
+
+		// Large integer parts keep fewer places to fit 96 bits
+		EXPECT_EQ( datatypes::Decimal38{ "7922816251426433759354395033.46" }.toDecimal().toString(), "7922816251426433759354395033.5" );
+
+		datatypes::Decimal result{ 7 };
+		const datatypes::Decimal38 large{ "79228162514264337593543950336" };
+		EXPECT_THROW( (void)large.toDecimal(), std::overflow_error );
+		EXPECT_FALSE( large.tryToDecimal( result ) );
+		EXPECT_EQ( result, datatypes::Decimal{ 7 } );
+	}
+
+	TEST( Decimal38Conversion, Streams )
+	{
+		std::ostringstream out;
+		out << datatypes::Decimal38{ "-0.000123" };
+		EXPECT_EQ( out.str(), "-0.000123" );
+
+		std::istringstream in{ "12345678901234567890123456789012.345678 abc" };
+		datatypes::Decimal38 value;
+		in >> value;
+		EXPECT_EQ( value.toString(), "12345678901234567890123456789012.345678" );
+		in >> value;
+		EXPECT_TRUE( in.fail() );
+	}
+} // namespace nfx::datatypes::test
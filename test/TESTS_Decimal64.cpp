@@ -0,0 +1,189 @@
+/**
+ * @file TESTS_Decimal64.cpp
+ * @brief Tests for the compact Decimal64 storage type
+ * @details Validates packing, lossless promotion, bulk span conversion and
+ *          agreement of the promoted arithmetic with Decimal
+ */
+
+#include <array>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/Decimal64.h>
+
+namespace nfx::datatypes::test
+{
+	//=====================================================================
+	// Decimal64 type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	TEST( Decimal64Construction, Packing )
+	{
+		static_assert( sizeof( datatypes::Decimal64 ) == 8 );
+
+		datatypes::Decimal64 value{ "-123.4567" };
+		EXPECT_TRUE( value.isNegative() );
+		EXPECT_EQ( value.scale(), 4 );
+		EXPECT_EQ( value.mantissa(), 1234567ULL );
+		EXPECT_EQ( value.toString(), "-123.4567" );
+
+		EXPECT_TRUE( datatypes::Decimal64{}.isZero() );
+		EXPECT_EQ( datatypes::Decimal64{ std::int64_t{ -42 } }.toDecimal(), datatypes::Decimal{ -42 } );
+		EXPECT_EQ( datatypes::Decimal64::maxValue().mantissa(), ( 1ULL << 56 ) - 1 );
+		EXPECT_EQ( datatypes::Decimal64::minValue(), -datatypes::Decimal64::maxValue() );
+	}
+
+	TEST( Decimal64Construction, Overflow )
+	{
+		// 2^56 - 1 is the largest mantissa
+		EXPECT_NO_THROW( datatypes::Decimal64{ std::int64_t{ 72057594037927935 } } );
+		EXPECT_THROW( datatypes::Decimal64{ std::int64_t{ 72057594037927936 } }, std::overflow_error );
+		EXPECT_THROW( datatypes::Decimal64{ "0.72057594037927936" }, std::overflow_error );
+
+		datatypes::Decimal64 result{ "1" };
+		datatypes::Decimal wide{ "12345678901234567890.12" };
+		EXPECT_FALSE( datatypes::Decimal64::fits( wide ) );
+		EXPECT_FALSE( datatypes::Decimal64::tryFromDecimal( wide, result ) );
+		EXPECT_EQ( result, datatypes::Decimal64{ "1" } );
+		EXPECT_TRUE( datatypes::Decimal64::tryFromDecimal( datatypes::Decimal{ "-0.0000000000000000000000000001" }, result ) );
+		EXPECT_EQ( result.scale(), 28 );
+	}
+
+	TEST( Decimal64Construction, Constexpr )
+	{
+		constexpr datatypes::Decimal64 price{ datatypes::Decimal{ "99.95" } };
+		static_assert( price.scale() == 2 );
+		static_assert( price.mantissa() == 9995 );
+		static_assert( price.toDecimal() == datatypes::Decimal{ "99.95" } );
+		static_assert( price + price == datatypes::Decimal{ "199.9" } );
+	}
+
+	//----------------------------------------------
+	// Conversion
+	//----------------------------------------------
+
+	TEST( Decimal64Conversion, BitExactRoundTrip )
+	{
+		// Unnormalized scale survives packing and promotion
+		const datatypes::Decimal source{ datatypes::Decimal{ "1.5" }.rescale( 6 ) };
+		const datatypes::Decimal promoted{ datatypes::Decimal64{ source } };
+		EXPECT_EQ( promoted.toBits(), source.toBits() );
+		EXPECT_EQ( promoted.toString(), source.toString() );
+
+		for ( const char* text : { "0", "-1", "0.0001", "123456789.12345678", "-72057594037927935", "0.0000000000000000000000000001" } )
+		{
+			const datatypes::Decimal value{ text };
+			EXPECT_EQ( datatypes::Decimal64{ value }.toDecimal().toBits(), value.toBits() ) << text;
+		}
+	}
+
+	TEST( Decimal64Conversion, Spans )
+	{
+		const std::vector<datatypes::Decimal> prices{
+			datatypes::Decimal{ "101.25" }, datatypes::Decimal{ "-0.0003" }, datatypes::Decimal{ "0" }, datatypes::Decimal{ "42" } };
+
+		std::vector<datatypes::Decimal64> packed( prices.size() );
+		datatypes::Decimal64::fromDecimals( prices, packed );
+
+		std::vector<datatypes::Decimal> restored( prices.size() );
+		datatypes::Decimal64::toDecimals( packed, restored );
+		for ( std::size_t i{ 0 }; i < prices.size(); ++i )
+		{
+			EXPECT_EQ( restored[i].toBits(), prices[i].toBits() ) << i;
+		}
+
+		// Destination too small
+		std::array<datatypes::Decimal64, 2> small{};
+		EXPECT_THROW( datatypes::Decimal64::fromDecimals( prices, small ), std::invalid_argument );
+		EXPECT_EQ( datatypes::Decimal64::tryFromDecimals( prices, small ), 2U );
+
+		// Stops at the first value that does not fit
+		std::vector<datatypes::Decimal> mixed{ prices[0], datatypes::Decimal{ "79228162514264337593543950335" }, prices[1] };
+		std::vector<datatypes::Decimal64> out( mixed.size() );
+		EXPECT_EQ( datatypes::Decimal64::tryFromDecimals( mixed, out ), 1U );
+		EXPECT_THROW( datatypes::Decimal64::fromDecimals( mixed, out ), std::overflow_error );
+	}
+
+	//----------------------------------------------
+	// Arithmetic
+	//----------------------------------------------
+
+	TEST( Decimal64Arithmetic, MatchesDecimal )
+	{
+		const std::vector<const char*> values{ "0", "1", "-1", "1.50", "2.25", "-2.25", "0.001", "99999999.99",
+			"-72057594037927935", "72057594037927935", "0.0000000000000000000000000001", "123.4567" };
+
+		for ( const char* l : values )
+		{
+			for ( const char* r : values )
+			{
+				const datatypes::Decimal left{ l };
+				const datatypes::Decimal right{ r };
+				const datatypes::Decimal64 packedLeft{ left };
+				const datatypes::Decimal64 packedRight{ right };
+
+				EXPECT_EQ( ( packedLeft + packedRight ).toBits(), ( left + right ).toBits() ) << l << " + " << r;
+				EXPECT_EQ( ( packedLeft - packedRight ).toBits(), ( left - right ).toBits() ) << l << " - " << r;
+				EXPECT_EQ( ( packedLeft * packedRight ).toBits(), ( left * right ).toBits() ) << l << " * " << r;
+				if ( !right.isZero() )
+				{
+					EXPECT_EQ( ( packedLeft / packedRight ).toBits(), ( left / right ).toBits() ) << l << " / " << r;
+				}
+
+				EXPECT_EQ( packedLeft == packedRight, left == right ) << l << " == " << r;
+				EXPECT_EQ( packedLeft < packedRight, left < right ) << l << " < " << r;
+				EXPECT_EQ( packedLeft >= packedRight, left >= right ) << l << " >= " << r;
+				EXPECT_EQ( packedLeft < right, left < right ) << l << " < " << r;
+			}
+		}
+	}
+
+	TEST( Decimal64Arithmetic, PromotesOnOverflow )
+	{
+		const auto max{ datatypes::Decimal64::maxValue() };
+
+		const datatypes::Decimal sum{ max + max };
+		EXPECT_EQ( sum, datatypes::Decimal{ "144115188075855870" } );
+		EXPECT_FALSE( datatypes::Decimal64::fits( sum ) );
+
+		const datatypes::Decimal product{ datatypes::Decimal64{ "4294967296" } * datatypes::Decimal64{ "-4294967296" } };
+		EXPECT_EQ( product, datatypes::Decimal{ "-18446744073709551616" } );
+
+		// Mixed operands promote through the implicit conversion
+		const datatypes::Decimal mixed{ datatypes::Decimal{ "0.5" } + datatypes::Decimal64{ "1.25" } };
+		EXPECT_EQ( mixed, datatypes::Decimal{ "1.75" } );
+		EXPECT_EQ( datatypes::Decimal64{ "1.25" } * datatypes::Decimal{ "2" }, datatypes::Decimal{ "2.5" } );
+
+		EXPECT_THROW( (void)( datatypes::Decimal64{ "1" } / datatypes::Decimal64{} ), std::overflow_error );
+		EXPECT_EQ( datatypes::Decimal64{ "-3.5" }.abs(), datatypes::Decimal64{ "3.5" } );
+	}
+
+	//----------------------------------------------
+	// String parsing
+	//----------------------------------------------
+
+	TEST( Decimal64StringParsing, ParseAndStreams )
+	{
+		datatypes::Decimal64 value;
+		EXPECT_TRUE( datatypes::Decimal64::tryParse( "3.14159", value ) );
+		EXPECT_EQ( value.toString(), "3.14159" );
+		EXPECT_FALSE( datatypes::Decimal64::tryParse( "not a number", value ) );
+		EXPECT_FALSE( datatypes::Decimal64::tryParse( "100000000000000000", value ) );
+		EXPECT_THROW( (void)datatypes::Decimal64::parse( "1..2" ), std::invalid_argument );
+
+		std::ostringstream os;
+		os << datatypes::Decimal64{ "-0.5" };
+		EXPECT_EQ( os.str(), "-0.5" );
+
+		std::istringstream is{ "12.75" };
+		is >> value;
+		EXPECT_EQ( value, datatypes::Decimal64{ "12.75" } );
+	}
+} // namespace nfx::datatypes::test
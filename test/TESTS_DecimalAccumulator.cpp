@@ -0,0 +1,371 @@
+/**
+ * @file TESTS_DecimalAccumulator.cpp
+ * @brief Tests for exact Decimal sums and dot products
+ * @details Validates results bit for bit against chained Decimal::add and Decimal::multiply
+ *          on exact data, mixed and unnormalized scales, intermediate sums beyond 96 bits,
+ *          single rounding of dot products, merging, null rows of columns and the overflow
+ *          and truncation rules of result()
+ */
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/ArithmeticStatus.h>
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalAccumulator.h>
+#include <nfx/datatypes/DecimalColumn.h>
+
+namespace nfx::datatypes::test
+{
+	namespace
+	{
+		/** @brief Random value with up to 18 digits and up to 10 fractional digits, so chained sums stay exact */
+		datatypes::Decimal randomDecimal( std::mt19937_64& engine )
+		{
+			const std::size_t digits{ 1 + engine() % 18 };
+			std::string text{ ( engine() % 2 ) != 0 ? "-" : "" };
+			for ( std::size_t i{ 0 }; i < digits; ++i )
+			{
+				text += static_cast<char>( '0' + engine() % 10 );
+			}
+
+			const std::size_t fractionDigits{ std::min<std::size_t>( digits, engine() % 11 ) };
+			text.insert( text.size() - fractionDigits, "." );
+
+			return datatypes::Decimal{ text + "0" }.rescale( static_cast<std::int32_t>( fractionDigits + engine() % 3 ) );
+		}
+
+		/** @brief Random value with up to 9 digits and up to 6 fractional digits, so products stay exact */
+		datatypes::Decimal randomFactor( std::mt19937_64& engine )
+		{
+			const std::int64_t mantissa{ static_cast<std::int64_t>( engine() % 1000000000 ) - 500000000 };
+			const auto scale{ static_cast<std::int32_t>( engine() % 7 ) };
+
+			return ( datatypes::Decimal{ mantissa } / datatypes::Decimal{ 1000000 } ).rescale( scale );
+		}
+
+		/** @brief Reference sum with one Decimal::add per value */
+		datatypes::Decimal chainedSum( const std::vector<datatypes::Decimal>& values, datatypes::ArithmeticStatus& status )
+		{
+			datatypes::Decimal sum{};
+			for ( const datatypes::Decimal& value : values )
+			{
+				sum = datatypes::Decimal::add( sum, value, status );
+			}
+
+			return sum;
+		}
+	} // namespace
+
+	//=====================================================================
+	// DecimalAccumulator type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Accumulation
+	//----------------------------------------------
+
+	TEST( DecimalAccumulatorSum, MatchesChainedAdd )
+	{
+		std::mt19937_64 engine{ 20240611 };
+
+		for ( std::size_t size : { 0UL, 1UL, 2UL, 17UL, 1000UL } )
+		{
+			std::vector<datatypes::Decimal> values;
+			for ( std::size_t i{ 0 }; i < size; ++i )
+			{
+				values.push_back( randomDecimal( engine ) );
+			}
+
+			datatypes::ArithmeticStatus expectedStatus{ datatypes::ArithmeticStatus::None };
+			const datatypes::Decimal expected{ chainedSum( values, expectedStatus ) };
+			ASSERT_EQ( expectedStatus, datatypes::ArithmeticStatus::None );
+
+			datatypes::DecimalAccumulator accumulator;
+			accumulator.add( values );
+
+			datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+			EXPECT_EQ( accumulator.result( status ).toBits(), expected.toBits() ) << size;
+			EXPECT_EQ( status, datatypes::ArithmeticStatus::None );
+			EXPECT_EQ( accumulator.result().toBits(), expected.toBits() );
+			EXPECT_EQ( accumulator.count(), size );
+		}
+	}
+
+	TEST( DecimalAccumulatorSum, MixedScales )
+	{
+		datatypes::DecimalAccumulator accumulator;
+		accumulator.add( datatypes::Decimal{ "1.5" } );
+		accumulator.add( datatypes::Decimal{ 2 } );
+		accumulator.add( datatypes::Decimal{ "0.0000000000000000000000000001" } );
+		accumulator.add( datatypes::Decimal{ "-0.25" } );
+		accumulator.add( datatypes::Decimal{ 3 }.rescale( 5 ) );
+
+		EXPECT_EQ( accumulator.result().toString(), "6.2500000000000000000000000001" );
+		EXPECT_EQ( accumulator.count(), 5U );
+
+		// The sum is normalized: trailing zeros of unnormalized inputs are dropped
+		datatypes::DecimalAccumulator padded;
+		padded.add( datatypes::Decimal{ "1.10" }.rescale( 12 ) );
+		padded.add( datatypes::Decimal{ "0.40" }.rescale( 4 ) );
+		EXPECT_EQ( padded.result().toBits(), datatypes::Decimal{ "1.5" }.toBits() );
+
+		// Cancelling values give a positive zero
+		datatypes::DecimalAccumulator cancelled;
+		cancelled.add( datatypes::Decimal{ "-7.125" } );
+		cancelled.add( datatypes::Decimal{ "7.125" }.rescale( 9 ) );
+		EXPECT_TRUE( cancelled.result().isZero() );
+		EXPECT_FALSE( cancelled.result().isNegative() );
+		EXPECT_TRUE( datatypes::DecimalAccumulator{}.result().isZero() );
+	}
+
+	TEST( DecimalAccumulatorSum, WideIntermediates )
+	{
+		const datatypes::Decimal max{ datatypes::Decimal::maxValue() };
+		const datatypes::Decimal smallest{ datatypes::Decimal::minValue() };
+
+		// The running sum leaves the Decimal range and comes back
+		datatypes::DecimalAccumulator accumulator;
+		for ( int i{ 0 }; i < 1000; ++i )
+		{
+			accumulator.add( max );
+		}
+		accumulator.add( smallest );
+		for ( int i{ 0 }; i < 999; ++i )
+		{
+			accumulator.add( -max );
+		}
+		accumulator.add( datatypes::Decimal{ -1 } );
+
+		datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+		EXPECT_EQ( accumulator.result( status ), max - datatypes::Decimal{ 1 } );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::Inexact );
+
+		// 10^28 - 1 at scale 28 plus a 28-digit integer: exact internally, truncated once
+		datatypes::DecimalAccumulator fine;
+		fine.add( datatypes::Decimal{ "0.9999999999999999999999999999" } );
+		fine.add( datatypes::Decimal{ "1000000000000000000000000000" } );
+		fine.add( datatypes::Decimal{ "-999999999999999999999999999" } );
+		status = datatypes::ArithmeticStatus::None;
+		EXPECT_EQ( fine.result( status ).toString(), "1.9999999999999999999999999999" );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::None );
+	}
+
+	TEST( DecimalAccumulatorSum, Overflow )
+	{
+		datatypes::DecimalAccumulator positive;
+		positive.add( datatypes::Decimal::maxValue() );
+		positive.add( datatypes::Decimal{ 1 } );
+		EXPECT_THROW( (void)positive.result(), std::overflow_error );
+
+		datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+		EXPECT_EQ( positive.result( status ), datatypes::Decimal::maxValue() );
+		EXPECT_TRUE( datatypes::hasStatus( status, datatypes::ArithmeticStatus::Overflow ) );
+
+		datatypes::DecimalAccumulator negative;
+		negative.add( -datatypes::Decimal::maxValue() );
+		negative.add( datatypes::Decimal{ "-0.5" } );
+		negative.add( datatypes::Decimal{ "-0.5" } );
+		status = datatypes::ArithmeticStatus::None;
+		EXPECT_THROW( (void)negative.result(), std::overflow_error );
+		EXPECT_EQ( negative.result( status ).toBits(), datatypes::Decimal::add( -datatypes::Decimal::maxValue(), datatypes::Decimal{ -1 }, status ).toBits() );
+		EXPECT_TRUE( datatypes::hasStatus( status, datatypes::ArithmeticStatus::Overflow ) );
+
+		// Fractional digits are truncated, like Decimal::add
+		datatypes::DecimalAccumulator truncated;
+		truncated.add( datatypes::Decimal::maxValue() - datatypes::Decimal{ 1 } );
+		truncated.add( datatypes::Decimal{ "0.75" } );
+		status = datatypes::ArithmeticStatus::None;
+		const datatypes::Decimal expected{ datatypes::Decimal::add( datatypes::Decimal::maxValue() - datatypes::Decimal{ 1 }, datatypes::Decimal{ "0.75" }, status ) };
+		datatypes::ArithmeticStatus accumulatorStatus{ datatypes::ArithmeticStatus::None };
+		EXPECT_EQ( truncated.result( accumulatorStatus ).toBits(), expected.toBits() );
+		EXPECT_EQ( accumulatorStatus, status );
+	}
+
+	//----------------------------------------------
+	// Dot product
+	//----------------------------------------------
+
+	TEST( DecimalAccumulatorDot, MatchesChainedMultiplyAdd )
+	{
+		std::mt19937_64 engine{ 42 };
+
+		for ( std::size_t size : { 0UL, 1UL, 3UL, 64UL, 1000UL } )
+		{
+			std::vector<datatypes::Decimal> prices;
+			std::vector<datatypes::Decimal> quantities;
+			datatypes::ArithmeticStatus expectedStatus{ datatypes::ArithmeticStatus::None };
+			datatypes::Decimal expected{};
+			for ( std::size_t i{ 0 }; i < size; ++i )
+			{
+				prices.push_back( randomFactor( engine ) );
+				quantities.push_back( ( i % 4 ) == 0 ? datatypes::Decimal{ static_cast<std::int64_t>( i ) } : randomFactor( engine ) );
+				expected = datatypes::Decimal::add( expected, datatypes::Decimal::multiply( prices.back(), quantities.back(), expectedStatus ), expectedStatus );
+			}
+			ASSERT_EQ( expectedStatus, datatypes::ArithmeticStatus::None );
+
+			datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+			EXPECT_EQ( datatypes::DecimalAccumulator::dot( prices, quantities, status ).toBits(), expected.toBits() ) << size;
+			EXPECT_EQ( status, datatypes::ArithmeticStatus::None );
+			EXPECT_EQ( datatypes::DecimalAccumulator::dot( prices, quantities ).toBits(), expected.toBits() );
+		}
+
+		// Same-scale operands take the path without any multiply by a power of 10
+		const std::vector<datatypes::Decimal> prices{ datatypes::Decimal{ "101.25" }, datatypes::Decimal{ "99.50" }, datatypes::Decimal{ "-0.75" } };
+		const std::vector<datatypes::Decimal> quantities{ datatypes::Decimal{ 100 }, datatypes::Decimal{ -40 }, datatypes::Decimal{ 8 } };
+		EXPECT_EQ( datatypes::DecimalAccumulator::dot( prices, quantities ), datatypes::Decimal{ "6139" } );
+	}
+
+	TEST( DecimalAccumulatorDot, RoundsOnce )
+	{
+		// Each product has 29 fractional digits: operator* drops the last one, dot keeps it
+		const std::vector<datatypes::Decimal> values( 10, datatypes::Decimal{ "0.00000000000001" } );
+		const std::vector<datatypes::Decimal> weights( 10, datatypes::Decimal{ "0.000000000000015" } );
+
+		datatypes::Decimal chained{};
+		for ( std::size_t i{ 0 }; i < values.size(); ++i )
+		{
+			chained += values[i] * weights[i];
+		}
+		EXPECT_EQ( chained.toString(), "0.000000000000000000000000001" );
+		EXPECT_EQ( datatypes::DecimalAccumulator::dot( values, weights ).toString(), "0.0000000000000000000000000015" );
+
+		// Products beyond 96 bits cancel exactly
+		const datatypes::Decimal max{ datatypes::Decimal::maxValue() };
+		const std::vector<datatypes::Decimal> left{ max, datatypes::Decimal{ "0.5" }, -max };
+		const std::vector<datatypes::Decimal> right{ max, datatypes::Decimal{ "0.5" }, max };
+		datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+		EXPECT_EQ( datatypes::DecimalAccumulator::dot( left, right, status ), datatypes::Decimal{ "0.25" } );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::None );
+	}
+
+	TEST( DecimalAccumulatorDot, WeightedSum )
+	{
+		// Cash plus positions, split over two accumulators
+		datatypes::DecimalAccumulator valuation;
+		valuation.add( datatypes::Decimal{ "1000.10" } );
+		valuation.addWeighted( datatypes::Decimal{ "12.345" }, datatypes::Decimal{ 200 } );
+
+		datatypes::DecimalAccumulator other;
+		const std::vector<datatypes::Decimal> prices{ datatypes::Decimal{ "0.0001" }, datatypes::Decimal{ 3 } };
+		const std::vector<datatypes::Decimal> quantities{ datatypes::Decimal{ "-0.5" }, datatypes::Decimal{ "2.25" } };
+		other.addWeighted( prices, quantities );
+		valuation.merge( other );
+
+		EXPECT_EQ( valuation.result().toString(), "3475.84995" );
+		EXPECT_EQ( valuation.count(), 4U );
+
+		const std::vector<datatypes::Decimal> shorter{ datatypes::Decimal{ 1 } };
+		EXPECT_THROW( valuation.addWeighted( prices, shorter ), std::invalid_argument );
+		EXPECT_THROW( (void)datatypes::DecimalAccumulator::dot( shorter, prices ), std::invalid_argument );
+		EXPECT_EQ( valuation.count(), 4U );
+	}
+
+	TEST( DecimalAccumulatorDot, Overflow )
+	{
+		const std::vector<datatypes::Decimal> values{ datatypes::Decimal::maxValue() };
+		const std::vector<datatypes::Decimal> weights{ datatypes::Decimal{ "1.5" } };
+		EXPECT_THROW( (void)datatypes::DecimalAccumulator::dot( values, weights ), std::overflow_error );
+
+		datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+		EXPECT_EQ( datatypes::DecimalAccumulator::dot( values, weights, status ), datatypes::Decimal::maxValue() );
+		EXPECT_TRUE( datatypes::hasStatus( status, datatypes::ArithmeticStatus::Overflow ) );
+
+		// Beyond the exact range: 10^25 at the scale of a 56-digit product needs more than 254 bits
+		datatypes::DecimalAccumulator wide;
+		wide.addWeighted( datatypes::Decimal{ "0.0000000000000000000000000001" }, datatypes::Decimal{ "0.0000000000000000000000000001" } );
+		wide.add( datatypes::Decimal{ "-10000000000000000000000000" } );
+		wide.add( datatypes::Decimal{ "10000000000000000000000000" } );
+		EXPECT_THROW( (void)wide.result(), std::overflow_error );
+
+		// The overflow is carried through merges
+		datatypes::DecimalAccumulator merged;
+		merged.add( datatypes::Decimal{ 1 } );
+		merged.merge( wide );
+		status = datatypes::ArithmeticStatus::None;
+		EXPECT_EQ( merged.result( status ).toBits(), datatypes::Decimal::add( -datatypes::Decimal::maxValue(), datatypes::Decimal{ -1 }, status ).toBits() );
+		EXPECT_TRUE( datatypes::hasStatus( status, datatypes::ArithmeticStatus::Overflow ) );
+
+		// Scales up to 56 within the exact range are kept to the last digit before truncation
+		datatypes::DecimalAccumulator fine;
+		fine.addWeighted( datatypes::Decimal{ "0.0000000000000000000000000003" }, datatypes::Decimal{ "0.0000000000000000000000000003" } );
+		fine.add( datatypes::Decimal{ "1.5" } );
+		status = datatypes::ArithmeticStatus::None;
+		EXPECT_EQ( fine.result( status ), datatypes::Decimal{ "1.5" } );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::Inexact );
+	}
+
+	//----------------------------------------------
+	// Combination
+	//----------------------------------------------
+
+	TEST( DecimalAccumulatorCombination, Merge )
+	{
+		std::mt19937_64 engine{ 7 };
+		std::vector<datatypes::Decimal> values;
+		for ( int i{ 0 }; i < 300; ++i )
+		{
+			values.push_back( randomDecimal( engine ) );
+		}
+
+		datatypes::DecimalAccumulator whole;
+		whole.add( values );
+
+		// Partitions with different internal scales merge to the same result
+		datatypes::DecimalAccumulator first;
+		datatypes::DecimalAccumulator second;
+		datatypes::DecimalAccumulator third;
+		first.add( std::span<const datatypes::Decimal>{ values }.first( 100 ) );
+		second.add( std::span<const datatypes::Decimal>{ values }.subspan( 100, 100 ) );
+		third.add( std::span<const datatypes::Decimal>{ values }.last( 100 ) );
+		second.add( datatypes::Decimal{ 0 }.rescale( 28 ) );
+		second.merge( third );
+		first.merge( second );
+
+		EXPECT_EQ( first.result().toBits(), whole.result().toBits() );
+		EXPECT_EQ( first.count(), 301U );
+
+		// Merging with itself doubles the sum
+		datatypes::DecimalAccumulator doubled{ whole };
+		doubled.merge( doubled );
+		EXPECT_EQ( doubled.result(), whole.result() * datatypes::Decimal{ 2 } );
+		EXPECT_EQ( doubled.count(), 600U );
+
+		doubled.reset();
+		EXPECT_TRUE( doubled.result().isZero() );
+		EXPECT_EQ( doubled.count(), 0U );
+	}
+
+	TEST( DecimalAccumulatorCombination, ColumnSkipsNulls )
+	{
+		datatypes::DecimalColumn column;
+		column.append( datatypes::Decimal{ "10.5" } );
+		column.appendNull();
+		column.append( datatypes::Decimal{ "-0.125" } );
+
+		datatypes::DecimalAccumulator accumulator;
+		accumulator.add( column );
+		EXPECT_EQ( accumulator.result(), datatypes::Decimal{ "10.375" } );
+		EXPECT_EQ( accumulator.count(), 2U );
+
+		// Columns without a validity bitmap sum every row
+		const std::vector<datatypes::Decimal> prices{ datatypes::Decimal{ "1.25" }, datatypes::Decimal{ "2.50" }, datatypes::Decimal{ 3 } };
+		datatypes::DecimalAccumulator dense;
+		dense.add( datatypes::DecimalColumn{ prices } );
+		EXPECT_EQ( dense.result(), datatypes::Decimal{ "6.75" } );
+	}
+
+	TEST( DecimalAccumulatorCombination, Constexpr )
+	{
+		constexpr datatypes::Decimal sum{ [] {
+			datatypes::DecimalAccumulator accumulator;
+			accumulator.add( datatypes::Decimal{ "0.1" } );
+			accumulator.add( datatypes::Decimal{ "0.2" } );
+			return accumulator.result();
+		}() };
+		static_assert( sum == datatypes::Decimal{ "0.3" } );
+	}
+} // namespace nfx::datatypes::test
@@ -0,0 +1,172 @@
+/**
+ * @file TESTS_DecimalColumn.cpp
+ * @brief Tests for the DecimalColumn structure-of-arrays container
+ * @details Validates the field split, bit-exact span round trips, lazy validity bitmap
+ *          handling across word boundaries, gather and slice
+ */
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalColumn.h>
+
+namespace nfx::datatypes::test
+{
+	//=====================================================================
+	// DecimalColumn type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Storage
+	//----------------------------------------------
+
+	TEST( DecimalColumnStorage, FieldArrays )
+	{
+		datatypes::DecimalColumn column;
+		EXPECT_TRUE( column.empty() );
+
+		// 2^64 + 5 with scale 3, negative
+		const datatypes::Decimal value{ "-18446744073709551.621" };
+		column.append( value );
+		column.append( datatypes::Decimal{ 42 } );
+
+		ASSERT_EQ( column.size(), 2U );
+		EXPECT_EQ( column.lo64()[0], 5ULL );
+		EXPECT_EQ( column.hi32()[0], 1U );
+		EXPECT_EQ( column.scaleSign()[0], value.flags() );
+		EXPECT_EQ( column.lo64()[1], 42ULL );
+		EXPECT_EQ( column.hi32()[1], 0U );
+		EXPECT_EQ( column.scaleSign()[1], 0U );
+		EXPECT_TRUE( column.validity().empty() );
+		EXPECT_EQ( column[0], value );
+	}
+
+	TEST( DecimalColumnStorage, SpanRoundTrip )
+	{
+		const std::vector<datatypes::Decimal> values{ datatypes::Decimal{ "101.25" }, datatypes::Decimal{ "-0.0003" },
+			datatypes::Decimal{ "1.5" }.rescale( 10 ), datatypes::Decimal::maxValue(), datatypes::Decimal::minValue() };
+
+		const datatypes::DecimalColumn column{ values };
+		std::vector<datatypes::Decimal> restored( values.size() );
+		column.toDecimals( restored );
+		for ( std::size_t i{ 0 }; i < values.size(); ++i )
+		{
+			EXPECT_EQ( restored[i].toBits(), values[i].toBits() ) << i;
+		}
+
+		std::array<datatypes::Decimal, 2> small{};
+		EXPECT_THROW( column.toDecimals( small ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Nulls
+	//----------------------------------------------
+
+	TEST( DecimalColumnNulls, LazyValidityBitmap )
+	{
+		datatypes::DecimalColumn column;
+		for ( int i{ 0 }; i < 70; ++i )
+		{
+			column.append( datatypes::Decimal{ i } );
+		}
+		EXPECT_FALSE( column.hasNulls() );
+
+		column.appendNull();
+		column.append( datatypes::Decimal{ 7 } );
+
+		ASSERT_EQ( column.validity().size(), 2U );
+		EXPECT_EQ( column.validity()[0], ~0ULL );
+		EXPECT_EQ( column.validity()[1], 0xBFULL );
+		EXPECT_EQ( column.nullCount(), 1U );
+		EXPECT_FALSE( column.isValid( 70 ) );
+		EXPECT_TRUE( column.isValid( 71 ) );
+		EXPECT_TRUE( column[70].isZero() );
+
+		// Span append keeps extending the bitmap
+		const std::vector<datatypes::Decimal> more( 100, datatypes::Decimal{ "0.5" } );
+		column.append( more );
+		ASSERT_EQ( column.size(), 172U );
+		ASSERT_EQ( column.validity().size(), 3U );
+		EXPECT_EQ( column.validity()[1], ~( 1ULL << 6 ) );
+		EXPECT_EQ( column.validity()[2], ( 1ULL << 44 ) - 1 );
+		EXPECT_EQ( column.nullCount(), 1U );
+
+		std::vector<datatypes::Decimal> restored( column.size() );
+		column.toDecimals( restored );
+		EXPECT_TRUE( restored[70].isZero() );
+		EXPECT_EQ( restored[171], datatypes::Decimal{ "0.5" } );
+
+		column.clear();
+		EXPECT_TRUE( column.empty() );
+		EXPECT_TRUE( column.validity().empty() );
+	}
+
+	//----------------------------------------------
+	// Selection
+	//----------------------------------------------
+
+	TEST( DecimalColumnSelection, Gather )
+	{
+		datatypes::DecimalColumn column;
+		column.append( datatypes::Decimal{ "1.1" } );
+		column.appendNull();
+		column.append( datatypes::Decimal{ "-3.3" } );
+
+		const std::array<std::size_t, 4> indices{ 2, 1, 0, 2 };
+		const datatypes::DecimalColumn picked{ column.gather( indices ) };
+		ASSERT_EQ( picked.size(), 4U );
+		EXPECT_EQ( picked[0], datatypes::Decimal{ "-3.3" } );
+		EXPECT_FALSE( picked.isValid( 1 ) );
+		EXPECT_EQ( picked[2], datatypes::Decimal{ "1.1" } );
+		EXPECT_EQ( picked.validity()[0], 0xDULL );
+
+		const std::array<std::size_t, 1> outOfRange{ 3 };
+		EXPECT_THROW( (void)column.gather( outOfRange ), std::out_of_range );
+
+		// No bitmap in, no bitmap out
+		const std::vector<datatypes::Decimal> values{ datatypes::Decimal{ 1 }, datatypes::Decimal{ 2 } };
+		const std::array<std::size_t, 1> second{ 1 };
+		EXPECT_TRUE( datatypes::DecimalColumn{ values }.gather( second ).validity().empty() );
+	}
+
+	TEST( DecimalColumnSelection, Slice )
+	{
+		datatypes::DecimalColumn column;
+		for ( int i{ 0 }; i < 200; ++i )
+		{
+			if ( i % 3 == 0 )
+			{
+				column.appendNull();
+			}
+			else
+			{
+				column.append( datatypes::Decimal{ i } );
+			}
+		}
+
+		// Unaligned slice spanning three source words
+		const datatypes::DecimalColumn part{ column.slice( 61, 80 ) };
+		ASSERT_EQ( part.size(), 80U );
+		ASSERT_EQ( part.validity().size(), 2U );
+		for ( std::size_t i{ 0 }; i < part.size(); ++i )
+		{
+			EXPECT_EQ( part.isValid( i ), ( i + 61 ) % 3 != 0 ) << i;
+			EXPECT_EQ( part[i], column[i + 61] ) << i;
+		}
+		EXPECT_EQ( part.validity()[1] >> 16, 0ULL );
+
+		// Appending to a slice continues its bitmap
+		datatypes::DecimalColumn tail{ column.slice( 190, 10 ) };
+		tail.append( datatypes::Decimal{ 1 } );
+		EXPECT_TRUE( tail.isValid( 10 ) );
+		EXPECT_EQ( tail.nullCount(), 3U );
+
+		EXPECT_TRUE( column.slice( 200, 0 ).empty() );
+		EXPECT_THROW( (void)column.slice( 150, 51 ), std::out_of_range );
+		EXPECT_THROW( (void)column.slice( 201, 0 ), std::out_of_range );
+	}
+} // namespace nfx::datatypes::test
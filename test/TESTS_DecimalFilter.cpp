@@ -0,0 +1,250 @@
+/**
+ * @file TESTS_DecimalFilter.cpp
+ * @brief Tests for the Decimal predicate kernels
+ * @details Validates every comparison and the inclusive range against the Decimal operators on
+ *          mixed-scale, same-scale and unnormalized data, null handling for columns, the
+ *          bitmask layout and the conversion to row indices
+ */
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalColumn.h>
+#include <nfx/datatypes/DecimalFilter.h>
+
+namespace nfx::datatypes::test
+{
+	using Comparison = datatypes::DecimalFilter::Comparison;
+
+	namespace
+	{
+		/**
+		 * @brief Random value with up to 28 digits, at most 9 of them before the point
+		 * @details Keeps every aligned mantissa below 10^37 so that the reference operators,
+		 *          which align scales in Int128, stay exact
+		 */
+		datatypes::Decimal randomDecimal( std::mt19937_64& engine )
+		{
+			const std::size_t digits{ 1 + engine() % 28 };
+			std::string text{ ( engine() % 2 ) != 0 ? "-" : "" };
+			for ( std::size_t i{ 0 }; i < digits; ++i )
+			{
+				text += static_cast<char>( '0' + engine() % 10 );
+			}
+
+			const std::size_t integerDigits{ std::min<std::size_t>( digits, engine() % 10 ) };
+			text.insert( text.size() - ( digits - integerDigits ), "." );
+
+			return datatypes::Decimal{ text + "0" };
+		}
+
+		/** @brief Prices at a fixed unnormalized scale of 2, as a price column holds them */
+		datatypes::Decimal randomPrice( std::mt19937_64& engine )
+		{
+			return ( datatypes::Decimal{ static_cast<std::int64_t>( engine() % 20000 ) - 10000 } / datatypes::Decimal{ 100 } ).rescale( 2 );
+		}
+
+		/** @brief Bounds around the interesting boundaries of a value set */
+		std::vector<datatypes::Decimal> boundsFor( const std::vector<datatypes::Decimal>& values, std::mt19937_64& engine )
+		{
+			std::vector<datatypes::Decimal> bounds{ datatypes::Decimal{ 0 }, datatypes::Decimal{ "0.0000000000000000000000000001" }, datatypes::Decimal{ "12.345" },
+				datatypes::Decimal{ "-12.3450000" }, datatypes::Decimal{ "50.005" }, datatypes::Decimal{ 7 }.rescale( 20 ) };
+			for ( int i{ 0 }; i < 6 && !values.empty(); ++i )
+			{
+				bounds.push_back( values[engine() % values.size()] );
+				bounds.push_back( randomDecimal( engine ) );
+			}
+
+			return bounds;
+		}
+
+		bool expectedComparison( const datatypes::Decimal& value, Comparison comparison, const datatypes::Decimal& bound )
+		{
+			switch ( comparison )
+			{
+				case Comparison::Less:
+					return value < bound;
+				case Comparison::LessOrEqual:
+					return value <= bound;
+				case Comparison::Greater:
+					return value > bound;
+				case Comparison::GreaterOrEqual:
+					return value >= bound;
+				case Comparison::Equal:
+					return value == bound;
+				case Comparison::NotEqual:
+				default:
+					return value != bound;
+			}
+		}
+
+		bool bitAt( const std::vector<std::uint64_t>& selection, std::size_t index )
+		{
+			return ( ( selection[index / 64] >> ( index % 64 ) ) & 1U ) != 0;
+		}
+
+		const std::array<Comparison, 6> comparisons{ Comparison::Less, Comparison::LessOrEqual, Comparison::Greater,
+			Comparison::GreaterOrEqual, Comparison::Equal, Comparison::NotEqual };
+	} // namespace
+
+	//=====================================================================
+	// DecimalFilter tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Span predicates
+	//----------------------------------------------
+
+	TEST( DecimalFilterSpan, MatchesOperators )
+	{
+		std::mt19937_64 engine{ 37 };
+
+		for ( const std::size_t size : { 0UL, 1UL, 63UL, 64UL, 130UL } )
+		{
+			std::vector<datatypes::Decimal> values;
+			for ( std::size_t i{ 0 }; i < size; ++i )
+			{
+				values.push_back( i % 2 == 0 ? randomDecimal( engine ) : randomPrice( engine ) );
+			}
+
+			for ( const datatypes::Decimal& bound : boundsFor( values, engine ) )
+			{
+				for ( const Comparison comparison : comparisons )
+				{
+					std::vector<std::uint64_t> selection( ( size + 63 ) / 64, ~0ULL );
+					datatypes::DecimalFilter::compare( values, comparison, bound, selection );
+					for ( std::size_t i{ 0 }; i < selection.size() * 64; ++i )
+					{
+						const bool expected{ i < size && expectedComparison( values[i], comparison, bound ) };
+						ASSERT_EQ( bitAt( selection, i ), expected ) << values[i].toString() << " vs " << bound.toString() << " op " << static_cast<int>( comparison );
+					}
+				}
+			}
+		}
+	}
+
+	TEST( DecimalFilterSpan, Between )
+	{
+		const std::vector<datatypes::Decimal> quantities{ datatypes::Decimal{ "9.99" }, datatypes::Decimal{ 10 }, datatypes::Decimal{ "10.000" },
+			datatypes::Decimal{ "15.5" }, datatypes::Decimal{ 20 }, datatypes::Decimal{ "20.0000001" }, datatypes::Decimal{ -15 } };
+		std::vector<std::uint64_t> selection( 1 );
+
+		datatypes::DecimalFilter::between( quantities, datatypes::Decimal{ 10 }, datatypes::Decimal{ "20.00" }, selection );
+		EXPECT_EQ( selection[0], 0b0011110ULL );
+
+		// Bounds with more fractional digits than the values
+		datatypes::DecimalFilter::between( quantities, datatypes::Decimal{ "9.995" }, datatypes::Decimal{ "15.49999" }, selection );
+		EXPECT_EQ( selection[0], 0b0000110ULL );
+
+		datatypes::DecimalFilter::between( quantities, datatypes::Decimal{ 20 }, datatypes::Decimal{ 10 }, selection );
+		EXPECT_EQ( selection[0], 0ULL );
+
+		std::vector<std::uint64_t> empty;
+		EXPECT_THROW( datatypes::DecimalFilter::between( quantities, datatypes::Decimal{ 0 }, datatypes::Decimal{ 1 }, empty ), std::invalid_argument );
+	}
+
+	TEST( DecimalFilterSpan, ExtremeBounds )
+	{
+		// Aligning these bounds to scale 28 needs far more than 128 bits
+		const std::vector<datatypes::Decimal> values{ datatypes::Decimal{ "29.1590667454632219324229209" },
+			datatypes::Decimal{ "-0.0000000000000000000000000001" }, datatypes::Decimal::maxValue(), -datatypes::Decimal::maxValue(),
+			datatypes::Decimal{ "-0" } };
+		std::vector<std::uint64_t> selection( 1 );
+
+		datatypes::DecimalFilter::compare( values, Comparison::Less, datatypes::Decimal::maxValue(), selection );
+		EXPECT_EQ( selection[0], 0b11011ULL );
+
+		datatypes::DecimalFilter::compare( values, Comparison::Greater, -datatypes::Decimal::maxValue(), selection );
+		EXPECT_EQ( selection[0], 0b10111ULL );
+
+		// Negative zero equals zero
+		datatypes::DecimalFilter::compare( values, Comparison::Equal, datatypes::Decimal{ 0 }, selection );
+		EXPECT_EQ( selection[0], 0b10000ULL );
+		datatypes::DecimalFilter::compare( values, Comparison::Less, datatypes::Decimal{ "-0" }, selection );
+		EXPECT_EQ( selection[0], 0b01010ULL );
+	}
+
+	//----------------------------------------------
+	// Column predicates
+	//----------------------------------------------
+
+	TEST( DecimalFilterColumn, MatchesOperators )
+	{
+		std::mt19937_64 engine{ 38 };
+
+		// Long same-scale runs take the vector path, with mixed-scale groups and nulls in between
+		std::vector<datatypes::Decimal> values;
+		datatypes::DecimalColumn column;
+		for ( std::size_t i{ 0 }; i < 300; ++i )
+		{
+			if ( i % 97 == 5 )
+			{
+				values.emplace_back();
+				column.appendNull();
+				continue;
+			}
+
+			values.push_back( ( i / 40 ) % 2 == 0 ? randomPrice( engine ) : randomDecimal( engine ) );
+			column.append( values.back() );
+		}
+
+		for ( const datatypes::Decimal& bound : boundsFor( values, engine ) )
+		{
+			for ( const Comparison comparison : comparisons )
+			{
+				std::vector<std::uint64_t> selection( ( values.size() + 63 ) / 64 );
+				datatypes::DecimalFilter::compare( column, comparison, bound, selection );
+				for ( std::size_t i{ 0 }; i < values.size(); ++i )
+				{
+					const bool expected{ column.isValid( i ) && expectedComparison( values[i], comparison, bound ) };
+					ASSERT_EQ( bitAt( selection, i ), expected ) << i << ": " << values[i].toString() << " vs " << bound.toString();
+				}
+				EXPECT_EQ( selection.back() >> ( values.size() % 64 ), 0ULL );
+			}
+
+			const datatypes::Decimal upper{ bound + datatypes::Decimal{ "25.5" } };
+			std::vector<std::uint64_t> selection( ( values.size() + 63 ) / 64 );
+			datatypes::DecimalFilter::between( column, bound, upper, selection );
+			for ( std::size_t i{ 0 }; i < values.size(); ++i )
+			{
+				const bool expected{ column.isValid( i ) && values[i] >= bound && values[i] <= upper };
+				ASSERT_EQ( bitAt( selection, i ), expected ) << i;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Selection conversion
+	//----------------------------------------------
+
+	TEST( DecimalFilterSelection, ToIndices )
+	{
+		const std::vector<datatypes::Decimal> prices{ datatypes::Decimal{ "99.5" }, datatypes::Decimal{ "100.5" }, datatypes::Decimal{ "101" },
+			datatypes::Decimal{ "100.49" } };
+		const datatypes::DecimalColumn column{ prices };
+
+		std::vector<std::uint64_t> selection( 1 );
+		datatypes::DecimalFilter::compare( column, Comparison::GreaterOrEqual, datatypes::Decimal{ "100.5" }, selection );
+
+		std::vector<std::size_t> rows( prices.size() );
+		rows.resize( datatypes::DecimalFilter::toIndices( selection, prices.size(), rows ) );
+		EXPECT_EQ( rows, ( std::vector<std::size_t>{ 1, 2 } ) );
+		EXPECT_EQ( column.gather( rows )[1], datatypes::Decimal{ 101 } );
+
+		// Bits beyond the row count are ignored
+		const std::vector<std::uint64_t> stray{ 0b110001ULL, ~0ULL };
+		std::vector<std::size_t> indices( 2 );
+		EXPECT_EQ( datatypes::DecimalFilter::toIndices( stray, 5, indices ), 2U );
+		EXPECT_EQ( indices, ( std::vector<std::size_t>{ 0, 4 } ) );
+
+		EXPECT_THROW( (void)datatypes::DecimalFilter::toIndices( stray, 129, indices ), std::invalid_argument );
+		std::vector<std::size_t> none;
+		EXPECT_THROW( (void)datatypes::DecimalFilter::toIndices( stray, 64, none ), std::invalid_argument );
+	}
+} // namespace nfx::datatypes::test
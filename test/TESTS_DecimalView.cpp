@@ -0,0 +1,147 @@
+/**
+ * @file TESTS_DecimalView.cpp
+ * @brief Tests for the read-only view over raw 16-byte decimal records
+ * @details Validates the three record layouts against reference bytes, validation of
+ *          reserved bits and scale, bulk conversion, and in-place use of Native buffers
+ */
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/DecimalView.h>
+
+namespace nfx::datatypes::test
+{
+	namespace
+	{
+		using Layout = datatypes::DecimalView::Layout;
+
+		/** @brief Append a 32-bit word in little-endian byte order */
+		void appendWord( std::vector<std::byte>& bytes, std::uint32_t word )
+		{
+			for ( int shift{ 0 }; shift < 32; shift += 8 )
+			{
+				bytes.push_back( static_cast<std::byte>( word >> shift ) );
+			}
+		}
+	} // namespace
+
+	//=====================================================================
+	// DecimalView type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Element access
+	//----------------------------------------------
+
+	TEST( DecimalViewAccess, Layouts )
+	{
+		// -1234567890123456789.123456789: mantissa 0x03FD35EB6D797A91C4D85F15, scale 9
+		const std::uint32_t lo{ 0xC4D85F15U };
+		const std::uint32_t mid{ 0x6D797A91U };
+		const std::uint32_t hi{ 0x03FD35EBU };
+		const std::uint32_t flags{ 0x80090000U };
+		const datatypes::Decimal expected{ "-1234567890123456789.123456789" };
+
+		std::vector<std::byte> bits;
+		for ( const std::uint32_t word : { lo, mid, hi, flags } )
+		{
+			appendWord( bits, word );
+		}
+
+		std::vector<std::byte> memory;
+		for ( const std::uint32_t word : { flags, hi, lo, mid } )
+		{
+			appendWord( memory, word );
+		}
+
+		std::vector<std::byte> native( sizeof( datatypes::Decimal ) );
+		std::memcpy( native.data(), &expected, sizeof( datatypes::Decimal ) );
+
+		EXPECT_EQ( ( datatypes::DecimalView{ bits, Layout::DotNetBits } )[0].toBits(), expected.toBits() );
+		EXPECT_EQ( ( datatypes::DecimalView{ memory, Layout::DotNetMemory } )[0].toBits(), expected.toBits() );
+		EXPECT_EQ( ( datatypes::DecimalView{ native, Layout::Native } )[0].toBits(), expected.toBits() );
+	}
+
+	TEST( DecimalViewAccess, Validation )
+	{
+		std::vector<std::byte> bytes;
+		for ( const std::uint32_t word : { 5U, 0U, 0U, 0x00010000U, 1U, 0U, 0U, 0x001D0000U, 1U, 0U, 0U, 0x00000100U } )
+		{
+			appendWord( bytes, word );
+		}
+
+		const datatypes::DecimalView view{ bytes, Layout::DotNetBits };
+		EXPECT_EQ( view.size(), 3U );
+		EXPECT_FALSE( view.isEmpty() );
+		EXPECT_EQ( view.layout(), Layout::DotNetBits );
+		EXPECT_EQ( view[0], datatypes::Decimal{ "0.5" } );
+
+		// Scale 29, then a reserved bit
+		datatypes::Decimal result{ 7 };
+		EXPECT_THROW( (void)view[1], std::invalid_argument );
+		EXPECT_FALSE( view.tryGet( 2, result ) );
+		EXPECT_EQ( result, datatypes::Decimal{ 7 } );
+		EXPECT_EQ( view.findInvalid(), 1U );
+
+		bytes.pop_back();
+		EXPECT_THROW( ( datatypes::DecimalView{ bytes, Layout::DotNetBits } ), std::invalid_argument );
+		EXPECT_TRUE( datatypes::DecimalView{}.isEmpty() );
+	}
+
+	//----------------------------------------------
+	// Bulk conversion
+	//----------------------------------------------
+
+	TEST( DecimalViewConversion, Spans )
+	{
+		const std::vector<datatypes::Decimal> prices{
+			datatypes::Decimal{ "101.25" }, datatypes::Decimal{ "-0.0003" }, datatypes::Decimal{ "0" }, datatypes::Decimal{ "42" } };
+
+		std::vector<std::byte> wire;
+		for ( const auto& price : prices )
+		{
+			for ( const std::int32_t word : price.toBits() )
+			{
+				appendWord( wire, static_cast<std::uint32_t>( word ) );
+			}
+		}
+
+		const datatypes::DecimalView view{ wire, Layout::DotNetBits };
+		std::vector<datatypes::Decimal> restored( prices.size() );
+		view.toDecimals( restored );
+		for ( std::size_t i{ 0 }; i < prices.size(); ++i )
+		{
+			EXPECT_EQ( restored[i].toBits(), prices[i].toBits() ) << i;
+		}
+
+		std::array<datatypes::Decimal, 2> small{};
+		EXPECT_THROW( view.toDecimals( small ), std::invalid_argument );
+		EXPECT_EQ( view.tryToDecimals( small ), 2U );
+
+		// Stops at the first invalid record
+		wire[2 * 16 + 15] = std::byte{ 0x7F };
+		EXPECT_EQ( view.tryToDecimals( restored ), 2U );
+		EXPECT_THROW( view.toDecimals( restored ), std::invalid_argument );
+	}
+
+	TEST( DecimalViewConversion, AsDecimalsInPlace )
+	{
+		std::vector<datatypes::Decimal> stored{ datatypes::Decimal{ "1.5" }, datatypes::Decimal{ "-2.25" } };
+		const std::span<const std::byte> bytes{ std::as_bytes( std::span{ stored } ) };
+
+		const std::span<const datatypes::Decimal> values{ datatypes::DecimalView::asDecimals( bytes ) };
+		EXPECT_EQ( values.data(), stored.data() );
+		EXPECT_EQ( values.size(), 2U );
+		EXPECT_EQ( values[1], datatypes::Decimal{ "-2.25" } );
+
+		EXPECT_THROW( (void)datatypes::DecimalView::asDecimals( bytes.subspan( 1, 16 ) ), std::invalid_argument );
+		EXPECT_THROW( (void)datatypes::DecimalView::asDecimals( bytes.first( 20 ) ), std::invalid_argument );
+
+		stored[1].flags() |= 0x00000001U;
+		EXPECT_THROW( (void)datatypes::DecimalView::asDecimals( bytes ), std::invalid_argument );
+	}
+} // namespace nfx::datatypes::test
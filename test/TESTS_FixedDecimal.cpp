@@ -0,0 +1,208 @@
+/**
+ * @file TESTS_FixedDecimal.cpp
+ * @brief Tests for the compile-time scale FixedDecimal type
+ * @details Validates integer-backed arithmetic, rounding and Decimal interoperability
+ */
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/FixedDecimal.h>
+#include <nfx/datatypes/Int128.h>
+
+namespace nfx::datatypes::test
+{
+	using Price = datatypes::FixedDecimal<4>;
+	using Quantity = datatypes::FixedDecimal<8>;
+	using WidePrice = datatypes::FixedDecimal<20, datatypes::Int128>;
+
+	//=====================================================================
+	// FixedDecimal type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	TEST( FixedDecimalConstruction, RawAndInteger )
+	{
+		static_assert( sizeof( Price ) == sizeof( std::int64_t ) );
+		static_assert( sizeof( WidePrice ) == sizeof( datatypes::Int128 ) );
+		static_assert( Price::scale() == 4 );
+
+		EXPECT_TRUE( Price{}.isZero() );
+		EXPECT_EQ( Price{ 12 }.raw(), 120000 );
+		EXPECT_EQ( Price{ -3 }.raw(), -30000 );
+		EXPECT_EQ( Price::fromRaw( 12345 ).toString(), "1.2345" );
+		EXPECT_EQ( WidePrice{ 7 }.toString(), "7.00000000000000000000" );
+
+		// Integer part beyond the storage range
+		EXPECT_THROW( datatypes::FixedDecimal<18>{ 10 }, std::overflow_error );
+		EXPECT_NO_THROW( datatypes::FixedDecimal<18>{ 9 } );
+	}
+
+	TEST( FixedDecimalConstruction, Constexpr )
+	{
+		constexpr Price bid{ "101.25" };
+		constexpr Price ask{ bid + Price::fromRaw( 25 ) };
+		static_assert( ask.raw() == 1012525 );
+		static_assert( ( bid * Price{ 2 } ).raw() == 2025000 );
+		static_assert( ask > bid );
+
+		constexpr WidePrice wide{ "0.00000000000000000001" };
+		static_assert( wide.raw() == datatypes::Int128{ 1 } );
+	}
+
+	//----------------------------------------------
+	// Arithmetic
+	//----------------------------------------------
+
+	TEST( FixedDecimalArithmetic, AddSubtractCompare )
+	{
+		Price a{ "1.5" };
+		Price b{ "0.25" };
+
+		EXPECT_EQ( ( a + b ).toString(), "1.7500" );
+		EXPECT_EQ( ( b - a ).toString(), "-1.2500" );
+		EXPECT_EQ( ( -a ).raw(), -15000 );
+		EXPECT_TRUE( b < a );
+		EXPECT_TRUE( a >= a );
+		EXPECT_TRUE( a != b );
+
+		a += b;
+		EXPECT_EQ( a, Price{ "1.75" } );
+		a -= b;
+		EXPECT_EQ( a, Price{ "1.5" } );
+
+		// Results beyond the storage range throw instead of wrapping
+		EXPECT_EQ( ( Price::maxValue() + Price::minValue() ).raw(), -1 );
+		EXPECT_EQ( ( Price::minValue() - Price::minValue() ).raw(), 0 );
+		EXPECT_THROW( (void)( Price::maxValue() + Price::fromRaw( 1 ) ), std::overflow_error );
+		EXPECT_THROW( (void)( Price::minValue() - Price::fromRaw( 1 ) ), std::overflow_error );
+		EXPECT_THROW( (void)( Price{} - Price::minValue() ), std::overflow_error );
+		EXPECT_THROW( (void)( -Price::minValue() ), std::overflow_error );
+		EXPECT_THROW( (void)Price::minValue().abs(), std::overflow_error );
+		EXPECT_EQ( Price::fromRaw( Price::minValue().raw() + 1 ).abs().raw(), Price::maxValue().raw() );
+		EXPECT_EQ( ( -Price::maxValue() ).raw(), Price::minValue().raw() + 1 );
+
+		Price total{ Price::maxValue() };
+		EXPECT_THROW( total += Price::fromRaw( 1 ), std::overflow_error );
+		EXPECT_EQ( total, Price::maxValue() );
+		EXPECT_THROW( total -= Price::fromRaw( -1 ), std::overflow_error );
+	}
+
+	TEST( FixedDecimalArithmetic, MultiplyRoundsHalfEven )
+	{
+		// 0.0001 * 0.5 = 0.00005 -> ties to even (0)
+		EXPECT_EQ( ( Price{ "0.0001" } * Price{ "0.5" } ).raw(), 0 );
+		// 0.0003 * 0.5 = 0.00015 -> ties to even (0.0002)
+		EXPECT_EQ( ( Price{ "0.0003" } * Price{ "0.5" } ).raw(), 2 );
+		EXPECT_EQ( ( Price{ "-0.0003" } * Price{ "0.5" } ).raw(), -2 );
+		EXPECT_EQ( ( Price{ "12.3456" } * Price{ "-2" } ).toString(), "-24.6912" );
+
+		// Full 128-bit intermediate: 9e10 * 9e4 needs more than 64 bits before rescaling
+		EXPECT_EQ( ( Quantity{ "90000000000" } * Quantity{ "0.000001" } ).toString(), "90000.00000000" );
+
+		EXPECT_THROW( (void)( Price{ 900000000000000 } * Price{ 1000 } ), std::overflow_error );
+	}
+
+	TEST( FixedDecimalArithmetic, DivideRoundsHalfEven )
+	{
+		EXPECT_EQ( ( Price{ 1 } / Price{ 3 } ).toString(), "0.3333" );
+		EXPECT_EQ( ( Price{ 2 } / Price{ 3 } ).toString(), "0.6667" );
+		EXPECT_EQ( ( Price{ -2 } / Price{ 3 } ).toString(), "-0.6667" );
+		// 0.00025 -> ties to even (0.0002)
+		EXPECT_EQ( ( Price{ "0.0005" } / Price{ 2 } ).raw(), 2 );
+
+		EXPECT_THROW( (void)( Price{ 1 } / Price{} ), std::overflow_error );
+	}
+
+	TEST( FixedDecimalArithmetic, Int128Storage )
+	{
+		WidePrice a{ "12345678901234567.12345678901234567890" };
+		WidePrice b{ "2" };
+
+		EXPECT_EQ( ( a + a ).toString(), "24691357802469134.24691357802469135780" );
+		EXPECT_EQ( ( a * b ).toString(), "24691357802469134.24691357802469135780" );
+		EXPECT_EQ( ( a / b ).toString(), "6172839450617283.56172839450617283945" );
+		EXPECT_EQ( ( WidePrice{ 1 } / WidePrice{ 3 } ).toString(), "0.33333333333333333333" );
+		EXPECT_EQ( ( WidePrice{ 2 } / WidePrice{ -3 } ).toString(), "-0.66666666666666666667" );
+		EXPECT_EQ( ( WidePrice{ "0.00000000000000000001" } * WidePrice{ "0.5" } ).raw(), datatypes::Int128{ 0 } );
+
+		EXPECT_THROW( (void)( WidePrice::maxValue() * WidePrice{ 2 } ), std::overflow_error );
+		EXPECT_THROW( (void)( WidePrice::maxValue() + WidePrice::fromRaw( datatypes::Int128{ 1 } ) ), std::overflow_error );
+		EXPECT_THROW( (void)( WidePrice::minValue() - WidePrice::fromRaw( datatypes::Int128{ 1 } ) ), std::overflow_error );
+		EXPECT_THROW( (void)( -WidePrice::minValue() ), std::overflow_error );
+		EXPECT_THROW( (void)WidePrice::minValue().abs(), std::overflow_error );
+		EXPECT_EQ( ( WidePrice::minValue() + WidePrice::maxValue() ).raw(), datatypes::Int128{ -1 } );
+	}
+
+	//----------------------------------------------
+	// Decimal interoperability
+	//----------------------------------------------
+
+	TEST( FixedDecimalConversion, FromDecimal )
+	{
+		EXPECT_EQ( Price{ datatypes::Decimal{ "1.23456" } }.raw(), 12346 );
+		EXPECT_EQ( Price{ datatypes::Decimal{ "1.23445" } }.raw(), 12344 );
+		EXPECT_EQ( Price( datatypes::Decimal{ "1.23456" }, datatypes::Decimal::RoundingMode::ToZero ).raw(), 12345 );
+		EXPECT_EQ( Price( datatypes::Decimal{ "-1.23451" }, datatypes::Decimal::RoundingMode::ToNegativeInfinity ).raw(), -12346 );
+
+		// Scaling happens in wide arithmetic; only the final result is range checked
+		EXPECT_EQ( WidePrice{ datatypes::Decimal{ "1234567890123456.5" } }.toString(), "1234567890123456.50000000000000000000" );
+
+		datatypes::Decimal large{ "79228162514264337593543950335" };
+		EXPECT_THROW( WidePrice{ large }, std::overflow_error );
+		EXPECT_THROW( Price{ large }, std::overflow_error );
+	}
+
+	TEST( FixedDecimalConversion, ToDecimal )
+	{
+		EXPECT_EQ( Price{ "1.2500" }.toDecimal().toString(), "1.25" );
+		EXPECT_EQ( Price{ "-0.0001" }.toDecimal(), datatypes::Decimal{ "-0.0001" } );
+		EXPECT_EQ( Price::maxValue().toDecimal(), datatypes::Decimal{ "922337203685477.5807" } );
+		EXPECT_EQ( Price::minValue().toDecimal(), datatypes::Decimal{ "-922337203685477.5808" } );
+
+		// Magnitudes beyond 96 bits drop fractional digits with rounding
+		WidePrice wide{ "1234567890123456789.12345678901234567890" };
+		EXPECT_EQ( wide.toDecimal().toString(), "1234567890123456789.123456789" );
+
+		// Round trip is exact when the Decimal can hold every digit
+		for ( const char* text : { "0", "1", "-1", "0.0001", "99999.9999", "-123456.7891" } )
+		{
+			Price value{ text };
+			EXPECT_EQ( Price{ value.toDecimal() }, value ) << text;
+		}
+	}
+
+	//----------------------------------------------
+	// String parsing and formatting
+	//----------------------------------------------
+
+	TEST( FixedDecimalStringParsing, ParseAndFormat )
+	{
+		Price value;
+		EXPECT_TRUE( Price::tryParse( "-12.34", value ) );
+		EXPECT_EQ( value.toString(), "-12.3400" );
+		EXPECT_TRUE( Price::tryParse( "0.00005", value ) );
+		EXPECT_EQ( value.toString(), "0.0000" );
+		EXPECT_FALSE( Price::tryParse( "abc", value ) );
+		EXPECT_FALSE( Price::tryParse( "1000000000000000", value ) );
+
+		EXPECT_THROW( (void)Price::parse( "1.2.3" ), std::invalid_argument );
+		EXPECT_EQ( datatypes::FixedDecimal<0>{ "42" }.toString(), "42" );
+
+		std::ostringstream os;
+		os << Price{ "3.5" };
+		EXPECT_EQ( os.str(), "3.5000" );
+
+		std::istringstream is{ "7.25 bad" };
+		Price parsed;
+		is >> parsed;
+		EXPECT_EQ( parsed, Price{ "7.25" } );
+		is >> parsed;
+		EXPECT_TRUE( is.fail() );
+	}
+} // namespace nfx::datatypes::test
@@ -0,0 +1,143 @@
+/**
+ * @file TESTS_FlatHashMap.cpp
+ * @brief Tests for the open-addressing Decimal and Int128 hash maps
+ * @details Validates canonical Decimal keys, insertion, lookup and erasure against
+ *          std::unordered_map, growth, tombstone reuse and iteration
+ */
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/FlatHashMap.h>
+
+namespace nfx::datatypes::test
+{
+	//=====================================================================
+	// FlatHashMap type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Canonical keys
+	//----------------------------------------------
+
+	TEST( FlatHashMapKeys, DecimalScalesShareOneKey )
+	{
+		datatypes::DecimalFlatMap<int> volumes;
+		EXPECT_TRUE( volumes.isEmpty() );
+		EXPECT_EQ( volumes.capacity(), 0U );
+		EXPECT_EQ( volumes.find( datatypes::Decimal{ "1.5" } ), nullptr );
+
+		volumes[datatypes::Decimal{ "101.25" }] += 10;
+		volumes[datatypes::Decimal{ "101.25" }.rescale( 4 )] += 5;
+		volumes[datatypes::Decimal{ "101.25" }.rescale( 26 )] += 1;
+		volumes[datatypes::Decimal{ "-101.25" }] += 100;
+		volumes[datatypes::Decimal{ "0" }.rescale( 3 )] += 7;
+		volumes[-datatypes::Decimal{ "0" }] += 7;
+		volumes[datatypes::Decimal{ 1200 }] += 1;
+		volumes[datatypes::Decimal{ 1200 }.rescale( 2 )] += 1;
+
+		EXPECT_EQ( volumes.size(), 4U );
+		ASSERT_NE( volumes.find( datatypes::Decimal{ "101.250" } ), nullptr );
+		EXPECT_EQ( *volumes.find( datatypes::Decimal{ "101.25" }.rescale( 9 ) ), 16 );
+		EXPECT_EQ( *volumes.find( datatypes::Decimal{ "-101.25" } ), 100 );
+		EXPECT_EQ( *volumes.find( datatypes::Decimal{} ), 14 );
+		EXPECT_EQ( *volumes.find( datatypes::Decimal{ 1200 } ), 2 );
+		EXPECT_FALSE( volumes.contains( datatypes::Decimal{ "101.2" } ) );
+
+		// Iteration yields keys at their smallest scale
+		volumes.forEach( []( const datatypes::Decimal& price, int ) { EXPECT_EQ( price.scale(), price.decimalPlacesCount() ); } );
+
+		// Extreme mantissas keep all 96 bits
+		const datatypes::Decimal max{ datatypes::Decimal::maxValue() };
+		volumes[max] = 1;
+		volumes[datatypes::Decimal{ "7922816251426433759354395033.5" }] = 2;
+		EXPECT_EQ( *volumes.find( max ), 1 );
+		EXPECT_EQ( *volumes.find( datatypes::Decimal{ "7922816251426433759354395033.5" } ), 2 );
+	}
+
+	//----------------------------------------------
+	// Reference behavior
+	//----------------------------------------------
+
+	TEST( FlatHashMapOperations, MatchesUnorderedMap )
+	{
+		datatypes::Int128FlatMap<std::int64_t> map;
+		std::unordered_map<datatypes::Int128, std::int64_t> reference;
+
+		std::mt19937_64 random{ 46 };
+		for ( int i{ 0 }; i < 200000; ++i )
+		{
+			// A small key range forces many hits, erasures and reuses of deleted slots
+			const datatypes::Int128 key{ random() % 5000U, ( random() % 4U ) * 0x8000000000000000ULL };
+			switch ( random() % 4U )
+			{
+				case 0:
+				case 1:
+					map[key] += i;
+					reference[key] += i;
+					break;
+				case 2:
+					EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+					break;
+				default:
+				{
+					const auto* value{ map.find( key ) };
+					const auto it{ reference.find( key ) };
+					ASSERT_EQ( value != nullptr, it != reference.end() );
+					if ( value != nullptr )
+					{
+						EXPECT_EQ( *value, it->second );
+					}
+					break;
+				}
+			}
+		}
+
+		EXPECT_EQ( map.size(), reference.size() );
+		std::size_t visited{ 0 };
+		map.forEach( [&]( const datatypes::Int128& key, std::int64_t value ) {
+			++visited;
+			EXPECT_EQ( reference.at( key ), value );
+		} );
+		EXPECT_EQ( visited, reference.size() );
+		EXPECT_LE( map.size() * 8, map.capacity() * 7 );
+	}
+
+	TEST( FlatHashMapOperations, InsertEraseClear )
+	{
+		datatypes::Int128FlatMap<std::string> names{ 100 };
+		EXPECT_GE( names.capacity() * 7, 100U * 8 );
+		const std::size_t capacity{ names.capacity() };
+
+		EXPECT_TRUE( names.insert( datatypes::Int128{ 1 }, "alice" ) );
+		EXPECT_FALSE( names.insert( datatypes::Int128{ 1 }, "bob" ) );
+		EXPECT_EQ( *names.find( datatypes::Int128{ 1 } ), "alice" );
+		EXPECT_FALSE( names.insertOrAssign( datatypes::Int128{ 1 }, "bob" ) );
+		EXPECT_EQ( *names.find( datatypes::Int128{ 1 } ), "bob" );
+		EXPECT_TRUE( names.insertOrAssign( datatypes::Int128{ -1 }, "carol" ) );
+
+		EXPECT_TRUE( names.erase( datatypes::Int128{ 1 } ) );
+		EXPECT_FALSE( names.erase( datatypes::Int128{ 1 } ) );
+		EXPECT_FALSE( names.contains( datatypes::Int128{ 1 } ) );
+		EXPECT_EQ( names.size(), 1U );
+
+		// Churn within the reserved size never grows the table
+		for ( std::int64_t i{ 0 }; i < 10000; ++i )
+		{
+			names[datatypes::Int128{ i }] = "x";
+			EXPECT_TRUE( names.erase( datatypes::Int128{ i } ) );
+		}
+		EXPECT_EQ( names.capacity(), capacity );
+		EXPECT_EQ( names.size(), 1U );
+
+		names.clear();
+		EXPECT_TRUE( names.isEmpty() );
+		EXPECT_EQ( names.capacity(), capacity );
+		EXPECT_FALSE( names.contains( datatypes::Int128{ -1 } ) );
+		EXPECT_TRUE( names[datatypes::Int128{ 5 }].empty() );
+	}
+} // namespace nfx::datatypes::test
@@ -0,0 +1,180 @@
+/**
+ * @file TESTS_IeeeDecimal128.cpp
+ * @brief Tests for IEEE 754-2008 decimal128 transcoding
+ * @details Validates BID and DPD encodings against reference bit patterns, exact
+ *          Decimal round trips, rounding and range checks on decode, and the span overloads
+ */
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/IeeeDecimal128.h>
+
+namespace nfx::datatypes::test
+{
+	using Encoding = datatypes::IeeeDecimal128::Encoding;
+
+	//=====================================================================
+	// IeeeDecimal128 type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Encoding
+	//----------------------------------------------
+
+	TEST( IeeeDecimal128Encoding, ReferenceBitPatterns )
+	{
+		static_assert( sizeof( datatypes::IeeeDecimal128 ) == 16 );
+
+		const auto one{ datatypes::IeeeDecimal128::fromDecimal( datatypes::Decimal{ 1 }, Encoding::Bid ) };
+		EXPECT_EQ( one.highBits(), 0x3040000000000000ULL );
+		EXPECT_EQ( one.lowBits(), 1ULL );
+
+		const auto dpdOne{ datatypes::IeeeDecimal128::fromDecimal( datatypes::Decimal{ 1 }, Encoding::Dpd ) };
+		EXPECT_EQ( dpdOne.highBits(), 0x2208000000000000ULL );
+		EXPECT_EQ( dpdOne.lowBits(), 1ULL );
+
+		// -7.50 keeps its trailing zero as exponent -2
+		const datatypes::Decimal price{ datatypes::Decimal{ "-7.5" }.rescale( 2 ) };
+		EXPECT_EQ( datatypes::IeeeDecimal128::fromDecimal( price, Encoding::Bid ), ( datatypes::IeeeDecimal128{ 0xB03C000000000000ULL, 750ULL } ) );
+		EXPECT_EQ( datatypes::IeeeDecimal128::fromDecimal( price, Encoding::Dpd ), ( datatypes::IeeeDecimal128{ 0xA207800000000000ULL, 0x3D0ULL } ) );
+	}
+
+	TEST( IeeeDecimal128Encoding, Constexpr )
+	{
+		constexpr auto encoded{ datatypes::IeeeDecimal128::fromDecimal( datatypes::Decimal{ "12.5" }, Encoding::Dpd ) };
+		static_assert( encoded.toDecimal( Encoding::Dpd ) == datatypes::Decimal{ "12.5" } );
+		static_assert( !encoded.isNegative() && !encoded.isNaN() && !encoded.isInfinite() );
+	}
+
+	//----------------------------------------------
+	// Decoding
+	//----------------------------------------------
+
+	TEST( IeeeDecimal128Decoding, BitExactRoundTrip )
+	{
+		for ( const Encoding encoding : { Encoding::Bid, Encoding::Dpd } )
+		{
+			for ( const char* text : { "0", "-1", "0.0001", "123.4567", "-12345678901234567890.123456789",
+					  "79228162514264337593543950335", "-79228162514264337593543950335", "0.0000000000000000000000000001",
+					  "999999999999999999999999999.9" } )
+			{
+				const datatypes::Decimal value{ text };
+				const auto encoded{ datatypes::IeeeDecimal128::fromDecimal( value, encoding ) };
+				EXPECT_EQ( encoded.toDecimal( encoding ).toBits(), value.toBits() ) << text;
+			}
+
+			// Unnormalized scale maps to the exponent and back
+			const datatypes::Decimal padded{ datatypes::Decimal{ "1.5" }.rescale( 10 ) };
+			EXPECT_EQ( datatypes::IeeeDecimal128::fromDecimal( padded, encoding ).toDecimal( encoding ).toBits(), padded.toBits() );
+		}
+	}
+
+	TEST( IeeeDecimal128Decoding, FullCoefficient )
+	{
+		// 1234567890123456789012345678901234E-33 keeps 28 fractional digits
+		const std::string expected{ "1.2345678901234567890123456789" };
+		EXPECT_EQ( ( datatypes::IeeeDecimal128{ 0x2FFE3CDE6FFF9732ULL, 0xDE825CD07E96AFF2ULL } ).toDecimal( Encoding::Bid ).toString(), expected );
+		EXPECT_EQ( ( datatypes::IeeeDecimal128{ 0x25FFD34B9C1E28E5ULL, 0x6F3C127177823534ULL } ).toDecimal( Encoding::Dpd ).toString(), expected );
+
+		// Leading digit 9 uses the large combination form: 9876543210987654321098765432109876E-6
+		EXPECT_EQ( ( datatypes::IeeeDecimal128{ 0x6E06B7CB0D10E3F5ULL, 0x46845EF96322277CULL } ).toDecimal( Encoding::Dpd ),
+			datatypes::Decimal{ "9876543210987654321098765432" } );
+	}
+
+	TEST( IeeeDecimal128Decoding, Rounding )
+	{
+		constexpr auto bid{ []( std::uint64_t coefficient, std::int32_t exponent ) {
+			return datatypes::IeeeDecimal128{ static_cast<std::uint64_t>( exponent + 6176 ) << 49, coefficient };
+		} };
+
+		// Ties to even at the 28th fractional digit
+		EXPECT_TRUE( bid( 5, -29 ).toDecimal( Encoding::Bid ).isZero() );
+		EXPECT_EQ( bid( 15, -29 ).toDecimal( Encoding::Bid ), datatypes::Decimal{ "0.0000000000000000000000000002" } );
+		EXPECT_EQ( bid( 16, -29 ).toDecimal( Encoding::Bid ), datatypes::Decimal{ "0.0000000000000000000000000002" } );
+		EXPECT_TRUE( bid( 1, -6176 ).toDecimal( Encoding::Bid ).isZero() );
+
+		// Positive exponents scale the coefficient
+		EXPECT_EQ( bid( 12, 3 ).toDecimal( Encoding::Bid ), datatypes::Decimal{ 12000 } );
+		EXPECT_TRUE( bid( 0, 6000 ).toDecimal( Encoding::Bid ).isZero() );
+
+		// 10^34 - 1 with exponent -6 rounds up to 10^28
+		const datatypes::IeeeDecimal128 nines{ ( static_cast<std::uint64_t>( 6170 ) << 49 ) | 0x0001ED09BEAD87C0ULL, 0x378D8E63FFFFFFFFULL };
+		EXPECT_EQ( nines.toDecimal( Encoding::Bid ).toString(), "10000000000000000000000000000" );
+	}
+
+	TEST( IeeeDecimal128Decoding, RangeAndSpecials )
+	{
+		datatypes::Decimal result{ 7 };
+
+		// Integer part beyond 96 bits
+		const datatypes::IeeeDecimal128 large{ static_cast<std::uint64_t>( 6176 + 29 ) << 49, 1ULL };
+		EXPECT_THROW( (void)large.toDecimal( Encoding::Bid ), std::overflow_error );
+		EXPECT_FALSE( large.tryToDecimal( Encoding::Bid, result ) );
+		EXPECT_THROW( (void)( datatypes::IeeeDecimal128{ 0x77FFCFF3FCFF3FCFULL, 0xF3FCFF3FCFF3FCFFULL } ).toDecimal( Encoding::Dpd ), std::overflow_error );
+
+		const datatypes::IeeeDecimal128 infinity{ 0xF800000000000000ULL, 0ULL };
+		const datatypes::IeeeDecimal128 nan{ 0x7C00000000000000ULL, 0ULL };
+		EXPECT_TRUE( infinity.isInfinite() && infinity.isNegative() && !infinity.isNaN() );
+		EXPECT_TRUE( nan.isNaN() && !nan.isInfinite() );
+		EXPECT_THROW( (void)infinity.toDecimal( Encoding::Dpd ), std::invalid_argument );
+		EXPECT_THROW( (void)nan.toDecimal( Encoding::Bid ), std::invalid_argument );
+		EXPECT_FALSE( nan.tryToDecimal( Encoding::Bid, result ) );
+		EXPECT_EQ( result, datatypes::Decimal{ 7 } );
+
+		// Non-canonical BID coefficients decode as zero
+		EXPECT_TRUE( ( datatypes::IeeeDecimal128{ 0x6000000000000001ULL, 0ULL } ).toDecimal( Encoding::Bid ).isZero() );
+		EXPECT_TRUE( ( datatypes::IeeeDecimal128{ 0x3041FFFFFFFFFFFFULL, ~0ULL } ).toDecimal( Encoding::Bid ).isZero() );
+	}
+
+	TEST( IeeeDecimal128Decoding, DecletTables )
+	{
+		for ( std::uint16_t value{ 0 }; value < 1000; ++value )
+		{
+			EXPECT_EQ( internal::DPD_DECODE_TABLE[internal::DPD_ENCODE_TABLE[value]], value ) << value;
+		}
+
+		// The 24 non-canonical declets decode like their canonical counterparts
+		EXPECT_EQ( internal::DPD_DECODE_TABLE[0x0FF], 999U );
+		EXPECT_EQ( internal::DPD_DECODE_TABLE[0x3FF], 999U );
+		EXPECT_EQ( internal::DPD_DECODE_TABLE[0x16E], 888U );
+		EXPECT_EQ( internal::DPD_DECODE_TABLE[0x06E], 888U );
+	}
+
+	//----------------------------------------------
+	// Bulk conversion
+	//----------------------------------------------
+
+	TEST( IeeeDecimal128Conversion, Spans )
+	{
+		const std::vector<datatypes::Decimal> prices{
+			datatypes::Decimal{ "101.25" }, datatypes::Decimal{ "-0.0003" }, datatypes::Decimal{ "0" }, datatypes::Decimal{ "42" } };
+
+		for ( const Encoding encoding : { Encoding::Bid, Encoding::Dpd } )
+		{
+			std::vector<datatypes::IeeeDecimal128> wire( prices.size() );
+			datatypes::IeeeDecimal128::fromDecimals( prices, wire, encoding );
+
+			std::vector<datatypes::Decimal> restored( prices.size() );
+			datatypes::IeeeDecimal128::toDecimals( wire, restored, encoding );
+			for ( std::size_t i{ 0 }; i < prices.size(); ++i )
+			{
+				EXPECT_EQ( restored[i].toBits(), prices[i].toBits() ) << i;
+			}
+
+			// Destination too small
+			std::array<datatypes::Decimal, 2> small{};
+			EXPECT_THROW( datatypes::IeeeDecimal128::toDecimals( wire, small, encoding ), std::invalid_argument );
+			EXPECT_EQ( datatypes::IeeeDecimal128::tryToDecimals( wire, small, encoding ), 2U );
+
+			// Stops at the first value that is not representable
+			wire[2] = datatypes::IeeeDecimal128{ 0x7C00000000000000ULL, 0ULL };
+			EXPECT_EQ( datatypes::IeeeDecimal128::tryToDecimals( wire, restored, encoding ), 2U );
+			EXPECT_THROW( datatypes::IeeeDecimal128::toDecimals( wire, restored, encoding ), std::invalid_argument );
+		}
+	}
+} // namespace nfx::datatypes::test
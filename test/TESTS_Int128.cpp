@@ -9,10 +9,12 @@
 #include <array>
 #include <cstdint>
 #include <limits>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <nfx/datatypes/Decimal.h>
 #include <nfx/datatypes/Int128.h>
-#include "Constants.h"
+#include <nfx/detail/datatypes/Constants.h>
 
 namespace nfx::datatypes::test
 {
@@ -1798,4 +1800,185 @@ namespace nfx::datatypes::test
 		datatypes::Int128 negatedMin{ -minNegative };
 		EXPECT_EQ( minNegative, negatedMin );
 	}
+
+	TEST( Int128EdgeCaseAndOverflow, DivisionNegativeWideDividend )
+	{
+		// 128-bit negative dividend with a divisor that fits in 64 bits
+		datatypes::Int128 dividend{ datatypes::Int128::parse( "-36893488147419103232" ) }; // -2^65
+		EXPECT_EQ( dividend / datatypes::Int128{ 4 }, datatypes::Int128::parse( "-9223372036854775808" ) );
+		EXPECT_EQ( dividend / datatypes::Int128{ 3 }, datatypes::Int128::parse( "-12297829382473034410" ) );
+		EXPECT_EQ( dividend % datatypes::Int128{ 3 }, datatypes::Int128{ -2 } );
+	}
+
+	TEST( Int128EdgeCaseAndOverflow, DivisionMinimumDividend )
+	{
+		// The minimum has no positive counterpart, so its magnitude is only exact unsigned
+		const datatypes::Int128 min{ 0ULL, 0x8000000000000000ULL };
+		const datatypes::Int128 max{ 0xFFFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL };
+		const datatypes::Int128 twoPow64{ 0ULL, 1ULL };
+
+		EXPECT_EQ( min / -twoPow64, datatypes::Int128::parse( "9223372036854775808" ) );
+		EXPECT_EQ( min / twoPow64, datatypes::Int128::parse( "-9223372036854775808" ) );
+		EXPECT_EQ( min / datatypes::Int128{ 3 }, datatypes::Int128::parse( "-56713727820156410577229101238628035242" ) );
+		EXPECT_EQ( min % datatypes::Int128{ 3 }, datatypes::Int128{ -2 } );
+		EXPECT_EQ( min / max, datatypes::Int128{ -1 } );
+		EXPECT_EQ( min / min, datatypes::Int128{ 1 } );
+		EXPECT_EQ( max / min, datatypes::Int128{ 0 } );
+
+		// Divisors above 2^126 double the remainder past 2^127
+		const datatypes::Int128 largeDivisor{ 1ULL, 0x4000000000000000ULL };
+		EXPECT_EQ( max / largeDivisor, datatypes::Int128{ 1 } );
+		EXPECT_EQ( max % largeDivisor, datatypes::Int128::parse( "85070591730234615865843651857942052862" ) );
+		EXPECT_EQ( max / -( largeDivisor + datatypes::Int128{ 2 } ), datatypes::Int128{ -1 } );
+	}
+
+	//----------------------------------------------
+	// Compile-time evaluation
+	//----------------------------------------------
+
+	TEST( Int128Constexpr, CoreOperations )
+	{
+		using datatypes::Int128;
+
+		constexpr Int128 a{ Int128::parse( "-123456789012345678901234567890" ) };
+		constexpr Int128 b{ std::int64_t{ 1000000007 } };
+		static_assert( ( a / b ) * b + a % b == a );
+		static_assert( a < b && -a > b );
+		static_assert( a.abs() == -a );
+		static_assert( Int128{ 1, 1 }.toHigh() == 1 && Int128{ 1, 1 }.toLow() == 1 );
+		static_assert( Int128{ std::int64_t{ -1 } }.toBits()[3] == -1 );
+
+		constexpr bool rejected{ [] {
+			Int128 value;
+			return !Int128::tryParse( "170141183460469231731687303715884105728", value );
+		}() };
+		static_assert( rejected );
+
+		EXPECT_EQ( a.toString(), "-123456789012345678901234567890" );
+	}
+
+	TEST( Int128Constexpr, Literals )
+	{
+		using datatypes::Int128;
+		using namespace datatypes::literals;
+
+		constexpr Int128 max{ 170141183460469231731687303715884105727_i128 };
+		static_assert( max == Int128{ constants::INT_128_MAX_POSITIVE_LOW, constants::INT_128_MAX_POSITIVE_HIGH } );
+		static_assert( -1_i128 == Int128{ -1 } );
+		static_assert( 0_i128 == 0 );
+		static_assert( 18446744073709551616_i128 == Int128{ 0, 1 } );
+
+		EXPECT_EQ( max.toString(), "170141183460469231731687303715884105727" );
+	}
+
+	//----------------------------------------------
+	// Non-throwing arithmetic
+	//----------------------------------------------
+
+	TEST( Int128StatusArithmetic, AddSubtract )
+	{
+		const datatypes::Int128 max{ 0xFFFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL };
+		const datatypes::Int128 min{ 0ULL, 0x8000000000000000ULL };
+		datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+
+		EXPECT_EQ( datatypes::Int128::add( datatypes::Int128{ -5 }, datatypes::Int128{ 12 }, status ), datatypes::Int128{ 7 } );
+		EXPECT_EQ( datatypes::Int128::subtract( max, max, status ), datatypes::Int128{ 0 } );
+		EXPECT_EQ( datatypes::Int128::add( datatypes::Int128{ 0xFFFFFFFFFFFFFFFFULL, 0ULL }, datatypes::Int128{ 1 }, status ),
+			( datatypes::Int128{ 0ULL, 1ULL } ) );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::None );
+
+		EXPECT_EQ( datatypes::Int128::add( max, datatypes::Int128{ 1 }, status ), max );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::Overflow );
+		EXPECT_EQ( datatypes::Int128::add( min, datatypes::Int128{ -1 }, status ), min );
+		EXPECT_EQ( datatypes::Int128::subtract( min, datatypes::Int128{ 1 }, status ), min );
+		EXPECT_EQ( datatypes::Int128::subtract( datatypes::Int128{ 0 }, min, status ), max );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::Overflow );
+	}
+
+	TEST( Int128StatusArithmetic, MultiplyDivide )
+	{
+		const datatypes::Int128 max{ 0xFFFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL };
+		const datatypes::Int128 min{ 0ULL, 0x8000000000000000ULL };
+		const datatypes::Int128 twoPow64{ 0ULL, 1ULL };
+		const datatypes::Int128 twoPow63{ 0x8000000000000000ULL, 0ULL };
+		datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+
+		// -2^64 * 2^63 is exactly the minimum value
+		EXPECT_EQ( datatypes::Int128::multiply( -twoPow64, twoPow63, status ), min );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::None );
+
+		EXPECT_EQ( datatypes::Int128::multiply( twoPow64, twoPow63, status ), max );
+		EXPECT_EQ( datatypes::Int128::multiply( min, datatypes::Int128{ -1 }, status ), max );
+		EXPECT_EQ( datatypes::Int128::multiply( -twoPow64, twoPow64, status ), min );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::Overflow );
+
+		// Products that fit exactly, including the largest magnitudes on either side
+		status = datatypes::ArithmeticStatus::None;
+		EXPECT_EQ( datatypes::Int128::multiply( twoPow63, -twoPow64, status ), min );
+		EXPECT_EQ( datatypes::Int128::multiply( min, datatypes::Int128{ 1 }, status ), min );
+		EXPECT_EQ( datatypes::Int128::multiply( max, datatypes::Int128{ -1 }, status ), -max );
+		EXPECT_EQ( datatypes::Int128::multiply( twoPow64 - datatypes::Int128{ 1 }, datatypes::Int128{ std::uint64_t{ 0x4000000000000001ULL } }, status ),
+			datatypes::Int128::parse( "85070591730234615879678709913224216575" ) );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::None );
+
+		EXPECT_EQ( datatypes::Int128::multiply( twoPow63 + datatypes::Int128{ 1 }, -twoPow64, status ), min );
+		EXPECT_EQ( datatypes::Int128::multiply( max, datatypes::Int128{ 2 }, status ), max );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::Overflow );
+
+		status = datatypes::ArithmeticStatus::None;
+		EXPECT_EQ( datatypes::Int128::divide( datatypes::Int128{ -7 }, datatypes::Int128{ 2 }, status ), datatypes::Int128{ -3 } );
+		EXPECT_EQ( datatypes::Int128::remainder( datatypes::Int128{ -7 }, datatypes::Int128{ 2 }, status ), datatypes::Int128{ -1 } );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::Inexact );
+
+		status = datatypes::ArithmeticStatus::None;
+		EXPECT_EQ( datatypes::Int128::divide( datatypes::Int128{ 7 }, datatypes::Int128{ 0 }, status ), datatypes::Int128{ 0 } );
+		EXPECT_EQ( datatypes::Int128::remainder( datatypes::Int128{ 7 }, datatypes::Int128{ 0 }, status ), datatypes::Int128{ 0 } );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::DivisionByZero );
+
+		status = datatypes::ArithmeticStatus::None;
+		EXPECT_EQ( datatypes::Int128::divide( min, datatypes::Int128{ -1 }, status ), max );
+		EXPECT_EQ( datatypes::Int128::remainder( min, datatypes::Int128{ -1 }, status ), datatypes::Int128{ 0 } );
+		EXPECT_EQ( status, datatypes::ArithmeticStatus::Overflow );
+
+		static_assert( [] {
+			datatypes::ArithmeticStatus flags{ datatypes::ArithmeticStatus::None };
+			const datatypes::Int128 product{ datatypes::Int128::multiply( datatypes::Int128{ 0ULL, 1ULL }, datatypes::Int128{ 0ULL, 1ULL }, flags ) };
+			return datatypes::hasStatus( flags, datatypes::ArithmeticStatus::Overflow ) && product > datatypes::Int128{ 0 };
+		}() );
+	}
+
+	//----------------------------------------------
+	// Hashing
+	//----------------------------------------------
+
+	TEST( Int128Hashing, StdHash )
+	{
+		const datatypes::Int128 max{ constants::INT_128_MAX_POSITIVE_LOW, constants::INT_128_MAX_POSITIVE_HIGH };
+		const datatypes::Int128 min{ constants::INT_128_MIN_NEGATIVE_LOW, constants::INT_128_MIN_NEGATIVE_HIGH };
+
+		EXPECT_EQ( datatypes::Int128{ 42 }.hash(), datatypes::Int128{ std::uint64_t{ 42 } }.hash() );
+		EXPECT_EQ( std::hash<datatypes::Int128>{}( max ), static_cast<std::size_t>( max.hash() ) );
+		EXPECT_NE( datatypes::Int128{ 1 }.hash(), datatypes::Int128{ -1 }.hash() );
+		EXPECT_NE( max.hash(), min.hash() );
+
+		// Words are not interchangeable
+		EXPECT_NE( ( datatypes::Int128{ 1ULL, 0ULL } ).hash(), ( datatypes::Int128{ 0ULL, 1ULL } ).hash() );
+
+		std::unordered_set<std::uint64_t> hashes;
+		for ( std::int64_t i{ -500 }; i < 500; ++i )
+		{
+			hashes.insert( datatypes::Int128{ i }.hash() );
+			hashes.insert( ( datatypes::Int128{ static_cast<std::uint64_t>( i ), 1ULL } ).hash() );
+		}
+		EXPECT_EQ( hashes.size(), 2000U );
+
+		std::unordered_map<datatypes::Int128, int> counts;
+		++counts[max];
+		++counts[datatypes::Int128{ 7 }];
+		++counts[datatypes::Int128{ 7 }];
+		EXPECT_EQ( counts.size(), 2U );
+		EXPECT_EQ( counts.at( datatypes::Int128{ 7 } ), 2 );
+
+		static_assert( datatypes::Int128{ 5 }.hash() == datatypes::Int128{ 5 }.hash() );
+	}
 } // namespace nfx::datatypes::test
@@ -0,0 +1,207 @@
+/**
+ * @file TESTS_Int128Kernels.cpp
+ * @brief Tests for the element-wise Int128 span kernels
+ * @details Validates the vector kernels against the scalar Int128 operators across carry and
+ *          sign boundaries, span lengths that leave vector tails, in-place updates, the
+ *          comparison bitmask layout and exact summation with overflow detection
+ */
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/Int128.h>
+#include <nfx/datatypes/Int128Kernels.h>
+
+namespace nfx::datatypes::test
+{
+	namespace
+	{
+		/** @brief Random values biased towards carry, borrow and sign boundaries */
+		std::vector<datatypes::Int128> randomValues( std::size_t count, std::mt19937_64& engine )
+		{
+			const std::array<std::uint64_t, 6> words{ 0ULL, 1ULL, ~0ULL, ~0ULL - 1, 1ULL << 63, ( 1ULL << 63 ) - 1 };
+
+			std::vector<datatypes::Int128> values;
+			values.reserve( count );
+			for ( std::size_t i{ 0 }; i < count; ++i )
+			{
+				const std::uint64_t pick{ engine() };
+				const std::uint64_t low{ ( pick & 1U ) != 0 ? words[pick % words.size()] : engine() };
+				const std::uint64_t high{ ( pick & 2U ) != 0 ? words[( pick >> 8 ) % words.size()] : engine() % 4 };
+				values.emplace_back( low, high );
+			}
+
+			return values;
+		}
+
+		const std::array<std::size_t, 12> spanSizes{ 0, 1, 2, 3, 4, 5, 7, 63, 64, 65, 130, 257 };
+	} // namespace
+
+	//=====================================================================
+	// Int128Kernels tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Element-wise arithmetic
+	//----------------------------------------------
+
+	TEST( Int128KernelsArithmetic, MatchesOperators )
+	{
+		std::mt19937_64 engine{ 36 };
+
+		for ( const std::size_t size : spanSizes )
+		{
+			const auto left{ randomValues( size, engine ) };
+			const auto right{ randomValues( size, engine ) };
+			std::vector<datatypes::Int128> result( size );
+
+			datatypes::Int128Kernels::add( left, right, result );
+			for ( std::size_t i{ 0 }; i < size; ++i )
+			{
+				EXPECT_EQ( result[i], left[i] + right[i] ) << size << ":" << i;
+			}
+
+			datatypes::Int128Kernels::subtract( left, right, result );
+			for ( std::size_t i{ 0 }; i < size; ++i )
+			{
+				EXPECT_EQ( result[i], left[i] - right[i] ) << size << ":" << i;
+			}
+
+			datatypes::Int128Kernels::negate( left, result );
+			for ( std::size_t i{ 0 }; i < size; ++i )
+			{
+				EXPECT_EQ( result[i], -left[i] ) << size << ":" << i;
+			}
+		}
+	}
+
+	TEST( Int128KernelsArithmetic, WrapsAndUpdatesInPlace )
+	{
+		const datatypes::Int128 max{ ~0ULL, ( 1ULL << 63 ) - 1 };
+		const datatypes::Int128 min{ 0ULL, 1ULL << 63 };
+
+		std::vector<datatypes::Int128> balances{ max, min, datatypes::Int128{ ~0ULL, 0ULL }, datatypes::Int128{ -1 }, datatypes::Int128{ 0 } };
+		const std::vector<datatypes::Int128> movements{ datatypes::Int128{ 1 }, datatypes::Int128{ -1 }, datatypes::Int128{ 1 },
+			datatypes::Int128{ 1 }, datatypes::Int128{ -1 } };
+
+		datatypes::Int128Kernels::add( balances, movements, balances );
+		EXPECT_EQ( balances[0], min );
+		EXPECT_EQ( balances[1], max );
+		EXPECT_EQ( balances[2], ( datatypes::Int128{ 0ULL, 1ULL } ) );
+		EXPECT_EQ( balances[3], datatypes::Int128{ 0 } );
+		EXPECT_EQ( balances[4], datatypes::Int128{ -1 } );
+
+		datatypes::Int128Kernels::subtract( balances, movements, balances );
+		EXPECT_EQ( balances[0], max );
+		EXPECT_EQ( balances[1], min );
+		EXPECT_EQ( balances[2], ( datatypes::Int128{ ~0ULL, 0ULL } ) );
+
+		datatypes::Int128Kernels::negate( balances, balances );
+		EXPECT_EQ( balances[0], min + datatypes::Int128{ 1 } );
+		EXPECT_EQ( balances[1], min );
+		EXPECT_EQ( balances[3], datatypes::Int128{ 1 } );
+		EXPECT_EQ( balances[4], datatypes::Int128{ 0 } );
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	TEST( Int128KernelsComparison, LessThanMask )
+	{
+		std::mt19937_64 engine{ 37 };
+
+		for ( const std::size_t size : spanSizes )
+		{
+			const auto left{ randomValues( size, engine ) };
+			auto right{ randomValues( size, engine ) };
+
+			// Equal high words leave the decision to the unsigned low words
+			for ( std::size_t i{ 0 }; i < size; i += 3 )
+			{
+				right[i] = datatypes::Int128{ engine(), left[i].toHigh() };
+			}
+
+			std::vector<std::uint64_t> mask( ( size + 63 ) / 64, ~0ULL );
+			datatypes::Int128Kernels::lessThan( left, right, mask );
+			for ( std::size_t i{ 0 }; i < mask.size() * 64; ++i )
+			{
+				const bool expected{ i < size && left[i] < right[i] };
+				EXPECT_EQ( ( ( mask[i / 64] >> ( i % 64 ) ) & 1U ) != 0, expected ) << size << ":" << i;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Reduction
+	//----------------------------------------------
+
+	TEST( Int128KernelsReduction, SumMatchesOperators )
+	{
+		std::mt19937_64 engine{ 38 };
+
+		for ( const std::size_t size : spanSizes )
+		{
+			std::vector<datatypes::Int128> values;
+			datatypes::Int128 expected{ 0 };
+			for ( std::size_t i{ 0 }; i < size; ++i )
+			{
+				const auto value{ datatypes::Int128{ engine(), engine() % 1024 } * datatypes::Int128{ ( i % 3 == 0 ) ? -1 : 1 } };
+				values.push_back( value );
+				expected += value;
+			}
+
+			ArithmeticStatus status{ ArithmeticStatus::None };
+			EXPECT_EQ( datatypes::Int128Kernels::sum( values, status ), expected ) << size;
+			EXPECT_EQ( status, ArithmeticStatus::None );
+		}
+	}
+
+	TEST( Int128KernelsReduction, SumOverflow )
+	{
+		const datatypes::Int128 max{ ~0ULL, ( 1ULL << 63 ) - 1 };
+		const datatypes::Int128 min{ 0ULL, 1ULL << 63 };
+
+		// Intermediate totals beyond the range do not matter when the final total fits
+		ArithmeticStatus status{ ArithmeticStatus::None };
+		const std::vector<datatypes::Int128> transient{ max, max, max, min, min, min, datatypes::Int128{ 5 } };
+		EXPECT_EQ( datatypes::Int128Kernels::sum( transient, status ), datatypes::Int128{ 2 } );
+		EXPECT_EQ( status, ArithmeticStatus::None );
+
+		const std::vector<datatypes::Int128> extremes{ max, datatypes::Int128{ -1 }, min, datatypes::Int128{ 0 } };
+		EXPECT_EQ( datatypes::Int128Kernels::sum( extremes, status ), datatypes::Int128{ -2 } );
+		EXPECT_EQ( datatypes::Int128Kernels::sum( std::vector<datatypes::Int128>{}, status ), datatypes::Int128{ 0 } );
+		EXPECT_EQ( status, ArithmeticStatus::None );
+
+		// Out of range totals saturate towards their sign
+		const std::vector<datatypes::Int128> positive( 9, max );
+		EXPECT_EQ( datatypes::Int128Kernels::sum( positive, status ), max );
+		EXPECT_TRUE( hasStatus( status, ArithmeticStatus::Overflow ) );
+
+		status = ArithmeticStatus::None;
+		const std::vector<datatypes::Int128> negative{ min, datatypes::Int128{ -1 }, datatypes::Int128{ 0 }, datatypes::Int128{ 0 }, datatypes::Int128{ 0 } };
+		EXPECT_EQ( datatypes::Int128Kernels::sum( negative, status ), min );
+		EXPECT_TRUE( hasStatus( status, ArithmeticStatus::Overflow ) );
+	}
+
+	//----------------------------------------------
+	// Argument validation
+	//----------------------------------------------
+
+	TEST( Int128KernelsValidation, SpanSizes )
+	{
+		const std::vector<datatypes::Int128> three( 3, datatypes::Int128{ 1 } );
+		const std::vector<datatypes::Int128> two( 2, datatypes::Int128{ 1 } );
+		std::vector<datatypes::Int128> result( 2 );
+		std::vector<std::uint64_t> mask;
+
+		EXPECT_THROW( datatypes::Int128Kernels::add( three, two, result ), std::invalid_argument );
+		EXPECT_THROW( datatypes::Int128Kernels::subtract( three, three, result ), std::invalid_argument );
+		EXPECT_THROW( datatypes::Int128Kernels::negate( three, result ), std::invalid_argument );
+		EXPECT_THROW( datatypes::Int128Kernels::lessThan( two, two, mask ), std::invalid_argument );
+		EXPECT_NO_THROW( datatypes::Int128Kernels::lessThan( std::vector<datatypes::Int128>{}, std::vector<datatypes::Int128>{}, mask ) );
+	}
+} // namespace nfx::datatypes::test
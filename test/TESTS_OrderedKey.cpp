@@ -0,0 +1,268 @@
+/**
+ * @file TESTS_OrderedKey.cpp
+ * @brief Tests for memcmp-comparable Decimal and Int128 keys
+ * @details Validates that byte order matches numeric order, canonical keys across scales,
+ *          round trips, malformed key rejection and the batch overloads
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/OrderedKey.h>
+
+namespace nfx::datatypes::test
+{
+	namespace
+	{
+		using Key = std::vector<std::uint8_t>;
+
+		Key decimalKey( const datatypes::Decimal& value )
+		{
+			Key key( datatypes::OrderedKey::encodedSize( value ) );
+			EXPECT_EQ( datatypes::OrderedKey::encode( value, key ), key.size() );
+
+			return key;
+		}
+
+		int compareKeys( const Key& a, const Key& b )
+		{
+			const int result{ std::memcmp( a.data(), b.data(), std::min( a.size(), b.size() ) ) };
+
+			return result != 0 ? result : static_cast<int>( a.size() ) - static_cast<int>( b.size() );
+		}
+
+		/** @brief Exact three-way comparison, independent of Decimal arithmetic */
+		int compareValues( const datatypes::Decimal& a, const datatypes::Decimal& b )
+		{
+			const auto aligned{ []( const datatypes::Decimal& value ) {
+				return internal::multiplyByPowerOf10Wide( internal::mantissaAsUInt256( value ),
+					static_cast<std::uint8_t>( constants::DECIMAL_MAXIMUM_PLACES - value.scale() ) );
+			} };
+			const int signA{ a.isZero() ? 0 : ( a.isNegative() ? -1 : 1 ) };
+			const int signB{ b.isZero() ? 0 : ( b.isNegative() ? -1 : 1 ) };
+			if ( signA != signB || signA == 0 )
+			{
+				return signA - signB;
+			}
+
+			const auto magnitudeA{ aligned( a ) };
+			const auto magnitudeB{ aligned( b ) };
+			const int magnitudeOrder{ magnitudeA < magnitudeB ? -1 : ( magnitudeB < magnitudeA ? 1 : 0 ) };
+
+			return signA * magnitudeOrder;
+		}
+
+		datatypes::Decimal randomDecimal( std::mt19937_64& random )
+		{
+			datatypes::Decimal value{};
+			const auto digits{ random() % 30U };
+			value.mantissa()[0] = static_cast<std::uint32_t>( random() );
+			value.mantissa()[1] = digits > 10U ? static_cast<std::uint32_t>( random() ) : 0U;
+			value.mantissa()[2] = digits > 20U ? static_cast<std::uint32_t>( random() ) : 0U;
+			if ( digits < 5U )
+			{
+				value.mantissa()[0] %= 1000U;
+			}
+			value.flags() = static_cast<std::uint32_t>( random() % 29U ) << constants::DECIMAL_SCALE_SHIFT |
+							( random() % 2U != 0U ? constants::DECIMAL_SIGN_MASK : 0U );
+
+			return value;
+		}
+	} // namespace
+
+	//=====================================================================
+	// OrderedKey type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Int128 keys
+	//----------------------------------------------
+
+	TEST( OrderedKeyInt128, ByteOrderMatchesNumericOrder )
+	{
+		const datatypes::Int128 max{ ~0ULL, ~0ULL >> 1 };
+		const datatypes::Int128 min{ 0ULL, 1ULL << 63 };
+		std::vector<datatypes::Int128> values{ min, datatypes::Int128{ std::int64_t{ -1 } }, datatypes::Int128{ 0 },
+			datatypes::Int128{ 1 }, datatypes::Int128{ std::int64_t{ -42 } }, max, datatypes::Int128{ 0ULL, 1ULL } };
+
+		std::mt19937_64 random{ 43 };
+		for ( int i{ 0 }; i < 500; ++i )
+		{
+			values.emplace_back( random(), random() );
+		}
+
+		for ( const auto& a : values )
+		{
+			const auto keyA{ datatypes::OrderedKey::encode( a ) };
+			EXPECT_EQ( datatypes::OrderedKey::decodeInt128( keyA ), a );
+
+			for ( std::size_t j{ 0 }; j < 8; ++j )
+			{
+				const auto& b{ values[j] };
+				const auto keyB{ datatypes::OrderedKey::encode( b ) };
+				const int order{ std::memcmp( keyA.data(), keyB.data(), keyA.size() ) };
+				EXPECT_EQ( order < 0, a < b );
+				EXPECT_EQ( order == 0, a == b );
+			}
+		}
+
+		EXPECT_EQ( datatypes::OrderedKey::encode( min ), datatypes::OrderedKey::Int128Key{} );
+		EXPECT_EQ( datatypes::OrderedKey::encode( datatypes::Int128{ 0 } )[0], 0x80U );
+
+		const std::array<std::uint8_t, 15> shortKey{};
+		EXPECT_THROW( (void)datatypes::OrderedKey::decodeInt128( shortKey ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Decimal keys
+	//----------------------------------------------
+
+	TEST( OrderedKeyDecimal, ByteOrderMatchesNumericOrder )
+	{
+		std::vector<datatypes::Decimal> values{ datatypes::Decimal{ "0" }, datatypes::Decimal{ "1" }, datatypes::Decimal{ "-1" },
+			datatypes::Decimal{ "0.0000000000000000000000000001" }, datatypes::Decimal{ "-0.0000000000000000000000000001" },
+			datatypes::Decimal{ "79228162514264337593543950335" }, datatypes::Decimal{ "-79228162514264337593543950335" },
+			datatypes::Decimal{ "10" }, datatypes::Decimal{ "9.99" }, datatypes::Decimal{ "1.1" }, datatypes::Decimal{ "1.01" } };
+
+		std::mt19937_64 random{ 44 };
+		for ( int i{ 0 }; i < 2000; ++i )
+		{
+			values.push_back( randomDecimal( random ) );
+		}
+
+		std::vector<Key> keys;
+		for ( const auto& value : values )
+		{
+			keys.push_back( decimalKey( value ) );
+			EXPECT_LE( keys.back().size(), constants::ORDERED_KEY_DECIMAL_MAX_SIZE );
+		}
+
+		// Compare every value with its neighbours and with the fixed edge cases
+		for ( std::size_t i{ 0 }; i < values.size(); ++i )
+		{
+			for ( std::size_t j : { std::size_t{ 0 }, std::size_t{ 3 }, std::size_t{ 5 }, std::size_t{ 6 }, std::size_t{ 8 }, ( i + 1 ) % values.size() } )
+			{
+				const int expected{ compareValues( values[i], values[j] ) };
+				const int order{ compareKeys( keys[i], keys[j] ) };
+				EXPECT_EQ( order < 0, expected < 0 ) << values[i] << " vs " << values[j];
+				EXPECT_EQ( order == 0, expected == 0 ) << values[i] << " vs " << values[j];
+			}
+		}
+
+		// Sorting the keys sorts the values
+		std::vector<std::size_t> order( values.size() );
+		for ( std::size_t i{ 0 }; i < order.size(); ++i )
+		{
+			order[i] = i;
+		}
+		std::sort( order.begin(), order.end(), [&]( std::size_t a, std::size_t b ) { return compareKeys( keys[a], keys[b] ) < 0; } );
+		for ( std::size_t i{ 1 }; i < order.size(); ++i )
+		{
+			EXPECT_LE( compareValues( values[order[i - 1]], values[order[i]] ), 0 );
+		}
+	}
+
+	TEST( OrderedKeyDecimal, CanonicalAcrossScales )
+	{
+		const Key key{ decimalKey( datatypes::Decimal{ "1.5" } ) };
+		EXPECT_EQ( decimalKey( datatypes::Decimal{ "1.5" }.rescale( 2 ) ), key );
+		EXPECT_EQ( decimalKey( datatypes::Decimal{ "1.5" }.rescale( 28 ) ), key );
+		EXPECT_EQ( key, ( Key{ 0x81U + 28U, 30U } ) );
+
+		EXPECT_EQ( decimalKey( datatypes::Decimal{ "100" } ), decimalKey( datatypes::Decimal{ "100" }.rescale( 5 ) ) );
+		EXPECT_EQ( decimalKey( datatypes::Decimal{ "-0" } ), Key{ 0x80U } );
+		EXPECT_EQ( decimalKey( datatypes::Decimal{ "0" }.rescale( 7 ) ), Key{ 0x80U } );
+
+		// Negative keys complement the digit bytes
+		EXPECT_EQ( decimalKey( datatypes::Decimal{ "-1.5" } ), ( Key{ 0x7FU - 28U, 0xFFU - 30U } ) );
+	}
+
+	TEST( OrderedKeyDecimal, RoundTrip )
+	{
+		std::mt19937_64 random{ 45 };
+		for ( int i{ 0 }; i < 2000; ++i )
+		{
+			const datatypes::Decimal value{ randomDecimal( random ) };
+			const Key key{ decimalKey( value ) };
+
+			std::size_t consumed{ 0 };
+			const datatypes::Decimal decoded{ datatypes::OrderedKey::decodeDecimal( key, consumed ) };
+			EXPECT_EQ( consumed, key.size() );
+			EXPECT_EQ( decoded, value ) << value;
+			EXPECT_LE( decoded.scale(), value.scale() );
+		}
+
+		EXPECT_EQ( datatypes::OrderedKey::decodeDecimal( decimalKey( datatypes::Decimal{ "101.25" }.rescale( 3 ) ) ).toBits(),
+			datatypes::Decimal{ "101.25" }.toBits() );
+		EXPECT_EQ( datatypes::OrderedKey::decodeDecimal( decimalKey( datatypes::Decimal{ "-79228162514264337593543950335" } ) ),
+			datatypes::Decimal{ "-79228162514264337593543950335" } );
+		EXPECT_EQ( datatypes::OrderedKey::decodeDecimal( decimalKey( datatypes::Decimal{ "12000" } ) ).scale(), 0U );
+
+		constexpr auto encoded{ [] {
+			std::array<std::uint8_t, 16> key{};
+			(void)datatypes::OrderedKey::encode( datatypes::Decimal{ "-12.5" }, key );
+			return key;
+		}() };
+		static_assert( datatypes::OrderedKey::decodeDecimal( encoded ) == datatypes::Decimal{ "-12.5" } );
+	}
+
+	TEST( OrderedKeyDecimal, Errors )
+	{
+		std::array<std::uint8_t, 1> small{};
+		EXPECT_THROW( (void)datatypes::OrderedKey::encode( datatypes::Decimal{ "1.5" }, small ), std::invalid_argument );
+		EXPECT_EQ( datatypes::OrderedKey::encode( datatypes::Decimal{ "0" }, small ), 1U );
+
+		for ( const Key& invalid : { Key{}, Key{ 0x81U + 28U }, Key{ 0x81U + 28U, 31U }, Key{ 0x81U + 28U, 2U }, Key{ 0x81U + 28U, 200U },
+				  Key{ 0x81U + 28U, 21U, 0U }, Key{ 0xBAU, 20U }, Key{ 0x46U, 0xFFU - 20U }, Key( 17, 0xB9U ),
+				  Key{ 0x81U, 21U, 20U } } )
+		{
+			EXPECT_THROW( (void)datatypes::OrderedKey::decodeDecimal( invalid ), std::invalid_argument );
+		}
+	}
+
+	//----------------------------------------------
+	// Batch encoding
+	//----------------------------------------------
+
+	TEST( OrderedKeyBatch, Spans )
+	{
+		const std::vector<datatypes::Decimal> prices{
+			datatypes::Decimal{ "101.25" }, datatypes::Decimal{ "-0.0003" }, datatypes::Decimal{ "0" }, datatypes::Decimal{ "42" } };
+
+		std::vector<std::uint8_t> buffer( prices.size() * constants::ORDERED_KEY_DECIMAL_MAX_SIZE );
+		std::vector<std::size_t> offsets( prices.size() + 1 );
+		const std::size_t written{ datatypes::OrderedKey::encode( prices, buffer, offsets ) };
+		EXPECT_EQ( written, offsets.back() );
+		EXPECT_EQ( offsets[0], 0U );
+		for ( std::size_t i{ 0 }; i < prices.size(); ++i )
+		{
+			EXPECT_EQ( offsets[i + 1] - offsets[i], datatypes::OrderedKey::encodedSize( prices[i] ) );
+		}
+
+		std::vector<datatypes::Decimal> restored( prices.size() );
+		EXPECT_EQ( datatypes::OrderedKey::decode( std::span{ buffer }.first( written ), restored ), written );
+		EXPECT_EQ( restored, prices );
+		EXPECT_EQ( datatypes::OrderedKey::encode( prices, buffer ), written );
+
+		std::vector<datatypes::Decimal> tooMany( prices.size() + 1 );
+		EXPECT_THROW( (void)datatypes::OrderedKey::decode( std::span{ buffer }.first( written ), tooMany ), std::invalid_argument );
+		EXPECT_THROW( (void)datatypes::OrderedKey::encode( prices, std::span{ buffer }.first( 4 ) ), std::invalid_argument );
+
+		const std::vector<datatypes::Int128> ids{ datatypes::Int128{ std::int64_t{ -7 } }, datatypes::Int128{ 7 } };
+		std::vector<std::uint8_t> idKeys( ids.size() * constants::ORDERED_KEY_INT128_SIZE );
+		datatypes::OrderedKey::encode( ids, idKeys );
+		EXPECT_LT( std::memcmp( idKeys.data(), idKeys.data() + 16, 16 ), 0 );
+
+		std::vector<datatypes::Int128> restoredIds( ids.size() );
+		datatypes::OrderedKey::decode( idKeys, restoredIds );
+		EXPECT_EQ( restoredIds, ids );
+
+		EXPECT_THROW( datatypes::OrderedKey::encode( ids, std::span{ idKeys }.first( 31 ) ), std::invalid_argument );
+		EXPECT_THROW( datatypes::OrderedKey::decode( std::span{ idKeys }.first( 31 ), restoredIds ), std::invalid_argument );
+	}
+} // namespace nfx::datatypes::test
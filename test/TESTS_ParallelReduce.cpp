@@ -0,0 +1,215 @@
+/**
+ * @file TESTS_ParallelReduce.cpp
+ * @brief Tests for multi-threaded Decimal and Int128 reductions
+ * @details Validates that sums, dot products and minimum / maximum scans return the same
+ *          bits for every thread count as a sequential DecimalAccumulator or scan, including
+ *          tie-breaking between equal values of different scales and chunk totals beyond Int128
+ */
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/ArithmeticStatus.h>
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/DecimalAccumulator.h>
+#include <nfx/datatypes/Int128.h>
+#include <nfx/datatypes/ParallelReduce.h>
+
+namespace nfx::datatypes::test
+{
+	namespace
+	{
+		/** @brief Thread counts exercised by every test, including uneven chunk splits */
+		constexpr std::size_t THREAD_COUNTS[]{ 0, 1, 2, 3, 7, 16 };
+
+		/** @brief Enough values for several chunks of constants::PARALLEL_MIN_CHUNK_VALUES */
+		constexpr std::size_t VALUE_COUNT{ 1UL << 19 };
+
+		/** @brief Random value with up to 20 digits and a scale of 0-12 */
+		datatypes::Decimal randomDecimal( std::mt19937_64& engine )
+		{
+			const std::size_t digits{ 1 + engine() % 20 };
+			std::string text{ ( engine() % 2 ) != 0 ? "-" : "" };
+			for ( std::size_t i{ 0 }; i < digits; ++i )
+			{
+				text += static_cast<char>( '0' + engine() % 10 );
+			}
+
+			const std::size_t fractionDigits{ std::min<std::size_t>( digits, engine() % 9 ) };
+			text.insert( text.size() - fractionDigits, "." );
+
+			return datatypes::Decimal{ text + "0" }.rescale( static_cast<std::int32_t>( fractionDigits + engine() % 5 ) );
+		}
+
+		/** @brief Random values, generated once and shared by the tests */
+		const std::vector<datatypes::Decimal>& randomValues()
+		{
+			static const std::vector<datatypes::Decimal> values{ [] {
+				std::mt19937_64 engine{ 40 };
+				std::vector<datatypes::Decimal> generated( VALUE_COUNT );
+				for ( auto& value : generated )
+				{
+					value = randomDecimal( engine );
+				}
+
+				return generated;
+			}() };
+
+			return values;
+		}
+	} // namespace
+
+	//=====================================================================
+	// ParallelReduce tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Sum
+	//----------------------------------------------
+
+	TEST( ParallelReduceSum, MatchesSequentialAccumulator )
+	{
+		const auto& values{ randomValues() };
+
+		datatypes::DecimalAccumulator sequential;
+		sequential.add( values );
+		const datatypes::Decimal expected{ sequential.result() };
+
+		for ( const std::size_t threads : THREAD_COUNTS )
+		{
+			EXPECT_EQ( datatypes::ParallelReduce::parallelSum( values, threads ).toBits(), expected.toBits() ) << threads;
+		}
+
+		// Spans too small to split still use the same accumulator
+		const std::span<const datatypes::Decimal> head{ values.data(), 1000 };
+		datatypes::DecimalAccumulator small;
+		small.add( head );
+		EXPECT_EQ( datatypes::ParallelReduce::parallelSum( head, 16 ).toBits(), small.result().toBits() );
+		EXPECT_TRUE( datatypes::ParallelReduce::parallelSum( std::span<const datatypes::Decimal>{}, 4 ).isZero() );
+	}
+
+	TEST( ParallelReduceSum, Overflow )
+	{
+		const std::vector<datatypes::Decimal> values( VALUE_COUNT, datatypes::Decimal::maxValue() );
+		EXPECT_THROW( (void)datatypes::ParallelReduce::parallelSum( values, 4 ), std::overflow_error );
+
+		datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+		EXPECT_EQ( datatypes::ParallelReduce::parallelSum( values, status, 4 ), datatypes::Decimal::maxValue() );
+		EXPECT_TRUE( hasStatus( status, datatypes::ArithmeticStatus::Overflow ) );
+	}
+
+	TEST( ParallelReduceSum, Int128ChunkTotalsBeyondRange )
+	{
+		const datatypes::Int128 max{ ~std::uint64_t{ 0 }, static_cast<std::uint64_t>( std::numeric_limits<std::int64_t>::max() ) };
+		const datatypes::Int128 min{ std::uint64_t{ 0 }, std::uint64_t{ 1 } << 63 };
+
+		// Every chunk total overflows Int128, the grand total is exact
+		std::vector<datatypes::Int128> values( VALUE_COUNT, max );
+		std::fill( values.begin() + VALUE_COUNT / 2, values.end(), -max );
+		values.front() = datatypes::Int128{ std::int64_t{ 42 } };
+
+		for ( const std::size_t threads : THREAD_COUNTS )
+		{
+			datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+			EXPECT_EQ( datatypes::ParallelReduce::parallelSum( values, status, threads ), datatypes::Int128{ std::int64_t{ 42 } } - max ) << threads;
+			EXPECT_EQ( status, datatypes::ArithmeticStatus::None ) << threads;
+		}
+
+		// Saturates when the grand total does not fit
+		std::fill( values.begin(), values.end(), -max );
+		for ( const std::size_t threads : THREAD_COUNTS )
+		{
+			datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+			EXPECT_EQ( datatypes::ParallelReduce::parallelSum( values, status, threads ), min ) << threads;
+			EXPECT_TRUE( hasStatus( status, datatypes::ArithmeticStatus::Overflow ) ) << threads;
+		}
+	}
+
+	//----------------------------------------------
+	// Dot product
+	//----------------------------------------------
+
+	TEST( ParallelReduceDot, MatchesSequentialDot )
+	{
+		const auto& values{ randomValues() };
+		const std::vector<datatypes::Decimal> weights( values.rbegin(), values.rend() );
+		datatypes::ArithmeticStatus expectedStatus{ datatypes::ArithmeticStatus::None };
+		const datatypes::Decimal expected{ datatypes::DecimalAccumulator::dot( values, weights, expectedStatus ) };
+
+		for ( const std::size_t threads : THREAD_COUNTS )
+		{
+			datatypes::ArithmeticStatus status{ datatypes::ArithmeticStatus::None };
+			EXPECT_EQ( datatypes::ParallelReduce::parallelDot( values, weights, status, threads ).toBits(), expected.toBits() ) << threads;
+			EXPECT_EQ( status, expectedStatus ) << threads;
+		}
+
+		// Weights of up to 4 digits keep the products in range
+		std::vector<datatypes::Decimal> quantities( values.size() );
+		for ( std::size_t i{ 0 }; i < values.size(); ++i )
+		{
+			quantities[i] = datatypes::Decimal{ static_cast<std::int64_t>( i % 10000 ) - 5000 }.rescale( static_cast<std::int32_t>( i % 3 ) );
+		}
+		const std::span<const datatypes::Decimal> prices{ values.data(), values.size() / 4 };
+		const std::span<const datatypes::Decimal> sizes{ quantities.data(), prices.size() };
+		const datatypes::Decimal notional{ datatypes::DecimalAccumulator::dot( prices, sizes ) };
+		for ( const std::size_t threads : THREAD_COUNTS )
+		{
+			EXPECT_EQ( datatypes::ParallelReduce::parallelDot( prices, sizes, threads ).toBits(), notional.toBits() ) << threads;
+		}
+
+		EXPECT_THROW( (void)datatypes::ParallelReduce::parallelDot( values, std::span{ weights }.first( 10 ), 4 ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Minimum and maximum
+	//----------------------------------------------
+
+	TEST( ParallelReduceMinMax, FirstOfEqualValues )
+	{
+		const auto& random{ randomValues() };
+		std::vector<datatypes::Decimal> values( random.begin(), random.end() );
+
+		// Equal extremes with different scales in several chunks: the first one wins
+		const datatypes::Decimal low{ "-100000000000000000000" };
+		const datatypes::Decimal high{ "100000000000000000000" };
+		for ( const std::size_t index : { std::size_t{ 70000 }, std::size_t{ 200000 }, VALUE_COUNT - 1 } )
+		{
+			values[index] = low.rescale( static_cast<std::int32_t>( index % 7 ) );
+			values[VALUE_COUNT - 1 - index] = high.rescale( static_cast<std::int32_t>( index % 5 ) );
+		}
+
+		for ( const std::size_t threads : THREAD_COUNTS )
+		{
+			const auto [minimum, maximum]{ datatypes::ParallelReduce::parallelMinMax( values, threads ) };
+			EXPECT_EQ( minimum.toBits(), values[70000].toBits() ) << threads;
+			EXPECT_EQ( maximum.toBits(), values[0].toBits() ) << threads;
+		}
+
+		EXPECT_THROW( (void)datatypes::ParallelReduce::parallelMinMax( std::span<const datatypes::Decimal>{} ), std::invalid_argument );
+	}
+
+	TEST( ParallelReduceMinMax, Int128 )
+	{
+		std::mt19937_64 engine{ 41 };
+		std::vector<datatypes::Int128> values( VALUE_COUNT );
+		for ( auto& value : values )
+		{
+			value = datatypes::Int128{ engine(), engine() };
+		}
+
+		const auto [low, high]{ std::minmax_element( values.begin(), values.end() ) };
+		for ( const std::size_t threads : THREAD_COUNTS )
+		{
+			const auto [minimum, maximum]{ datatypes::ParallelReduce::parallelMinMax( values, threads ) };
+			EXPECT_EQ( minimum, *low ) << threads;
+			EXPECT_EQ( maximum, *high ) << threads;
+		}
+
+		EXPECT_THROW( (void)datatypes::ParallelReduce::parallelMinMax( std::span<const datatypes::Int128>{} ), std::invalid_argument );
+	}
+} // namespace nfx::datatypes::test
@@ -0,0 +1,192 @@
+/**
+ * @file TESTS_PriceLadder.cpp
+ * @brief Tests for the price grid and the tick-indexed price ladder
+ * @details Validates price to tick mapping across scales, grid validation, best level
+ *          tracking against std::map, iteration order and window re-centering
+ */
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/PriceLadder.h>
+
+namespace nfx::datatypes::test
+{
+	namespace
+	{
+		struct Level
+		{
+			std::int64_t quantity{ 0 };
+			int orders{ 0 };
+		};
+
+		using Ladder = datatypes::PriceLadder<Level>;
+	} // namespace
+
+	//=====================================================================
+	// PriceLadder type tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// Price grid
+	//----------------------------------------------
+
+	TEST( PriceGrid, TickMapping )
+	{
+		const datatypes::PriceGrid grid{ datatypes::Decimal{ "0.05" }, datatypes::Decimal{ "100" } };
+		EXPECT_EQ( grid.scale(), 2U );
+
+		EXPECT_EQ( grid.tickOf( datatypes::Decimal{ "100" } ), 0 );
+		EXPECT_EQ( grid.tickOf( datatypes::Decimal{ "101.25" } ), 25 );
+		EXPECT_EQ( grid.tickOf( datatypes::Decimal{ "101.25" }.rescale( 9 ) ), 25 );
+		EXPECT_EQ( grid.tickOf( datatypes::Decimal{ "99.95" } ), -1 );
+		EXPECT_EQ( grid.tickOf( datatypes::Decimal{ "-0.05" } ), -2001 );
+		EXPECT_EQ( grid.tickOf( datatypes::Decimal{ 105 } ), 100 );
+
+		EXPECT_EQ( grid.priceOf( 25 ), datatypes::Decimal{ "101.25" } );
+		EXPECT_EQ( grid.priceOf( 25 ).scale(), 2U );
+		EXPECT_EQ( grid.priceOf( -2001 ), datatypes::Decimal{ "-0.05" } );
+
+		// Off the grid
+		EXPECT_FALSE( grid.isOnGrid( datatypes::Decimal{ "101.26" } ) );
+		EXPECT_FALSE( grid.isOnGrid( datatypes::Decimal{ "101.251" } ) );
+		EXPECT_THROW( (void)grid.tickOf( datatypes::Decimal{ "100.01" } ), std::invalid_argument );
+		EXPECT_TRUE( grid.isOnGrid( datatypes::Decimal{ "100.050000" }.rescale( 6 ) ) );
+
+		// Far from the base price: offsets beyond 2^63 units are rejected
+		EXPECT_EQ( grid.tickOf( datatypes::Decimal{ "1000000100" } ), 20000000000 );
+		EXPECT_FALSE( grid.isOnGrid( datatypes::Decimal{ "792281625142643375935439503.35" } ) );
+		const datatypes::PriceGrid coarse{ datatypes::Decimal{ 1000000000000 }, datatypes::Decimal{ "0" } };
+		EXPECT_THROW( (void)coarse.priceOf( INT64_MAX ), std::overflow_error );
+
+		// Base price off a round grid
+		const datatypes::PriceGrid shifted{ datatypes::Decimal{ "0.25" }, datatypes::Decimal{ "0.1" } };
+		EXPECT_EQ( shifted.tickOf( datatypes::Decimal{ "0.6" } ), 2 );
+		EXPECT_FALSE( shifted.isOnGrid( datatypes::Decimal{ "0.5" } ) );
+
+		EXPECT_THROW( ( datatypes::PriceGrid{ datatypes::Decimal{ "0" }, datatypes::Decimal{ "1" } } ), std::invalid_argument );
+		EXPECT_THROW( ( datatypes::PriceGrid{ datatypes::Decimal{ "-0.01" }, datatypes::Decimal{ "1" } } ), std::invalid_argument );
+		EXPECT_THROW( ( datatypes::PriceGrid{ datatypes::Decimal{ 1000 }, datatypes::Decimal{ "0.0000000000000000001" } } ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Levels
+	//----------------------------------------------
+
+	TEST( PriceLadderLevels, MatchesOrderedMap )
+	{
+		for ( const Ladder::Side side : { Ladder::Side::Bid, Ladder::Side::Ask } )
+		{
+			Ladder ladder{ side, datatypes::Decimal{ "0.01" }, datatypes::Decimal{ "100" }, 1000 };
+			EXPECT_EQ( ladder.capacity(), 1024U );
+			EXPECT_EQ( ladder.windowLowTick(), -512 );
+			EXPECT_THROW( (void)ladder.bestPrice(), std::out_of_range );
+
+			std::map<std::int64_t, std::int64_t> reference;
+			std::mt19937_64 random{ 49 };
+			for ( int i{ 0 }; i < 20000; ++i )
+			{
+				const auto tick{ static_cast<std::int64_t>( random() % 1024U ) - 512 };
+				const datatypes::Decimal price{ ladder.grid().priceOf( tick ) };
+				if ( random() % 3U == 0 )
+				{
+					EXPECT_EQ( ladder.erase( price ), reference.erase( tick ) == 1 );
+				}
+				else
+				{
+					ladder[price].quantity += 1;
+					reference[tick] += 1;
+				}
+
+				ASSERT_EQ( ladder.size(), reference.size() );
+				if ( !reference.empty() )
+				{
+					const auto best{ side == Ladder::Side::Bid ? reference.rbegin()->first : reference.begin()->first };
+					ASSERT_EQ( ladder.bestTick(), best );
+					EXPECT_EQ( ladder.best().quantity, side == Ladder::Side::Bid ? reference.rbegin()->second : reference.begin()->second );
+				}
+			}
+
+			// Iteration runs from the best level outward
+			std::vector<std::int64_t> ticks;
+			ladder.forEach( [&]( const datatypes::Decimal& price, Level& level ) {
+				ticks.push_back( ladder.grid().tickOf( price ) );
+				EXPECT_EQ( level.quantity, reference.at( ticks.back() ) );
+			} );
+			std::vector<std::int64_t> expected;
+			for ( const auto& [tick, quantity] : reference )
+			{
+				expected.push_back( tick );
+			}
+			if ( side == Ladder::Side::Bid )
+			{
+				std::reverse( expected.begin(), expected.end() );
+			}
+			EXPECT_EQ( ticks, expected );
+
+			ladder.clear();
+			EXPECT_TRUE( ladder.isEmpty() );
+			EXPECT_EQ( ladder.find( ladder.grid().priceOf( expected.front() ) ), nullptr );
+		}
+	}
+
+	TEST( PriceLadderLevels, Validation )
+	{
+		Ladder asks{ Ladder::Side::Ask, datatypes::Decimal{ "0.5" }, datatypes::Decimal{ "10" }, 64 };
+		asks[datatypes::Decimal{ "10.5" }].orders = 3;
+		EXPECT_EQ( asks.find( datatypes::Decimal{ "10.50" }.rescale( 4 ) )->orders, 3 );
+		EXPECT_EQ( asks.bestPrice(), datatypes::Decimal{ "10.5" } );
+
+		EXPECT_THROW( (void)asks[datatypes::Decimal{ "10.25" }], std::invalid_argument );
+		EXPECT_THROW( (void)asks[datatypes::Decimal{ "100" }], std::out_of_range );
+		EXPECT_FALSE( asks.isInWindow( datatypes::Decimal{ "100" } ) );
+		EXPECT_TRUE( asks.isInWindow( datatypes::Decimal{ "25.5" } ) );
+		EXPECT_FALSE( asks.isInWindow( datatypes::Decimal{ "26" } ) );
+		EXPECT_EQ( asks.find( datatypes::Decimal{ "10.25" } ), nullptr );
+		EXPECT_EQ( asks.find( datatypes::Decimal{ "11" } ), nullptr );
+		EXPECT_FALSE( asks.erase( datatypes::Decimal{ "11" } ) );
+
+		// Erased levels come back default constructed
+		EXPECT_TRUE( asks.erase( datatypes::Decimal{ "10.5" } ) );
+		EXPECT_EQ( asks[datatypes::Decimal{ "10.5" }].orders, 0 );
+	}
+
+	//----------------------------------------------
+	// Window
+	//----------------------------------------------
+
+	TEST( PriceLadderWindow, Recenter )
+	{
+		Ladder bids{ Ladder::Side::Bid, datatypes::Decimal{ "0.01" }, datatypes::Decimal{ "100" }, 64 };
+		for ( const char* price : { "99.70", "99.90", "100.10", "100.30" } )
+		{
+			bids[datatypes::Decimal{ price }].quantity = 1;
+		}
+		EXPECT_EQ( bids.bestPrice(), datatypes::Decimal{ "100.3" } );
+
+		// Moving up 20 ticks drops 99.70 only; the other levels keep their values
+		bids[datatypes::Decimal{ "99.90" }].quantity = 7;
+		EXPECT_EQ( bids.recenter( datatypes::Decimal{ "100.20" } ), 1U );
+		EXPECT_EQ( bids.windowLowTick(), -12 );
+		EXPECT_EQ( bids.size(), 3U );
+		EXPECT_EQ( bids.find( datatypes::Decimal{ "99.9" } )->quantity, 7 );
+		EXPECT_EQ( bids.find( datatypes::Decimal{ "99.7" } ), nullptr );
+		EXPECT_EQ( bids.bestPrice(), datatypes::Decimal{ "100.3" } );
+		bids[datatypes::Decimal{ "100.51" }].quantity = 2;
+		EXPECT_EQ( bids.bestTick(), 51 );
+
+		// Moving down drops the best levels
+		EXPECT_EQ( bids.recenter( datatypes::Decimal{ "99.80" } ), 2U );
+		EXPECT_EQ( bids.bestPrice(), datatypes::Decimal{ "100.1" } );
+
+		// Moving beyond the window drops everything
+		EXPECT_EQ( bids.recenter( datatypes::Decimal{ "1000" } ), 2U );
+		EXPECT_TRUE( bids.isEmpty() );
+		bids[datatypes::Decimal{ "1000.01" }].quantity = 1;
+		EXPECT_EQ( bids.bestPrice(), datatypes::Decimal{ "1000.01" } );
+		EXPECT_THROW( (void)bids.recenter( datatypes::Decimal{ "1000.001" } ), std::invalid_argument );
+	}
+} // namespace nfx::datatypes::test
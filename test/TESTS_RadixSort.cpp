@@ -0,0 +1,209 @@
+/**
+ * @file TESTS_RadixSort.cpp
+ * @brief Tests for the Decimal and Int128 radix sorts
+ * @details Validates sorted output against std::stable_sort with the comparison operators,
+ *          stability between equal values of different scales, keys wider than 128 bits,
+ *          argsort and key-value variants, and identical results for every thread count
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <nfx/datatypes/Decimal.h>
+#include <nfx/datatypes/Int128.h>
+#include <nfx/datatypes/RadixSort.h>
+
+namespace nfx::datatypes::test
+{
+	namespace
+	{
+		/** @brief Thread counts exercised by every test, including uneven chunk splits */
+		constexpr std::size_t THREAD_COUNTS[]{ 1, 2, 3, 0 };
+
+		/** @brief Span sizes: short ones compare keys, the largest is split into several chunks */
+		constexpr std::size_t SIZES[]{ 0, 1, 2, 17, 1000, 5000, 1UL << 18 };
+
+		/**
+		 * @brief Random price with 0-12 digits and scale 0-8, drawn from a small set so that
+		 *        equal values of different scales are frequent
+		 */
+		datatypes::Decimal randomPrice( std::mt19937_64& engine )
+		{
+			const auto mantissa{ static_cast<std::int64_t>( engine() % 4000 ) - 2000 };
+			const auto scale{ static_cast<std::int32_t>( engine() % 5 ) };
+			const datatypes::Decimal value{ datatypes::Decimal{ mantissa } / datatypes::Decimal{ 100 } };
+
+			// Keeps operator< exact: aligned mantissas stay far below 2^127
+			return ( engine() % 8 == 0 ? value * datatypes::Decimal{ std::int64_t{ 1000000000000 } } : value ).rescale( 2 + scale );
+		}
+
+		std::vector<datatypes::Decimal> randomPrices( std::size_t size, std::uint64_t seed )
+		{
+			std::mt19937_64 engine{ seed };
+			std::vector<datatypes::Decimal> values( size );
+			for ( auto& value : values )
+			{
+				value = randomPrice( engine );
+			}
+
+			return values;
+		}
+
+		std::vector<datatypes::Int128> randomInt128s( std::size_t size, std::uint64_t seed )
+		{
+			std::mt19937_64 engine{ seed };
+			std::vector<datatypes::Int128> values( size );
+			for ( auto& value : values )
+			{
+				// Mix of full-width and small values, to exercise skipped bytes and both signs
+				value = ( engine() % 2 ) != 0 ? datatypes::Int128{ engine(), engine() } : datatypes::Int128{ static_cast<std::int64_t>( engine() % 1000 ) - 500 };
+			}
+
+			return values;
+		}
+
+		std::vector<std::array<std::int32_t, 4>> bits( const std::vector<datatypes::Decimal>& values )
+		{
+			std::vector<std::array<std::int32_t, 4>> result;
+			for ( const auto& value : values )
+			{
+				result.push_back( value.toBits() );
+			}
+
+			return result;
+		}
+	} // namespace
+
+	//=====================================================================
+	// RadixSort tests
+	//=====================================================================
+
+	//----------------------------------------------
+	// In-place sort
+	//----------------------------------------------
+
+	TEST( RadixSortInPlace, Int128MatchesStdSort )
+	{
+		for ( const std::size_t size : SIZES )
+		{
+			const auto values{ randomInt128s( size, 42 + size ) };
+			auto expected{ values };
+			std::sort( expected.begin(), expected.end() );
+
+			for ( const std::size_t threads : THREAD_COUNTS )
+			{
+				auto sorted{ values };
+				datatypes::RadixSort::radixSort( std::span{ sorted }, threads );
+				EXPECT_EQ( sorted, expected ) << size << " " << threads;
+			}
+		}
+	}
+
+	TEST( RadixSortInPlace, DecimalMatchesStableSort )
+	{
+		for ( const std::size_t size : SIZES )
+		{
+			const auto values{ randomPrices( size, 42 + size ) };
+			auto expected{ values };
+			std::stable_sort( expected.begin(), expected.end() );
+
+			for ( const std::size_t threads : THREAD_COUNTS )
+			{
+				auto sorted{ values };
+				datatypes::RadixSort::radixSort( std::span{ sorted }, threads );
+
+				// Bit comparison also checks that equal values keep their input order
+				EXPECT_EQ( bits( sorted ), bits( expected ) ) << size << " " << threads;
+			}
+		}
+	}
+
+	TEST( RadixSortInPlace, DecimalWideKeys )
+	{
+		// Aligning the maximum to scale 28 needs 190 bits
+		const std::vector<datatypes::Decimal> ordered{ -datatypes::Decimal::maxValue(), datatypes::Decimal{ "-1.5" },
+			datatypes::Decimal{ "-0.0000000000000000000000000001" }, datatypes::Decimal{ 0 }, datatypes::Decimal{ "0.0000000000000000000000000001" },
+			datatypes::Decimal{ "0.0000000000000000000000000002" }, datatypes::Decimal{ "1.5" }, datatypes::Decimal{ "1.5" }.rescale( 2 ),
+			datatypes::Decimal{ "79228162514264337593543950334" }, datatypes::Decimal::maxValue() };
+
+		constexpr std::size_t copies{ 300 };
+		std::vector<datatypes::Decimal> values;
+		for ( const auto& value : ordered )
+		{
+			values.insert( values.end(), copies, value );
+		}
+
+		std::mt19937_64 engine{ 42 };
+		for ( const std::size_t threads : THREAD_COUNTS )
+		{
+			std::shuffle( values.begin(), values.end(), engine );
+			datatypes::RadixSort::radixSort( std::span{ values }, threads );
+			for ( std::size_t i{ 0 }; i < values.size(); ++i )
+			{
+				ASSERT_TRUE( values[i] == ordered[i / copies] ) << threads << " " << i;
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Argsort
+	//----------------------------------------------
+
+	TEST( RadixSortArgsort, StableOrder )
+	{
+		for ( const std::size_t size : SIZES )
+		{
+			const auto decimals{ randomPrices( size, 7 + size ) };
+			const auto integers{ randomInt128s( size, 7 + size ) };
+
+			std::vector<std::size_t> expectedDecimal( size );
+			std::iota( expectedDecimal.begin(), expectedDecimal.end(), std::size_t{ 0 } );
+			std::vector<std::size_t> expectedInt128{ expectedDecimal };
+			std::stable_sort( expectedDecimal.begin(), expectedDecimal.end(), [&]( std::size_t a, std::size_t b ) { return decimals[a] < decimals[b]; } );
+			std::stable_sort( expectedInt128.begin(), expectedInt128.end(), [&]( std::size_t a, std::size_t b ) { return integers[a] < integers[b]; } );
+
+			for ( const std::size_t threads : THREAD_COUNTS )
+			{
+				std::vector<std::size_t> indices( size );
+				datatypes::RadixSort::argsort( std::span<const datatypes::Decimal>{ decimals }, indices, threads );
+				EXPECT_EQ( indices, expectedDecimal ) << size << " " << threads;
+
+				datatypes::RadixSort::argsort( std::span<const datatypes::Int128>{ integers }, indices, threads );
+				EXPECT_EQ( indices, expectedInt128 ) << size << " " << threads;
+			}
+		}
+
+		const std::vector<datatypes::Decimal> values{ datatypes::Decimal{ 2 }, datatypes::Decimal{ 1 } };
+		std::vector<std::size_t> small( 1 );
+		EXPECT_THROW( datatypes::RadixSort::argsort( std::span<const datatypes::Decimal>{ values }, small ), std::invalid_argument );
+	}
+
+	//----------------------------------------------
+	// Key-value sort
+	//----------------------------------------------
+
+	TEST( RadixSortByKey, PermutesValues )
+	{
+		std::vector<datatypes::Decimal> prices{ datatypes::Decimal{ "101.25" }, datatypes::Decimal{ "99.5" }, datatypes::Decimal{ "101.25" }.rescale( 3 ),
+			datatypes::Decimal{ "-3" } };
+		std::vector<std::string> orders{ "a", "b", "c", "d" };
+
+		datatypes::RadixSort::radixSortByKey( prices, std::span{ orders } );
+		EXPECT_EQ( orders, ( std::vector<std::string>{ "d", "b", "a", "c" } ) );
+		EXPECT_EQ( prices[2].toString(), "101.25" );
+		EXPECT_EQ( prices[3].scale(), 3U );
+
+		std::vector<datatypes::Int128> keys{ datatypes::Int128{ std::int64_t{ 5 } }, datatypes::Int128{ std::int64_t{ -5 } } };
+		std::vector<int> payloads{ 1, 2 };
+		datatypes::RadixSort::radixSortByKey( keys, std::span{ payloads } );
+		EXPECT_EQ( payloads, ( std::vector<int>{ 2, 1 } ) );
+
+		payloads.push_back( 3 );
+		EXPECT_THROW( datatypes::RadixSort::radixSortByKey( keys, std::span{ payloads } ), std::invalid_argument );
+	}
+} // namespace nfx::datatypes::test